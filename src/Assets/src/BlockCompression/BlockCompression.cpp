@@ -0,0 +1,211 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+module VKING.Assets.BlockCompression;
+
+import :Simd;
+import :Encoders;
+import VKING.JobSystem;
+import VKING.Log;
+
+namespace VKING::Assets::BlockCompression {
+
+    using BlockCompressionLogger = Log::Named<"BlockCompression">;
+
+    namespace {
+
+        Encoders::EncoderParameters parametersFor(const Quality quality) {
+            switch (quality) {
+                case Quality::FAST:   return {.refinementPasses = 0, .endpointSearchRadius = 0, .exhaustivePBits = false};
+                case Quality::HIGH:   return {.refinementPasses = 3, .endpointSearchRadius = 1, .exhaustivePBits = true};
+                case Quality::NORMAL:
+                default:              return {.refinementPasses = 1, .endpointSearchRadius = 0, .exhaustivePBits = false};
+            }
+        }
+
+        /// Gathers a 4x4 block into SoA floats, clamping reads to the image edge
+        void loadBlock(const ImageView& image, const uint32_t rowPitch, const uint32_t blockX, const uint32_t blockY, Simd::BlockPixels& block) {
+            for (uint32_t y = 0; y < 4; y++) {
+                const uint32_t sourceY = std::min(blockY * 4 + y, image.height - 1);
+                const uint8_t* row = image.pixels + static_cast<uint64_t>(sourceY) * rowPitch;
+                for (uint32_t x = 0; x < 4; x++) {
+                    const uint32_t sourceX = std::min(blockX * 4 + x, image.width - 1);
+                    const uint8_t* pixel = row + sourceX * 4;
+                    const uint32_t i = y * 4 + x;
+                    block.r[i] = pixel[0];
+                    block.g[i] = pixel[1];
+                    block.b[i] = pixel[2];
+                    block.a[i] = pixel[3];
+                }
+            }
+        }
+
+        void encodeBlock(const Format format, const Simd::BlockPixels& block, const Encoders::EncoderParameters& parameters, uint8_t* output) {
+            switch (format) {
+                case Format::BC1:
+                    Encoders::encodeBC1Block(block, parameters, output);
+                    break;
+                case Format::BC3:
+                    Encoders::encodeBC4Block(block.a, parameters, output);
+                    Encoders::encodeBC1Block(block, parameters, output + 8);
+                    break;
+                case Format::BC5:
+                    Encoders::encodeBC4Block(block.r, parameters, output);
+                    Encoders::encodeBC4Block(block.g, parameters, output + 8);
+                    break;
+                case Format::BC7:
+                    Encoders::encodeBC7Block(block, parameters, output);
+                    break;
+            }
+        }
+
+        bool decodeBlock(const Format format, const uint8_t* input, uint8_t (&rgba)[16][4]) {
+            switch (format) {
+                case Format::BC1:
+                    Encoders::decodeBC1Block(input, rgba);
+                    return true;
+                case Format::BC3: {
+                    uint8_t alpha[16];
+                    Encoders::decodeBC4Block(input, alpha);
+                    Encoders::decodeBC1Block(input + 8, rgba);
+                    for (uint32_t i = 0; i < 16; i++) rgba[i][3] = alpha[i];
+                    return true;
+                }
+                case Format::BC5: {
+                    uint8_t red[16], green[16];
+                    Encoders::decodeBC4Block(input, red);
+                    Encoders::decodeBC4Block(input + 8, green);
+                    for (uint32_t i = 0; i < 16; i++) {
+                        rgba[i][0] = red[i];
+                        rgba[i][1] = green[i];
+                        rgba[i][2] = 0;
+                        rgba[i][3] = 255;
+                    }
+                    return true;
+                }
+                case Format::BC7:
+                    return Encoders::decodeBC7Block(input, rgba);
+            }
+            return false;
+        }
+
+    }
+
+    std::vector<uint8_t> compress(const ImageView& image, const CompressSettings& settings) {
+        if (!image.pixels || image.width == 0 || image.height == 0) {
+            BlockCompressionLogger::record().error("Cannot compress an empty image.");
+            return {};
+        }
+
+        const uint32_t rowPitch = image.rowPitchBytes ? image.rowPitchBytes : image.width * 4;
+        const uint32_t blocksWide = (image.width + 3) / 4;
+        const uint32_t blocksHigh = (image.height + 3) / 4;
+        const uint32_t bytesPerBlock = getBytesPerBlock(settings.format);
+        const Encoders::EncoderParameters parameters = parametersFor(settings.quality);
+
+        std::vector<uint8_t> output(getCompressedSize(settings.format, image.width, image.height));
+
+        // blocks are fully independent, each chunk writes a disjoint range of the output
+        JobSystem& jobs = settings.jobSystem ? *settings.jobSystem : JobSystem::getDefault();
+        jobs.parallelFor(blocksWide * blocksHigh, settings.blocksPerJob, [&](const uint32_t begin, const uint32_t end) {
+            Simd::BlockPixels block;
+            for (uint32_t blockIndex = begin; blockIndex < end; blockIndex++) {
+                loadBlock(image, rowPitch, blockIndex % blocksWide, blockIndex / blocksWide, block);
+                encodeBlock(settings.format, block, parameters, output.data() + static_cast<uint64_t>(blockIndex) * bytesPerBlock);
+            }
+        });
+
+        return output;
+    }
+
+    bool decompress(const Format format, const std::span<const uint8_t> blocks, const uint32_t width, const uint32_t height, std::vector<uint8_t>& rgba) {
+        if (blocks.size() < getCompressedSize(format, width, height)) {
+            BlockCompressionLogger::record().error("Compressed data is {} bytes, a {}x{} {} image needs {}.",
+                                                   blocks.size(), width, height, formatToString(format),
+                                                   getCompressedSize(format, width, height));
+            return false;
+        }
+
+        const uint32_t blocksWide = (width + 3) / 4;
+        const uint32_t blocksHigh = (height + 3) / 4;
+        const uint32_t bytesPerBlock = getBytesPerBlock(format);
+        rgba.resize(static_cast<uint64_t>(width) * height * 4);
+
+        for (uint32_t blockY = 0; blockY < blocksHigh; blockY++) {
+            for (uint32_t blockX = 0; blockX < blocksWide; blockX++) {
+                uint8_t decoded[16][4];
+                const uint8_t* input = blocks.data() + (static_cast<uint64_t>(blockY) * blocksWide + blockX) * bytesPerBlock;
+                if (!decodeBlock(format, input, decoded)) {
+                    BlockCompressionLogger::record().error("Block ({}, {}) uses a {} mode the decoder does not support.", blockX, blockY, formatToString(format));
+                    return false;
+                }
+
+                for (uint32_t y = 0; y < 4 && blockY * 4 + y < height; y++) {
+                    for (uint32_t x = 0; x < 4 && blockX * 4 + x < width; x++) {
+                        uint8_t* pixel = rgba.data() + (static_cast<uint64_t>(blockY * 4 + y) * width + blockX * 4 + x) * 4;
+                        for (uint32_t c = 0; c < 4; c++) pixel[c] = decoded[y * 4 + x][c];
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    double computePSNR(const ImageView& reference, const ImageView& test, const Format format) {
+        if (reference.width != test.width || reference.height != test.height || !reference.pixels || !test.pixels) {
+            BlockCompressionLogger::record().error("PSNR needs two non-empty images of the same size.");
+            return 0.0;
+        }
+
+        const uint32_t channelCount = format == Format::BC1 ? 3 : (format == Format::BC5 ? 2 : 4);
+        const uint32_t referencePitch = reference.rowPitchBytes ? reference.rowPitchBytes : reference.width * 4;
+        const uint32_t testPitch = test.rowPitchBytes ? test.rowPitchBytes : test.width * 4;
+
+        double squaredError = 0.0;
+        for (uint32_t y = 0; y < reference.height; y++) {
+            const uint8_t* referenceRow = reference.pixels + static_cast<uint64_t>(y) * referencePitch;
+            const uint8_t* testRow = test.pixels + static_cast<uint64_t>(y) * testPitch;
+            for (uint32_t x = 0; x < reference.width; x++) {
+                for (uint32_t c = 0; c < channelCount; c++) {
+                    const double difference = static_cast<double>(referenceRow[x * 4 + c]) - static_cast<double>(testRow[x * 4 + c]);
+                    squaredError += difference * difference;
+                }
+            }
+        }
+
+        const double meanSquaredError = squaredError / (static_cast<double>(reference.width) * reference.height * channelCount);
+        if (meanSquaredError == 0.0) return std::numeric_limits<double>::infinity();
+        return 10.0 * std::log10(255.0 * 255.0 / meanSquaredError);
+    }
+
+    const char* getInstructionSet() {
+        return Simd::INSTRUCTION_SET;
+    }
+
+}
@@ -0,0 +1,144 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <span>
+#include <vector>
+
+export module VKING.Assets.BlockCompression;
+
+import VKING.JobSystem;
+
+export namespace VKING::Assets::BlockCompression {
+
+    /**
+     * @brief Block compressed output formats.
+     *
+     * - BC1: RGB, 4 bits per pixel. Alpha is dropped.
+     * - BC3: RGBA, 8 bits per pixel. BC1 color plus a BC4 alpha block.
+     * - BC5: Two channels (R, G), 8 bits per pixel. Meant for tangent space normal maps.
+     * - BC7: RGBA, 8 bits per pixel. Currently encoded with mode 6 only (single subset, 4 bit indices).
+     */
+    enum class Format {
+        BC1,
+        BC3,
+        BC5,
+        BC7
+    };
+
+    /**
+     * @brief Speed/quality trade-off of the endpoint search.
+     *
+     * - FAST: principal axis fit only, meant for iteration builds.
+     * - NORMAL: one least squares refinement pass.
+     * - HIGH: several refinement passes plus a greedy search over neighbouring quantized endpoints.
+     */
+    enum class Quality {
+        FAST,
+        NORMAL,
+        HIGH
+    };
+
+    /**
+     * @brief Non-owning view of an 8 bit RGBA image.
+     */
+    struct ImageView {
+        const uint8_t* pixels = nullptr;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        /// Bytes between the start of two rows. 0 means tightly packed (width * 4)
+        uint32_t rowPitchBytes = 0;
+    };
+
+    struct CompressSettings {
+        Format format = Format::BC7;
+        Quality quality = Quality::NORMAL;
+        /// Pool used to encode blocks in parallel. nullptr uses JobSystem::getDefault()
+        JobSystem* jobSystem = nullptr;
+        /// Blocks handed to a job at once
+        uint32_t blocksPerJob = 256;
+    };
+
+    /**
+     * @return The size of one 4x4 block in bytes
+     */
+    constexpr uint32_t getBytesPerBlock(const Format format) {
+        return format == Format::BC1 ? 8 : 16;
+    }
+
+    /**
+     * @return The size in bytes of a compressed image. Partial blocks at the edges count as whole blocks
+     */
+    constexpr uint64_t getCompressedSize(const Format format, const uint32_t width, const uint32_t height) {
+        return static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4) * getBytesPerBlock(format);
+    }
+
+    constexpr const char* formatToString(const Format format) {
+        switch (format) {
+            case Format::BC1: return "BC1";
+            case Format::BC3: return "BC3";
+            case Format::BC5: return "BC5";
+            case Format::BC7: return "BC7";
+            default: return "Unknown";
+        }
+    }
+
+    constexpr const char* qualityToString(const Quality quality) {
+        switch (quality) {
+            case Quality::FAST: return "Fast";
+            case Quality::NORMAL: return "Normal";
+            case Quality::HIGH: return "High";
+            default: return "Unknown";
+        }
+    }
+
+    /**
+     * @brief Compresses an RGBA image into tightly packed blocks, row major.
+     *
+     * Edge blocks of images whose size is not a multiple of four replicate the last row/column.
+     *
+     * @return The compressed blocks, or an empty vector if the image view is invalid
+     */
+    std::vector<uint8_t> compress(const ImageView& image, const CompressSettings& settings);
+
+    /**
+     * @brief Decompresses blocks produced by compress() back into tightly packed RGBA.
+     *
+     * Channels a format does not store are filled with defaults (BC1 alpha 255, BC5 blue 0 and alpha 255).
+     *
+     * @return false if the input is too small or contains BC7 modes other than mode 6
+     */
+    bool decompress(Format format, std::span<const uint8_t> blocks, uint32_t width, uint32_t height, std::vector<uint8_t>& rgba);
+
+    /**
+     * @brief Peak signal-to-noise ratio over the channels the format actually stores.
+     *
+     * @return PSNR in dB, infinity if the images are identical
+     */
+    double computePSNR(const ImageView& reference, const ImageView& test, Format format);
+
+    /**
+     * @return The SIMD instruction set the block kernels were compiled for ("SSE2", "NEON" or "Scalar")
+     */
+    const char* getInstructionSet();
+
+}
@@ -0,0 +1,668 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+module VKING.Assets.BlockCompression:Encoders;
+
+import :Simd;
+
+namespace VKING::Assets::BlockCompression::Encoders {
+
+    using Simd::BlockPixels;
+    using Simd::Float4;
+
+    /**
+     * @brief Knobs derived from the public quality preset.
+     */
+    struct EncoderParameters {
+        /// Least squares re-fits of the endpoints to the chosen indices
+        uint32_t refinementPasses = 1;
+        /// Quantized steps each endpoint component is nudged by during the greedy endpoint search (0 disables)
+        uint32_t endpointSearchRadius = 0;
+        /// BC7: evaluate all four p-bit combinations instead of picking each endpoint's p-bit independently
+        bool exhaustivePBits = false;
+    };
+
+    // =================================================================================================
+    // Shared kernels
+    // =================================================================================================
+
+    /**
+     * @brief Finds the nearest palette entry for all 16 pixels and returns the summed squared error.
+     *
+     * This is the hot loop of every encoder, it runs once per candidate endpoint pair. Each iteration
+     * handles a row of four pixels against one palette entry using four-wide SIMD.
+     */
+    template<uint32_t Channels, uint32_t Entries>
+    float evaluatePalette(const float* const (&channels)[Channels], const float (&palette)[Entries][4], uint8_t (&indices)[16]) {
+        float totalError = 0.0f;
+
+        for (uint32_t row = 0; row < 4; row++) {
+            Float4 values[Channels];
+            for (uint32_t c = 0; c < Channels; c++) values[c] = Simd::load(channels[c] + row * 4);
+
+            Float4 bestError = Simd::splat(FLT_MAX);
+            Float4 bestIndex = Simd::splat(0.0f);
+
+            for (uint32_t entry = 0; entry < Entries; entry++) {
+                Float4 error = Simd::splat(0.0f);
+                for (uint32_t c = 0; c < Channels; c++) {
+                    const Float4 difference = values[c] - Simd::splat(palette[entry][c]);
+                    error = error + difference * difference;
+                }
+                const Float4 closer = Simd::lessThan(error, bestError);
+                bestError = Simd::select(closer, error, bestError);
+                bestIndex = Simd::select(closer, Simd::splat(static_cast<float>(entry)), bestIndex);
+            }
+
+            totalError += Simd::horizontalSum(bestError);
+
+            alignas(16) float rowIndices[4];
+            Simd::store(rowIndices, bestIndex);
+            for (uint32_t i = 0; i < 4; i++) indices[row * 4 + i] = static_cast<uint8_t>(rowIndices[i]);
+        }
+
+        return totalError;
+    }
+
+    /**
+     * @brief Fits the line through the block's colors and returns the extreme points along it.
+     *
+     * The principal axis comes from a few power iterations on the covariance matrix, the pixels are then
+     * projected onto it with SIMD and the min/max projections become the initial endpoints.
+     */
+    template<uint32_t Channels>
+    void principalEndpoints(const float* const (&channels)[Channels], float (&endpoint0)[4], float (&endpoint1)[4]) {
+        float mean[Channels];
+        for (uint32_t c = 0; c < Channels; c++) {
+            Float4 sum = Simd::splat(0.0f);
+            for (uint32_t row = 0; row < 4; row++) sum = sum + Simd::load(channels[c] + row * 4);
+            mean[c] = Simd::horizontalSum(sum) / 16.0f;
+        }
+
+        float covariance[Channels][Channels];
+        for (uint32_t i = 0; i < Channels; i++) {
+            for (uint32_t j = i; j < Channels; j++) {
+                Float4 sum = Simd::splat(0.0f);
+                for (uint32_t row = 0; row < 4; row++) {
+                    const Float4 di = Simd::load(channels[i] + row * 4) - Simd::splat(mean[i]);
+                    const Float4 dj = Simd::load(channels[j] + row * 4) - Simd::splat(mean[j]);
+                    sum = sum + di * dj;
+                }
+                covariance[i][j] = covariance[j][i] = Simd::horizontalSum(sum);
+            }
+        }
+
+        float axis[Channels];
+        for (uint32_t c = 0; c < Channels; c++) axis[c] = 1.0f;
+        for (uint32_t iteration = 0; iteration < 8; iteration++) {
+            float next[Channels];
+            float length = 0.0f;
+            for (uint32_t i = 0; i < Channels; i++) {
+                next[i] = 0.0f;
+                for (uint32_t j = 0; j < Channels; j++) next[i] += covariance[i][j] * axis[j];
+                length = std::max(length, std::fabs(next[i]));
+            }
+            if (length < 1e-6f) {
+                // no variance at all, the block is a single color
+                for (uint32_t c = 0; c < Channels; c++) endpoint0[c] = endpoint1[c] = mean[c];
+                return;
+            }
+            for (uint32_t c = 0; c < Channels; c++) axis[c] = next[c] / length;
+        }
+
+        Float4 minimum = Simd::splat(FLT_MAX);
+        Float4 maximum = Simd::splat(-FLT_MAX);
+        for (uint32_t row = 0; row < 4; row++) {
+            Float4 projection = Simd::splat(0.0f);
+            for (uint32_t c = 0; c < Channels; c++) {
+                projection = projection + (Simd::load(channels[c] + row * 4) - Simd::splat(mean[c])) * Simd::splat(axis[c]);
+            }
+            minimum = Simd::min(minimum, projection);
+            maximum = Simd::max(maximum, projection);
+        }
+
+        alignas(16) float minimumLanes[4], maximumLanes[4];
+        Simd::store(minimumLanes, minimum);
+        Simd::store(maximumLanes, maximum);
+        const float tMin = std::min(std::min(minimumLanes[0], minimumLanes[1]), std::min(minimumLanes[2], minimumLanes[3]));
+        const float tMax = std::max(std::max(maximumLanes[0], maximumLanes[1]), std::max(maximumLanes[2], maximumLanes[3]));
+
+        // axis is normalized by its largest component, so scale back to a unit vector for the projection
+        float axisLengthSquared = 0.0f;
+        for (uint32_t c = 0; c < Channels; c++) axisLengthSquared += axis[c] * axis[c];
+
+        for (uint32_t c = 0; c < Channels; c++) {
+            endpoint0[c] = std::clamp(mean[c] + axis[c] * tMax / axisLengthSquared, 0.0f, 255.0f);
+            endpoint1[c] = std::clamp(mean[c] + axis[c] * tMin / axisLengthSquared, 0.0f, 255.0f);
+        }
+    }
+
+    /**
+     * @brief Solves for the endpoints that minimize the error for a fixed set of indices.
+     *
+     * @param weights Fraction of endpoint1 contributed by each index value
+     * @return false if the system is singular (every pixel picked the same weight)
+     */
+    template<uint32_t Channels, uint32_t Entries>
+    bool leastSquaresEndpoints(const float* const (&channels)[Channels], const uint8_t (&indices)[16],
+                               const float (&weights)[Entries], float (&endpoint0)[4], float (&endpoint1)[4]) {
+        float alphaAlpha = 0.0f, alphaBeta = 0.0f, betaBeta = 0.0f;
+        float alphaX[Channels]{}, betaX[Channels]{};
+
+        for (uint32_t i = 0; i < 16; i++) {
+            const float beta = weights[indices[i]];
+            const float alpha = 1.0f - beta;
+            alphaAlpha += alpha * alpha;
+            alphaBeta += alpha * beta;
+            betaBeta += beta * beta;
+            for (uint32_t c = 0; c < Channels; c++) {
+                alphaX[c] += alpha * channels[c][i];
+                betaX[c] += beta * channels[c][i];
+            }
+        }
+
+        const float determinant = alphaAlpha * betaBeta - alphaBeta * alphaBeta;
+        if (std::fabs(determinant) < 1e-6f) return false;
+
+        const float inverse = 1.0f / determinant;
+        for (uint32_t c = 0; c < Channels; c++) {
+            endpoint0[c] = std::clamp((betaBeta * alphaX[c] - alphaBeta * betaX[c]) * inverse, 0.0f, 255.0f);
+            endpoint1[c] = std::clamp((alphaAlpha * betaX[c] - alphaBeta * alphaX[c]) * inverse, 0.0f, 255.0f);
+        }
+        return true;
+    }
+
+    inline int quantize(const float value, const int maximum) {
+        return std::clamp(static_cast<int>(std::lround(value * static_cast<float>(maximum) / 255.0f)), 0, maximum);
+    }
+
+    // =================================================================================================
+    // BC1 (also the color half of BC3)
+    // =================================================================================================
+
+    constexpr int BC1_MAXIMUMS[3] = {31, 63, 31};
+    constexpr float BC1_WEIGHTS[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+    inline uint16_t pack565(const int (&q)[3]) {
+        return static_cast<uint16_t>((q[0] << 11) | (q[1] << 5) | q[2]);
+    }
+
+    inline void expand565(const uint16_t packed, int (&rgb)[3]) {
+        const int r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+        rgb[0] = (r << 3) | (r >> 2);
+        rgb[1] = (g << 2) | (g >> 4);
+        rgb[2] = (b << 3) | (b >> 2);
+    }
+
+    /// Builds the four color palette exactly the way the decoder does (4-color mode, integer thirds)
+    inline void buildBC1Palette(const uint16_t color0, const uint16_t color1, float (&palette)[4][4]) {
+        int c0[3], c1[3];
+        expand565(color0, c0);
+        expand565(color1, c1);
+        for (uint32_t c = 0; c < 3; c++) {
+            palette[0][c] = static_cast<float>(c0[c]);
+            palette[1][c] = static_cast<float>(c1[c]);
+            palette[2][c] = static_cast<float>((2 * c0[c] + c1[c]) / 3);
+            palette[3][c] = static_cast<float>((c0[c] + 2 * c1[c]) / 3);
+        }
+    }
+
+    inline float evaluateBC1(const float* const (&channels)[3], const int (&q0)[3], const int (&q1)[3], uint8_t (&indices)[16]) {
+        float palette[4][4];
+        buildBC1Palette(pack565(q0), pack565(q1), palette);
+        return evaluatePalette<3, 4>(channels, palette, indices);
+    }
+
+    /**
+     * @brief Encodes the RGB of a block as an 8 byte BC1 block (always 4-color mode unless the block is flat).
+     */
+    void encodeBC1Block(const BlockPixels& pixels, const EncoderParameters& parameters, uint8_t* output) {
+        const float* const channels[3] = {pixels.r, pixels.g, pixels.b};
+
+        float endpoint0[4], endpoint1[4];
+        principalEndpoints<3>(channels, endpoint0, endpoint1);
+
+        int best0[3], best1[3];
+        for (uint32_t c = 0; c < 3; c++) {
+            best0[c] = quantize(endpoint0[c], BC1_MAXIMUMS[c]);
+            best1[c] = quantize(endpoint1[c], BC1_MAXIMUMS[c]);
+        }
+        uint8_t bestIndices[16];
+        float bestError = evaluateBC1(channels, best0, best1, bestIndices);
+
+        for (uint32_t pass = 0; pass < parameters.refinementPasses; pass++) {
+            if (!leastSquaresEndpoints<3, 4>(channels, bestIndices, BC1_WEIGHTS, endpoint0, endpoint1)) break;
+
+            int candidate0[3], candidate1[3];
+            for (uint32_t c = 0; c < 3; c++) {
+                candidate0[c] = quantize(endpoint0[c], BC1_MAXIMUMS[c]);
+                candidate1[c] = quantize(endpoint1[c], BC1_MAXIMUMS[c]);
+            }
+            uint8_t indices[16];
+            const float error = evaluateBC1(channels, candidate0, candidate1, indices);
+            if (error >= bestError) break;
+            bestError = error;
+            std::memcpy(best0, candidate0, sizeof(best0));
+            std::memcpy(best1, candidate1, sizeof(best1));
+            std::memcpy(bestIndices, indices, sizeof(bestIndices));
+        }
+
+        // greedy endpoint search: nudge each quantized component and keep anything that lowers the error
+        const int radius = static_cast<int>(parameters.endpointSearchRadius);
+        for (uint32_t round = 0; radius > 0 && round < 2 && bestError > 0.0f; round++) {
+            bool improved = false;
+            for (uint32_t component = 0; component < 6; component++) {
+                int (&target)[3] = component < 3 ? best0 : best1;
+                const uint32_t c = component % 3;
+                const int original = target[c];
+                for (int step = -radius; step <= radius; step++) {
+                    if (step == 0) continue;
+                    const int value = original + step;
+                    if (value < 0 || value > BC1_MAXIMUMS[c]) continue;
+                    target[c] = value;
+                    uint8_t indices[16];
+                    const float error = evaluateBC1(channels, best0, best1, indices);
+                    if (error < bestError) {
+                        bestError = error;
+                        std::memcpy(bestIndices, indices, sizeof(bestIndices));
+                        improved = true;
+                        break;
+                    }
+                    target[c] = original;
+                }
+            }
+            if (!improved) break;
+        }
+
+        uint16_t color0 = pack565(best0);
+        uint16_t color1 = pack565(best1);
+
+        // 4-color mode needs color0 > color1, swapping the endpoints swaps index 0/1 and 2/3
+        if (color0 < color1) {
+            std::swap(color0, color1);
+            for (auto& index : bestIndices) index ^= 1;
+        } else if (color0 == color1) {
+            std::memset(bestIndices, 0, sizeof(bestIndices));
+        }
+
+        uint32_t packedIndices = 0;
+        for (uint32_t i = 0; i < 16; i++) packedIndices |= static_cast<uint32_t>(bestIndices[i]) << (i * 2);
+
+        output[0] = static_cast<uint8_t>(color0 & 0xFF);
+        output[1] = static_cast<uint8_t>(color0 >> 8);
+        output[2] = static_cast<uint8_t>(color1 & 0xFF);
+        output[3] = static_cast<uint8_t>(color1 >> 8);
+        for (uint32_t i = 0; i < 4; i++) output[4 + i] = static_cast<uint8_t>(packedIndices >> (i * 8));
+    }
+
+    void decodeBC1Block(const uint8_t* input, uint8_t (&rgba)[16][4]) {
+        const auto color0 = static_cast<uint16_t>(input[0] | (input[1] << 8));
+        const auto color1 = static_cast<uint16_t>(input[2] | (input[3] << 8));
+        const uint32_t packedIndices = static_cast<uint32_t>(input[4]) | (static_cast<uint32_t>(input[5]) << 8) |
+                                       (static_cast<uint32_t>(input[6]) << 16) | (static_cast<uint32_t>(input[7]) << 24);
+
+        int c0[3], c1[3];
+        expand565(color0, c0);
+        expand565(color1, c1);
+
+        int palette[4][4];
+        for (uint32_t c = 0; c < 3; c++) {
+            palette[0][c] = c0[c];
+            palette[1][c] = c1[c];
+            if (color0 > color1) {
+                palette[2][c] = (2 * c0[c] + c1[c]) / 3;
+                palette[3][c] = (c0[c] + 2 * c1[c]) / 3;
+            } else {
+                palette[2][c] = (c0[c] + c1[c]) / 2;
+                palette[3][c] = 0;
+            }
+        }
+        palette[0][3] = palette[1][3] = palette[2][3] = 255;
+        palette[3][3] = color0 > color1 ? 255 : 0;
+
+        for (uint32_t i = 0; i < 16; i++) {
+            const uint32_t index = (packedIndices >> (i * 2)) & 3;
+            for (uint32_t c = 0; c < 4; c++) rgba[i][c] = static_cast<uint8_t>(palette[index][c]);
+        }
+    }
+
+    // =================================================================================================
+    // BC4 (single channel, used for BC3 alpha and both BC5 channels)
+    // =================================================================================================
+
+    constexpr float BC4_WEIGHTS[8] = {0.0f, 1.0f, 1.0f / 7.0f, 2.0f / 7.0f, 3.0f / 7.0f, 4.0f / 7.0f, 5.0f / 7.0f, 6.0f / 7.0f};
+
+    /// 8 value palette (endpoint0 > endpoint1), rounded like the reference decoder
+    inline void buildBC4Palette(const int endpoint0, const int endpoint1, int (&palette)[8]) {
+        palette[0] = endpoint0;
+        palette[1] = endpoint1;
+        if (endpoint0 > endpoint1) {
+            for (int i = 1; i < 7; i++) palette[i + 1] = ((7 - i) * endpoint0 + i * endpoint1 + 3) / 7;
+        } else {
+            for (int i = 1; i < 5; i++) palette[i + 1] = ((5 - i) * endpoint0 + i * endpoint1 + 2) / 5;
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+    }
+
+    inline float evaluateBC4(const float* const (&channel)[1], const int endpoint0, const int endpoint1, uint8_t (&indices)[16]) {
+        int integerPalette[8];
+        buildBC4Palette(endpoint0, endpoint1, integerPalette);
+        float palette[8][4];
+        for (uint32_t i = 0; i < 8; i++) palette[i][0] = static_cast<float>(integerPalette[i]);
+        return evaluatePalette<1, 8>(channel, palette, indices);
+    }
+
+    /**
+     * @brief Encodes a single channel of a block as an 8 byte BC4 block.
+     */
+    void encodeBC4Block(const float* values, const EncoderParameters& parameters, uint8_t* output) {
+        const float* const channel[1] = {values};
+
+        float minimum = values[0], maximum = values[0];
+        for (uint32_t i = 1; i < 16; i++) {
+            minimum = std::min(minimum, values[i]);
+            maximum = std::max(maximum, values[i]);
+        }
+
+        int best0 = std::clamp(static_cast<int>(std::lround(maximum)), 0, 255);
+        int best1 = std::clamp(static_cast<int>(std::lround(minimum)), 0, 255);
+        uint8_t bestIndices[16]{};
+        float bestError = 0.0f;
+
+        if (best0 == best1) {
+            // flat block. Index 0 is endpoint0 in either palette mode
+        } else {
+            bestError = evaluateBC4(channel, best0, best1, bestIndices);
+
+            for (uint32_t pass = 0; pass < parameters.refinementPasses && bestError > 0.0f; pass++) {
+                float endpoint0[4], endpoint1[4];
+                if (!leastSquaresEndpoints<1, 8>(channel, bestIndices, BC4_WEIGHTS, endpoint0, endpoint1)) break;
+                const int candidate0 = static_cast<int>(std::lround(endpoint0[0]));
+                const int candidate1 = static_cast<int>(std::lround(endpoint1[0]));
+                if (candidate0 <= candidate1) break;
+
+                uint8_t indices[16];
+                const float error = evaluateBC4(channel, candidate0, candidate1, indices);
+                if (error >= bestError) break;
+                bestError = error;
+                best0 = candidate0;
+                best1 = candidate1;
+                std::memcpy(bestIndices, indices, sizeof(bestIndices));
+            }
+
+            // BC4 endpoints are a single byte each, so a small exhaustive window around the fit is affordable
+            const int radius = static_cast<int>(parameters.endpointSearchRadius) * 2;
+            const int center0 = best0, center1 = best1;
+            for (int offset0 = -radius; offset0 <= radius && bestError > 0.0f; offset0++) {
+                for (int offset1 = -radius; offset1 <= radius; offset1++) {
+                    const int candidate0 = center0 + offset0, candidate1 = center1 + offset1;
+                    if ((offset0 == 0 && offset1 == 0) || candidate0 > 255 || candidate1 < 0 || candidate0 <= candidate1) continue;
+
+                    uint8_t indices[16];
+                    const float error = evaluateBC4(channel, candidate0, candidate1, indices);
+                    if (error < bestError) {
+                        bestError = error;
+                        best0 = candidate0;
+                        best1 = candidate1;
+                        std::memcpy(bestIndices, indices, sizeof(bestIndices));
+                    }
+                }
+            }
+        }
+
+        uint64_t packedIndices = 0;
+        for (uint32_t i = 0; i < 16; i++) packedIndices |= static_cast<uint64_t>(bestIndices[i]) << (i * 3);
+
+        output[0] = static_cast<uint8_t>(best0);
+        output[1] = static_cast<uint8_t>(best1);
+        for (uint32_t i = 0; i < 6; i++) output[2 + i] = static_cast<uint8_t>(packedIndices >> (i * 8));
+    }
+
+    void decodeBC4Block(const uint8_t* input, uint8_t (&values)[16]) {
+        int palette[8];
+        buildBC4Palette(input[0], input[1], palette);
+
+        uint64_t packedIndices = 0;
+        for (uint32_t i = 0; i < 6; i++) packedIndices |= static_cast<uint64_t>(input[2 + i]) << (i * 8);
+
+        for (uint32_t i = 0; i < 16; i++) {
+            values[i] = static_cast<uint8_t>(palette[(packedIndices >> (i * 3)) & 7]);
+        }
+    }
+
+    // =================================================================================================
+    // BC7 (mode 6: one subset, RGBA 7.7.7.7 endpoints with a unique p-bit each, 4 bit indices)
+    // =================================================================================================
+
+    constexpr int BC7_WEIGHTS_4BIT[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+    constexpr float BC7_WEIGHTS_4BIT_FLOAT[16] = {
+        0.0f / 64.0f, 4.0f / 64.0f, 9.0f / 64.0f, 13.0f / 64.0f, 17.0f / 64.0f, 21.0f / 64.0f, 26.0f / 64.0f, 30.0f / 64.0f,
+        34.0f / 64.0f, 38.0f / 64.0f, 43.0f / 64.0f, 47.0f / 64.0f, 51.0f / 64.0f, 55.0f / 64.0f, 60.0f / 64.0f, 64.0f / 64.0f
+    };
+
+    struct Mode6Endpoints {
+        int q0[4]; ///< 7 bit components of endpoint 0
+        int q1[4]; ///< 7 bit components of endpoint 1
+        int p0;    ///< p-bit of endpoint 0
+        int p1;    ///< p-bit of endpoint 1
+    };
+
+    inline void quantizeMode6Endpoint(const float (&endpoint)[4], const int pBit, int (&q)[4]) {
+        for (uint32_t c = 0; c < 4; c++) {
+            q[c] = std::clamp(static_cast<int>(std::lround((endpoint[c] - static_cast<float>(pBit)) * 0.5f)), 0, 127);
+        }
+    }
+
+    inline float mode6QuantizationError(const float (&endpoint)[4], const int (&q)[4], const int pBit) {
+        float error = 0.0f;
+        for (uint32_t c = 0; c < 4; c++) {
+            const float difference = endpoint[c] - static_cast<float>((q[c] << 1) | pBit);
+            error += difference * difference;
+        }
+        return error;
+    }
+
+    inline float evaluateMode6(const float* const (&channels)[4], const Mode6Endpoints& endpoints, uint8_t (&indices)[16]) {
+        float palette[16][4];
+        for (uint32_t i = 0; i < 16; i++) {
+            for (uint32_t c = 0; c < 4; c++) {
+                const int value0 = (endpoints.q0[c] << 1) | endpoints.p0;
+                const int value1 = (endpoints.q1[c] << 1) | endpoints.p1;
+                palette[i][c] = static_cast<float>(((64 - BC7_WEIGHTS_4BIT[i]) * value0 + BC7_WEIGHTS_4BIT[i] * value1 + 32) >> 6);
+            }
+        }
+        return evaluatePalette<4, 16>(channels, palette, indices);
+    }
+
+    /**
+     * @brief Quantizes a float endpoint pair, choosing p-bits either per endpoint or by full evaluation.
+     */
+    inline float quantizeAndEvaluateMode6(const float* const (&channels)[4], const float (&endpoint0)[4], const float (&endpoint1)[4],
+                                          const bool exhaustivePBits, Mode6Endpoints& endpoints, uint8_t (&indices)[16]) {
+        if (!exhaustivePBits) {
+            float bestError0 = FLT_MAX, bestError1 = FLT_MAX;
+            for (int pBit = 0; pBit < 2; pBit++) {
+                int q0[4], q1[4];
+                quantizeMode6Endpoint(endpoint0, pBit, q0);
+                quantizeMode6Endpoint(endpoint1, pBit, q1);
+                const float error0 = mode6QuantizationError(endpoint0, q0, pBit);
+                const float error1 = mode6QuantizationError(endpoint1, q1, pBit);
+                if (error0 < bestError0) { bestError0 = error0; std::memcpy(endpoints.q0, q0, sizeof(q0)); endpoints.p0 = pBit; }
+                if (error1 < bestError1) { bestError1 = error1; std::memcpy(endpoints.q1, q1, sizeof(q1)); endpoints.p1 = pBit; }
+            }
+            return evaluateMode6(channels, endpoints, indices);
+        }
+
+        float bestError = FLT_MAX;
+        for (int combination = 0; combination < 4; combination++) {
+            Mode6Endpoints candidate{};
+            candidate.p0 = combination & 1;
+            candidate.p1 = combination >> 1;
+            quantizeMode6Endpoint(endpoint0, candidate.p0, candidate.q0);
+            quantizeMode6Endpoint(endpoint1, candidate.p1, candidate.q1);
+
+            uint8_t candidateIndices[16];
+            const float error = evaluateMode6(channels, candidate, candidateIndices);
+            if (error < bestError) {
+                bestError = error;
+                endpoints = candidate;
+                std::memcpy(indices, candidateIndices, sizeof(candidateIndices));
+            }
+        }
+        return bestError;
+    }
+
+    /**
+     * @brief Little endian 128 bit writer used to pack BC7 blocks.
+     */
+    struct BitWriter {
+        uint8_t* output;
+        uint32_t position = 0;
+
+        void write(const uint32_t value, const uint32_t bitCount) {
+            for (uint32_t bit = 0; bit < bitCount; bit++, position++) {
+                if ((value >> bit) & 1u) output[position >> 3] = static_cast<uint8_t>(output[position >> 3] | (1u << (position & 7)));
+            }
+        }
+    };
+
+    struct BitReader {
+        const uint8_t* input;
+        uint32_t position = 0;
+
+        uint32_t read(const uint32_t bitCount) {
+            uint32_t value = 0;
+            for (uint32_t bit = 0; bit < bitCount; bit++, position++) {
+                value |= static_cast<uint32_t>((input[position >> 3] >> (position & 7)) & 1u) << bit;
+            }
+            return value;
+        }
+    };
+
+    /**
+     * @brief Encodes an RGBA block as a 16 byte BC7 mode 6 block.
+     */
+    void encodeBC7Block(const BlockPixels& pixels, const EncoderParameters& parameters, uint8_t* output) {
+        const float* const channels[4] = {pixels.r, pixels.g, pixels.b, pixels.a};
+
+        float endpoint0[4], endpoint1[4];
+        principalEndpoints<4>(channels, endpoint0, endpoint1);
+
+        Mode6Endpoints best{};
+        uint8_t bestIndices[16];
+        float bestError = quantizeAndEvaluateMode6(channels, endpoint0, endpoint1, parameters.exhaustivePBits, best, bestIndices);
+
+        for (uint32_t pass = 0; pass < parameters.refinementPasses && bestError > 0.0f; pass++) {
+            if (!leastSquaresEndpoints<4, 16>(channels, bestIndices, BC7_WEIGHTS_4BIT_FLOAT, endpoint0, endpoint1)) break;
+
+            Mode6Endpoints candidate{};
+            uint8_t indices[16];
+            const float error = quantizeAndEvaluateMode6(channels, endpoint0, endpoint1, parameters.exhaustivePBits, candidate, indices);
+            if (error >= bestError) break;
+            bestError = error;
+            best = candidate;
+            std::memcpy(bestIndices, indices, sizeof(bestIndices));
+        }
+
+        const int radius = static_cast<int>(parameters.endpointSearchRadius);
+        for (uint32_t round = 0; radius > 0 && round < 2 && bestError > 0.0f; round++) {
+            bool improved = false;
+            for (uint32_t component = 0; component < 8; component++) {
+                int (&target)[4] = component < 4 ? best.q0 : best.q1;
+                const uint32_t c = component % 4;
+                const int original = target[c];
+                for (int step = -radius; step <= radius; step++) {
+                    if (step == 0 || original + step < 0 || original + step > 127) continue;
+                    target[c] = original + step;
+                    uint8_t indices[16];
+                    const float error = evaluateMode6(channels, best, indices);
+                    if (error < bestError) {
+                        bestError = error;
+                        std::memcpy(bestIndices, indices, sizeof(bestIndices));
+                        improved = true;
+                        break;
+                    }
+                    target[c] = original;
+                }
+            }
+            if (!improved) break;
+        }
+
+        // the anchor (pixel 0) index is stored with an implicit zero MSB, flip the line if it is set
+        if (bestIndices[0] & 8) {
+            std::swap(best.q0, best.q1);
+            std::swap(best.p0, best.p1);
+            for (auto& index : bestIndices) index = static_cast<uint8_t>(15 - index);
+        }
+
+        std::memset(output, 0, 16);
+        BitWriter writer{output};
+        writer.write(1u << 6, 7); // mode 6 is encoded as six zero bits followed by a one
+        for (uint32_t c = 0; c < 4; c++) {
+            writer.write(static_cast<uint32_t>(best.q0[c]), 7);
+            writer.write(static_cast<uint32_t>(best.q1[c]), 7);
+        }
+        writer.write(static_cast<uint32_t>(best.p0), 1);
+        writer.write(static_cast<uint32_t>(best.p1), 1);
+        writer.write(bestIndices[0], 3);
+        for (uint32_t i = 1; i < 16; i++) writer.write(bestIndices[i], 4);
+    }
+
+    /**
+     * @brief Decodes a BC7 block. Only mode 6, which is what encodeBC7Block() emits, is supported.
+     *
+     * @return false if the block uses another mode (the output is then left untouched)
+     */
+    bool decodeBC7Block(const uint8_t* input, uint8_t (&rgba)[16][4]) {
+        if ((input[0] & 0x7F) != 0x40) return false;
+
+        BitReader reader{input, 7};
+        int value0[4], value1[4];
+        for (uint32_t c = 0; c < 4; c++) {
+            value0[c] = static_cast<int>(reader.read(7));
+            value1[c] = static_cast<int>(reader.read(7));
+        }
+        const int p0 = static_cast<int>(reader.read(1));
+        const int p1 = static_cast<int>(reader.read(1));
+        for (uint32_t c = 0; c < 4; c++) {
+            value0[c] = (value0[c] << 1) | p0;
+            value1[c] = (value1[c] << 1) | p1;
+        }
+
+        for (uint32_t i = 0; i < 16; i++) {
+            const uint32_t index = reader.read(i == 0 ? 3 : 4);
+            const int weight = BC7_WEIGHTS_4BIT[index];
+            for (uint32_t c = 0; c < 4; c++) {
+                rgba[i][c] = static_cast<uint8_t>(((64 - weight) * value0[c] + weight * value1[c] + 32) >> 6);
+            }
+        }
+        return true;
+    }
+
+}
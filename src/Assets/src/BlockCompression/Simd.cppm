@@ -0,0 +1,144 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cmath>
+#include <cstdint>
+
+// SSE2 is baseline on every x86-64 target and NEON on every AArch64 target, so no extra
+// compiler flags are needed. Anything else takes the scalar path.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define VKING_BC_SIMD_SSE2 1
+#   include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#   define VKING_BC_SIMD_NEON 1
+#   include <arm_neon.h>
+#endif
+
+module VKING.Assets.BlockCompression:Simd;
+
+namespace VKING::Assets::BlockCompression::Simd {
+
+    /**
+     * @brief Four float lanes. The block encoders process a 4x4 block as four rows of four pixels,
+     *        so every per-pixel loop becomes four iterations over this type.
+     */
+    struct Float4 {
+#if defined(VKING_BC_SIMD_SSE2)
+        __m128 v;
+#elif defined(VKING_BC_SIMD_NEON)
+        float32x4_t v;
+#else
+        float v[4];
+#endif
+    };
+
+    /// Name of the instruction set the kernels were compiled for, reported by the benchmark
+    constexpr const char* INSTRUCTION_SET =
+#if defined(VKING_BC_SIMD_SSE2)
+        "SSE2";
+#elif defined(VKING_BC_SIMD_NEON)
+        "NEON";
+#else
+        "Scalar";
+#endif
+
+#if defined(VKING_BC_SIMD_SSE2)
+
+    inline Float4 load(const float* p) { return {_mm_loadu_ps(p)}; }
+    inline void store(float* p, const Float4 a) { _mm_storeu_ps(p, a.v); }
+    inline Float4 splat(const float f) { return {_mm_set1_ps(f)}; }
+    inline Float4 operator+(const Float4 a, const Float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+    inline Float4 operator-(const Float4 a, const Float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+    inline Float4 operator*(const Float4 a, const Float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+    inline Float4 min(const Float4 a, const Float4 b) { return {_mm_min_ps(a.v, b.v)}; }
+    inline Float4 max(const Float4 a, const Float4 b) { return {_mm_max_ps(a.v, b.v)}; }
+    /// Lane mask of a < b
+    inline Float4 lessThan(const Float4 a, const Float4 b) { return {_mm_cmplt_ps(a.v, b.v)}; }
+    /// mask ? a : b
+    inline Float4 select(const Float4 mask, const Float4 a, const Float4 b) {
+        return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+    }
+    /// Round half away from zero is not required, the default MXCSR mode (nearest even) is fine for quantization
+    inline Float4 round(const Float4 a) { return {_mm_cvtepi32_ps(_mm_cvtps_epi32(a.v))}; }
+    inline float horizontalSum(const Float4 a) {
+        const __m128 shuffled = _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m128 sums = _mm_add_ps(a.v, shuffled);
+        return _mm_cvtss_f32(_mm_add_ss(sums, _mm_movehl_ps(shuffled, sums)));
+    }
+
+#elif defined(VKING_BC_SIMD_NEON)
+
+    inline Float4 load(const float* p) { return {vld1q_f32(p)}; }
+    inline void store(float* p, const Float4 a) { vst1q_f32(p, a.v); }
+    inline Float4 splat(const float f) { return {vdupq_n_f32(f)}; }
+    inline Float4 operator+(const Float4 a, const Float4 b) { return {vaddq_f32(a.v, b.v)}; }
+    inline Float4 operator-(const Float4 a, const Float4 b) { return {vsubq_f32(a.v, b.v)}; }
+    inline Float4 operator*(const Float4 a, const Float4 b) { return {vmulq_f32(a.v, b.v)}; }
+    inline Float4 min(const Float4 a, const Float4 b) { return {vminq_f32(a.v, b.v)}; }
+    inline Float4 max(const Float4 a, const Float4 b) { return {vmaxq_f32(a.v, b.v)}; }
+    inline Float4 lessThan(const Float4 a, const Float4 b) { return {vreinterpretq_f32_u32(vcltq_f32(a.v, b.v))}; }
+    inline Float4 select(const Float4 mask, const Float4 a, const Float4 b) {
+        return {vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v)};
+    }
+    inline Float4 round(const Float4 a) { return {vrndnq_f32(a.v)}; }
+    inline float horizontalSum(const Float4 a) { return vaddvq_f32(a.v); }
+
+#else
+
+    inline Float4 load(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+    inline void store(float* p, const Float4 a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+    inline Float4 splat(const float f) { return {{f, f, f, f}}; }
+    inline Float4 operator+(const Float4 a, const Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i] + b.v[i]; return r; }
+    inline Float4 operator-(const Float4 a, const Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i] - b.v[i]; return r; }
+    inline Float4 operator*(const Float4 a, const Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i] * b.v[i]; return r; }
+    inline Float4 min(const Float4 a, const Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return r; }
+    inline Float4 max(const Float4 a, const Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return r; }
+    // the scalar mask uses 1.0f/0.0f instead of all-bits-set, only select() interprets it
+    inline Float4 lessThan(const Float4 a, const Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = a.v[i] < b.v[i] ? 1.0f : 0.0f; return r; }
+    inline Float4 select(const Float4 mask, const Float4 a, const Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = mask.v[i] != 0.0f ? a.v[i] : b.v[i]; return r; }
+    inline Float4 round(const Float4 a) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = std::nearbyint(a.v[i]); return r; }
+    inline float horizontalSum(const Float4 a) { return (a.v[0] + a.v[1]) + (a.v[2] + a.v[3]); }
+
+#endif
+
+    inline Float4 clamp(const Float4 a, const Float4 low, const Float4 high) { return min(max(a, low), high); }
+
+    /**
+     * @brief A 4x4 block in structure-of-arrays form, values in [0, 255].
+     */
+    struct BlockPixels {
+        alignas(16) float r[16];
+        alignas(16) float g[16];
+        alignas(16) float b[16];
+        alignas(16) float a[16];
+
+        [[nodiscard]] const float* channel(const uint32_t index) const {
+            switch (index) {
+                case 0: return r;
+                case 1: return g;
+                case 2: return b;
+                default: return a;
+            }
+        }
+    };
+
+}
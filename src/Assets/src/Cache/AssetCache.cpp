@@ -0,0 +1,138 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+module VKING.Assets.Cache;
+
+import VKING.Log;
+
+namespace VKING::Assets {
+
+    using AssetCacheLogger = Log::Named<"AssetCache">;
+
+    namespace {
+
+        constexpr uint32_t CACHE_ENTRY_MAGIC = 0x48434B56; // "VKCH"
+
+        struct EntryHeader {
+            uint32_t magic;
+            uint32_t importerVersion;
+            uint64_t payloadSize;
+            uint64_t payloadHash;
+        };
+
+    }
+
+    uint64_t hashBytes(const std::span<const std::byte> bytes, uint64_t seed) {
+        for (const std::byte byte : bytes) {
+            seed ^= static_cast<uint8_t>(byte);
+            seed *= 0x100000001b3ull;
+        }
+        return seed;
+    }
+
+    uint64_t hashString(const std::string_view string, const uint64_t seed) {
+        return hashBytes(std::as_bytes(std::span(string.data(), string.size())), seed);
+    }
+
+    AssetCache::AssetCache(std::filesystem::path directory)
+        : m_Directory(std::move(directory)) {
+        std::error_code error;
+        std::filesystem::create_directories(m_Directory, error);
+        if (error) AssetCacheLogger::record().warn("Could not create asset cache directory '{}': {}", m_Directory.string(), error.message());
+    }
+
+    std::filesystem::path AssetCache::getEntryPath(const AssetCacheKey& key) const {
+        char name[96];
+        std::snprintf(name, sizeof(name), "%016llx-%016llx-v%u.bin",
+                      static_cast<unsigned long long>(key.sourceHash), static_cast<unsigned long long>(key.settingsHash), key.importerVersion);
+        return m_Directory / (key.kind + "-" + name);
+    }
+
+    std::optional<std::vector<std::byte>> AssetCache::load(const AssetCacheKey& key) const {
+        const std::filesystem::path path = getEntryPath(key);
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return std::nullopt;
+
+        EntryHeader header{};
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != CACHE_ENTRY_MAGIC
+            || header.importerVersion != key.importerVersion) {
+            AssetCacheLogger::record().warn("Ignoring malformed cache entry '{}'.", path.string());
+            return std::nullopt;
+        }
+
+        std::vector<std::byte> payload(header.payloadSize);
+        if (!file.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payload.size()))
+            || hashBytes(payload) != header.payloadHash) {
+            AssetCacheLogger::record().warn("Ignoring truncated or corrupt cache entry '{}'.", path.string());
+            return std::nullopt;
+        }
+
+        AssetCacheLogger::record().trace("Cache hit '{}' ({} bytes).", path.filename().string(), payload.size());
+        return payload;
+    }
+
+    bool AssetCache::store(const AssetCacheKey& key, const std::span<const std::byte> payload) const {
+        static std::atomic<uint32_t> s_TemporaryCounter = 0;
+
+        const std::filesystem::path path = getEntryPath(key);
+        std::filesystem::path temporaryPath = path;
+        temporaryPath += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()))
+                         + "-" + std::to_string(s_TemporaryCounter.fetch_add(1, std::memory_order_relaxed));
+
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            const EntryHeader header{CACHE_ENTRY_MAGIC, key.importerVersion, payload.size(), hashBytes(payload)};
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+            if (!file) {
+                AssetCacheLogger::record().warn("Could not write cache entry '{}'.", path.string());
+                std::error_code ignored;
+                std::filesystem::remove(temporaryPath, ignored);
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporaryPath, path, error);
+        if (error) {
+            AssetCacheLogger::record().warn("Could not move cache entry into place '{}': {}", path.string(), error.message());
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+        return true;
+    }
+
+}
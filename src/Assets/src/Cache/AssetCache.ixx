@@ -0,0 +1,86 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+export module VKING.Assets.Cache;
+
+export namespace VKING::Assets {
+
+    constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ull;
+
+    /**
+     * @brief FNV-1a 64 over a byte range. Pass a previous result as seed to hash several ranges as one.
+     */
+    uint64_t hashBytes(std::span<const std::byte> bytes, uint64_t seed = HASH_SEED);
+    uint64_t hashString(std::string_view string, uint64_t seed = HASH_SEED);
+
+    /**
+     * @brief Identifies one cached import result.
+     *
+     * An entry is only reused if the source content, the import settings and the importer version all match,
+     * so editing a source file, changing a setting or fixing an importer bug all invalidate it automatically.
+     */
+    struct AssetCacheKey {
+        /// Short importer name, also used as file name prefix ("mesh", "texture", ...)
+        std::string kind;
+        uint64_t sourceHash = 0;
+        uint64_t settingsHash = 0;
+        uint32_t importerVersion = 0;
+    };
+
+    /**
+     * @brief Content addressed on-disk cache of import results.
+     *
+     * Each entry is one file holding a small header (with a hash of the payload, so torn or corrupt
+     * entries are detected and ignored) followed by the payload. Entries are written to a temporary file
+     * and renamed into place, so concurrent importers never observe a partial entry.
+     */
+    class AssetCache {
+    public:
+        explicit AssetCache(std::filesystem::path directory);
+
+        /**
+         * @return The cached payload, or std::nullopt on a miss or a corrupt entry
+         */
+        [[nodiscard]] std::optional<std::vector<std::byte>> load(const AssetCacheKey& key) const;
+
+        /**
+         * @return false if the entry could not be written. The cache is an optimization, callers may ignore this
+         */
+        bool store(const AssetCacheKey& key, std::span<const std::byte> payload) const;
+
+        [[nodiscard]] std::filesystem::path getEntryPath(const AssetCacheKey& key) const;
+        [[nodiscard]] const std::filesystem::path& getDirectory() const { return m_Directory; }
+
+    private:
+        std::filesystem::path m_Directory;
+    };
+
+}
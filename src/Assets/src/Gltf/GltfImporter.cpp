@@ -0,0 +1,575 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+module VKING.Assets.Gltf;
+
+import VKING.Json;
+import VKING.Log;
+
+namespace VKING::Assets {
+
+    using GltfImportLogger = Log::Named<"GltfImport">;
+
+    namespace {
+
+        constexpr uint32_t GLB_MAGIC = 0x46546C67;       // "glTF"
+        constexpr uint32_t GLB_CHUNK_JSON = 0x4E4F534A;  // "JSON"
+        constexpr uint32_t GLB_CHUNK_BIN = 0x004E4942;   // "BIN\0"
+
+        constexpr uint32_t COMPONENT_BYTE = 5120;
+        constexpr uint32_t COMPONENT_UNSIGNED_BYTE = 5121;
+        constexpr uint32_t COMPONENT_SHORT = 5122;
+        constexpr uint32_t COMPONENT_UNSIGNED_SHORT = 5123;
+        constexpr uint32_t COMPONENT_UNSIGNED_INT = 5125;
+        constexpr uint32_t COMPONENT_FLOAT = 5126;
+
+        constexpr uint32_t PRIMITIVE_MODE_TRIANGLES = 4;
+
+        /// Values an accessor without a buffer view may expand to. Such accessors are all zero and bounded by nothing else
+        constexpr uint64_t MAX_ZERO_ACCESSOR_VALUES = uint64_t{1} << 26;
+
+        double millisecondsSince(const std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        std::optional<std::vector<std::byte>> readFile(const std::filesystem::path& path) {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file) return std::nullopt;
+            const std::streamsize size = file.tellg();
+            file.seekg(0);
+            std::vector<std::byte> bytes(static_cast<size_t>(size));
+            if (!file.read(reinterpret_cast<char*>(bytes.data()), size)) return std::nullopt;
+            return bytes;
+        }
+
+        std::optional<std::vector<std::byte>> decodeBase64(const std::string_view text) {
+            auto decodeCharacter = [](const char c) -> int {
+                if (c >= 'A' && c <= 'Z') return c - 'A';
+                if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+                if (c >= '0' && c <= '9') return c - '0' + 52;
+                if (c == '+') return 62;
+                if (c == '/') return 63;
+                return -1;
+            };
+
+            std::vector<std::byte> output;
+            output.reserve(text.size() / 4 * 3);
+            uint32_t accumulator = 0;
+            uint32_t bits = 0;
+            for (const char c : text) {
+                if (c == '=') break;
+                const int value = decodeCharacter(c);
+                if (value < 0) return std::nullopt;
+                accumulator = accumulator << 6 | static_cast<uint32_t>(value);
+                bits += 6;
+                if (bits >= 8) {
+                    bits -= 8;
+                    output.push_back(static_cast<std::byte>(accumulator >> bits & 0xFF));
+                }
+            }
+            return output;
+        }
+
+        uint32_t getComponentSize(const uint32_t componentType) {
+            switch (componentType) {
+                case COMPONENT_BYTE:
+                case COMPONENT_UNSIGNED_BYTE: return 1;
+                case COMPONENT_SHORT:
+                case COMPONENT_UNSIGNED_SHORT: return 2;
+                case COMPONENT_UNSIGNED_INT:
+                case COMPONENT_FLOAT: return 4;
+                default: return 0;
+            }
+        }
+
+        uint32_t getComponentCount(const std::string_view type) {
+            if (type == "SCALAR") return 1;
+            if (type == "VEC2") return 2;
+            if (type == "VEC3") return 3;
+            if (type == "VEC4") return 4;
+            if (type == "MAT2") return 4;
+            if (type == "MAT3") return 9;
+            if (type == "MAT4") return 16;
+            return 0;
+        }
+
+        template<typename T>
+        T loadUnaligned(const std::byte* data) {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        double readComponent(const std::byte* data, const uint32_t componentType, const bool normalized) {
+            switch (componentType) {
+                case COMPONENT_BYTE: {
+                    const auto value = loadUnaligned<int8_t>(data);
+                    return normalized ? std::max(value / 127.0, -1.0) : value;
+                }
+                case COMPONENT_UNSIGNED_BYTE: {
+                    const auto value = loadUnaligned<uint8_t>(data);
+                    return normalized ? value / 255.0 : value;
+                }
+                case COMPONENT_SHORT: {
+                    const auto value = loadUnaligned<int16_t>(data);
+                    return normalized ? std::max(value / 32767.0, -1.0) : value;
+                }
+                case COMPONENT_UNSIGNED_SHORT: {
+                    const auto value = loadUnaligned<uint16_t>(data);
+                    return normalized ? value / 65535.0 : value;
+                }
+                case COMPONENT_UNSIGNED_INT: return loadUnaligned<uint32_t>(data);
+                case COMPONENT_FLOAT: return loadUnaligned<float>(data);
+                default: return 0.0;
+            }
+        }
+
+        /// The JSON document plus every buffer it references, resolved to bytes
+        struct Document {
+            Json::Value json;
+            std::vector<std::vector<std::byte>> buffers;
+        };
+
+        /**
+         * @brief Reads an accessor into plain values, converting any component type.
+         *
+         * @param document The resolved document
+         * @param accessorIndex Index into "accessors"
+         * @param output Receives count * components values
+         * @param components Receives the number of components per element
+         * @param error Receives a description on failure
+         */
+        template<typename T>
+        bool readAccessor(const Document& document, const uint32_t accessorIndex, std::vector<T>& output, uint32_t& components, std::string& error) {
+            const Json::Value& accessors = document.json["accessors"];
+            if (accessorIndex >= accessors.size()) {
+                error = "accessor " + std::to_string(accessorIndex) + " does not exist";
+                return false;
+            }
+            const Json::Value& accessor = accessors[accessorIndex];
+
+            const auto componentType = accessor["componentType"].asNumber<uint32_t>();
+            const uint32_t componentSize = getComponentSize(componentType);
+            components = getComponentCount(accessor["type"].asString());
+            // Malformed numbers get fallbacks that fail the checks below instead of quietly reading as 0
+            const auto count = accessor["count"].asNumber<uint64_t>(UINT64_MAX);
+            const bool normalized = accessor["normalized"].asBool();
+            if (componentSize == 0 || components == 0) {
+                error = "accessor " + std::to_string(accessorIndex) + " has an invalid component type or element type";
+                return false;
+            }
+            if (accessor.contains("sparse")) {
+                GltfImportLogger::record().warn("Accessor {} is sparse, sparse substitution is not supported and is ignored.", accessorIndex);
+            }
+
+            // Nothing is allocated before count is known to fit, a bad count must fail the import, not the process
+            if (!accessor.contains("bufferView")) {
+                // All zero, as the spec defines. Nothing in the file bounds it, so it is capped instead
+                if (count > MAX_ZERO_ACCESSOR_VALUES / components) {
+                    error = "accessor " + std::to_string(accessorIndex) + " has no buffer view and too many elements (" + std::to_string(count) + ")";
+                    return false;
+                }
+                output.assign(count * components, T{});
+                return true;
+            }
+
+            const auto viewIndex = accessor["bufferView"].asNumber<uint32_t>(UINT32_MAX);
+            const Json::Value& views = document.json["bufferViews"];
+            if (viewIndex >= views.size()) {
+                error = "accessor " + std::to_string(accessorIndex) + " references a missing buffer view";
+                return false;
+            }
+            const Json::Value& view = views[viewIndex];
+            const auto bufferIndex = view["buffer"].asNumber<uint32_t>(UINT32_MAX);
+            if (bufferIndex >= document.buffers.size()) {
+                error = "buffer view " + std::to_string(viewIndex) + " references a missing buffer";
+                return false;
+            }
+            const std::vector<std::byte>& buffer = document.buffers[bufferIndex];
+
+            // Offsets are optional and default to 0, but one that is present must be valid
+            const auto viewOffset = view.contains("byteOffset") ? view["byteOffset"].asNumber<uint64_t>(UINT64_MAX) : 0;
+            const auto viewLength = view["byteLength"].asNumber<uint64_t>(UINT64_MAX);
+            const auto accessorOffset = accessor.contains("byteOffset") ? accessor["byteOffset"].asNumber<uint64_t>(UINT64_MAX) : 0;
+            const uint64_t elementSize = static_cast<uint64_t>(componentSize) * components;
+            const uint64_t stride = view.contains("byteStride") ? view["byteStride"].asNumber<uint64_t>(0) : elementSize;
+
+            // Divides instead of multiplying count by stride, which a large count overflows past the check.
+            // Every element lies inside the view, so count * components is bounded by the buffer size too
+            if (viewOffset > buffer.size() || viewLength > buffer.size() - viewOffset || stride < elementSize
+                || (count > 0 && (accessorOffset > viewLength || viewLength - accessorOffset < elementSize
+                                  || count - 1 > (viewLength - accessorOffset - elementSize) / stride))) {
+                error = "accessor " + std::to_string(accessorIndex) + " reads outside its buffer";
+                return false;
+            }
+
+            output.assign(count * components, T{});
+            const std::byte* element = buffer.data() + viewOffset + accessorOffset;
+            T* out = output.data();
+            for (uint64_t i = 0; i < count; i++, element += stride) {
+                for (uint32_t c = 0; c < components; c++) {
+                    *out++ = static_cast<T>(readComponent(element + c * componentSize, componentType, normalized));
+                }
+            }
+            return true;
+        }
+
+        /// Reads an optional vertex attribute. Missing attributes leave output empty
+        bool readAttribute(const Document& document, const Json::Value& attributes, const std::string_view name, const uint32_t expectedComponents,
+                           const uint64_t vertexCount, std::vector<float>& output, std::string& error) {
+            const Json::Value* accessor = attributes.find(name);
+            if (!accessor) return true;
+
+            uint32_t components = 0;
+            if (!readAccessor(document, accessor->asNumber<uint32_t>(UINT32_MAX), output, components, error)) return false;
+            if (output.size() / std::max(components, 1u) != vertexCount) {
+                error = std::string(name) + " has a different vertex count than POSITION";
+                return false;
+            }
+
+            if (components == 3 && expectedComponents == 4) {
+                // COLOR_0 may be RGB, expand with an opaque alpha
+                std::vector<float> expanded(vertexCount * 4);
+                for (uint64_t v = 0; v < vertexCount; v++) {
+                    std::memcpy(&expanded[v * 4], &output[v * 3], 3 * sizeof(float));
+                    expanded[v * 4 + 3] = 1.0f;
+                }
+                output = std::move(expanded);
+            } else if (components != expectedComponents) {
+                error = std::string(name) + " has " + std::to_string(components) + " components, expected " + std::to_string(expectedComponents);
+                return false;
+            }
+            return true;
+        }
+
+        bool decodePrimitive(const Document& document, const Json::Value& primitive, Mesh::SourcePrimitive& output, std::string& error) {
+            const Json::Value& attributes = primitive["attributes"];
+            const Json::Value* position = attributes.find("POSITION");
+            if (!position) {
+                error = "primitive has no POSITION attribute";
+                return false;
+            }
+
+            uint32_t components = 0;
+            if (!readAccessor(document, position->asNumber<uint32_t>(UINT32_MAX), output.positions, components, error)) return false;
+            if (components != 3) {
+                error = "POSITION must be VEC3";
+                return false;
+            }
+            const uint64_t vertexCount = output.positions.size() / 3;
+
+            if (!readAttribute(document, attributes, "NORMAL", 3, vertexCount, output.normals, error)
+                || !readAttribute(document, attributes, "TANGENT", 4, vertexCount, output.tangents, error)
+                || !readAttribute(document, attributes, "TEXCOORD_0", 2, vertexCount, output.texcoords, error)
+                || !readAttribute(document, attributes, "COLOR_0", 4, vertexCount, output.colors, error)) {
+                return false;
+            }
+
+            if (const Json::Value* indices = primitive.find("indices")) {
+                if (!readAccessor(document, indices->asNumber<uint32_t>(UINT32_MAX), output.indices, components, error)) return false;
+            } else {
+                output.indices.resize(vertexCount);
+                for (uint32_t i = 0; i < vertexCount; i++) output.indices[i] = i;
+            }
+
+            output.materialIndex = primitive["material"].asNumber<uint32_t>();
+            return true;
+        }
+
+        /**
+         * @brief Parses the JSON and resolves every buffer, from the GLB binary chunk, a data URI or an external file.
+         */
+        bool loadDocument(const std::filesystem::path& path, const std::span<const std::byte> file, Document& document, uint64_t& sourceBytes, std::string& error) {
+            std::string_view jsonText;
+            std::span<const std::byte> binaryChunk;
+
+            if (file.size() >= 12 && loadUnaligned<uint32_t>(file.data()) == GLB_MAGIC) {
+                const auto version = loadUnaligned<uint32_t>(file.data() + 4);
+                const uint64_t length = std::min<uint64_t>(loadUnaligned<uint32_t>(file.data() + 8), file.size());
+                if (version != 2) {
+                    error = "unsupported GLB version " + std::to_string(version);
+                    return false;
+                }
+
+                uint64_t offset = 12;
+                while (offset + 8 <= length) {
+                    const auto chunkLength = loadUnaligned<uint32_t>(file.data() + offset);
+                    const auto chunkType = loadUnaligned<uint32_t>(file.data() + offset + 4);
+                    offset += 8;
+                    if (chunkLength > length - offset) {
+                        error = "GLB chunk exceeds the file";
+                        return false;
+                    }
+                    if (chunkType == GLB_CHUNK_JSON && jsonText.empty()) {
+                        jsonText = std::string_view(reinterpret_cast<const char*>(file.data() + offset), chunkLength);
+                    } else if (chunkType == GLB_CHUNK_BIN && binaryChunk.empty()) {
+                        binaryChunk = file.subspan(offset, chunkLength);
+                    }
+                    offset += (chunkLength + 3) & ~3ull;
+                }
+                if (jsonText.empty()) {
+                    error = "GLB has no JSON chunk";
+                    return false;
+                }
+            } else {
+                jsonText = std::string_view(reinterpret_cast<const char*>(file.data()), file.size());
+            }
+
+            std::optional<Json::Value> json = Json::parse(jsonText, &error);
+            if (!json) return false;
+            document.json = std::move(*json);
+
+            const Json::Value& buffers = document.json["buffers"];
+            document.buffers.resize(buffers.size());
+            for (size_t i = 0; i < buffers.size(); i++) {
+                const Json::Value& buffer = buffers[i];
+                const auto byteLength = buffer["byteLength"].asNumber<uint64_t>();
+                const std::string_view uri = buffer["uri"].asString();
+
+                std::vector<std::byte>& bytes = document.buffers[i];
+                if (uri.empty()) {
+                    if (i != 0 || binaryChunk.empty()) {
+                        error = "buffer " + std::to_string(i) + " has no uri and is not the GLB binary chunk";
+                        return false;
+                    }
+                    bytes.assign(binaryChunk.begin(), binaryChunk.end());
+                } else if (uri.starts_with("data:")) {
+                    const size_t comma = uri.find(',');
+                    std::optional<std::vector<std::byte>> decoded;
+                    if (comma != std::string_view::npos && uri.substr(0, comma).ends_with(";base64")) decoded = decodeBase64(uri.substr(comma + 1));
+                    if (!decoded) {
+                        error = "buffer " + std::to_string(i) + " has an unsupported data uri";
+                        return false;
+                    }
+                    bytes = std::move(*decoded);
+                } else {
+                    std::optional<std::vector<std::byte>> external = readFile(path.parent_path() / std::filesystem::path(std::u8string(uri.begin(), uri.end())));
+                    if (!external) {
+                        error = "could not read buffer '" + std::string(uri) + "'";
+                        return false;
+                    }
+                    sourceBytes += external->size();
+                    bytes = std::move(*external);
+                }
+
+                if (bytes.size() < byteLength) {
+                    error = "buffer " + std::to_string(i) + " is shorter than its byteLength";
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        uint64_t hashSettings(const Mesh::MeshBuildSettings& settings) {
+            const uint32_t fields[] = {
+                static_cast<uint32_t>(settings.layout), settings.quantize, settings.optimizeVertexCache, settings.optimizeVertexFetch,
+                settings.buildMeshlets, settings.maxMeshletVertices, settings.maxMeshletTriangles
+            };
+            return hashBytes(std::as_bytes(std::span(fields)));
+        }
+
+        // Cache package: u32 mesh count, then per mesh u32 name length, name, u64 blob size, blob
+
+        std::vector<std::byte> packMeshes(const std::vector<ImportedMesh>& meshes) {
+            std::vector<std::byte> package;
+            auto append = [&package](const void* data, const size_t size) {
+                const auto* bytes = static_cast<const std::byte*>(data);
+                package.insert(package.end(), bytes, bytes + size);
+            };
+
+            const auto count = static_cast<uint32_t>(meshes.size());
+            append(&count, sizeof(count));
+            for (const ImportedMesh& mesh : meshes) {
+                const auto nameLength = static_cast<uint32_t>(mesh.name.size());
+                const uint64_t blobSize = mesh.blob.size();
+                append(&nameLength, sizeof(nameLength));
+                append(mesh.name.data(), nameLength);
+                append(&blobSize, sizeof(blobSize));
+                append(mesh.blob.data(), mesh.blob.size());
+            }
+            return package;
+        }
+
+        std::optional<std::vector<ImportedMesh>> unpackMeshes(const std::span<const std::byte> package) {
+            size_t offset = 0;
+            auto read = [&](void* data, const size_t size) {
+                if (size > package.size() - offset) return false;
+                std::memcpy(data, package.data() + offset, size);
+                offset += size;
+                return true;
+            };
+
+            uint32_t count = 0;
+            if (!read(&count, sizeof(count))) return std::nullopt;
+            std::vector<ImportedMesh> meshes(count);
+            for (ImportedMesh& mesh : meshes) {
+                uint32_t nameLength = 0;
+                uint64_t blobSize = 0;
+                if (!read(&nameLength, sizeof(nameLength))) return std::nullopt;
+                mesh.name.resize(nameLength);
+                if (!read(mesh.name.data(), nameLength) || !read(&blobSize, sizeof(blobSize)) || blobSize > package.size() - offset) return std::nullopt;
+                mesh.blob.resize(blobSize);
+                read(mesh.blob.data(), blobSize);
+            }
+            return meshes;
+        }
+
+        void accumulateOutputStats(GltfImportStats& stats, const std::vector<ImportedMesh>& meshes) {
+            for (const ImportedMesh& mesh : meshes) {
+                stats.outputBytes += mesh.blob.size();
+                const std::optional<Mesh::MeshBlobView> view = Mesh::MeshBlobView::create(mesh.blob);
+                if (!view) continue;
+                stats.vertexCount += view->getHeader().vertexCount;
+                stats.triangleCount += view->getHeader().indexCount / 3;
+                stats.meshletCount += view->getHeader().meshletCount;
+                stats.primitiveCount += view->getHeader().submeshCount;
+            }
+            stats.meshCount = static_cast<uint32_t>(meshes.size());
+        }
+
+        GltfImportResult fail(const std::filesystem::path& path, GltfImportResult& result, std::string error) {
+            GltfImportLogger::record().error("Failed to import '{}': {}", path.string(), error);
+            result.error = std::move(error);
+            result.success = false;
+            result.meshes.clear();
+            return std::move(result);
+        }
+
+    }
+
+    GltfImportResult importGltf(const std::filesystem::path& path, const GltfImportSettings& settings) {
+        GltfImportResult result;
+        GltfImportStats& stats = result.stats;
+        const auto importStart = std::chrono::steady_clock::now();
+        JobSystem& jobSystem = settings.jobSystem ? *settings.jobSystem : JobSystem::getDefault();
+
+        // === Read and parse ===
+        const auto readStart = std::chrono::steady_clock::now();
+        std::optional<std::vector<std::byte>> file = readFile(path);
+        if (!file) return fail(path, result, "could not read file");
+        stats.sourceBytes = file->size();
+        stats.readMilliseconds = millisecondsSince(readStart);
+
+        const auto parseStart = std::chrono::steady_clock::now();
+        Document document;
+        std::string error;
+        if (!loadDocument(path, *file, document, stats.sourceBytes, error)) return fail(path, result, std::move(error));
+        stats.parseMilliseconds = millisecondsSince(parseStart);
+
+        // === Cache lookup ===
+        AssetCacheKey cacheKey;
+        if (settings.cache) {
+            uint64_t sourceHash = hashBytes(*file);
+            for (const std::vector<std::byte>& buffer : document.buffers) sourceHash = hashBytes(buffer, sourceHash);
+            cacheKey = {"mesh", sourceHash, hashSettings(settings.mesh), GLTF_IMPORTER_VERSION};
+
+            if (std::optional<std::vector<std::byte>> package = settings.cache->load(cacheKey)) {
+                if (std::optional<std::vector<ImportedMesh>> meshes = unpackMeshes(*package)) {
+                    result.meshes = std::move(*meshes);
+                    result.success = true;
+                    stats.cacheHit = true;
+                    accumulateOutputStats(stats, result.meshes);
+                    stats.totalMilliseconds = millisecondsSince(importStart);
+                    GltfImportLogger::record().info("Imported '{}' from cache: {} meshes in {:.2f} ms ({:.1f} MB/s).",
+                                                    path.filename().string(), stats.meshCount, stats.totalMilliseconds, stats.getMegabytesPerSecond());
+                    return result;
+                }
+                GltfImportLogger::record().warn("Cache entry for '{}' is malformed, reimporting.", path.string());
+            }
+        }
+
+        // === Decode every primitive in parallel ===
+        const auto processStart = std::chrono::steady_clock::now();
+        const Json::Value& meshes = document.json["meshes"];
+
+        struct PrimitiveTask {
+            uint32_t mesh;
+            const Json::Value* primitive;
+            std::string error;
+            bool decoded = false;
+        };
+        std::vector<Mesh::SourceMesh> sourceMeshes(meshes.size());
+        std::vector<PrimitiveTask> tasks;
+        for (uint32_t m = 0; m < meshes.size(); m++) {
+            const Json::Value& mesh = meshes[m];
+            sourceMeshes[m].name = mesh.contains("name") ? std::string(mesh["name"].asString()) : "Mesh" + std::to_string(m);
+
+            for (const Json::Value& primitive : mesh["primitives"].asArray()) {
+                if (primitive["mode"].asNumber<uint32_t>(PRIMITIVE_MODE_TRIANGLES) != PRIMITIVE_MODE_TRIANGLES) {
+                    GltfImportLogger::record().warn("Mesh '{}' has a non triangle list primitive, skipping it.", sourceMeshes[m].name);
+                    continue;
+                }
+                tasks.push_back({m, &primitive, {}});
+            }
+        }
+
+        std::vector<Mesh::SourcePrimitive> primitives(tasks.size());
+        jobSystem.parallelFor(static_cast<uint32_t>(tasks.size()), 1, [&](const uint32_t begin, const uint32_t end) {
+            for (uint32_t i = begin; i < end; i++) tasks[i].decoded = decodePrimitive(document, *tasks[i].primitive, primitives[i], tasks[i].error);
+        });
+
+        for (size_t i = 0; i < tasks.size(); i++) {
+            if (!tasks[i].decoded) return fail(path, result, "mesh '" + sourceMeshes[tasks[i].mesh].name + "': " + tasks[i].error);
+            sourceMeshes[tasks[i].mesh].primitives.push_back(std::move(primitives[i]));
+        }
+
+        // === Build blobs in parallel ===
+        result.meshes.resize(sourceMeshes.size());
+        std::vector<Mesh::MeshBuildStats> buildStats(sourceMeshes.size());
+        jobSystem.parallelFor(static_cast<uint32_t>(sourceMeshes.size()), 1, [&](const uint32_t begin, const uint32_t end) {
+            for (uint32_t m = begin; m < end; m++) {
+                result.meshes[m].name = sourceMeshes[m].name;
+                result.meshes[m].blob = Mesh::buildMeshBlob(sourceMeshes[m], settings.mesh, &buildStats[m]);
+            }
+        });
+
+        for (const ImportedMesh& mesh : result.meshes) {
+            if (mesh.blob.empty()) return fail(path, result, "mesh '" + mesh.name + "' could not be built");
+        }
+        stats.processMilliseconds = millisecondsSince(processStart);
+
+        if (settings.cache) settings.cache->store(cacheKey, packMeshes(result.meshes));
+
+        accumulateOutputStats(stats, result.meshes);
+        stats.totalMilliseconds = millisecondsSince(importStart);
+        result.success = true;
+
+        GltfImportLogger::record().info("Imported '{}': {} meshes, {} triangles, {} meshlets, {:.1f} MB in {:.2f} ms ({:.1f} MB/s).",
+                                        path.filename().string(), stats.meshCount, stats.triangleCount, stats.meshletCount,
+                                        static_cast<double>(stats.sourceBytes) / (1024.0 * 1024.0), stats.totalMilliseconds, stats.getMegabytesPerSecond());
+        return result;
+    }
+
+}
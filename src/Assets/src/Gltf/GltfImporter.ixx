@@ -0,0 +1,91 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+export module VKING.Assets.Gltf;
+
+export import VKING.Assets.Mesh;
+export import VKING.Assets.Cache;
+import VKING.JobSystem;
+
+export namespace VKING::Assets {
+
+    /// Bump whenever the importer's output changes, so stale cache entries are not reused
+    constexpr uint32_t GLTF_IMPORTER_VERSION = 1;
+
+    struct GltfImportSettings {
+        Mesh::MeshBuildSettings mesh;
+        /// Runs primitive decoding and mesh building. nullptr uses JobSystem::getDefault()
+        JobSystem* jobSystem = nullptr;
+        /// Checked before importing and filled afterwards. nullptr disables caching
+        const AssetCache* cache = nullptr;
+    };
+
+    struct ImportedMesh {
+        std::string name;
+        /// A blob as produced by Mesh::buildMeshBlob(), readable through Mesh::MeshBlobView
+        std::vector<std::byte> blob;
+    };
+
+    struct GltfImportStats {
+        /// The glTF/GLB file plus every external buffer it references
+        uint64_t sourceBytes = 0;
+        uint64_t outputBytes = 0;
+        uint32_t meshCount = 0;
+        uint32_t primitiveCount = 0;
+        uint64_t vertexCount = 0;
+        uint64_t triangleCount = 0;
+        uint64_t meshletCount = 0;
+        double readMilliseconds = 0.0;
+        double parseMilliseconds = 0.0;
+        double processMilliseconds = 0.0;
+        double totalMilliseconds = 0.0;
+        bool cacheHit = false;
+
+        /// Import throughput measured against the source size
+        [[nodiscard]] double getMegabytesPerSecond() const {
+            return totalMilliseconds > 0.0 ? static_cast<double>(sourceBytes) / (1024.0 * 1024.0) / (totalMilliseconds / 1000.0) : 0.0;
+        }
+    };
+
+    struct GltfImportResult {
+        bool success = false;
+        /// One entry per glTF mesh, in document order
+        std::vector<ImportedMesh> meshes;
+        GltfImportStats stats;
+        std::string error;
+    };
+
+    /**
+     * @brief Imports every mesh of a glTF 2.0 file (.gltf with external or data URI buffers, or binary .glb).
+     *
+     * Only triangle list primitives are imported, other modes are skipped with a warning. Primitives are decoded
+     * and meshes are built in parallel on the job system. Materials, nodes, skins and animations are ignored.
+     */
+    GltfImportResult importGltf(const std::filesystem::path& path, const GltfImportSettings& settings = {});
+
+}
@@ -0,0 +1,427 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+module VKING.Assets.Mesh;
+
+import :Processing;
+import VKING.Log;
+
+namespace VKING::Assets::Mesh {
+
+    using MeshBuildLogger = Log::Named<"MeshBuild">;
+
+    namespace {
+
+        constexpr uint64_t SECTION_ALIGNMENT = 16;
+
+        constexpr uint64_t alignUp(const uint64_t value, const uint64_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        /// Components of each attribute in SourcePrimitive, and the value used where a primitive lacks it
+        constexpr uint32_t ATTRIBUTE_COMPONENTS[VERTEX_ATTRIBUTE_COUNT] = {3, 3, 4, 2, 4};
+        constexpr float ATTRIBUTE_DEFAULTS[VERTEX_ATTRIBUTE_COUNT][4] = {
+            {0.0f, 0.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f, 0.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {0.0f, 0.0f, 0.0f, 0.0f},
+            {1.0f, 1.0f, 1.0f, 1.0f},
+        };
+
+        const std::vector<float>& getAttribute(const SourcePrimitive& primitive, const uint32_t attribute) {
+            switch (static_cast<VertexAttribute>(attribute)) {
+                case VertexAttribute::NORMAL:    return primitive.normals;
+                case VertexAttribute::TANGENT:   return primitive.tangents;
+                case VertexAttribute::TEXCOORD0: return primitive.texcoords;
+                case VertexAttribute::COLOR0:    return primitive.colors;
+                case VertexAttribute::POSITION:
+                default:                         return primitive.positions;
+            }
+        }
+
+        AttributeFormat chooseFormat(const uint32_t attribute, const bool quantize) {
+            switch (static_cast<VertexAttribute>(attribute)) {
+                case VertexAttribute::POSITION:  return quantize ? AttributeFormat::UNORM16X4 : AttributeFormat::FLOAT32X3;
+                case VertexAttribute::NORMAL:    return quantize ? AttributeFormat::SNORM16X2_OCTAHEDRAL : AttributeFormat::FLOAT32X3;
+                case VertexAttribute::TANGENT:   return quantize ? AttributeFormat::SNORM8X4 : AttributeFormat::FLOAT32X4;
+                case VertexAttribute::TEXCOORD0: return quantize ? AttributeFormat::FLOAT16X2 : AttributeFormat::FLOAT32X2;
+                case VertexAttribute::COLOR0:    return quantize ? AttributeFormat::UNORM8X4 : AttributeFormat::FLOAT32X4;
+                default:                         return AttributeFormat::NONE;
+            }
+        }
+
+        /// A primitive after validation, index optimization and vertex reordering
+        struct PreparedPrimitive {
+            std::vector<float> attributes[VERTEX_ATTRIBUTE_COUNT];
+            std::vector<uint32_t> indices;
+            uint32_t vertexCount = 0;
+            uint32_t materialIndex = 0;
+        };
+
+        bool preparePrimitive(const SourcePrimitive& source, const MeshBuildSettings& settings, PreparedPrimitive& prepared, MeshBuildStats& stats) {
+            if (source.positions.size() < 3 || source.positions.size() % 3 != 0) return false;
+            const auto vertexCount = static_cast<uint32_t>(source.positions.size() / 3);
+
+            prepared.indices.assign(source.indices.begin(), source.indices.begin() + static_cast<std::ptrdiff_t>(source.indices.size() / 3 * 3));
+            if (std::ranges::any_of(prepared.indices, [vertexCount](const uint32_t index) { return index >= vertexCount; })) {
+                MeshBuildLogger::record().error("Primitive references vertices beyond its {} vertices, skipping it.", vertexCount);
+                return false;
+            }
+            if (prepared.indices.empty()) return false;
+
+            stats.acmrBefore += Processing::computeACMR(prepared.indices, vertexCount) * static_cast<double>(prepared.indices.size() / 3);
+            if (settings.optimizeVertexCache) Processing::optimizeVertexCache(prepared.indices, vertexCount);
+
+            std::vector<uint32_t> remap;
+            prepared.vertexCount = vertexCount;
+            if (settings.optimizeVertexFetch) remap = Processing::optimizeVertexFetch(prepared.indices, vertexCount, prepared.vertexCount);
+            stats.acmrAfter += Processing::computeACMR(prepared.indices, prepared.vertexCount) * static_cast<double>(prepared.indices.size() / 3);
+
+            for (uint32_t attribute = 0; attribute < VERTEX_ATTRIBUTE_COUNT; attribute++) {
+                const std::vector<float>& input = getAttribute(source, attribute);
+                const uint32_t components = ATTRIBUTE_COMPONENTS[attribute];
+                if (input.empty()) continue;
+                if (input.size() != static_cast<size_t>(vertexCount) * components) {
+                    MeshBuildLogger::record().warn("Attribute {} has {} values, expected {}. Ignoring it.", attribute, input.size(), vertexCount * components);
+                    continue;
+                }
+
+                std::vector<float>& output = prepared.attributes[attribute];
+                if (remap.empty()) {
+                    output = input;
+                    continue;
+                }
+                output.resize(static_cast<size_t>(prepared.vertexCount) * components);
+                for (uint32_t v = 0; v < vertexCount; v++) {
+                    if (remap[v] == UINT32_MAX) continue;
+                    std::memcpy(&output[static_cast<size_t>(remap[v]) * components], &input[static_cast<size_t>(v) * components], components * sizeof(float));
+                }
+            }
+
+            prepared.materialIndex = source.materialIndex;
+            return true;
+        }
+
+        void encodeAttribute(const AttributeFormat format, const float* value, const MeshBlobHeader& header, std::byte* output) {
+            switch (format) {
+                case AttributeFormat::FLOAT32X2: std::memcpy(output, value, 8); break;
+                case AttributeFormat::FLOAT32X3: std::memcpy(output, value, 12); break;
+                case AttributeFormat::FLOAT32X4: std::memcpy(output, value, 16); break;
+                case AttributeFormat::UNORM16X4: {
+                    uint16_t quantized[4] = {0, 0, 0, 0};
+                    for (uint32_t axis = 0; axis < 3; axis++) {
+                        const float scale = header.positionScale[axis];
+                        const float normalized = scale > 0.0f ? (value[axis] - header.positionOffset[axis]) / scale : 0.0f;
+                        quantized[axis] = static_cast<uint16_t>(std::clamp(std::lround(normalized), 0l, 65535l));
+                    }
+                    std::memcpy(output, quantized, sizeof(quantized));
+                    break;
+                }
+                case AttributeFormat::SNORM16X2_OCTAHEDRAL: {
+                    int16_t encoded[2];
+                    Processing::encodeOctahedral(value, encoded);
+                    std::memcpy(output, encoded, sizeof(encoded));
+                    break;
+                }
+                case AttributeFormat::SNORM8X4: {
+                    const float length = std::sqrt(value[0] * value[0] + value[1] * value[1] + value[2] * value[2]);
+                    const float inverse = length > 0.0f ? 1.0f / length : 0.0f;
+                    const int8_t encoded[4] = {Processing::toSnorm8(value[0] * inverse), Processing::toSnorm8(value[1] * inverse),
+                                               Processing::toSnorm8(value[2] * inverse), static_cast<int8_t>(value[3] < 0.0f ? -127 : 127)};
+                    std::memcpy(output, encoded, sizeof(encoded));
+                    break;
+                }
+                case AttributeFormat::FLOAT16X2: {
+                    const uint16_t encoded[2] = {Processing::floatToHalf(value[0]), Processing::floatToHalf(value[1])};
+                    std::memcpy(output, encoded, sizeof(encoded));
+                    break;
+                }
+                case AttributeFormat::UNORM8X4: {
+                    const uint8_t encoded[4] = {Processing::toUnorm8(value[0]), Processing::toUnorm8(value[1]),
+                                                Processing::toUnorm8(value[2]), Processing::toUnorm8(value[3])};
+                    std::memcpy(output, encoded, sizeof(encoded));
+                    break;
+                }
+                default: break;
+            }
+        }
+
+    }
+
+    std::vector<std::byte> buildMeshBlob(const SourceMesh& mesh, const MeshBuildSettings& settings, MeshBuildStats* stats) {
+        MeshBuildStats localStats;
+
+        std::vector<PreparedPrimitive> primitives;
+        primitives.reserve(mesh.primitives.size());
+        for (const SourcePrimitive& source : mesh.primitives) {
+            PreparedPrimitive prepared;
+            if (preparePrimitive(source, settings, prepared, localStats)) primitives.push_back(std::move(prepared));
+        }
+        if (primitives.empty()) {
+            MeshBuildLogger::record().error("Mesh '{}' has no valid triangles.", mesh.name);
+            return {};
+        }
+
+        // === Gather everything into mesh wide arrays ===
+        MeshBlobHeader header{};
+        header.magic = MESH_BLOB_MAGIC;
+        header.version = MESH_BLOB_VERSION;
+        header.layout = static_cast<uint32_t>(settings.layout);
+
+        bool present[VERTEX_ATTRIBUTE_COUNT] = {};
+        for (const PreparedPrimitive& primitive : primitives) {
+            header.vertexCount += primitive.vertexCount;
+            header.indexCount += static_cast<uint32_t>(primitive.indices.size());
+            for (uint32_t attribute = 0; attribute < VERTEX_ATTRIBUTE_COUNT; attribute++) present[attribute] |= !primitive.attributes[attribute].empty();
+        }
+        header.indexSize = header.vertexCount <= 0xFFFF ? 2 : 4;
+
+        for (uint32_t axis = 0; axis < 3; axis++) {
+            header.boundsMin[axis] = std::numeric_limits<float>::max();
+            header.boundsMax[axis] = std::numeric_limits<float>::lowest();
+        }
+
+        std::vector<SubmeshRecord> submeshes;
+        std::vector<uint32_t> indices;
+        std::vector<Processing::Meshlet> meshlets;
+        std::vector<uint32_t> meshletVertices;
+        std::vector<uint8_t> meshletTriangles;
+        indices.reserve(header.indexCount);
+
+        uint32_t baseVertex = 0;
+        for (const PreparedPrimitive& primitive : primitives) {
+            SubmeshRecord submesh{};
+            submesh.firstIndex = static_cast<uint32_t>(indices.size());
+            submesh.indexCount = static_cast<uint32_t>(primitive.indices.size());
+            submesh.firstVertex = baseVertex;
+            submesh.vertexCount = primitive.vertexCount;
+            submesh.materialIndex = primitive.materialIndex;
+
+            const std::vector<float>& positions = primitive.attributes[static_cast<uint32_t>(VertexAttribute::POSITION)];
+            for (uint32_t axis = 0; axis < 3; axis++) {
+                submesh.boundsMin[axis] = std::numeric_limits<float>::max();
+                submesh.boundsMax[axis] = std::numeric_limits<float>::lowest();
+            }
+            for (size_t v = 0; v < primitive.vertexCount; v++) {
+                for (uint32_t axis = 0; axis < 3; axis++) {
+                    submesh.boundsMin[axis] = std::min(submesh.boundsMin[axis], positions[v * 3 + axis]);
+                    submesh.boundsMax[axis] = std::max(submesh.boundsMax[axis], positions[v * 3 + axis]);
+                }
+            }
+            for (uint32_t axis = 0; axis < 3; axis++) {
+                header.boundsMin[axis] = std::min(header.boundsMin[axis], submesh.boundsMin[axis]);
+                header.boundsMax[axis] = std::max(header.boundsMax[axis], submesh.boundsMax[axis]);
+            }
+
+            for (const uint32_t index : primitive.indices) indices.push_back(index + baseVertex);
+
+            if (settings.buildMeshlets) {
+                submesh.firstMeshlet = static_cast<uint32_t>(meshlets.size());
+                const size_t firstMeshletVertex = meshletVertices.size();
+                Processing::buildMeshlets(primitive.indices, positions, primitive.vertexCount,
+                                          std::clamp(settings.maxMeshletVertices, 3u, 255u), std::clamp(settings.maxMeshletTriangles, 1u, 255u),
+                                          meshlets, meshletVertices, meshletTriangles);
+                for (size_t i = firstMeshletVertex; i < meshletVertices.size(); i++) meshletVertices[i] += baseVertex;
+                submesh.meshletCount = static_cast<uint32_t>(meshlets.size()) - submesh.firstMeshlet;
+            }
+
+            submeshes.push_back(submesh);
+            baseVertex += primitive.vertexCount;
+        }
+
+        header.submeshCount = static_cast<uint32_t>(submeshes.size());
+        header.meshletCount = static_cast<uint32_t>(meshlets.size());
+        header.meshletVertexCount = static_cast<uint32_t>(meshletVertices.size());
+        header.meshletTriangleBytes = static_cast<uint32_t>(meshletTriangles.size());
+        for (uint32_t axis = 0; axis < 3; axis++) {
+            header.positionOffset[axis] = header.boundsMin[axis];
+            header.positionScale[axis] = (header.boundsMax[axis] - header.boundsMin[axis]) / 65535.0f;
+        }
+
+        // === Vertex stream layout ===
+        uint32_t interleavedStride = 0;
+        for (uint32_t attribute = 0; attribute < VERTEX_ATTRIBUTE_COUNT; attribute++) {
+            if (!present[attribute]) continue;
+            const AttributeFormat format = chooseFormat(attribute, settings.quantize);
+            header.attributeFormats[attribute] = static_cast<uint32_t>(format);
+            if (settings.layout == StreamLayout::INTERLEAVED) {
+                header.attributeStreams[attribute] = 0;
+                header.attributeOffsets[attribute] = interleavedStride;
+                interleavedStride += getAttributeFormatSize(format);
+            } else {
+                header.attributeStreams[attribute] = header.streamCount;
+                header.attributeOffsets[attribute] = 0;
+                header.streamStrides[header.streamCount++] = getAttributeFormatSize(format);
+            }
+        }
+        if (settings.layout == StreamLayout::INTERLEAVED) {
+            header.streamCount = 1;
+            header.streamStrides[0] = interleavedStride;
+        }
+
+        uint64_t cursor = alignUp(sizeof(MeshBlobHeader), SECTION_ALIGNMENT);
+        auto place = [&cursor](const uint64_t bytes) {
+            const uint64_t offset = cursor;
+            cursor = alignUp(cursor + bytes, SECTION_ALIGNMENT);
+            return offset;
+        };
+        for (uint32_t stream = 0; stream < header.streamCount; stream++) {
+            header.streamOffsets[stream] = place(static_cast<uint64_t>(header.streamStrides[stream]) * header.vertexCount);
+        }
+        header.indexOffset = place(static_cast<uint64_t>(header.indexSize) * header.indexCount);
+        header.submeshOffset = place(sizeof(SubmeshRecord) * submeshes.size());
+        header.meshletOffset = place(sizeof(MeshletRecord) * meshlets.size());
+        header.meshletVertexOffset = place(sizeof(uint32_t) * meshletVertices.size());
+        header.meshletTriangleOffset = place(meshletTriangles.size());
+        header.totalSize = cursor;
+
+        // === Write ===
+        std::vector<std::byte> blob(header.totalSize);
+        std::memcpy(blob.data(), &header, sizeof(header));
+
+        uint32_t vertex = 0;
+        for (const PreparedPrimitive& primitive : primitives) {
+            for (uint32_t attribute = 0; attribute < VERTEX_ATTRIBUTE_COUNT; attribute++) {
+                if (!present[attribute]) continue;
+                const auto format = static_cast<AttributeFormat>(header.attributeFormats[attribute]);
+                const uint32_t stream = header.attributeStreams[attribute];
+                const uint32_t stride = header.streamStrides[stream];
+                const uint32_t components = ATTRIBUTE_COMPONENTS[attribute];
+                std::byte* output = blob.data() + header.streamOffsets[stream] + header.attributeOffsets[attribute] + static_cast<uint64_t>(vertex) * stride;
+                const std::vector<float>& values = primitive.attributes[attribute];
+
+                for (uint32_t v = 0; v < primitive.vertexCount; v++, output += stride) {
+                    const float* value = values.empty() ? ATTRIBUTE_DEFAULTS[attribute] : &values[static_cast<size_t>(v) * components];
+                    encodeAttribute(format, value, header, output);
+                }
+            }
+            vertex += primitive.vertexCount;
+        }
+
+        if (header.indexSize == 2) {
+            auto* output = reinterpret_cast<uint16_t*>(blob.data() + header.indexOffset);
+            for (size_t i = 0; i < indices.size(); i++) output[i] = static_cast<uint16_t>(indices[i]);
+        } else {
+            std::memcpy(blob.data() + header.indexOffset, indices.data(), indices.size() * sizeof(uint32_t));
+        }
+
+        std::memcpy(blob.data() + header.submeshOffset, submeshes.data(), submeshes.size() * sizeof(SubmeshRecord));
+
+        auto* meshletOutput = reinterpret_cast<MeshletRecord*>(blob.data() + header.meshletOffset);
+        for (size_t m = 0; m < meshlets.size(); m++) {
+            const Processing::Meshlet& meshlet = meshlets[m];
+            MeshletRecord record{};
+            record.vertexOffset = meshlet.vertexOffset;
+            record.triangleOffset = meshlet.triangleOffset;
+            record.vertexCount = static_cast<uint8_t>(meshlet.vertexCount);
+            record.triangleCount = static_cast<uint8_t>(meshlet.triangleCount);
+            std::memcpy(record.center, meshlet.center, sizeof(record.center));
+            record.radius = meshlet.radius;
+            std::memcpy(record.coneApex, meshlet.coneApex, sizeof(record.coneApex));
+            std::memcpy(record.coneAxis, meshlet.coneAxis, sizeof(record.coneAxis));
+            record.coneCutoff = meshlet.coneCutoff;
+            meshletOutput[m] = record;
+        }
+        std::memcpy(blob.data() + header.meshletVertexOffset, meshletVertices.data(), meshletVertices.size() * sizeof(uint32_t));
+        std::memcpy(blob.data() + header.meshletTriangleOffset, meshletTriangles.data(), meshletTriangles.size());
+
+        localStats.vertexCount = header.vertexCount;
+        localStats.triangleCount = header.indexCount / 3;
+        localStats.meshletCount = header.meshletCount;
+        localStats.acmrBefore /= static_cast<double>(localStats.triangleCount);
+        localStats.acmrAfter /= static_cast<double>(localStats.triangleCount);
+        if (stats) *stats = localStats;
+
+        MeshBuildLogger::record().trace("Built mesh '{}': {} vertices, {} triangles, {} meshlets, ACMR {:.3f} -> {:.3f}, {} bytes.",
+                                        mesh.name, localStats.vertexCount, localStats.triangleCount, localStats.meshletCount,
+                                        localStats.acmrBefore, localStats.acmrAfter, blob.size());
+        return blob;
+    }
+
+    // === MeshBlobView ===
+
+    MeshBlobView::MeshBlobView(const std::span<const std::byte> blob)
+        : m_Blob(blob), m_Header(reinterpret_cast<const MeshBlobHeader*>(blob.data())) {
+    }
+
+    std::optional<MeshBlobView> MeshBlobView::create(const std::span<const std::byte> blob) {
+        if (blob.size() < sizeof(MeshBlobHeader) || reinterpret_cast<uintptr_t>(blob.data()) % alignof(MeshBlobHeader) != 0) return std::nullopt;
+
+        const auto& header = *reinterpret_cast<const MeshBlobHeader*>(blob.data());
+        if (header.magic != MESH_BLOB_MAGIC || header.version != MESH_BLOB_VERSION || header.totalSize > blob.size()
+            || (header.indexSize != 2 && header.indexSize != 4) || header.streamCount > VERTEX_ATTRIBUTE_COUNT) {
+            return std::nullopt;
+        }
+
+        auto fits = [&header](const uint64_t offset, const uint64_t bytes) {
+            return offset <= header.totalSize && header.totalSize - offset >= bytes;
+        };
+        for (uint32_t stream = 0; stream < header.streamCount; stream++) {
+            if (!fits(header.streamOffsets[stream], static_cast<uint64_t>(header.streamStrides[stream]) * header.vertexCount)) return std::nullopt;
+        }
+        if (!fits(header.indexOffset, static_cast<uint64_t>(header.indexSize) * header.indexCount)
+            || !fits(header.submeshOffset, sizeof(SubmeshRecord) * static_cast<uint64_t>(header.submeshCount))
+            || !fits(header.meshletOffset, sizeof(MeshletRecord) * static_cast<uint64_t>(header.meshletCount))
+            || !fits(header.meshletVertexOffset, sizeof(uint32_t) * static_cast<uint64_t>(header.meshletVertexCount))
+            || !fits(header.meshletTriangleOffset, header.meshletTriangleBytes)) {
+            return std::nullopt;
+        }
+
+        return MeshBlobView(blob.first(header.totalSize));
+    }
+
+    std::span<const std::byte> MeshBlobView::getStream(const uint32_t stream) const {
+        if (stream >= m_Header->streamCount) return {};
+        return m_Blob.subspan(m_Header->streamOffsets[stream], static_cast<size_t>(m_Header->streamStrides[stream]) * m_Header->vertexCount);
+    }
+
+    std::span<const std::byte> MeshBlobView::getIndices() const {
+        return m_Blob.subspan(m_Header->indexOffset, static_cast<size_t>(m_Header->indexSize) * m_Header->indexCount);
+    }
+
+    std::span<const SubmeshRecord> MeshBlobView::getSubmeshes() const {
+        return {reinterpret_cast<const SubmeshRecord*>(m_Blob.data() + m_Header->submeshOffset), m_Header->submeshCount};
+    }
+
+    std::span<const MeshletRecord> MeshBlobView::getMeshlets() const {
+        return {reinterpret_cast<const MeshletRecord*>(m_Blob.data() + m_Header->meshletOffset), m_Header->meshletCount};
+    }
+
+    std::span<const uint32_t> MeshBlobView::getMeshletVertices() const {
+        return {reinterpret_cast<const uint32_t*>(m_Blob.data() + m_Header->meshletVertexOffset), m_Header->meshletVertexCount};
+    }
+
+    std::span<const uint8_t> MeshBlobView::getMeshletTriangles() const {
+        return {reinterpret_cast<const uint8_t*>(m_Blob.data() + m_Header->meshletTriangleOffset), m_Header->meshletTriangleBytes};
+    }
+
+}
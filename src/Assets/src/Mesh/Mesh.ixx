@@ -0,0 +1,241 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+export module VKING.Assets.Mesh;
+
+export namespace VKING::Assets::Mesh {
+
+    enum class VertexAttribute : uint32_t {
+        POSITION,
+        NORMAL,
+        TANGENT,
+        TEXCOORD0,
+        COLOR0
+    };
+
+    constexpr uint32_t VERTEX_ATTRIBUTE_COUNT = 5;
+
+    /**
+     * @brief Storage format of one vertex attribute in a mesh blob.
+     *
+     * Quantized formats map directly onto Vulkan vertex input formats:
+     * - UNORM16X4: position relative to the mesh bounds, dequantized with MeshBlobHeader::positionScale/positionOffset
+     * - SNORM16X2_OCTAHEDRAL: unit vector in octahedral encoding
+     * - SNORM8X4: tangent xyz with the bitangent sign in w
+     * - FLOAT16X2: texture coordinates
+     * - UNORM8X4: vertex color
+     */
+    enum class AttributeFormat : uint32_t {
+        NONE,
+        FLOAT32X2,
+        FLOAT32X3,
+        FLOAT32X4,
+        UNORM16X4,
+        SNORM16X2_OCTAHEDRAL,
+        SNORM8X4,
+        FLOAT16X2,
+        UNORM8X4
+    };
+
+    constexpr uint32_t getAttributeFormatSize(const AttributeFormat format) {
+        switch (format) {
+            case AttributeFormat::FLOAT32X2: return 8;
+            case AttributeFormat::FLOAT32X3: return 12;
+            case AttributeFormat::FLOAT32X4: return 16;
+            case AttributeFormat::UNORM16X4: return 8;
+            case AttributeFormat::SNORM16X2_OCTAHEDRAL:
+            case AttributeFormat::SNORM8X4:
+            case AttributeFormat::FLOAT16X2:
+            case AttributeFormat::UNORM8X4: return 4;
+            default: return 0;
+        }
+    }
+
+    /**
+     * @brief How vertex attributes are split into vertex buffers.
+     *
+     * - INTERLEAVED: one stream, every attribute of a vertex adjacent. Best when every pass reads every attribute.
+     * - SPLIT: one stream per attribute. Depth and shadow passes then only fetch positions.
+     */
+    enum class StreamLayout : uint32_t {
+        INTERLEAVED,
+        SPLIT
+    };
+
+    struct MeshBuildSettings {
+        StreamLayout layout = StreamLayout::SPLIT;
+        /// Store attributes in the compact formats listed on AttributeFormat instead of 32 bit floats
+        bool quantize = true;
+        /// Reorder triangles for the post-transform vertex cache
+        bool optimizeVertexCache = true;
+        /// Reorder vertices into first use order, which also drops unreferenced vertices
+        bool optimizeVertexFetch = true;
+        bool buildMeshlets = true;
+        uint32_t maxMeshletVertices = 64;
+        uint32_t maxMeshletTriangles = 124;
+    };
+
+    /**
+     * @brief One primitive as decoded from a source file, in plain float arrays.
+     *
+     * Only positions are required. Optional attributes are either empty or have one element per vertex.
+     */
+    struct SourcePrimitive {
+        std::vector<float> positions;   // xyz
+        std::vector<float> normals;     // xyz
+        std::vector<float> tangents;    // xyzw
+        std::vector<float> texcoords;   // uv
+        std::vector<float> colors;      // rgba
+        std::vector<uint32_t> indices;  // triangle list, generated if the source had none
+        uint32_t materialIndex = 0;
+    };
+
+    struct SourceMesh {
+        std::string name;
+        std::vector<SourcePrimitive> primitives;
+    };
+
+    // === Blob layout ===
+    // A blob is one allocation: MeshBlobHeader, then every section at the offset the header gives,
+    // 16 byte aligned. All offsets are from the start of the blob, so it can be uploaded or mapped as is.
+
+    constexpr uint32_t MESH_BLOB_MAGIC = 0x534D4B56; // "VKMS"
+    constexpr uint32_t MESH_BLOB_VERSION = 1;
+
+    struct MeshBlobHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t totalSize;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        /// 2 or 4 bytes per index
+        uint32_t indexSize;
+        uint32_t layout;
+        uint32_t submeshCount;
+        uint32_t meshletCount;
+        uint32_t meshletVertexCount;
+        uint32_t meshletTriangleBytes;
+        float boundsMin[3];
+        float boundsMax[3];
+        float positionScale[3];
+        float positionOffset[3];
+        uint32_t attributeFormats[VERTEX_ATTRIBUTE_COUNT];
+        uint32_t attributeStreams[VERTEX_ATTRIBUTE_COUNT];
+        uint32_t attributeOffsets[VERTEX_ATTRIBUTE_COUNT];
+        uint32_t streamCount;
+        uint32_t streamStrides[VERTEX_ATTRIBUTE_COUNT];
+        uint64_t streamOffsets[VERTEX_ATTRIBUTE_COUNT];
+        uint64_t indexOffset;
+        uint64_t submeshOffset;
+        uint64_t meshletOffset;
+        uint64_t meshletVertexOffset;
+        uint64_t meshletTriangleOffset;
+    };
+
+    struct SubmeshRecord {
+        uint32_t firstIndex;
+        uint32_t indexCount;
+        uint32_t firstVertex;
+        uint32_t vertexCount;
+        uint32_t firstMeshlet;
+        uint32_t meshletCount;
+        uint32_t materialIndex;
+        uint32_t reserved;
+        float boundsMin[3];
+        float boundsMax[3];
+    };
+
+    /**
+     * @brief A small cluster of triangles for mesh shading and cluster culling.
+     *
+     * Vertices are indices into the mesh's vertex buffers, stored in the meshlet vertex section starting at
+     * vertexOffset. Triangles are three uint8 indices into that local vertex list each, starting at byte
+     * triangleOffset of the meshlet triangle section.
+     *
+     * The cone allows backface culling a whole meshlet: it faces away from a camera at position p if
+     * dot(normalize(coneApex - p), coneAxis) >= coneCutoff.
+     */
+    struct MeshletRecord {
+        uint32_t vertexOffset;
+        uint32_t triangleOffset;
+        uint8_t vertexCount;
+        uint8_t triangleCount;
+        uint16_t reserved;
+        float center[3];
+        float radius;
+        float coneApex[3];
+        float coneAxis[3];
+        float coneCutoff;
+    };
+
+    struct MeshBuildStats {
+        uint32_t vertexCount = 0;
+        uint32_t triangleCount = 0;
+        uint32_t meshletCount = 0;
+        /// Average cache miss ratio (transformed vertices per triangle, 32 entry FIFO) before and after optimization
+        double acmrBefore = 0.0;
+        double acmrAfter = 0.0;
+    };
+
+    /**
+     * @brief Converts a decoded mesh into a GPU-ready blob.
+     *
+     * Every primitive becomes a submesh sharing the blob's vertex and index buffers. Indices are absolute,
+     * 16 bit when the whole mesh has at most 65535 vertices.
+     *
+     * @return The blob, or an empty vector if the mesh has no valid triangles
+     */
+    std::vector<std::byte> buildMeshBlob(const SourceMesh& mesh, const MeshBuildSettings& settings, MeshBuildStats* stats = nullptr);
+
+    /**
+     * @brief Validated read access to a mesh blob.
+     */
+    class MeshBlobView {
+    public:
+        /**
+         * @return A view of the blob, or std::nullopt if the data is not a complete mesh blob of this version
+         */
+        static std::optional<MeshBlobView> create(std::span<const std::byte> blob);
+
+        [[nodiscard]] const MeshBlobHeader& getHeader() const { return *m_Header; }
+        [[nodiscard]] std::span<const std::byte> getStream(uint32_t stream) const;
+        [[nodiscard]] std::span<const std::byte> getIndices() const;
+        [[nodiscard]] std::span<const SubmeshRecord> getSubmeshes() const;
+        [[nodiscard]] std::span<const MeshletRecord> getMeshlets() const;
+        [[nodiscard]] std::span<const uint32_t> getMeshletVertices() const;
+        [[nodiscard]] std::span<const uint8_t> getMeshletTriangles() const;
+
+    private:
+        explicit MeshBlobView(std::span<const std::byte> blob);
+
+        std::span<const std::byte> m_Blob;
+        const MeshBlobHeader* m_Header;
+    };
+
+}
@@ -0,0 +1,416 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+module VKING.Assets.Mesh:Processing;
+
+namespace VKING::Assets::Mesh::Processing {
+
+    // === Index order ===
+
+    /// FIFO size used for ACMR statistics, close to what current GPUs effectively reuse
+    constexpr uint32_t STATISTICS_CACHE_SIZE = 32;
+
+    /**
+     * @brief Average cache miss ratio of a triangle list with a FIFO post-transform cache. 0.5 is the ideal
+     *        for regular grids, 3.0 means no reuse at all.
+     */
+    inline double computeACMR(const std::span<const uint32_t> indices, const uint32_t vertexCount, const uint32_t cacheSize = STATISTICS_CACHE_SIZE) {
+        if (indices.size() < 3) return 0.0;
+
+        std::vector<uint32_t> insertedAt(vertexCount, 0);
+        uint32_t timestamp = cacheSize + 1;
+        uint32_t misses = 0;
+        for (const uint32_t index : indices) {
+            if (timestamp - insertedAt[index] > cacheSize) {
+                insertedAt[index] = timestamp++;
+                misses++;
+            }
+        }
+        return static_cast<double>(misses) / static_cast<double>(indices.size() / 3);
+    }
+
+    /**
+     * @brief Reorders triangles for vertex reuse (Tom Forsyth, "Linear-Speed Vertex Cache Optimisation").
+     *
+     * Each step emits the best scoring triangle among those using a vertex in the simulated LRU cache.
+     * Vertex scores favour recently used vertices and vertices with few remaining triangles, so the
+     * order sweeps across the mesh instead of leaving isolated triangles behind.
+     */
+    inline void optimizeVertexCache(std::span<uint32_t> indices, const uint32_t vertexCount) {
+        constexpr uint32_t CACHE_SIZE = 32;
+        constexpr float CACHE_DECAY_POWER = 1.5f;
+        constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+        constexpr float VALENCE_BOOST_SCALE = 2.0f;
+        constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+        const auto triangleCount = static_cast<uint32_t>(indices.size() / 3);
+        if (triangleCount < 2) return;
+
+        // precomputed score tables, valence beyond the table is treated as the last entry
+        constexpr uint32_t MAX_VALENCE = 64;
+        float cacheScores[CACHE_SIZE];
+        for (uint32_t position = 0; position < CACHE_SIZE; position++) {
+            cacheScores[position] = position < 3
+                                        ? LAST_TRIANGLE_SCORE
+                                        : std::pow(1.0f - static_cast<float>(position - 3) / static_cast<float>(CACHE_SIZE - 3), CACHE_DECAY_POWER);
+        }
+        float valenceScores[MAX_VALENCE + 1];
+        valenceScores[0] = 0.0f;
+        for (uint32_t valence = 1; valence <= MAX_VALENCE; valence++) {
+            valenceScores[valence] = VALENCE_BOOST_SCALE * std::pow(static_cast<float>(valence), -VALENCE_BOOST_POWER);
+        }
+
+        // vertex -> triangle adjacency in CSR form
+        std::vector<uint32_t> triangleOffsets(vertexCount + 1, 0);
+        for (const uint32_t index : indices) triangleOffsets[index + 1]++;
+        for (uint32_t v = 0; v < vertexCount; v++) triangleOffsets[v + 1] += triangleOffsets[v];
+        std::vector<uint32_t> adjacency(indices.size());
+        std::vector<uint32_t> remaining(vertexCount, 0);
+        for (uint32_t t = 0; t < triangleCount; t++) {
+            for (uint32_t corner = 0; corner < 3; corner++) {
+                const uint32_t v = indices[t * 3 + corner];
+                adjacency[triangleOffsets[v] + remaining[v]++] = t;
+            }
+        }
+
+        std::vector<int32_t> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScores(vertexCount);
+        auto scoreVertex = [&](const uint32_t v) {
+            if (remaining[v] == 0) return -1.0f;
+            const float cacheScore = cachePosition[v] >= 0 ? cacheScores[cachePosition[v]] : 0.0f;
+            return cacheScore + valenceScores[std::min(remaining[v], MAX_VALENCE)];
+        };
+        for (uint32_t v = 0; v < vertexCount; v++) vertexScores[v] = scoreVertex(v);
+
+        std::vector<float> triangleScores(triangleCount);
+        std::vector<uint8_t> emitted(triangleCount, 0);
+        for (uint32_t t = 0; t < triangleCount; t++) {
+            triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+        }
+
+        std::vector<uint32_t> output;
+        output.reserve(indices.size());
+        uint32_t cache[CACHE_SIZE + 3];
+        uint32_t cacheCount = 0;
+        uint32_t scanCursor = 0;
+
+        auto bestTriangle = static_cast<uint32_t>(std::max_element(triangleScores.begin(), triangleScores.end()) - triangleScores.begin());
+        while (bestTriangle != UINT32_MAX) {
+            emitted[bestTriangle] = 1;
+            const uint32_t* triangle = &indices[bestTriangle * 3];
+            output.insert(output.end(), triangle, triangle + 3);
+
+            // move the triangle's vertices to the front of the cache, everything else shifts back
+            uint32_t newCache[CACHE_SIZE + 3];
+            uint32_t newCount = 0;
+            for (uint32_t corner = 0; corner < 3; corner++) newCache[newCount++] = triangle[corner];
+            for (uint32_t i = 0; i < cacheCount; i++) {
+                const uint32_t v = cache[i];
+                if (v != triangle[0] && v != triangle[1] && v != triangle[2]) newCache[newCount++] = v;
+            }
+
+            // retire the triangle from its vertices' adjacency
+            for (uint32_t corner = 0; corner < 3; corner++) {
+                const uint32_t v = triangle[corner];
+                uint32_t* list = &adjacency[triangleOffsets[v]];
+                for (uint32_t i = 0; i < remaining[v]; i++) {
+                    if (list[i] == bestTriangle) {
+                        list[i] = list[remaining[v] - 1];
+                        remaining[v]--;
+                        break;
+                    }
+                }
+            }
+
+            // vertices falling out of the cache lose their cache score
+            for (uint32_t i = CACHE_SIZE; i < newCount; i++) cachePosition[newCache[i]] = -1;
+            cacheCount = std::min(newCount, CACHE_SIZE);
+            for (uint32_t i = 0; i < cacheCount; i++) {
+                cache[i] = newCache[i];
+                cachePosition[cache[i]] = static_cast<int32_t>(i);
+            }
+
+            // rescore everything that was touched and pick the best triangle around the cache
+            float bestScore = -1.0f;
+            bestTriangle = UINT32_MAX;
+            for (uint32_t i = 0; i < newCount; i++) {
+                const uint32_t v = newCache[i];
+                const float oldScore = vertexScores[v];
+                vertexScores[v] = scoreVertex(v);
+                const float delta = vertexScores[v] - oldScore;
+                for (uint32_t a = 0; a < remaining[v]; a++) {
+                    const uint32_t t = adjacency[triangleOffsets[v] + a];
+                    triangleScores[t] += delta;
+                    if (triangleScores[t] > bestScore) {
+                        bestScore = triangleScores[t];
+                        bestTriangle = t;
+                    }
+                }
+            }
+
+            // nothing adjacent left, continue with the next unemitted triangle in input order
+            if (bestTriangle == UINT32_MAX) {
+                while (scanCursor < triangleCount && emitted[scanCursor]) scanCursor++;
+                if (scanCursor < triangleCount) bestTriangle = scanCursor;
+            }
+        }
+
+        std::ranges::copy(output, indices.begin());
+    }
+
+    /**
+     * @brief Renumbers vertices in order of first use so vertex fetch walks memory linearly.
+     *
+     * @return Old to new vertex index. Unreferenced vertices map to UINT32_MAX and are dropped
+     */
+    inline std::vector<uint32_t> optimizeVertexFetch(std::span<uint32_t> indices, const uint32_t vertexCount, uint32_t& newVertexCount) {
+        std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+        newVertexCount = 0;
+        for (uint32_t& index : indices) {
+            if (remap[index] == UINT32_MAX) remap[index] = newVertexCount++;
+            index = remap[index];
+        }
+        return remap;
+    }
+
+    // === Meshlets ===
+
+    struct Meshlet {
+        uint32_t vertexOffset;
+        uint32_t triangleOffset;
+        uint32_t vertexCount;
+        uint32_t triangleCount;
+        float center[3];
+        float radius;
+        float coneApex[3];
+        float coneAxis[3];
+        float coneCutoff;
+    };
+
+    inline void computeMeshletBounds(Meshlet& meshlet, const std::span<const uint32_t> meshletVertices, const std::span<const uint8_t> meshletTriangles,
+                                     const std::span<const float> positions) {
+        auto position = [&](const uint32_t local, const uint32_t axis) {
+            return positions[meshletVertices[meshlet.vertexOffset + local] * 3 + axis];
+        };
+
+        // bounding sphere around the AABB center, cheap and within a few percent of optimal for meshlets
+        float minimum[3] = {position(0, 0), position(0, 1), position(0, 2)};
+        float maximum[3] = {minimum[0], minimum[1], minimum[2]};
+        for (uint32_t v = 1; v < meshlet.vertexCount; v++) {
+            for (uint32_t axis = 0; axis < 3; axis++) {
+                minimum[axis] = std::min(minimum[axis], position(v, axis));
+                maximum[axis] = std::max(maximum[axis], position(v, axis));
+            }
+        }
+        float radiusSquared = 0.0f;
+        for (uint32_t axis = 0; axis < 3; axis++) meshlet.center[axis] = (minimum[axis] + maximum[axis]) * 0.5f;
+        for (uint32_t v = 0; v < meshlet.vertexCount; v++) {
+            float distanceSquared = 0.0f;
+            for (uint32_t axis = 0; axis < 3; axis++) {
+                const float d = position(v, axis) - meshlet.center[axis];
+                distanceSquared += d * d;
+            }
+            radiusSquared = std::max(radiusSquared, distanceSquared);
+        }
+        meshlet.radius = std::sqrt(radiusSquared);
+
+        // normal cone: average of the triangle normals, cutoff from the widest deviation
+        std::vector<float> normals(static_cast<size_t>(meshlet.triangleCount) * 3, 0.0f);
+        float axis[3] = {0.0f, 0.0f, 0.0f};
+        for (uint32_t t = 0; t < meshlet.triangleCount; t++) {
+            const uint8_t* triangle = &meshletTriangles[meshlet.triangleOffset + t * 3];
+            float edge0[3], edge1[3];
+            for (uint32_t c = 0; c < 3; c++) {
+                edge0[c] = position(triangle[1], c) - position(triangle[0], c);
+                edge1[c] = position(triangle[2], c) - position(triangle[0], c);
+            }
+            float normal[3] = {edge0[1] * edge1[2] - edge0[2] * edge1[1],
+                               edge0[2] * edge1[0] - edge0[0] * edge1[2],
+                               edge0[0] * edge1[1] - edge0[1] * edge1[0]};
+            const float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+            if (length > 0.0f) {
+                for (uint32_t c = 0; c < 3; c++) {
+                    normal[c] /= length;
+                    normals[t * 3 + c] = normal[c];
+                    axis[c] += normal[c];
+                }
+            }
+        }
+
+        const float axisLength = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+        std::memcpy(meshlet.coneApex, meshlet.center, sizeof(meshlet.center));
+        if (axisLength <= 0.0f) {
+            meshlet.coneAxis[0] = meshlet.coneAxis[1] = 0.0f;
+            meshlet.coneAxis[2] = 1.0f;
+            meshlet.coneCutoff = 1.0f; // never culled
+            return;
+        }
+        for (float& component : axis) component /= axisLength;
+
+        float minimumDot = 1.0f;
+        for (uint32_t t = 0; t < meshlet.triangleCount; t++) {
+            const float dot = normals[t * 3] * axis[0] + normals[t * 3 + 1] * axis[1] + normals[t * 3 + 2] * axis[2];
+            minimumDot = std::min(minimumDot, dot);
+        }
+        std::memcpy(meshlet.coneAxis, axis, sizeof(axis));
+
+        // triangles spanning more than a hemisphere can always be seen from somewhere
+        if (minimumDot <= 0.1f) {
+            meshlet.coneCutoff = 1.0f;
+            return;
+        }
+
+        // move the apex back along the axis until every triangle plane is in front of it
+        float maximumT = 0.0f;
+        for (uint32_t t = 0; t < meshlet.triangleCount; t++) {
+            const uint8_t* triangle = &meshletTriangles[meshlet.triangleOffset + t * 3];
+            float toCenter = 0.0f;
+            float axisDot = 0.0f;
+            for (uint32_t c = 0; c < 3; c++) {
+                toCenter += (meshlet.center[c] - position(triangle[0], c)) * normals[t * 3 + c];
+                axisDot += axis[c] * normals[t * 3 + c];
+            }
+            if (axisDot > 0.0f) maximumT = std::max(maximumT, toCenter / axisDot);
+        }
+        for (uint32_t c = 0; c < 3; c++) meshlet.coneApex[c] = meshlet.center[c] - axis[c] * maximumT;
+        meshlet.coneCutoff = std::sqrt(1.0f - minimumDot * minimumDot);
+    }
+
+    /**
+     * @brief Splits an (already cache optimized) triangle list into meshlets, greedily in index order.
+     *
+     * Following the cache optimized order keeps meshlets spatially coherent without a separate clustering pass.
+     */
+    inline void buildMeshlets(const std::span<const uint32_t> indices, const std::span<const float> positions, const uint32_t vertexCount,
+                              const uint32_t maxVertices, const uint32_t maxTriangles, std::vector<Meshlet>& meshlets,
+                              std::vector<uint32_t>& meshletVertices, std::vector<uint8_t>& meshletTriangles) {
+        std::vector<uint32_t> meshletOf(vertexCount, UINT32_MAX);
+        std::vector<uint8_t> localIndex(vertexCount, 0);
+
+        const auto firstMeshlet = static_cast<uint32_t>(meshlets.size());
+        Meshlet current{};
+        current.vertexOffset = static_cast<uint32_t>(meshletVertices.size());
+        current.triangleOffset = static_cast<uint32_t>(meshletTriangles.size());
+
+        auto flush = [&] {
+            if (current.triangleCount == 0) return;
+            meshlets.push_back(current);
+            // keep each meshlet's triangles 4 byte aligned so shaders can fetch them as uint32
+            while (meshletTriangles.size() % 4) meshletTriangles.push_back(0);
+            current = {};
+            current.vertexOffset = static_cast<uint32_t>(meshletVertices.size());
+            current.triangleOffset = static_cast<uint32_t>(meshletTriangles.size());
+        };
+
+        for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+            const auto meshletIndex = static_cast<uint32_t>(meshlets.size());
+            uint32_t newVertices = 0;
+            for (uint32_t corner = 0; corner < 3; corner++) {
+                if (meshletOf[indices[t + corner]] != meshletIndex) newVertices++;
+            }
+            // duplicate corners (degenerate triangles) may overcount, which only splits slightly early
+            if (current.vertexCount + newVertices > maxVertices || current.triangleCount + 1 > maxTriangles) flush();
+
+            const auto activeMeshlet = static_cast<uint32_t>(meshlets.size());
+            for (uint32_t corner = 0; corner < 3; corner++) {
+                const uint32_t v = indices[t + corner];
+                if (meshletOf[v] != activeMeshlet) {
+                    meshletOf[v] = activeMeshlet;
+                    localIndex[v] = static_cast<uint8_t>(current.vertexCount++);
+                    meshletVertices.push_back(v);
+                }
+                meshletTriangles.push_back(localIndex[v]);
+            }
+            current.triangleCount++;
+        }
+        flush();
+
+        for (size_t m = firstMeshlet; m < meshlets.size(); m++) computeMeshletBounds(meshlets[m], meshletVertices, meshletTriangles, positions);
+    }
+
+    // === Quantization ===
+
+    inline uint16_t floatToHalf(const float value) {
+        const auto bits = std::bit_cast<uint32_t>(value);
+        const uint32_t sign = (bits >> 16) & 0x8000;
+        const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+        uint32_t mantissa = bits & 0x7FFFFF;
+
+        if (((bits >> 23) & 0xFF) == 0xFF) return static_cast<uint16_t>(sign | 0x7C00 | (mantissa ? 0x200 : 0)); // inf / nan
+        if (exponent >= 31) return static_cast<uint16_t>(sign | 0x7C00);                                          // overflow to inf
+        if (exponent <= 0) {
+            if (exponent < -10) return static_cast<uint16_t>(sign);                                               // underflow to zero
+            mantissa |= 0x800000;
+            const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+            uint32_t half = mantissa >> shift;
+            if ((mantissa >> (shift - 1)) & 1) half++;                                                            // round
+            return static_cast<uint16_t>(sign | half);
+        }
+        uint32_t half = sign | static_cast<uint32_t>(exponent) << 10 | mantissa >> 13;
+        if (mantissa & 0x1000) half++; // round to nearest, a carry correctly bumps the exponent
+        return static_cast<uint16_t>(half);
+    }
+
+    inline int16_t toSnorm16(const float value) {
+        return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    inline int8_t toSnorm8(const float value) {
+        return static_cast<int8_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 127.0f));
+    }
+
+    inline uint8_t toUnorm8(const float value) {
+        return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    /**
+     * @brief Octahedral encoding of a unit vector into two snorm16 values.
+     */
+    inline void encodeOctahedral(const float* normal, int16_t* output) {
+        float x = normal[0], y = normal[1];
+        const float z = normal[2];
+        const float sum = std::abs(x) + std::abs(y) + std::abs(z);
+        if (sum <= 0.0f) {
+            output[0] = output[1] = 0;
+            return;
+        }
+        x /= sum;
+        y /= sum;
+        if (z < 0.0f) {
+            const float foldedX = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            const float foldedY = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = foldedX;
+            y = foldedY;
+        }
+        output[0] = toSnorm16(x);
+        output[1] = toSnorm16(y);
+    }
+
+}
@@ -0,0 +1,267 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_BenchmarkCompare <baseline.json> <candidate.json> [--alpha=<p>] [--threshold=<percent>] [--json=<path>]
+//
+// Compares two reports written by VKING_Benchmarks --json or VKING_Main --harness. Every result present in both
+// is tested with Welch's t-test on its raw samples. A result regresses when its mean got slower by more than
+// --threshold percent (default 2) and the difference is significant at --alpha (default 0.01).
+//
+// Exit code: 0 no regression, 1 at least one regression, 2 unusable input.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+import VKING.Json;
+
+namespace {
+
+    using namespace VKING;
+
+    struct Series {
+        std::string name;
+        std::vector<double> samples;
+    };
+
+    struct Comparison {
+        std::string name;
+        double baselineMean = 0.0;
+        double candidateMean = 0.0;
+        /// Relative change of the mean, positive is slower
+        double change = 0.0;
+        double pValue = 1.0;
+        const char* verdict = "same";
+    };
+
+    std::optional<std::vector<Series>> readReport(const char* path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            std::fprintf(stderr, "Could not open %s\n", path);
+            return std::nullopt;
+        }
+        const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        std::string error;
+        const std::optional<Json::Value> report = Json::parse(text, &error);
+        if (!report) {
+            std::fprintf(stderr, "%s is not valid JSON: %s\n", path, error.c_str());
+            return std::nullopt;
+        }
+        const Json::Value* results = report->find("results");
+        if (!results || !results->isArray()) {
+            std::fprintf(stderr, "%s has no \"results\" array\n", path);
+            return std::nullopt;
+        }
+
+        std::vector<Series> series;
+        for (const Json::Value& result : results->asArray()) {
+            Series entry;
+            entry.name = result["name"].asString();
+            for (const Json::Value& sample : result["samples"].asArray()) entry.samples.push_back(sample.asNumber());
+            if (!entry.name.empty() && !entry.samples.empty()) series.push_back(std::move(entry));
+        }
+        return series;
+    }
+
+    /// Continued fraction for the incomplete beta function (modified Lentz)
+    double betaContinuedFraction(const double a, const double b, const double x) {
+        constexpr int MAX_ITERATIONS = 300;
+        constexpr double EPSILON = 1e-14;
+        constexpr double TINY = 1e-300;
+
+        const double qab = a + b;
+        const double qap = a + 1.0;
+        const double qam = a - 1.0;
+        double c = 1.0;
+        double d = 1.0 - qab * x / qap;
+        if (std::abs(d) < TINY) d = TINY;
+        d = 1.0 / d;
+        double h = d;
+        for (int m = 1; m <= MAX_ITERATIONS; m++) {
+            const double m2 = 2.0 * m;
+            double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+            d = 1.0 + aa * d;
+            if (std::abs(d) < TINY) d = TINY;
+            c = 1.0 + aa / c;
+            if (std::abs(c) < TINY) c = TINY;
+            d = 1.0 / d;
+            h *= d * c;
+
+            aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+            d = 1.0 + aa * d;
+            if (std::abs(d) < TINY) d = TINY;
+            c = 1.0 + aa / c;
+            if (std::abs(c) < TINY) c = TINY;
+            d = 1.0 / d;
+            const double delta = d * c;
+            h *= delta;
+            if (std::abs(delta - 1.0) < EPSILON) break;
+        }
+        return h;
+    }
+
+    /// Regularized incomplete beta function I_x(a, b)
+    double incompleteBeta(const double a, const double b, const double x) {
+        if (x <= 0.0) return 0.0;
+        if (x >= 1.0) return 1.0;
+        const double front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) + b * std::log(1.0 - x));
+        if (x < (a + 1.0) / (a + b + 2.0)) return front * betaContinuedFraction(a, b, x) / a;
+        return 1.0 - front * betaContinuedFraction(b, a, 1.0 - x) / b;
+    }
+
+    void describe(const std::vector<double>& samples, double& mean, double& variance) {
+        mean = 0.0;
+        for (const double sample : samples) mean += sample;
+        mean /= static_cast<double>(samples.size());
+        variance = 0.0;
+        for (const double sample : samples) variance += (sample - mean) * (sample - mean);
+        variance = samples.size() > 1 ? variance / static_cast<double>(samples.size() - 1) : 0.0;
+    }
+
+    /**
+     * @brief Two-sided p-value of Welch's t-test, which does not assume equal variances.
+     */
+    double welchTTest(const std::vector<double>& baseline, const std::vector<double>& candidate, double& baselineMean, double& candidateMean) {
+        double baselineVariance = 0.0;
+        double candidateVariance = 0.0;
+        describe(baseline, baselineMean, baselineVariance);
+        describe(candidate, candidateMean, candidateVariance);
+        if (baseline.size() < 2 || candidate.size() < 2) return 1.0;
+
+        const double baselineError = baselineVariance / static_cast<double>(baseline.size());
+        const double candidateError = candidateVariance / static_cast<double>(candidate.size());
+        const double standardError = baselineError + candidateError;
+        if (standardError <= 0.0) return baselineMean == candidateMean ? 1.0 : 0.0;
+
+        const double t = (candidateMean - baselineMean) / std::sqrt(standardError);
+        // Welch–Satterthwaite degrees of freedom
+        const double degreesOfFreedom = standardError * standardError /
+            (baselineError * baselineError / static_cast<double>(baseline.size() - 1) +
+             candidateError * candidateError / static_cast<double>(candidate.size() - 1));
+        return incompleteBeta(degreesOfFreedom / 2.0, 0.5, degreesOfFreedom / (degreesOfFreedom + t * t));
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    const char* baselinePath = nullptr;
+    const char* candidatePath = nullptr;
+    double alpha = 0.01;
+    double threshold = 0.02;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if (argument.starts_with("--alpha=")) {
+            alpha = std::strtod(argv[i] + 8, nullptr);
+        } else if (argument.starts_with("--threshold=")) {
+            threshold = std::strtod(argv[i] + 12, nullptr) / 100.0;
+        } else if (argument.starts_with("--json=")) {
+            jsonPath = argument.substr(7);
+        } else if (!argument.starts_with("--") && !baselinePath) {
+            baselinePath = argv[i];
+        } else if (!argument.starts_with("--") && !candidatePath) {
+            candidatePath = argv[i];
+        } else {
+            std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (!baselinePath || !candidatePath) {
+        std::fprintf(stderr, "Usage: %s <baseline.json> <candidate.json> [--alpha=<p>] [--threshold=<percent>] [--json=<path>]\n", argv[0]);
+        return 2;
+    }
+
+    const auto baseline = readReport(baselinePath);
+    const auto candidate = readReport(candidatePath);
+    if (!baseline || !candidate) return 2;
+
+    // === Compare every result present in both reports ===
+    std::vector<Comparison> comparisons;
+    uint32_t regressions = 0;
+    for (const Series& base : *baseline) {
+        const auto match = std::ranges::find(*candidate, base.name, &Series::name);
+        if (match == candidate->end()) {
+            std::printf("%-56s missing from candidate\n", base.name.c_str());
+            continue;
+        }
+
+        Comparison comparison;
+        comparison.name = base.name;
+        comparison.pValue = welchTTest(base.samples, match->samples, comparison.baselineMean, comparison.candidateMean);
+        comparison.change = comparison.baselineMean > 0.0 ? comparison.candidateMean / comparison.baselineMean - 1.0 : 0.0;
+        if (comparison.pValue < alpha && comparison.change > threshold) {
+            comparison.verdict = "REGRESSION";
+            regressions++;
+        } else if (comparison.pValue < alpha && comparison.change < -threshold) {
+            comparison.verdict = "improved";
+        }
+        comparisons.push_back(comparison);
+    }
+
+    std::printf("%-56s %14s %14s %9s %10s  %s\n", "Result", "Baseline (ns)", "Candidate (ns)", "Change", "p-value", "Verdict");
+    for (const Comparison& comparison : comparisons) {
+        std::printf("%-56s %14.2f %14.2f %+8.2f%% %10.2g  %s\n", comparison.name.c_str(), comparison.baselineMean,
+                    comparison.candidateMean, comparison.change * 100.0, comparison.pValue, comparison.verdict);
+    }
+    std::printf("\n%zu compared, %u regressed (alpha %.3g, threshold %.3g%%)\n", comparisons.size(), regressions, alpha, threshold * 100.0);
+
+    if (!jsonPath.empty()) {
+        Json::Value report = Json::Value::Object{};
+        report.set("baseline", baselinePath);
+        report.set("candidate", candidatePath);
+        report.set("alpha", alpha);
+        report.set("threshold", threshold);
+        report.set("regressions", regressions);
+        Json::Value entries = Json::Value::Array{};
+        for (const Comparison& comparison : comparisons) {
+            Json::Value entry = Json::Value::Object{};
+            entry.set("name", comparison.name);
+            entry.set("baselineMeanNs", comparison.baselineMean);
+            entry.set("candidateMeanNs", comparison.candidateMean);
+            entry.set("change", comparison.change);
+            entry.set("pValue", comparison.pValue);
+            entry.set("verdict", comparison.verdict);
+            entries.push(std::move(entry));
+        }
+        report.set("comparisons", std::move(entries));
+
+        std::ofstream file(jsonPath, std::ios::binary | std::ios::trunc);
+        file << report.dump(2) << '\n';
+        if (!file) {
+            std::fprintf(stderr, "Could not write %s\n", jsonPath.c_str());
+            return 2;
+        }
+    }
+
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,177 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Benchmark_BlockCompression [--size=<pixels>] [--iterations=<n>] [--raw=<file> --width=<w> --height=<h>]
+//
+// Without --raw a deterministic synthetic image (gradients, hard edges, noise and a normal-map-like region)
+// is generated so results are comparable between machines and runs.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+import VKING.Assets.BlockCompression;
+import VKING.JobSystem;
+import VKING.Log;
+
+namespace {
+
+    using namespace VKING::Assets;
+
+    std::vector<uint8_t> generateSyntheticImage(const uint32_t width, const uint32_t height) {
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+        std::mt19937 random(0x56'4B'49'4Eu);
+        std::uniform_int_distribution noise(-6, 6);
+
+        for (uint32_t y = 0; y < height; y++) {
+            for (uint32_t x = 0; x < width; x++) {
+                uint8_t* pixel = pixels.data() + (static_cast<size_t>(y) * width + x) * 4;
+                const float u = static_cast<float>(x) / static_cast<float>(width);
+                const float v = static_cast<float>(y) / static_cast<float>(height);
+
+                float r, g, b;
+                if (u < 0.5f && v < 0.5f) {
+                    // smooth gradients, the easy case
+                    r = u * 2.0f * 255.0f;
+                    g = v * 2.0f * 255.0f;
+                    b = 128.0f;
+                } else if (u >= 0.5f && v < 0.5f) {
+                    // hard edged checkerboard with two colors per block boundary
+                    const bool check = ((x / 6) + (y / 6)) & 1;
+                    r = check ? 220.0f : 30.0f;
+                    g = check ? 60.0f : 190.0f;
+                    b = check ? 40.0f : 210.0f;
+                } else if (u < 0.5f) {
+                    // normal map style data: unit vectors of a bumpy surface
+                    const float nx = std::sin(static_cast<float>(x) * 0.11f) * 0.5f;
+                    const float ny = std::cos(static_cast<float>(y) * 0.07f) * 0.5f;
+                    const float nz = std::sqrt(std::max(0.0f, 1.0f - nx * nx - ny * ny));
+                    r = (nx * 0.5f + 0.5f) * 255.0f;
+                    g = (ny * 0.5f + 0.5f) * 255.0f;
+                    b = (nz * 0.5f + 0.5f) * 255.0f;
+                } else {
+                    // photographic-ish noise over a colored ramp
+                    r = 90.0f + u * 80.0f + static_cast<float>(noise(random)) * 3.0f;
+                    g = 120.0f + static_cast<float>(noise(random)) * 3.0f;
+                    b = 200.0f - v * 90.0f + static_cast<float>(noise(random)) * 3.0f;
+                }
+
+                pixel[0] = static_cast<uint8_t>(std::clamp(r, 0.0f, 255.0f));
+                pixel[1] = static_cast<uint8_t>(std::clamp(g, 0.0f, 255.0f));
+                pixel[2] = static_cast<uint8_t>(std::clamp(b, 0.0f, 255.0f));
+                pixel[3] = static_cast<uint8_t>(128.0f + 127.0f * std::sin(u * 12.0f) * std::cos(v * 9.0f));
+            }
+        }
+        return pixels;
+    }
+
+    bool parseUnsigned(const std::string_view argument, const std::string_view prefix, uint32_t& value) {
+        if (!argument.starts_with(prefix)) return false;
+        value = static_cast<uint32_t>(std::strtoul(std::string(argument.substr(prefix.size())).c_str(), nullptr, 10));
+        return true;
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    VKING::Log::Init("VKING-Benchmarks.log", VKING::Log::Level::warn);
+
+    uint32_t size = 2048;
+    uint32_t iterations = 3;
+    uint32_t width = 0, height = 0;
+    std::string rawPath;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if (parseUnsigned(argument, "--size=", size)) continue;
+        if (parseUnsigned(argument, "--iterations=", iterations)) continue;
+        if (parseUnsigned(argument, "--width=", width)) continue;
+        if (parseUnsigned(argument, "--height=", height)) continue;
+        if (argument.starts_with("--raw=")) { rawPath = argument.substr(6); continue; }
+        std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+        return 1;
+    }
+
+    std::vector<uint8_t> pixels;
+    if (!rawPath.empty()) {
+        std::ifstream file(rawPath, std::ios::binary);
+        pixels.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        if (width == 0 || height == 0 || pixels.size() < static_cast<size_t>(width) * height * 4) {
+            std::fprintf(stderr, "--raw needs an RGBA8 file of at least --width * --height * 4 bytes.\n");
+            return 1;
+        }
+    } else {
+        width = height = size;
+        pixels = generateSyntheticImage(width, height);
+    }
+
+    const BlockCompression::ImageView image{pixels.data(), width, height, 0};
+    auto& jobs = VKING::JobSystem::getDefault();
+    const double megapixels = static_cast<double>(width) * height / 1'000'000.0;
+
+    std::printf("Block compression benchmark: %ux%u image, %u iterations, %u workers + caller, %s kernels\n",
+                width, height, iterations, jobs.getWorkerCount(), BlockCompression::getInstructionSet());
+    std::printf("%-6s %-8s %12s %10s\n", "Format", "Quality", "MPix/s", "PSNR (dB)");
+
+    for (const auto format : {BlockCompression::Format::BC1, BlockCompression::Format::BC3,
+                              BlockCompression::Format::BC5, BlockCompression::Format::BC7}) {
+        for (const auto quality : {BlockCompression::Quality::FAST, BlockCompression::Quality::NORMAL,
+                                   BlockCompression::Quality::HIGH}) {
+
+            const BlockCompression::CompressSettings settings{.format = format, .quality = quality, .jobSystem = &jobs};
+
+            // one untimed pass warms the pool and the caches, and its output is used for the PSNR
+            std::vector<uint8_t> blocks = BlockCompression::compress(image, settings);
+
+            double bestSeconds = std::numeric_limits<double>::max();
+            for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+                const auto start = std::chrono::steady_clock::now();
+                blocks = BlockCompression::compress(image, settings);
+                const auto end = std::chrono::steady_clock::now();
+                bestSeconds = std::min(bestSeconds, std::chrono::duration<double>(end - start).count());
+            }
+
+            std::vector<uint8_t> decoded;
+            double psnr = 0.0;
+            if (BlockCompression::decompress(format, blocks, width, height, decoded)) {
+                psnr = BlockCompression::computePSNR(image, {decoded.data(), width, height, 0}, format);
+            }
+
+            std::printf("%-6s %-8s %12.2f %10.2f\n", BlockCompression::formatToString(format),
+                        BlockCompression::qualityToString(quality), megapixels / bestSeconds, psnr);
+        }
+    }
+
+    return 0;
+}
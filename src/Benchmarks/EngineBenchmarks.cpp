@@ -0,0 +1,234 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Benchmarks [--samples=<n>] [--min-sample-ms=<ms>] [--filter=<text>] [--json=<path|->]
+//
+// Microbenchmarks of the engine's hot paths: logging, shutdown requests, platform selection and the Vulkan
+// allocation callbacks. Logging goes to VKING_Benchmarks.log only, so the table (or --json=-) stays readable.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <VKING/Profiler.hpp>
+#include <VKING/Signals.hpp>
+
+#if defined(VKING_BENCHMARK_VULKAN)
+#include <vulkan/vulkan.h>
+#include <VKING/AllocationProfiler.hpp>
+#endif
+
+import VKING.Log;
+import VKING.Types.Platform;
+import VKING.EngineConfig;
+import VKING.Benchmark.Harness;
+
+#if defined(VKING_BENCHMARK_VULKAN)
+import VKING.Platform.Vulkan;
+#endif
+
+namespace {
+
+    using namespace VKING;
+    using BenchmarkLogger = Log::Named<"Benchmark">;
+
+    /// 1, 2, 4, ... up to the hardware thread count, which is always included
+    std::vector<uint32_t> getThreadCounts() {
+        const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<uint32_t> counts;
+        for (uint32_t threads = 1; threads < hardwareThreads; threads *= 2) counts.push_back(threads);
+        counts.push_back(hardwareThreads);
+        return counts;
+    }
+
+    void benchmarkLogging(Benchmark::Runner& runner) {
+        for (const uint32_t threads : getThreadCounts()) {
+            const std::string suffix = "/threads:" + std::to_string(threads);
+
+            Log::setLevel(Log::Level::info);
+            runner.runThreaded("Log/record/enabled" + suffix, threads, [](const uint32_t threadIndex, const uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; i++) {
+                    BenchmarkLogger::record().info("Thread {} message {}", threadIndex, i);
+                }
+            });
+
+            // Below the global level: the cost every filtered out trace or debug call pays
+            Log::setLevel(Log::Level::warn);
+            runner.runThreaded("Log/record/disabled" + suffix, threads, [](const uint32_t threadIndex, const uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; i++) {
+                    BenchmarkLogger::record().debug("Thread {} message {}", threadIndex, i);
+                }
+            });
+        }
+        Log::setLevel(Log::Level::info);
+    }
+
+    void benchmarkShutdown(Benchmark::Runner& runner) {
+        for (const uint32_t threads : getThreadCounts()) {
+            runner.runThreaded("Shutdown/isRequested/threads:" + std::to_string(threads), threads, [](uint32_t, const uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; i++) {
+                    Benchmark::doNotOptimize(Shutdown::isRequested());
+                }
+            });
+        }
+
+        runner.run("Shutdown/request", [](const uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                Shutdown::request(Shutdown::Reason::REASON_USER_REQUEST, "Benchmark shutdown request");
+            }
+        });
+        Shutdown::clearRequest();
+    }
+
+    void benchmarkPlatformSelection(Benchmark::Runner& runner) {
+        using namespace Types::Platform;
+
+        runner.run("EngineConfig/getPlatformScores", [](const uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                Benchmark::doNotOptimize(EngineConfig::getPlatformScores());
+            }
+        });
+
+        runner.run("EngineConfig/getBackendScores", [](const uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                Benchmark::doNotOptimize(EngineConfig::getBackendScores());
+            }
+        });
+
+        const auto platforms = EngineConfig::getPlatformScores();
+        runner.run("EngineConfig/getPlatformScore", [&platforms](const uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                Benchmark::doNotOptimize(EngineConfig::getPlatformScore(platforms, PlatformType::GLFW));
+            }
+        });
+
+        const auto backends = EngineConfig::getBackendScores();
+        runner.run("EngineConfig/getBackendScore", [&backends](const uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                Benchmark::doNotOptimize(EngineConfig::getBackendScore(backends, BackendType::VULKAN));
+            }
+        });
+
+        runner.run("EngineConfig/getAvailablePlatformConfigurations", [](const uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                Benchmark::doNotOptimize(EngineConfig::getAvailablePlatformConfigurations().size());
+            }
+        });
+
+        // selectPlatform logs its decision at info, keep that out of the measurement
+        Log::setLevel(Log::Level::warn);
+        runner.run("EngineConfig/selectPlatform/noPreference", [](const uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                Benchmark::doNotOptimize(EngineConfig::selectPlatform({}));
+            }
+        });
+        runner.run("EngineConfig/selectPlatform/GLFWVulkan", [](const uint64_t iterations) {
+            PlatformManager::PlatformSpecification specification;
+            specification.platformType = PlatformType::GLFW;
+            specification.backendType = BackendType::VULKAN;
+            for (uint64_t i = 0; i < iterations; i++) {
+                Benchmark::doNotOptimize(EngineConfig::selectPlatform(specification));
+            }
+        });
+        Log::setLevel(Log::Level::info);
+    }
+
+#if defined(VKING_BENCHMARK_VULKAN)
+    void benchmarkVulkanCallbacks(Benchmark::Runner& runner) {
+        /// Vulkan commonly requests 16 byte alignment for host allocations
+        constexpr size_t ALIGNMENT = 16;
+        constexpr size_t SIZE_CLASSES[] = {16, 64, 256, 1024, 4096, 64 * 1024, 1024 * 1024};
+
+        const VkAllocationCallbacks* callbacks = VKING_Platform_Vulkan_CreateAllocationCallbacks();
+
+        for (const size_t size : SIZE_CLASSES) {
+            const std::string suffix = "/bytes:" + std::to_string(size);
+
+            runner.run("Vulkan/allocationCallbacks/allocFree" + suffix, [callbacks, size](const uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; i++) {
+                    void* memory = callbacks->pfnAllocation(nullptr, size, ALIGNMENT, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+                    Benchmark::doNotOptimize(memory);
+                    callbacks->pfnFree(nullptr, memory);
+                }
+            });
+
+            // Grow to twice the size, which copies the whole old block
+            runner.run("Vulkan/allocationCallbacks/reallocGrow" + suffix, [callbacks, size](const uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; i++) {
+                    void* memory = callbacks->pfnAllocation(nullptr, size, ALIGNMENT, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+                    memory = callbacks->pfnReallocation(nullptr, memory, size * 2, ALIGNMENT, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+                    Benchmark::doNotOptimize(memory);
+                    callbacks->pfnFree(nullptr, memory);
+                }
+            });
+        }
+
+        // Same allocations with the allocation profiler sampling, to keep its cost in check against allocFree
+        Profiler::Allocations::setEnabled(true);
+        for (const size_t size : SIZE_CLASSES) {
+            runner.run("Vulkan/allocationCallbacks/allocFree/profiled/bytes:" + std::to_string(size), [callbacks, size](const uint64_t iterations) {
+                for (uint64_t i = 0; i < iterations; i++) {
+                    void* memory = callbacks->pfnAllocation(nullptr, size, ALIGNMENT, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+                    Benchmark::doNotOptimize(memory);
+                    callbacks->pfnFree(nullptr, memory);
+                }
+            });
+        }
+        Profiler::Allocations::setEnabled(false);
+    }
+#endif
+
+}
+
+int main(const int argc, char** argv) {
+    std::string error;
+    const auto options = Benchmark::parseOptions(argc, argv, &error);
+    if (!options) {
+        if (error.empty()) return 0;
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    Log::Init("VKING_Benchmarks.log", Log::Level::info);
+    Log::setConsoleOutput(false);
+    // Nothing here measures the profiler, and with no frames marked each thread's zone ring would fill partway
+    // through a benchmark and change what the logging benchmarks measure
+    Profiler::setCapturing(false);
+
+    Benchmark::Runner runner(*options);
+    benchmarkLogging(runner);
+    benchmarkShutdown(runner);
+    benchmarkPlatformSelection(runner);
+#if defined(VKING_BENCHMARK_VULKAN)
+    benchmarkVulkanCallbacks(runner);
+#endif
+
+    if (!runner.writeReport("VKING_Benchmarks")) {
+        std::fprintf(stderr, "Could not write the report to %s\n", options->jsonPath.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,330 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+module VKING.Benchmark.Harness;
+
+namespace VKING::Benchmark {
+
+    namespace {
+
+        /// Calibration never goes beyond this many iterations, even for operations the compiler reduced to nothing
+        constexpr uint64_t MAX_ITERATIONS = uint64_t{1} << 40;
+
+        /**
+         * @brief Threads that run one benchmark's body, started once and reused for every calibration pass and sample.
+         *
+         * Starting threads per sample would put thread creation into the timings, and every fresh thread that records
+         * a profiler zone or a log line allocates its per-thread buffers again.
+         */
+        class WorkerPool {
+        public:
+            using Body = std::function<void(uint32_t, uint64_t)>;
+
+            WorkerPool(const uint32_t threads, const Body& body)
+                : m_Body(body) {
+                m_Workers.reserve(threads);
+                for (uint32_t i = 0; i < threads; i++) m_Workers.emplace_back([this, i] { workerLoop(i); });
+            }
+
+            ~WorkerPool() {
+                m_Stopping.store(true, std::memory_order_relaxed);
+                m_Generation.fetch_add(1, std::memory_order_release);
+                for (std::thread& worker : m_Workers) worker.join();
+            }
+
+            WorkerPool(const WorkerPool&) = delete;
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+            /**
+             * @return Nanoseconds from releasing every worker until the last one finished iterations
+             */
+            double time(const uint64_t iterations) {
+                using clock = std::chrono::steady_clock;
+
+                // Every worker is parked on the start barrier before the clock starts
+                while (m_Parked.load(std::memory_order_acquire) != m_Workers.size()) std::this_thread::yield();
+                m_Parked.store(0, std::memory_order_relaxed);
+                m_Finished.store(0, std::memory_order_relaxed);
+                m_Iterations = iterations;
+
+                const auto start = clock::now();
+                m_Generation.fetch_add(1, std::memory_order_release);
+                while (m_Finished.load(std::memory_order_acquire) != m_Workers.size()) std::this_thread::yield();
+                return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+            }
+
+        private:
+            void workerLoop(const uint32_t index) {
+                uint64_t seenGeneration = 0;
+                while (true) {
+                    m_Parked.fetch_add(1, std::memory_order_acq_rel);
+                    uint64_t generation;
+                    while ((generation = m_Generation.load(std::memory_order_acquire)) == seenGeneration) std::this_thread::yield();
+                    seenGeneration = generation;
+                    if (m_Stopping.load(std::memory_order_relaxed)) return;
+
+                    m_Body(index, m_Iterations);
+                    m_Finished.fetch_add(1, std::memory_order_acq_rel);
+                }
+            }
+
+            const Body& m_Body;
+            std::vector<std::thread> m_Workers;
+            /// Written before each release, read by the workers after it
+            uint64_t m_Iterations = 0;
+            std::atomic<uint64_t> m_Generation{0};
+            std::atomic<size_t> m_Parked{0};
+            std::atomic<size_t> m_Finished{0};
+            std::atomic_bool m_Stopping{false};
+        };
+
+        double timeIterations(const uint32_t threads, const uint64_t iterations, const std::function<void(uint32_t, uint64_t)>& body, WorkerPool* pool) {
+            if (threads <= 1) {
+                const auto start = std::chrono::steady_clock::now();
+                body(0, iterations);
+                return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            }
+            return pool->time(iterations);
+        }
+
+        std::string getCompilerName() {
+#if defined(__clang__)
+            return std::string("Clang ") + __clang_version__;
+#elif defined(__GNUC__)
+            return std::string("GCC ") + __VERSION__;
+#elif defined(_MSC_VER)
+            return "MSVC " + std::to_string(_MSC_VER);
+#else
+            return "Unknown";
+#endif
+        }
+
+        const char* getOperatingSystemName() {
+#if defined(_WIN32)
+            return "Windows";
+#elif defined(__APPLE__)
+            return "macOS";
+#elif defined(__linux__)
+            return "Linux";
+#else
+            return "Unknown";
+#endif
+        }
+
+        std::string getUtcTimestamp() {
+            const std::time_t now = std::time(nullptr);
+            std::tm utc{};
+#if defined(_WIN32)
+            gmtime_s(&utc, &now);
+#else
+            gmtime_r(&now, &utc);
+#endif
+            char buffer[32];
+            std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+            return buffer;
+        }
+
+        void printUsage(const char* program) {
+            std::printf("Usage: %s [--samples=<n>] [--min-sample-ms=<ms>] [--filter=<text>] [--json=<path|->]\n"
+                        "  --samples        Timed samples per benchmark (default 10)\n"
+                        "  --min-sample-ms  Minimum duration of one sample, iterations are calibrated to it (default 10)\n"
+                        "  --filter         Only run benchmarks whose name contains the text\n"
+                        "  --json           Write a JSON report to the path, or to stdout with '-'\n", program);
+        }
+
+    }
+
+    std::optional<Options> parseOptions(const int argc, const char* const* argv, std::string* error) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            const std::string_view argument = argv[i];
+            const size_t equals = argument.find('=');
+            const std::string_view key = argument.substr(0, equals);
+            const std::string value = equals == std::string_view::npos ? std::string() : std::string(argument.substr(equals + 1));
+
+            if (key == "--help" || key == "-h") {
+                printUsage(argv[0]);
+                if (error) error->clear();
+                return std::nullopt;
+            }
+            if (key == "--samples" && !value.empty()) {
+                options.samples = std::max(1u, static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10)));
+            } else if (key == "--min-sample-ms" && !value.empty()) {
+                options.minSampleMilliseconds = std::max(0.01, std::strtod(value.c_str(), nullptr));
+            } else if (key == "--filter") {
+                options.filter = value;
+            } else if (key == "--json" && !value.empty()) {
+                options.jsonPath = value;
+            } else {
+                if (error) *error = "Unknown or malformed argument: " + std::string(argument);
+                return std::nullopt;
+            }
+        }
+        return options;
+    }
+
+    Runner::Runner(Options options)
+        : m_Options(std::move(options)) {
+        std::FILE* table = m_Options.jsonPath == "-" ? stderr : stdout;
+        std::fprintf(table, "%-48s %7s %12s %12s %12s %12s %12s\n", "Benchmark", "Threads", "Iterations", "Mean (ns)", "Median",
+                     "StdDev", "Min");
+    }
+
+    bool Runner::isSelected(const std::string_view name) const {
+        return m_Options.filter.empty() || name.find(m_Options.filter) != std::string_view::npos;
+    }
+
+    void Runner::run(const std::string_view name, const std::function<void(uint64_t)>& body) {
+        runThreaded(name, 1, [&body](uint32_t, const uint64_t iterations) { body(iterations); });
+    }
+
+    void Runner::runThreaded(const std::string_view name, uint32_t threads, const std::function<void(uint32_t, uint64_t)>& body) {
+        if (!isSelected(name)) return;
+        threads = std::max(threads, 1u);
+        std::optional<WorkerPool> pool;
+        if (threads > 1) pool.emplace(threads, body);
+
+        // === Calibrate ===
+        const double targetNanoseconds = m_Options.minSampleMilliseconds * 1'000'000.0;
+        uint64_t iterations = 1;
+        while (iterations < MAX_ITERATIONS) {
+            const double elapsed = timeIterations(threads, iterations, body, pool ? &*pool : nullptr);
+            if (elapsed >= targetNanoseconds) break;
+            const double scale = elapsed > 0.0 ? targetNanoseconds * 1.2 / elapsed : 100.0;
+            iterations = std::min(MAX_ITERATIONS, static_cast<uint64_t>(static_cast<double>(iterations) * std::clamp(scale, 2.0, 100.0)));
+        }
+
+        // === Measure ===
+        std::vector<double> samples;
+        samples.reserve(m_Options.samples);
+        for (uint32_t sample = 0; sample < m_Options.samples; sample++) {
+            samples.push_back(timeIterations(threads, iterations, body, pool ? &*pool : nullptr) / static_cast<double>(iterations));
+        }
+        record(name, threads, iterations, std::move(samples));
+    }
+
+    void Runner::record(const std::string_view name, const uint32_t threads, const uint64_t iterations, std::vector<double> samples) {
+        Result result;
+        result.name = name;
+        result.threads = threads;
+        result.iterations = iterations;
+
+        std::vector<double> sorted = samples;
+        std::ranges::sort(sorted);
+        const size_t count = sorted.size();
+        double sum = 0.0;
+        for (const double sample : sorted) sum += sample;
+        result.meanNanoseconds = sum / static_cast<double>(count);
+        result.medianNanoseconds = count % 2 ? sorted[count / 2] : (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0;
+        result.minNanoseconds = sorted.front();
+        result.maxNanoseconds = sorted.back();
+        double variance = 0.0;
+        for (const double sample : sorted) variance += (sample - result.meanNanoseconds) * (sample - result.meanNanoseconds);
+        result.stddevNanoseconds = count > 1 ? std::sqrt(variance / static_cast<double>(count - 1)) : 0.0;
+        result.samples = std::move(samples);
+
+        std::FILE* table = m_Options.jsonPath == "-" ? stderr : stdout;
+        std::fprintf(table, "%-48s %7u %12llu %12.2f %12.2f %12.2f %12.2f\n", result.name.c_str(), result.threads,
+                     static_cast<unsigned long long>(result.iterations), result.meanNanoseconds, result.medianNanoseconds,
+                     result.stddevNanoseconds, result.minNanoseconds);
+        std::fflush(table);
+
+        m_Results.push_back(std::move(result));
+    }
+
+    Json::Value Runner::toJson(const std::string_view suite) const {
+        Json::Value report = Json::Value::Object{};
+        report.set("schema", REPORT_SCHEMA_VERSION);
+        report.set("suite", suite);
+        report.set("timestamp", getUtcTimestamp());
+
+        Json::Value host = Json::Value::Object{};
+        host.set("os", getOperatingSystemName());
+        host.set("hardwareThreads", std::thread::hardware_concurrency());
+        report.set("host", std::move(host));
+
+        Json::Value build = Json::Value::Object{};
+        build.set("compiler", getCompilerName());
+#if defined(NDEBUG)
+        build.set("type", "Release");
+#else
+        build.set("type", "Debug");
+#endif
+        report.set("build", std::move(build));
+
+        Json::Value options = Json::Value::Object{};
+        options.set("samples", m_Options.samples);
+        options.set("minSampleMilliseconds", m_Options.minSampleMilliseconds);
+        report.set("options", std::move(options));
+
+        Json::Value results = Json::Value::Array{};
+        for (const Result& result : m_Results) {
+            Json::Value entry = Json::Value::Object{};
+            entry.set("name", result.name);
+            entry.set("threads", result.threads);
+            entry.set("iterations", result.iterations);
+            entry.set("meanNs", result.meanNanoseconds);
+            entry.set("medianNs", result.medianNanoseconds);
+            entry.set("stddevNs", result.stddevNanoseconds);
+            entry.set("minNs", result.minNanoseconds);
+            entry.set("maxNs", result.maxNanoseconds);
+            Json::Value samples = Json::Value::Array{};
+            for (const double sample : result.samples) samples.push(sample);
+            entry.set("samples", std::move(samples));
+            results.push(std::move(entry));
+        }
+        report.set("results", std::move(results));
+        return report;
+    }
+
+    bool Runner::writeReport(const std::string_view suite) const {
+        if (m_Options.jsonPath.empty()) return true;
+
+        const std::string text = toJson(suite).dump(2);
+        if (m_Options.jsonPath == "-") {
+            std::fwrite(text.data(), 1, text.size(), stdout);
+            std::fputc('\n', stdout);
+            return std::fflush(stdout) == 0;
+        }
+
+        std::ofstream file(m_Options.jsonPath, std::ios::binary | std::ios::trunc);
+        file << text << '\n';
+        return static_cast<bool>(file);
+    }
+
+}
@@ -0,0 +1,137 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+export module VKING.Benchmark.Harness;
+
+export import VKING.Json;
+
+export namespace VKING::Benchmark {
+
+    /// Version of the JSON report layout, bumped whenever a field changes meaning
+    constexpr uint32_t REPORT_SCHEMA_VERSION = 1;
+
+    struct Options {
+        /// Timed samples per benchmark. Each sample runs the calibrated iteration count
+        uint32_t samples = 10;
+        /// Iterations are calibrated so one sample takes at least this long
+        double minSampleMilliseconds = 10.0;
+        /// Only benchmarks whose name contains this string run
+        std::string filter;
+        /// Where to write the JSON report. Empty writes none, "-" writes it to stdout instead of the table
+        std::string jsonPath;
+    };
+
+    /**
+     * @brief Parses the options every benchmark executable shares.
+     *
+     * Recognized: --samples=<n>, --min-sample-ms=<ms>, --filter=<text>, --json=<path|->, --help.
+     *
+     * @param error Receives a message for unknown or malformed arguments
+     * @return The options, or std::nullopt if the program should exit (error set, or --help printed)
+     */
+    std::optional<Options> parseOptions(int argc, const char* const* argv, std::string* error = nullptr);
+
+    struct Result {
+        std::string name;
+        uint32_t threads = 1;
+        /// Operations each thread performed per sample
+        uint64_t iterations = 0;
+        /// Nanoseconds per operation of each sample
+        std::vector<double> samples;
+        double meanNanoseconds = 0.0;
+        double medianNanoseconds = 0.0;
+        double stddevNanoseconds = 0.0;
+        double minNanoseconds = 0.0;
+        double maxNanoseconds = 0.0;
+    };
+
+    /**
+     * @brief Prevents the compiler from discarding a value whose computation is being measured.
+     */
+    template<typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static_cast<void>(*static_cast<const volatile T*>(&value));
+#endif
+    }
+
+    /**
+     * @brief Runs microbenchmarks and collects their results.
+     *
+     * Each benchmark is first calibrated (iteration count grown until one sample takes minSampleMilliseconds),
+     * then timed for the configured number of samples. Results are printed as they finish and can be written
+     * as a JSON report to compare runs.
+     */
+    class Runner {
+    public:
+        explicit Runner(Options options);
+
+        /**
+         * @param name Unique benchmark name, e.g. "Log/record/enabled"
+         * @param body Performs the measured operation iterations times
+         */
+        void run(std::string_view name, const std::function<void(uint64_t iterations)>& body);
+
+        /**
+         * @brief Runs body on threads threads at once. Reported time is wall time divided by per-thread iterations,
+         *        so it is the latency of one operation under that much contention.
+         *
+         * @param body Called on each thread as body(threadIndex, iterations)
+         */
+        void runThreaded(std::string_view name, uint32_t threads, const std::function<void(uint32_t threadIndex, uint64_t iterations)>& body);
+
+        [[nodiscard]] const std::vector<Result>& getResults() const { return m_Results; }
+        [[nodiscard]] const Options& getOptions() const { return m_Options; }
+
+        /**
+         * @brief Builds the report: schema version, host and build information, and every result with its raw samples.
+         *
+         * @param suite Name of the executable or suite, stored in the report
+         */
+        [[nodiscard]] Json::Value toJson(std::string_view suite) const;
+
+        /**
+         * @brief Writes toJson() where Options::jsonPath says. Does nothing if it is empty.
+         *
+         * @return false if the report could not be written
+         */
+        bool writeReport(std::string_view suite) const;
+
+    private:
+        [[nodiscard]] bool isSelected(std::string_view name) const;
+        void record(std::string_view name, uint32_t threads, uint64_t iterations, std::vector<double> samples);
+
+        Options m_Options;
+        std::vector<Result> m_Results;
+    };
+
+}
@@ -0,0 +1,284 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Benchmark_MeshImport [--file=<path.gltf|path.glb>] [--meshes=<n>] [--iterations=<n>]
+//
+// Without --file, writes a GLB of <meshes> UV spheres with shuffled triangle order (so the vertex cache
+// optimization has something to do), then imports it cold and from the asset cache, once per layout.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+import VKING.Assets.Gltf;
+import VKING.Json;
+import VKING.Log;
+
+namespace {
+
+    using namespace VKING::Assets;
+
+    bool parseUnsigned(const std::string_view argument, const std::string_view prefix, uint32_t& value) {
+        if (!argument.starts_with(prefix)) return false;
+        value = static_cast<uint32_t>(std::strtoul(std::string(argument.substr(prefix.size())).c_str(), nullptr, 10));
+        return true;
+    }
+
+    /**
+     * @brief Writes a GLB containing meshCount spheres of rings x segments quads each.
+     */
+    bool writeSphereGlb(const std::filesystem::path& path, const uint32_t meshCount, const uint32_t rings, const uint32_t segments) {
+        namespace Json = VKING::Json;
+
+        std::vector<std::byte> binary;
+        Json::Value::Array bufferViews;
+        Json::Value::Array accessors;
+        Json::Value::Array meshes;
+
+        auto addView = [&](const void* data, const size_t size) {
+            while (binary.size() % 4 != 0) binary.push_back(std::byte{0});
+            Json::Value view = Json::Value::Object{};
+            view.set("buffer", 0);
+            view.set("byteOffset", static_cast<uint64_t>(binary.size()));
+            view.set("byteLength", static_cast<uint64_t>(size));
+            const auto* bytes = static_cast<const std::byte*>(data);
+            binary.insert(binary.end(), bytes, bytes + size);
+            bufferViews.push_back(std::move(view));
+            return static_cast<uint32_t>(bufferViews.size() - 1);
+        };
+        auto addAccessor = [&](const uint32_t view, const uint32_t componentType, const size_t count, const char* type) {
+            Json::Value accessor = Json::Value::Object{};
+            accessor.set("bufferView", view);
+            accessor.set("componentType", componentType);
+            accessor.set("count", static_cast<uint64_t>(count));
+            accessor.set("type", type);
+            accessors.push_back(std::move(accessor));
+            return static_cast<uint32_t>(accessors.size() - 1);
+        };
+
+        uint32_t random = 0x9E3779B9u;
+        for (uint32_t m = 0; m < meshCount; m++) {
+            std::vector<float> positions, normals, texcoords;
+            for (uint32_t r = 0; r <= rings; r++) {
+                const float theta = std::numbers::pi_v<float> * static_cast<float>(r) / static_cast<float>(rings);
+                for (uint32_t s = 0; s <= segments; s++) {
+                    const float phi = 2.0f * std::numbers::pi_v<float> * static_cast<float>(s) / static_cast<float>(segments);
+                    const float normal[3] = {std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)};
+                    for (uint32_t axis = 0; axis < 3; axis++) {
+                        normals.push_back(normal[axis]);
+                        positions.push_back(normal[axis] * (1.0f + static_cast<float>(m)) + (axis == 0 ? static_cast<float>(m) * 4.0f : 0.0f));
+                    }
+                    texcoords.push_back(static_cast<float>(s) / static_cast<float>(segments));
+                    texcoords.push_back(static_cast<float>(r) / static_cast<float>(rings));
+                }
+            }
+
+            std::vector<uint32_t> triangles;
+            for (uint32_t r = 0; r < rings; r++) {
+                for (uint32_t s = 0; s < segments; s++) {
+                    const uint32_t a = r * (segments + 1) + s, b = a + segments + 1;
+                    triangles.insert(triangles.end(), {a, b, a + 1, a + 1, b, b + 1});
+                }
+            }
+            // Shuffle whole triangles, the worst case for the post-transform cache
+            const size_t triangleCount = triangles.size() / 3;
+            for (size_t t = triangleCount - 1; t > 0; t--) {
+                random = random * 1664525u + 1013904223u;
+                const size_t other = random % (t + 1);
+                for (uint32_t corner = 0; corner < 3; corner++) std::swap(triangles[t * 3 + corner], triangles[other * 3 + corner]);
+            }
+
+            const size_t vertexCount = positions.size() / 3;
+            const uint32_t positionAccessor = addAccessor(addView(positions.data(), positions.size() * sizeof(float)), 5126, vertexCount, "VEC3");
+            const uint32_t normalAccessor = addAccessor(addView(normals.data(), normals.size() * sizeof(float)), 5126, vertexCount, "VEC3");
+            const uint32_t texcoordAccessor = addAccessor(addView(texcoords.data(), texcoords.size() * sizeof(float)), 5126, vertexCount, "VEC2");
+            const uint32_t indexAccessor = addAccessor(addView(triangles.data(), triangles.size() * sizeof(uint32_t)), 5125, triangles.size(), "SCALAR");
+
+            Json::Value attributes = Json::Value::Object{};
+            attributes.set("POSITION", positionAccessor);
+            attributes.set("NORMAL", normalAccessor);
+            attributes.set("TEXCOORD_0", texcoordAccessor);
+            Json::Value primitive = Json::Value::Object{};
+            primitive.set("attributes", std::move(attributes));
+            primitive.set("indices", indexAccessor);
+            Json::Value mesh = Json::Value::Object{};
+            mesh.set("name", "Sphere" + std::to_string(m));
+            mesh.set("primitives", Json::Value::Array{std::move(primitive)});
+            meshes.push_back(std::move(mesh));
+        }
+        while (binary.size() % 4 != 0) binary.push_back(std::byte{0});
+
+        Json::Value document = Json::Value::Object{};
+        Json::Value asset = Json::Value::Object{};
+        asset.set("version", "2.0");
+        document.set("asset", std::move(asset));
+        Json::Value buffer = Json::Value::Object{};
+        buffer.set("byteLength", static_cast<uint64_t>(binary.size()));
+        document.set("buffers", Json::Value::Array{std::move(buffer)});
+        document.set("bufferViews", std::move(bufferViews));
+        document.set("accessors", std::move(accessors));
+        document.set("meshes", std::move(meshes));
+
+        std::string json = document.dump();
+        while (json.size() % 4 != 0) json.push_back(' ');
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        auto writeU32 = [&file](const uint32_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+        writeU32(0x46546C67);
+        writeU32(2);
+        writeU32(static_cast<uint32_t>(12 + 8 + json.size() + 8 + binary.size()));
+        writeU32(static_cast<uint32_t>(json.size()));
+        writeU32(0x4E4F534A);
+        file.write(json.data(), static_cast<std::streamsize>(json.size()));
+        writeU32(static_cast<uint32_t>(binary.size()));
+        writeU32(0x004E4942);
+        file.write(reinterpret_cast<const char*>(binary.data()), static_cast<std::streamsize>(binary.size()));
+        return static_cast<bool>(file);
+    }
+
+    /// Transformed vertices per triangle with a 32 entry FIFO cache, measured on the imported index buffers
+    double averageACMR(const GltfImportResult& result) {
+        double misses = 0.0;
+        uint64_t triangles = 0;
+        for (const ImportedMesh& mesh : result.meshes) {
+            const auto view = Mesh::MeshBlobView::create(mesh.blob);
+            if (!view) continue;
+            const auto& header = view->getHeader();
+            const std::span<const std::byte> indexBytes = view->getIndices();
+
+            std::vector<uint32_t> cachedAt(header.vertexCount, UINT32_MAX);
+            uint64_t time = 0;
+            for (uint32_t i = 0; i < header.indexCount; i++) {
+                uint32_t index;
+                if (header.indexSize == 2) {
+                    uint16_t value;
+                    std::memcpy(&value, indexBytes.data() + i * 2, 2);
+                    index = value;
+                } else {
+                    std::memcpy(&index, indexBytes.data() + i * 4, 4);
+                }
+                if (cachedAt[index] == UINT32_MAX || time - cachedAt[index] >= 32) {
+                    cachedAt[index] = static_cast<uint32_t>(time++);
+                    misses += 1.0;
+                }
+            }
+            triangles += header.indexCount / 3;
+        }
+        return triangles ? misses / static_cast<double>(triangles) : 0.0;
+    }
+
+    void runImports(const char* label, const std::filesystem::path& path, const GltfImportSettings& settings, const uint32_t iterations) {
+        double bestMilliseconds = std::numeric_limits<double>::max();
+        GltfImportResult best;
+        for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+            GltfImportResult result = importGltf(path, settings);
+            if (!result.success) {
+                std::fprintf(stderr, "Failed to import %s: %s\n", path.string().c_str(), result.error.c_str());
+                return;
+            }
+            if (result.stats.totalMilliseconds < bestMilliseconds) {
+                bestMilliseconds = result.stats.totalMilliseconds;
+                best = std::move(result);
+            }
+        }
+
+        const GltfImportStats& stats = best.stats;
+        std::printf("%-18s %10.2f %10.1f %8.2f %8.2f %8.2f %10llu %9llu %8.3f %10.1f\n", label, stats.totalMilliseconds,
+                    stats.getMegabytesPerSecond(), stats.readMilliseconds, stats.parseMilliseconds, stats.processMilliseconds,
+                    static_cast<unsigned long long>(stats.triangleCount), static_cast<unsigned long long>(stats.meshletCount),
+                    averageACMR(best), static_cast<double>(stats.outputBytes) / (1024.0 * 1024.0));
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    VKING::Log::Init("VKING-Benchmarks.log", VKING::Log::Level::warn);
+
+    uint32_t meshCount = 16;
+    uint32_t iterations = 3;
+    std::filesystem::path path;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if (parseUnsigned(argument, "--meshes=", meshCount)) continue;
+        if (parseUnsigned(argument, "--iterations=", iterations)) continue;
+        if (argument.starts_with("--file=")) { path = argument.substr(7); continue; }
+        std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+        return 1;
+    }
+
+    const std::filesystem::path workDirectory = std::filesystem::temp_directory_path() / "VKING-MeshImportBenchmark";
+    std::filesystem::create_directories(workDirectory);
+    const bool generated = path.empty();
+    if (generated) {
+        path = workDirectory / "Spheres.glb";
+        if (!writeSphereGlb(path, meshCount, 128, 256)) {
+            std::fprintf(stderr, "Failed to write %s\n", path.string().c_str());
+            return 1;
+        }
+    }
+
+    std::printf("Mesh import benchmark: %s, %.1f MiB, best of %u imports\n", path.filename().string().c_str(),
+                static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0), iterations);
+    std::printf("%-18s %10s %10s %8s %8s %8s %10s %9s %8s %10s\n", "Configuration", "Total (ms)", "MB/s", "Read",
+                "Parse", "Process", "Triangles", "Meshlets", "ACMR", "Out (MiB)");
+
+    // === Source order, then each optimized layout ===
+    GltfImportSettings settings;
+    settings.mesh.quantize = false;
+    settings.mesh.optimizeVertexCache = false;
+    settings.mesh.optimizeVertexFetch = false;
+    settings.mesh.buildMeshlets = false;
+    settings.mesh.layout = Mesh::StreamLayout::INTERLEAVED;
+    runImports("Unoptimized", path, settings, iterations);
+
+    settings.mesh = {};
+    settings.mesh.layout = Mesh::StreamLayout::INTERLEAVED;
+    runImports("Interleaved", path, settings, iterations);
+
+    settings.mesh.layout = Mesh::StreamLayout::SPLIT;
+    runImports("Split", path, settings, iterations);
+
+    // === Asset cache: the first import fills it, later imports hit ===
+    const AssetCache cache(workDirectory / "Cache");
+    settings.cache = &cache;
+    runImports("Split (cache fill)", path, settings, 1);
+    runImports("Split (cached)", path, settings, iterations);
+
+    std::error_code error;
+    std::filesystem::remove_all(cache.getDirectory(), error);
+    if (generated) std::filesystem::remove(path, error);
+    return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Benchmark_SceneLoad [--entities=<n>] [--iterations=<n>] [--file=<path>]
+//
+// Writes a scene with the requested number of entities, then loads it back repeatedly, once with the
+// schemas it was written with (zero-copy) and once with a changed Velocity schema (migration).
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+import VKING.Log;
+import VKING.Scene.Serialization;
+
+namespace {
+
+    using namespace VKING::Scene;
+
+    struct Transform {
+        float position[3];
+        float rotation[4];
+        float scale[3];
+    };
+
+    struct Velocity {
+        float linear[3];
+    };
+
+    /// What Velocity might look like a few releases later: doubles, plus a new field
+    struct VelocityV2 {
+        double linear[3];
+        float angular[3] = {0.0f, 0.0f, 1.0f};
+    };
+
+    struct Renderable {
+        BlobRef meshName;
+        uint32_t materialIndex;
+    };
+
+    void registerComponents(ComponentRegistry& registry, const bool useVelocityV2) {
+        registry.registerComponent<Transform>("Transform", {
+            {.name = "position", .type = FieldType::FLOAT32, .offset = offsetof(Transform, position), .count = 3},
+            {.name = "rotation", .type = FieldType::FLOAT32, .offset = offsetof(Transform, rotation), .count = 4},
+            {.name = "scale", .type = FieldType::FLOAT32, .offset = offsetof(Transform, scale), .count = 3},
+        });
+        if (useVelocityV2) {
+            registry.registerComponent<VelocityV2>("Velocity", {
+                {.name = "linear", .type = FieldType::FLOAT64, .offset = offsetof(VelocityV2, linear), .count = 3},
+                {.name = "angular", .type = FieldType::FLOAT32, .offset = offsetof(VelocityV2, angular), .count = 3},
+            });
+        } else {
+            registry.registerComponent<Velocity>("Velocity", {
+                {.name = "linear", .type = FieldType::FLOAT32, .offset = offsetof(Velocity, linear), .count = 3},
+            });
+        }
+        registry.registerComponent<Renderable>("Renderable", {
+            {.name = "meshName", .type = FieldType::BLOB_REF, .offset = offsetof(Renderable, meshName), .count = 1},
+            {.name = "materialIndex", .type = FieldType::UINT32, .offset = offsetof(Renderable, materialIndex), .count = 1},
+        });
+    }
+
+    bool parseUnsigned(const std::string_view argument, const std::string_view prefix, uint32_t& value) {
+        if (!argument.starts_with(prefix)) return false;
+        value = static_cast<uint32_t>(std::strtoul(std::string(argument.substr(prefix.size())).c_str(), nullptr, 10));
+        return true;
+    }
+
+    /// Touches every position so lazily mapped pages are counted, and so the load cannot be optimized away
+    double sumPositions(const SceneFile& scene, const uint32_t transformIndex) {
+        double sum = 0.0;
+        for (const SceneArchetype& archetype : scene.getArchetypes()) {
+            const uint32_t column = archetype.findComponent(transformIndex);
+            if (column == UINT32_MAX) continue;
+            for (const ChunkView& chunk : archetype.chunks) {
+                const Transform* transforms = chunk.getColumn<Transform>(column);
+                for (uint32_t i = 0; i < chunk.entityCount; i++) sum += transforms[i].position[0];
+            }
+        }
+        return sum;
+    }
+
+    void runLoads(const char* label, const std::filesystem::path& path, const ComponentRegistry& registry, const uint32_t iterations) {
+        double bestLoad = std::numeric_limits<double>::max();
+        double bestTouch = std::numeric_limits<double>::max();
+        SceneFile::LoadStats stats;
+        double checksum = 0.0;
+
+        for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+            const auto start = std::chrono::steady_clock::now();
+            const auto scene = SceneFile::load(path, registry);
+            const auto loaded = std::chrono::steady_clock::now();
+            if (!scene) {
+                std::fprintf(stderr, "Failed to load %s\n", path.string().c_str());
+                return;
+            }
+            checksum = sumPositions(*scene, registry.findComponent("Transform"));
+            const auto touched = std::chrono::steady_clock::now();
+
+            bestLoad = std::min(bestLoad, std::chrono::duration<double, std::milli>(loaded - start).count());
+            bestTouch = std::min(bestTouch, std::chrono::duration<double, std::milli>(touched - loaded).count());
+            stats = scene->getStats();
+        }
+
+        std::printf("%-10s %10.2f %10.2f %10.2f %10.2f %10.2f %8u %8u  %.1f\n", label, bestLoad, stats.mapMilliseconds,
+                    stats.fixupMilliseconds, stats.migrationMilliseconds, bestTouch, stats.zeroCopyChunks,
+                    stats.migratedChunks, checksum);
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    VKING::Log::Init("VKING-Benchmarks.log", VKING::Log::Level::warn);
+
+    uint32_t entities = 1'000'000;
+    uint32_t iterations = 5;
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "VKING-SceneLoadBenchmark.vkscene";
+
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if (parseUnsigned(argument, "--entities=", entities)) continue;
+        if (parseUnsigned(argument, "--iterations=", iterations)) continue;
+        if (argument.starts_with("--file=")) { path = argument.substr(7); continue; }
+        std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+        return 1;
+    }
+
+    ComponentRegistry registry;
+    registerComponents(registry, false);
+
+    // === Write ===
+    const auto writeStart = std::chrono::steady_clock::now();
+    {
+        SceneWriter writer(registry);
+        const std::string_view moving[] = {"Transform", "Velocity"};
+        const std::string_view rendered[] = {"Transform", "Renderable"};
+        const uint32_t movingArchetype = writer.addArchetype(moving);
+        const uint32_t renderedArchetype = writer.addArchetype(rendered);
+        const BlobRef meshNames[] = {writer.addString("Meshes/Rock.mesh"), writer.addString("Meshes/Tree.mesh")};
+
+        uint64_t nextEntity = 0;
+        writer.appendEntities(movingArchetype, entities / 2, [&](const ChunkView& chunk, const uint32_t begin, const uint32_t end) {
+            auto* transforms = chunk.getColumn<Transform>(0);
+            auto* velocities = chunk.getColumn<Velocity>(1);
+            for (uint32_t i = begin; i < end; i++) {
+                const auto x = static_cast<float>(nextEntity % 1000);
+                chunk.getEntities()[i] = nextEntity++;
+                transforms[i] = {{x, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}};
+                velocities[i] = {{1.0f, 0.0f, x}};
+            }
+        });
+        writer.appendEntities(renderedArchetype, entities - entities / 2, [&](const ChunkView& chunk, const uint32_t begin, const uint32_t end) {
+            auto* transforms = chunk.getColumn<Transform>(0);
+            auto* renderables = chunk.getColumn<Renderable>(1);
+            for (uint32_t i = begin; i < end; i++) {
+                const auto x = static_cast<float>(nextEntity % 1000);
+                chunk.getEntities()[i] = nextEntity++;
+                transforms[i] = {{x, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}};
+                renderables[i] = {meshNames[i & 1], i % 16};
+            }
+        });
+
+        if (!writer.save(path)) {
+            std::fprintf(stderr, "Failed to write %s\n", path.string().c_str());
+            return 1;
+        }
+    }
+    const double writeMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - writeStart).count();
+
+    std::printf("Scene load benchmark: %u entities, %.1f MiB on disk, written in %.2f ms, best of %u loads\n",
+                entities, static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0), writeMilliseconds, iterations);
+    std::printf("%-10s %10s %10s %10s %10s %10s %8s %8s  %s\n", "Schemas", "Load (ms)", "Map", "Fixup", "Migrate",
+                "Touch", "InPlace", "Migrated", "Checksum");
+
+    // === Load with identical schemas, then with a changed Velocity ===
+    runLoads("Current", path, registry, iterations);
+
+    ComponentRegistry changedRegistry;
+    registerComponents(changedRegistry, true);
+    runLoads("Changed", path, changedRegistry, iterations);
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Benchmark_Server [--instances=<n>] [--ticks=<n>] [--work-us=<us>] [+server.tickHz=<n>] [+server.residentBudgetMb=<mib>]
+//
+// Runs dedicated server instances for a number of ticks, all in this process through an ApplicationHost, and
+// reports what one costs: CPU time per tick, the share of a core an instance keeps busy, and so how many instances
+// one core can host at that tick rate, next to the resident memory per instance against the server's budget.
+// --work-us adds busy work to each tick to stand in for a game's simulation; without it the numbers are the
+// engine's own overhead. Compare --instances=1 with more to see what sharing a process saves.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <VKING/Signals.hpp>
+
+#if defined(_WIN32)
+#   include <Windows.h>
+#else
+#   include <sys/resource.h>
+#endif
+
+import VKING.Log;
+import VKING.Application;
+import VKING.LaunchOptions;
+import VKING.FrameHarness;
+import VKING.EngineContext;
+import VKING.CVar;
+
+namespace {
+
+    using namespace VKING;
+
+    /// CPU time this process used so far, user and kernel
+    uint64_t getProcessCpuNanoseconds() {
+#if defined(_WIN32)
+        FILETIME creation, exit, kernel, user;
+        if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) return 0;
+        const auto toNanoseconds = [](const FILETIME& time) {
+            return ((uint64_t{time.dwHighDateTime} << 32) | time.dwLowDateTime) * 100;
+        };
+        return toNanoseconds(kernel) + toNanoseconds(user);
+#else
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+        const auto toNanoseconds = [](const timeval& time) {
+            return static_cast<uint64_t>(time.tv_sec) * 1'000'000'000 + static_cast<uint64_t>(time.tv_usec) * 1'000;
+        };
+        return toNanoseconds(usage.ru_utime) + toNanoseconds(usage.ru_stime);
+#endif
+    }
+
+    class BenchmarkServer : public Application {
+    public:
+        BenchmarkServer(const uint64_t ticks, const uint32_t workMicroseconds)
+            : m_Ticks(ticks), m_Work(std::chrono::microseconds(workMicroseconds)) {}
+
+    protected:
+        void onUpdate([[maybe_unused]] const float deltaMilliseconds) override {
+            // Spins rather than sleeps, simulation work keeps the core busy
+            const auto end = std::chrono::steady_clock::now() + m_Work;
+            while (std::chrono::steady_clock::now() < end) {}
+
+            // Ends this instance only, the others finish their own ticks
+            if (++m_TicksRun >= m_Ticks) Shutdown::request(Shutdown::Reason::REASON_USER_REQUEST, "Server benchmark finished.");
+        }
+
+    private:
+        uint64_t m_Ticks;
+        std::chrono::nanoseconds m_Work;
+        uint64_t m_TicksRun = 0;
+    };
+
+    bool parseUnsigned(const std::string_view argument, const std::string_view prefix, uint32_t& value) {
+        if (!argument.starts_with(prefix)) return false;
+        value = static_cast<uint32_t>(std::strtoul(std::string(argument.substr(prefix.size())).c_str(), nullptr, 10));
+        return true;
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    Log::Init("VKING-Benchmarks.log", Log::Level::warn);
+
+    uint32_t instances = 1;
+    uint32_t ticks = 300;
+    uint32_t workMicroseconds = 0;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if (parseUnsigned(argument, "--instances=", instances)) continue;
+        if (parseUnsigned(argument, "--ticks=", ticks)) continue;
+        if (parseUnsigned(argument, "--work-us=", workMicroseconds)) continue;
+        // CVars, applied below
+        if (argument.starts_with("+")) continue;
+        std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+        return 1;
+    }
+    if (instances == 0) instances = 1;
+    if (ticks == 0) ticks = 1;
+    CVars::parseCommandLine(argc, argv);
+
+    LaunchOptions options;
+    options.server = true;
+    setLaunchOptions(options);
+
+    const uint32_t tickRate = std::max(1u, static_cast<uint32_t>(std::strtoul(CVars::get("server.tickHz").value_or("30").c_str(), nullptr, 10)));
+    const uint32_t budgetMegabytes = static_cast<uint32_t>(std::strtoul(CVars::get("server.residentBudgetMb").value_or("0").c_str(), nullptr, 10));
+
+    // Startup of the instances is measured too, it is small next to the ticks and cannot be told apart on their threads
+    const uint64_t cpuStart = getProcessCpuNanoseconds();
+    const auto wallStart = std::chrono::steady_clock::now();
+    uint64_t ticksRun = 0;
+    {
+        ApplicationHost host;
+        for (uint32_t i = 0; i < instances; i++) {
+            host.launch("Server " + std::to_string(i), [ticks, workMicroseconds] { return std::make_unique<BenchmarkServer>(ticks, workMicroseconds); });
+        }
+        host.run();
+        for (size_t i = 0; i < host.getInstanceCount(); i++) ticksRun += host.getInstance(i).getStats().frames;
+    }
+    const double wallNanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - wallStart).count();
+    const auto cpuNanoseconds = static_cast<double>(getProcessCpuNanoseconds() - cpuStart);
+
+    // Per instance: the CPU all of them used, shared over the instances
+    const double load = wallNanoseconds > 0.0 ? cpuNanoseconds / wallNanoseconds / instances : 0.0;
+    const double residentMegabytes = static_cast<double>(FrameHarness::getPeakResidentBytes()) / (1024.0 * 1024.0);
+    const double instanceMegabytes = residentMegabytes / instances;
+
+    std::printf("Server benchmark: %u instances, %llu ticks at %u Hz, %u us of work per tick\n", instances,
+                static_cast<unsigned long long>(ticksRun), tickRate, workMicroseconds);
+    std::printf("%-30s %12.3f\n", "CPU per tick (ms)", ticksRun ? cpuNanoseconds / static_cast<double>(ticksRun) / 1'000'000.0 : 0.0);
+    std::printf("%-30s %12.3f\n", "Core load per instance (%)", load * 100.0);
+    std::printf("%-30s %12.1f\n", "Instances per core", load > 0.0 ? 1.0 / load : 0.0);
+    std::printf("%-30s %12.1f\n", "Peak resident (MiB)", residentMegabytes);
+    std::printf("%-30s %12.1f\n", "Resident per instance (MiB)", instanceMegabytes);
+    std::printf("%-30s %12u %s\n", "Resident budget (MiB)", budgetMegabytes, instanceMegabytes <= budgetMegabytes ? "(within)" : "(OVER)");
+    std::printf("%-30s %12.1f\n", "Instances per GiB", instanceMegabytes > 0.0 ? 1024.0 / instanceMegabytes : 0.0);
+    return 0;
+}
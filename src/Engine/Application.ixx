@@ -20,8 +20,23 @@
 // Created by Matthew Krueger on 1/3/26.
 //
 module;
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
+
+#include <VKING/Signals.hpp>
+
+#include <VKING/Profiler.hpp>
+#include <VKING/LiveMetrics.hpp>
+#include <VKING/Watchdog.hpp>
 
 
 export module VKING.Application;
@@ -30,21 +45,266 @@ import VKING.Log;
 import VKING.Types.Platform;
 import VKING.EngineConfig;
 import VKING.Types.Window;
+import VKING.LaunchOptions;
+import VKING.FrameHarness;
+import VKING.Scene.Schema;
+import VKING.Scene.Serialization;
+import VKING.Startup;
+import VKING.CVar;
+import VKING.TickTimer;
+import VKING.EngineContext;
 
 export namespace VKING {
     class Application {
     public:
+        /**
+         * @brief Selects the platform, then creates the main window (on this thread) and the RHI (on a worker) at once,
+         *        and finally the main window's swapchain.
+         *
+         * With --server none of them are created, see runServer(). The application runs in EngineInstance::getCurrent(),
+         * and an instance hosted by an ApplicationHost always runs as a server.
+         */
         explicit Application();
         virtual ~Application() = default;
 
         /**
          * @brief Main Event Loop
+         *
+         * Loads the --scene given on the command line first, unless adoptWorld() took one over. With --harness, runs
+         * the frame-time harness instead and requests shutdown once the report is written. With --server, runs the
+         * fixed-tick server loop. Returns at once if startup failed.
          */
         void run();
 
+        /**
+         * @return true when running as a dedicated server, without platform, windows or RHI
+         */
+        [[nodiscard]] bool isServer() const { return m_Server; }
+
+        /**
+         * @return The instance the application runs in, with its shutdown state and stats
+         */
+        [[nodiscard]] EngineInstance& getInstance() const { return m_Instance; }
+        [[nodiscard]] EngineContext& getContext() const { return m_Instance.getContext(); }
+
+        /**
+         * @brief Components scenes may contain. Register them in the derived constructor, before run().
+         */
+        Scene::ComponentRegistry& getComponentRegistry() { return m_ComponentRegistry; }
+
+        /**
+         * @brief Loads a scene, replacing the current one.
+         *
+         * @return false if the scene could not be loaded, the current scene is kept
+         */
+        bool loadScene(const std::filesystem::path& path);
+
+        [[nodiscard]] const Scene::SceneFile* getScene() const { return m_Scene.get(); }
+
+        /**
+         * @brief The world one application hands to the next when the game module is reloaded: the scene with its
+         *        entities as they are now, and the component layout they were loaded with.
+         */
+        struct PreservedWorld {
+            std::unique_ptr<Scene::SceneFile> scene;
+            double sceneLoadMilliseconds = 0.0;
+            /// Name and schema hash of each registered component, by registry index
+            std::vector<std::pair<std::string, uint64_t>> components;
+        };
+
+        /**
+         * @brief Gives up the current scene for the next application. The scene lives in engine memory, not in the
+         *        game module, so it outlives the module that created this application.
+         *
+         * Only what the scene holds survives a reload, members of the derived application start over.
+         */
+        PreservedWorld releaseWorld();
+
+        /**
+         * @brief Takes over a world released by the previous application, run() then skips loading --scene.
+         *
+         * Call it once the components are registered. Chunks are taken as they are, so every component the world
+         * knew must keep its registry index and schema hash; new components may be appended.
+         *
+         * @return false if a component changed, the world is dropped and run() loads --scene from its file again
+         */
+        bool adoptWorld(PreservedWorld world);
+
+        /**
+         * @return The backend's RHI, nullptr on the headless platform or if the GPU could not be initialized
+         */
+        [[nodiscard]] Types::Platform::RHI* getRHI() const { return m_RHI.get(); }
+
+        /**
+         * @brief Opens another window on the main window's platform, presenting through the same RHI.
+         *
+         * Closing it only closes that window; closing the main window ends the application.
+         *
+         * @param targetFramesPerSecond How often the window presents, 0 for every frame. Tool windows can present
+         *                              less often than viewports without slowing them down
+         * @return The window, owned by the application until closeWindow() or shutdown. nullptr if it could not be created
+         */
+        Types::Window* openWindow(const Types::Window::WindowCreateInfo& createInfo, uint32_t targetFramesPerSecond = 0);
+
+        /**
+         * @brief Closes a window opened with openWindow(). The main window cannot be closed this way.
+         */
+        void closeWindow(Types::Window* window);
+
+        /**
+         * @return The window created at startup, nullptr if startup failed
+         */
+        [[nodiscard]] Types::Window* getMainWindow() const { return m_Windows.empty() ? nullptr : m_Windows.front().window.get(); }
+        [[nodiscard]] size_t getWindowCount() const { return m_Windows.size(); }
+
+        /**
+         * @return The swapchain a window presents through, nullptr without an RHI or if the backend cannot present to it
+         */
+        [[nodiscard]] Types::Platform::Swapchain* getSwapchain(const Types::Window* window) const;
+
+    protected:
+        /**
+         * @brief Called once per frame, after the frame's input events were handed to onInputEvent().
+         *
+         * @param deltaMilliseconds Time since the previous frame started
+         */
+        virtual void onUpdate([[maybe_unused]] float deltaMilliseconds) {}
+
+        /**
+         * @brief Called for every input event that arrived since the previous frame, oldest first, right before onUpdate().
+         *
+         * event.timestampNanoseconds is on the Types::InputQueue::now() clock, so it places the event within the frame.
+         */
+        virtual void onInputEvent([[maybe_unused]] Types::Window& window, [[maybe_unused]] const Types::InputEvent& event) {}
+
     private:
+        struct WindowSlot {
+            std::unique_ptr<Types::Window> window;
+            /// Declared after the window so it is destroyed first
+            std::unique_ptr<Types::Platform::Swapchain> swapchain;
+            /// 0 presents every frame
+            std::chrono::nanoseconds presentInterval{0};
+            std::chrono::steady_clock::time_point nextPresent;
+            uint64_t reportedDroppedInput = 0;
+        };
+
+        /**
+         * @brief Creates a window and its swapchain, the main window first.
+         */
+        Types::Window* addWindow(const Types::Window::WindowCreateInfo& createInfo, uint32_t targetFramesPerSecond, bool main);
+
+        /**
+         * @brief Hands every input event that arrived up to now, from every window, to onInputEvent().
+         */
+        void dispatchInput();
+
+        /**
+         * @brief Closes the secondary windows whose close was requested by the window system.
+         */
+        void closeRequestedWindows();
+
+        /**
+         * @brief Presents every window that is due by its own target rate, all in one batch on the RHI.
+         */
+        void presentWindows();
+
+        /**
+         * @brief Runs --warmup-frames unmeasured and --frames measured frames as fast as possible, then writes the report.
+         */
+        void runHarness();
+
+        /**
+         * @brief Calls onUpdate() at server.tickHz with a fixed delta until shutdown is requested.
+         *
+         * Ticks are paced by a TickTimer, so an idle server sleeps in the kernel between ticks instead of polling.
+         * After a stall it runs up to SERVER_MAX_CATCH_UP_TICKS ticks back to back and skips the rest. Peak resident
+         * memory is checked against server.residentBudgetMb about once a second.
+         */
+        void runServer();
+
+        /**
+         * @brief Per-frame bookkeeping once a frame or tick is done: the instance's stats, and for the process's instance
+         *        the live metrics and the watchdog too.
+         */
+        void endFrame(double milliseconds);
+
+        EngineInstance& m_Instance;
+        // Destroyed bottom up: windows and their swapchains, then the RHI they share, then the platform that made them all
         std::unique_ptr<VKING::Types::Platform::PlatformManager> m_PlatformManager;
-        std::unique_ptr<Types::Window> m_Window;
+        std::unique_ptr<Types::Platform::RHI> m_RHI;
+        /// The main window first
+        std::vector<WindowSlot> m_Windows;
+        Scene::ComponentRegistry m_ComponentRegistry;
+        std::unique_ptr<Scene::SceneFile> m_Scene;
+        double m_SceneLoadMilliseconds = 0.0;
+        bool m_Server = false;
+    };
+
+    /**
+     * @brief Runs several applications as instances of one EngineContext, each on a thread of its own.
+     *
+     * Every instance shares the context's job system and asset cache with the others, but stops, restarts and
+     * counts its frames on its own: its application's Shutdown::request() ends that instance alone (and a restart
+     * request constructs a new application in it), while a signal ends them all. Hosted applications always run as
+     * dedicated servers.
+     *
+     * @code
+     * EngineContext context;
+     * ApplicationHost host(context);
+     * for (uint32_t match = 0; match < 32; match++) {
+     *     host.launch("Match " + std::to_string(match), [] { return std::make_unique<MatchServer>(); });
+     * }
+     * host.run();
+     * @endcode
+     */
+    class ApplicationHost {
+    public:
+        using Factory = std::function<std::unique_ptr<Application>()>;
+
+        explicit ApplicationHost(EngineContext& context = EngineContext::getDefault());
+
+        /**
+         * @brief Requests every instance to shut down and waits for them.
+         */
+        ~ApplicationHost();
+
+        ApplicationHost(const ApplicationHost&) = delete;
+        ApplicationHost& operator=(const ApplicationHost&) = delete;
+
+        /**
+         * @brief Starts an instance. factory is called on the instance's thread, and again after each restart.
+         */
+        EngineInstance& launch(std::string name, Factory factory);
+
+        /**
+         * @brief Blocks until every instance has stopped. Meanwhile this thread does the process's part of the main
+         *        loop: config hot reload and CVar change callbacks, and the watchdog's heartbeat. The heartbeat only
+         *        comes once every running instance has ticked since the last one, so one stalled instance trips the
+         *        watchdog even while the others keep going.
+         */
+        void run();
+
+        /**
+         * @brief Requests every instance to shut down, without waiting for them.
+         */
+        void requestShutdown(Shutdown::Reason reason, const char* message = nullptr);
+
+        [[nodiscard]] size_t getInstanceCount() const { return m_Instances.size(); }
+        [[nodiscard]] EngineInstance& getInstance(const size_t index) const { return *m_Instances[index].instance; }
+        [[nodiscard]] EngineContext& getContext() const { return m_Context; }
+
+    private:
+        struct HostedInstance {
+            std::unique_ptr<EngineInstance> instance;
+            std::thread thread;
+            /// The instance's frame count at the last watchdog heartbeat
+            uint64_t heartbeatFrames = 0;
+        };
+
+        static void runInstance(EngineInstance& instance, const Factory& factory);
+
+        EngineContext& m_Context;
+        std::vector<HostedInstance> m_Instances;
     };
 
 } // VKING
@@ -52,37 +312,472 @@ export namespace VKING {
 
 namespace VKING {
 
-    Application::Application() {
+    using ApplicationLogger = Log::Named<"Application">;
+
+    CVars::CVar<uint32_t> s_FrameSleepMilliseconds{"app.frameSleepMs", 10, "Idle sleep per interactive frame, in milliseconds"};
+    CVars::CVar<uint32_t> s_WindowWidth{"window.width", 1280, "Width of the main window when it is created"};
+    CVars::CVar<uint32_t> s_WindowHeight{"window.height", 720, "Height of the main window when it is created"};
+    CVars::CVar<uint32_t> s_ServerTickRate{"server.tickHz", 30, "Ticks per second of a dedicated server, read when it starts"};
+    /// The budget one dedicated server instance is held to. A server process with an empty simulation peaks near
+    /// 10 MiB once its profiler history is capped (see SERVER_RETAINED_TICKS), so this leaves about twice that to the
+    /// simulation; VKING_Benchmark_Server reports where an instance lands
+    CVars::CVar<uint32_t> s_ServerResidentBudgetMegabytes{"server.residentBudgetMb", 32,
+                                                          "Peak resident memory a dedicated server instance may use before it warns, in MiB"};
+
+    /// How often ApplicationHost::run() does the process's housekeeping while its instances run
+    constexpr auto HOST_UPDATE_INTERVAL = std::chrono::milliseconds(100);
+
+    /// Ticks of profiler history a dedicated server keeps, whatever was asked for: a server runs for days, and its
+    /// resident budget has no room for a long history
+    constexpr uint32_t SERVER_RETAINED_TICKS = Profiler::DEFAULT_RETAINED_FRAMES;
+
+    /// Ticks a server runs back to back to catch up after a stall. Further missed ticks are skipped rather than
+    /// letting a server that cannot keep up fall ever further behind
+    constexpr uint64_t SERVER_MAX_CATCH_UP_TICKS = 5;
+
+    Application::Application()
+        : m_Instance(EngineInstance::getCurrent()) {
+        VKING_PROFILE_SCOPE("Application::Application");
 
-        m_PlatformManager = VKING::EngineConfig::selectPlatform({.platformType = Types::Platform::PlatformType::PLATFORM_NO_PREFERENCE, .backendType = Types::Platform::BackendType::VULKAN});
-        m_Window = m_PlatformManager->createWindow({"VKING Window", 1280, 720});
-        m_Window->setWindowCloseRequestCallbackEventFN([]([[maybe_unused]] Types::Window* window) {
-            VKING::Shutdown::request(Shutdown::Reason::REASON_USER_REQUEST, "Window Close Request Received.");
+        // Nothing is rendered on a dedicated server, so no platform is selected at all: no plugins are opened, no
+        // probes run, and no window system connection, GPU driver or swapchain is ever created. Hosted instances run
+        // off the main thread, where window systems are not available anyway
+        if (getLaunchOptions().server || !m_Instance.isProcess()) {
+            m_Server = true;
+            ApplicationLogger::record().info("Dedicated server '{}', skipping platform, window and RHI creation.", m_Instance.getName());
+            return;
+        }
+
+        Startup::InitGraph graph;
+        graph.add({"Platform.select", {}, [this] {
+            if (getLaunchOptions().headless) {
+                m_PlatformManager = VKING::EngineConfig::selectPlatform({.platformType = Types::Platform::PlatformType::HEADLESS, .backendType = Types::Platform::BackendType::HEADLESS});
+            } else {
+                m_PlatformManager = VKING::EngineConfig::selectPlatform({.platformType = Types::Platform::PlatformType::PLATFORM_NO_PREFERENCE, .backendType = Types::Platform::BackendType::VULKAN});
+            }
+            return m_PlatformManager != nullptr;
+        }, true});
+        // Window systems generally insist on their main thread
+        graph.add({"Window.create", {"Platform.select"}, [this] {
+            return addWindow({"VKING Window", s_WindowWidth.get(), s_WindowHeight.get()}, 0, true) != nullptr;
+        }, true});
+        // Instance and device creation, the slowest part of startup on most drivers. Nothing renders yet, so
+        // running without an RHI is not a startup failure
+        graph.add({"RHI.create", {"Platform.select"}, [this] {
+            m_RHI = m_PlatformManager->createRHI();
             return true;
-        });
+        }});
+        // Needs both the window and the device; surfaces belong to the window system's thread as well
+        graph.add({"Swapchain.create", {"Window.create", "RHI.create"}, [this] {
+            if (m_RHI) m_Windows.front().swapchain = m_PlatformManager->createSwapchain(*m_RHI, *m_Windows.front().window);
+            return true;
+        }, true});
+
+        if (!graph.run()) {
+            Shutdown::request(Shutdown::Reason::REASON_FATAL_ERROR, "Engine startup failed.");
+        }
+    }
+
+    Types::Window* Application::addWindow(const Types::Window::WindowCreateInfo& createInfo, const uint32_t targetFramesPerSecond, const bool main) {
+        VKING_PROFILE_SCOPE("Application::addWindow");
+
+        WindowSlot slot;
+        slot.window = m_PlatformManager->createWindow(createInfo);
+        if (!slot.window) {
+            ApplicationLogger::record().error("Could not create window '{}'.", createInfo.title);
+            return nullptr;
+        }
+        if (main) {
+            slot.window->setWindowCloseRequestCallbackEventFN([]([[maybe_unused]] Types::Window* window) {
+                VKING::Shutdown::request(Shutdown::Reason::REASON_USER_REQUEST, "Window Close Request Received.");
+                return true;
+            });
+        } else {
+            // Closed by the main loop, not from inside the window system's callback
+            slot.window->setWindowCloseRequestCallbackEventFN([](Types::Window* window) {
+                window->requestClose();
+                return true;
+            });
+        }
+        // The main window's swapchain is created by the startup graph, once the RHI exists
+        if (!main && m_RHI) slot.swapchain = m_PlatformManager->createSwapchain(*m_RHI, *slot.window);
+        if (targetFramesPerSecond > 0) slot.presentInterval = std::chrono::nanoseconds(1'000'000'000 / targetFramesPerSecond);
+
+        m_Windows.push_back(std::move(slot));
+        return m_Windows.back().window.get();
+    }
+
+    Types::Window* Application::openWindow(const Types::Window::WindowCreateInfo& createInfo, const uint32_t targetFramesPerSecond) {
+        if (m_Windows.empty()) {
+            ApplicationLogger::record().error("Cannot open window '{}' without a main window.", createInfo.title);
+            return nullptr;
+        }
+        Types::Window* window = addWindow(createInfo, targetFramesPerSecond, false);
+        if (window) ApplicationLogger::record().info("Opened window '{}', {} windows open.", createInfo.title, m_Windows.size());
+        return window;
+    }
+
+    void Application::closeWindow(Types::Window* window) {
+        if (m_Windows.empty() || window == m_Windows.front().window.get()) {
+            ApplicationLogger::record().warn("The main window is not closed with closeWindow(), request a shutdown instead.");
+            return;
+        }
+        const auto erased = std::erase_if(m_Windows, [window](const WindowSlot& slot) { return slot.window.get() == window; });
+        if (erased) ApplicationLogger::record().info("Closed a window, {} windows open.", m_Windows.size());
+    }
+
+    Types::Platform::Swapchain* Application::getSwapchain(const Types::Window* window) const {
+        const auto slot = std::ranges::find_if(m_Windows, [window](const WindowSlot& candidate) { return candidate.window.get() == window; });
+        return slot == m_Windows.end() ? nullptr : slot->swapchain.get();
+    }
+
+    bool Application::loadScene(const std::filesystem::path& path) {
+        VKING_PROFILE_SCOPE("Application::loadScene");
+
+        const auto start = std::chrono::steady_clock::now();
+        std::unique_ptr<Scene::SceneFile> scene = Scene::SceneFile::load(path, m_ComponentRegistry);
+        if (!scene) {
+            ApplicationLogger::record().error("Could not load scene {}.", path.string());
+            return false;
+        }
+        m_SceneLoadMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        ApplicationLogger::record().info("Loaded scene {} with {} entities in {:.2f} ms.", path.string(), scene->getEntityCount(), m_SceneLoadMilliseconds);
+        m_Scene = std::move(scene);
+        return true;
+    }
+
+    Application::PreservedWorld Application::releaseWorld() {
+        PreservedWorld world;
+        if (!m_Scene) return world;
+        for (const Scene::ComponentSchema& schema : m_ComponentRegistry.getSchemas()) {
+            world.components.emplace_back(schema.name, schema.hash);
+        }
+        world.scene = std::move(m_Scene);
+        world.sceneLoadMilliseconds = m_SceneLoadMilliseconds;
+        return world;
+    }
+
+    bool Application::adoptWorld(PreservedWorld world) {
+        if (!world.scene) return false;
+
+        const std::span<const Scene::ComponentSchema> schemas = m_ComponentRegistry.getSchemas();
+        for (size_t index = 0; index < world.components.size(); index++) {
+            const auto& [name, hash] = world.components[index];
+            if (index >= schemas.size() || schemas[index].name != name || schemas[index].hash != hash) {
+                ApplicationLogger::record().warn("Component {} changed its layout, the scene is loaded from its file again.", name);
+                return false;
+            }
+        }
+
+        m_Scene = std::move(world.scene);
+        m_SceneLoadMilliseconds = world.sceneLoadMilliseconds;
+        ApplicationLogger::record().info("Took over the previous application's scene with {} entities.", m_Scene->getEntityCount());
+        return true;
     }
 
     void Application::run() {
 
+        // The constructor only requests a shutdown when startup fails, the loops below would run without a platform
+        if (Shutdown::isRequested() || (!m_Server && !m_PlatformManager)) {
+            ApplicationLogger::record().error("Not running the application, startup did not complete.");
+            return;
+        }
+
+        const LaunchOptions& options = getLaunchOptions();
+        // A scene taken over from before a reload is kept
+        if (!m_Scene && !options.scenePath.empty()) loadScene(options.scenePath);
+
+        if (m_Server) {
+            runServer();
+            return;
+        }
+        if (options.harness) {
+            runHarness();
+            return;
+        }
+
         using clock = std::chrono::steady_clock;
         auto previousTime = clock::now();
         auto currentTime = previousTime;
         float deltaTime = 0.0f;
 
         while (!Shutdown::isRequested()) {
+            VKING_PROFILE_FRAME();
+            VKING_PROFILE_SCOPE("Application::frame");
 
             currentTime = clock::now();
             deltaTime = std::chrono::duration<float, std::milli>(currentTime - previousTime).count();
             previousTime = currentTime;
 
-            // just while we don't have a real event loop or load, lets prevent the thread from infinitely sinning
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            // Spend the idle part of the frame pumping events instead of sleeping, so input is stamped when it
+            // arrives rather than when the frame gets around to it. Window systems want this on the main thread
+            {
+                VKING_PROFILE_SCOPE("Application::idle");
+                const auto idleEnd = currentTime + std::chrono::milliseconds(s_FrameSleepMilliseconds.get());
+                for (const WindowSlot& slot : m_Windows) slot.window->pollEvents();
+                // Window systems deliver every window's events from one queue, waiting on the main window covers all of them
+                for (auto now = clock::now(); now < idleEnd; now = clock::now()) {
+                    getMainWindow()->waitEvents(std::chrono::duration<double>(idleEnd - now).count());
+                }
+            }
+            // Config file hot reload and change callbacks, both on this thread
+            CVars::update();
             //VKING::Shutdown::request(VKING::Shutdown::Reason::REASON_FATAL_ERROR, "No work to do");
 
-            m_Window->pollEvents();
+            dispatchInput();
+            closeRequestedWindows();
+            onUpdate(deltaTime);
+            presentWindows();
+
+            endFrame(std::chrono::duration<double, std::milli>(clock::now() - currentTime).count());
+        }
+        // Teardown and the next application's startup are not frames
+        Watchdog::pause();
+
+    }
+
+    void Application::dispatchInput() {
+        VKING_PROFILE_SCOPE("Application::dispatchInput");
+        const uint64_t until = Types::InputQueue::now();
+        // Indexed, onInputEvent() may open windows
+        for (size_t i = 0; i < m_Windows.size(); i++) {
+            Types::Window& window = *m_Windows[i].window;
+            Types::InputQueue& input = window.getInputQueue();
+            input.drain(until, [this, &window](const Types::InputEvent& event) { onInputEvent(window, event); });
 
+            if (const uint64_t dropped = input.getDroppedCount(); dropped != m_Windows[i].reportedDroppedInput) {
+                ApplicationLogger::record().warn("Input queue overflowed, {} events dropped so far.", dropped);
+                m_Windows[i].reportedDroppedInput = dropped;
+            }
         }
+    }
+
+    void Application::closeRequestedWindows() {
+        const Types::Window* mainWindow = getMainWindow();
+        const auto closed = std::erase_if(m_Windows, [mainWindow](const WindowSlot& slot) {
+            return slot.window->isCloseRequested() && slot.window.get() != mainWindow;
+        });
+        if (closed) ApplicationLogger::record().info("Closed {} windows at their request, {} windows open.", closed, m_Windows.size());
+    }
+
+    void Application::presentWindows() {
+        if (!m_RHI) return;
+        VKING_PROFILE_SCOPE("Application::presentWindows");
+
+        // Each window keeps its own pace; only the ones that are due join this frame's batch
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<Types::Platform::Swapchain*> due;
+        due.reserve(m_Windows.size());
+        for (WindowSlot& slot : m_Windows) {
+            if (!slot.swapchain || now < slot.nextPresent) continue;
+            slot.window->onBeforePresent();
+            due.push_back(slot.swapchain.get());
+            // A window that fell more than an interval behind restarts its pace instead of presenting to catch up
+            slot.nextPresent += slot.presentInterval;
+            if (slot.nextPresent <= now) slot.nextPresent = now + slot.presentInterval;
+
+            // With presentation feedback the pace locks to the display: the interval becomes a whole number of
+            // refreshes counted from the last frame actually shown, aiming half a refresh ahead of the one it targets
+            const auto timing = slot.window->getPresentationTiming();
+            if (slot.presentInterval.count() == 0 || !timing || timing->refreshNanoseconds == 0) continue;
+            const uint64_t refresh = timing->refreshNanoseconds;
+            const uint64_t refreshes = std::max<uint64_t>(1, (static_cast<uint64_t>(slot.presentInterval.count()) + refresh / 2) / refresh);
+            const auto target = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(timing->lastPresentNanoseconds + refreshes * refresh - refresh / 2));
+            if (target > now) slot.nextPresent = target;
+        }
+        m_RHI->present(due);
+    }
+
+    void Application::runHarness() {
+
+        const LaunchOptions& options = getLaunchOptions();
+        FrameHarness harness({
+            .scenePath = options.scenePath,
+            .sceneEntities = m_Scene ? m_Scene->getEntityCount() : 0,
+            .sceneLoadMilliseconds = m_Scene ? m_SceneLoadMilliseconds : 0.0,
+            .platform = Types::Platform::platformToString(m_PlatformManager->getPlatformType()),
+            .backend = Types::Platform::backendToString(m_PlatformManager->getBackendType()),
+            .warmupFrames = options.warmupFrames
+        }, options.measuredFrames);
+        ApplicationLogger::record().info("Harness: {} warm-up and {} measured frames.", options.warmupFrames, options.measuredFrames);
+
+        using clock = std::chrono::steady_clock;
+        auto previousTime = clock::now();
+        const uint64_t totalFrames = uint64_t{options.warmupFrames} + options.measuredFrames;
+
+        // No idle sleep here: the harness measures how long a frame takes, not how often one is allowed to run
+        for (uint64_t frame = 0; frame < totalFrames && !Shutdown::isRequested(); frame++) {
+            VKING_PROFILE_FRAME();
+
+            const auto frameStart = clock::now();
+            {
+                VKING_PROFILE_SCOPE("Application::frame");
+                dispatchInput();
+                onUpdate(std::chrono::duration<float, std::milli>(frameStart - previousTime).count());
+                for (const WindowSlot& slot : m_Windows) slot.window->pollEvents();
+                presentWindows();
+            }
+            const auto frameEnd = clock::now();
+            previousTime = frameStart;
+            endFrame(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+
+            if (frame >= options.warmupFrames) harness.recordFrame(std::chrono::duration<double, std::nano>(frameEnd - frameStart).count());
+        }
+        // Closes the last measured frame for the profiler
+        VKING_PROFILE_FRAME();
+        Watchdog::pause();
+
+        harness.writeReport(options.reportPath);
+        Shutdown::request(Shutdown::Reason::REASON_USER_REQUEST, "Frame harness finished.");
+
+    }
+
+    void Application::runServer() {
+
+        const uint32_t tickRate = std::max(1u, s_ServerTickRate.get());
+        const uint64_t residentBudgetBytes = uint64_t{s_ServerResidentBudgetMegabytes.get()} * 1024 * 1024;
+        TickTimer timer(std::chrono::nanoseconds(1'000'000'000 / tickRate));
+        const float tickMilliseconds = std::chrono::duration<float, std::milli>(timer.getInterval()).count();
+        ApplicationLogger::record().info("Server ticking at {} Hz, resident budget {} MiB.", tickRate, s_ServerResidentBudgetMegabytes.get());
+        if (m_Instance.isProcess() && Profiler::getRetainedFrames() > SERVER_RETAINED_TICKS) {
+            Profiler::setRetainedFrames(SERVER_RETAINED_TICKS);
+            ApplicationLogger::record().info("Profiler history limited to the last {} ticks on a dedicated server.", SERVER_RETAINED_TICKS);
+        }
+
+        using clock = std::chrono::steady_clock;
+        uint64_t ticks = 0;
+        uint64_t skippedTicks = 0;
+        // The budget is per instance, the peak per process: only a process of its own can be held to it
+        uint64_t nextBudgetCheck = m_Instance.isProcess() ? 0 : UINT64_MAX;
+
+        while (!Shutdown::isRequested()) {
+            const uint64_t due = timer.wait();
+            if (due == 0) continue;
+
+            const uint64_t run = std::min(due, SERVER_MAX_CATCH_UP_TICKS);
+            if (run < due) {
+                skippedTicks += due - run;
+                ApplicationLogger::record().warn("Server fell {} ticks behind, {} ticks skipped so far.", due, skippedTicks);
+            }
+
+            for (uint64_t i = 0; i < run && !Shutdown::isRequested(); i++) {
+                // Frame boundaries are process wide: hosted instances ticking on their own clocks would cut each other's frames
+                if (m_Instance.isProcess()) VKING_PROFILE_FRAME();
+                VKING_PROFILE_SCOPE("Application::tick");
+
+                const auto tickStart = clock::now();
+                // Hosted instances leave config reloads and change callbacks to the host's thread
+                if (m_Instance.isProcess()) CVars::update();
+                // Fixed, not measured: the simulation advances the same amount every tick, caught up ones included
+                onUpdate(tickMilliseconds);
+
+                endFrame(std::chrono::duration<double, std::milli>(clock::now() - tickStart).count());
+                ticks++;
+            }
+
+            // Only the first overrun is reported, the peak cannot come back down
+            if (nextBudgetCheck != UINT64_MAX && ticks >= nextBudgetCheck) {
+                nextBudgetCheck = ticks + tickRate;
+                if (const uint64_t resident = FrameHarness::getPeakResidentBytes(); resident > residentBudgetBytes) {
+                    ApplicationLogger::record().warn("Server peak resident memory is {} MiB, over its {} MiB budget.",
+                                                     resident / (1024 * 1024), s_ServerResidentBudgetMegabytes.get());
+                    nextBudgetCheck = UINT64_MAX;
+                }
+            }
+        }
+        if (m_Instance.isProcess()) {
+            // Closes the last tick for the profiler
+            VKING_PROFILE_FRAME();
+            Watchdog::pause();
+        }
+
+    }
+
+    void Application::endFrame(const double milliseconds) {
+        m_Instance.recordFrame(milliseconds);
+        // The live metrics and the watchdog watch the process's main loop; hosted instances are watched by their stats
+        if (!m_Instance.isProcess()) return;
+        LiveMetrics::publishFrame(milliseconds);
+        Watchdog::heartbeat();
+        Startup::markFirstFrame();
+    }
+
+    ApplicationHost::ApplicationHost(EngineContext& context)
+        : m_Context(context) {}
+
+    ApplicationHost::~ApplicationHost() {
+        requestShutdown(Shutdown::Reason::REASON_USER_REQUEST, "Application host destroyed.");
+        for (HostedInstance& hosted : m_Instances) {
+            if (hosted.thread.joinable()) hosted.thread.join();
+        }
+    }
+
+    EngineInstance& ApplicationHost::launch(std::string name, Factory factory) {
+        HostedInstance hosted;
+        hosted.instance = std::make_unique<EngineInstance>(m_Context, std::move(name));
+        // Running before the thread starts, so run() cannot miss an instance that has yet to construct its application
+        hosted.instance->setRunning(true);
+        hosted.thread = std::thread([instance = hosted.instance.get(), factory = std::move(factory)] { runInstance(*instance, factory); });
+        m_Instances.push_back(std::move(hosted));
+        return *m_Instances.back().instance;
+    }
+
+    void ApplicationHost::runInstance(EngineInstance& instance, const Factory& factory) {
+        EngineInstance::Binding binding(instance);
+        VKING_PROFILE_THREAD(instance.getName());
+        ApplicationLogger::record().info("Instance '{}' started.", instance.getName());
+
+        bool shouldRestart = true;
+        while (shouldRestart) {
+            std::unique_ptr<Application> application = factory();
+            if (!application) {
+                ApplicationLogger::record().error("Instance '{}' could not create its application.", instance.getName());
+                break;
+            }
+            application->run();
+
+            // Shutdown now acts on the instance's own state, apart from a process shutdown, which wins over a restart
+            const Shutdown::Info shutdownInfo = Shutdown::getReason();
+            shouldRestart = Shutdown::restartRequested();
+            ApplicationLogger::record().info("Instance '{}' stopped: {}. {}", instance.getName(), Shutdown::reasonToString(shutdownInfo.reason),
+                                             shouldRestart ? "Restarting." : "Not restarting.");
+            application.reset();
+            Shutdown::clearRequest();
+            if (shouldRestart) instance.recordRestart();
+        }
+        instance.setRunning(false);
+    }
+
+    void ApplicationHost::run() {
+        const auto isRunning = [this] {
+            return std::ranges::any_of(m_Instances, [](const HostedInstance& hosted) { return hosted.instance->getStats().running; });
+        };
+        // Instances that have stopped no longer hold the heartbeat back
+        const auto allInstancesAdvanced = [this] {
+            const bool advanced = std::ranges::all_of(m_Instances, [](const HostedInstance& hosted) {
+                const InstanceStats stats = hosted.instance->getStats();
+                return !stats.running || stats.frames > hosted.heartbeatFrames;
+            });
+            if (advanced) {
+                for (HostedInstance& hosted : m_Instances) hosted.heartbeatFrames = hosted.instance->getStats().frames;
+            }
+            return advanced;
+        };
+        while (isRunning()) {
+            // The host marks frames for its instances, one per update, so the profiler's history stays bounded
+            VKING_PROFILE_FRAME();
+            CVars::update();
+            if (allInstancesAdvanced()) Watchdog::heartbeat();
+            Startup::markFirstFrame();
+            std::this_thread::sleep_for(HOST_UPDATE_INTERVAL);
+        }
+        for (HostedInstance& hosted : m_Instances) {
+            if (hosted.thread.joinable()) hosted.thread.join();
+        }
+    }
 
+    void ApplicationHost::requestShutdown(const Shutdown::Reason reason, const char* message) {
+        for (const HostedInstance& hosted : m_Instances) hosted.instance->getShutdown().request(reason, message);
     }
 
-}
\ No newline at end of file
+}
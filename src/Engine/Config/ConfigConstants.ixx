@@ -48,7 +48,7 @@ namespace VKING::EngineConfig {
      * @return A vector of `ScoredType` objects, where each object contains a supported
      *         platform type and its associated score.
      */
-    constexpr auto getPlatformScores() {
+    export constexpr auto getPlatformScores() {
         std::vector<ScoredType<Types::Platform::PlatformType>> platforms;
 
         if constexpr (VKING_HAS_GLFW == 1) {
@@ -94,7 +94,7 @@ namespace VKING::EngineConfig {
      * @return A vector of `ScoredType` objects, where each object contains a supported backend
      *         type and its associated score.
      */
-    constexpr auto getBackendScores() {
+    export constexpr auto getBackendScores() {
         std::vector<ScoredType<Types::Platform::BackendType>> backends;
 
         if constexpr (VKING_HAS_VULKAN == 1) {
@@ -133,7 +133,7 @@ namespace VKING::EngineConfig {
      *         `std::numeric_limits<uint16_t>::max()` if the platform is not found or if there are
      *         duplicate entries for the platform.
      */
-    constexpr uint16_t getPlatformScore(const std::vector<ScoredType<Types::Platform::PlatformType, uint16_t>> &platforms, const Types::Platform::PlatformType desiredPlatform) {
+    export constexpr uint16_t getPlatformScore(const std::vector<ScoredType<Types::Platform::PlatformType, uint16_t>> &platforms, const Types::Platform::PlatformType desiredPlatform) {
 
         auto score = std::numeric_limits<uint16_t>::max();
         uint32_t candidates = 0;
@@ -164,7 +164,7 @@ namespace VKING::EngineConfig {
      * @return The score associated with the desired backend if exactly one match is found,
      *         or the maximum possible score if no match or multiple matches are found.
      */
-    constexpr uint16_t getBackendScore(const std::vector<ScoredType<Types::Platform::BackendType, uint16_t>> &backends, const Types::Platform::BackendType desiredBackend) {
+    export constexpr uint16_t getBackendScore(const std::vector<ScoredType<Types::Platform::BackendType, uint16_t>> &backends, const Types::Platform::BackendType desiredBackend) {
 
         auto score = std::numeric_limits<uint16_t>::max();
         uint32_t candidates = 0;
@@ -191,10 +191,13 @@ namespace VKING::EngineConfig {
      * A Meyers singleton is used to ensure the table is initialized only once and is shared across all invocations of the
      * function, minimizing overhead from repeated computations.
      *
+     * Entries of platform plugins (see setPlatformPluginDirectory()) are included, without their create functions until
+     * one of them is selected.
+     *
      * @return A constant reference to a vector of `ScoredType` objects, where each object represents a platform specification
      *         and its corresponding score.
      */
-    const std::vector<ScoredType<Types::Platform::PlatformManager::PlatformSpecification>> &getAvailablePlatformConfigurations();
+    export const std::vector<ScoredType<Types::Platform::PlatformManager::PlatformSpecification>> &getAvailablePlatformConfigurations();
 
 
     /**
@@ -219,4 +222,64 @@ namespace VKING::EngineConfig {
         Types::Platform::PlatformManager::PlatformSpecification desiredSpecification
     );
 
+    /**
+     * @brief Whether a configuration of getAvailablePlatformConfigurations() can work on this machine.
+     */
+    export struct PlatformProbeResult {
+        bool available = true;
+        /// Why not, when unavailable
+        std::string reason;
+        /// Read from the probe cache instead of probed by this process
+        bool cached = false;
+        double milliseconds = 0.0;
+    };
+
+    /**
+     * @brief Runs the probe of every configuration (PlatformCreateInfo::pfn_PlatformProbe) the first time it is
+     *        called, in parallel on the job system. selectPlatform() never picks a configuration whose probe failed.
+     *
+     * Configurations that passed are cached on disk at getPlatformProbeCachePath(), keyed by a fingerprint of the
+     * installed Vulkan drivers, the display environment and the executable, so later launches do not probe them again
+     * until one of those changes. Failures are not cached, they may be transient and are probed on every launch.
+     *
+     * @return One result per entry of getAvailablePlatformConfigurations(), in the same order
+     */
+    export const std::vector<PlatformProbeResult>& getPlatformProbeResults();
+
+    /**
+     * @brief Makes getPlatformProbeResults() probe everything instead of trusting the cache. Fresh results are still
+     *        written. Only has an effect before the first getPlatformProbeResults() or selectPlatform().
+     */
+    export void setPlatformProbeCacheIgnored(bool ignored);
+
+    /**
+     * @return Where this executable's probe results are cached, empty if the platform has no cache directory
+     */
+    export std::string getPlatformProbeCachePath();
+
+    /**
+     * @brief Sets where platform plugins are searched for. Only has an effect before the configuration table is first
+     *        built, so it is called before selectPlatform().
+     *
+     * Plugins are glue libraries built with VKING_PLATFORM_PLUGINS, each exporting
+     * Types::Platform::PLATFORM_PLUGIN_REGISTER_SYMBOL. Each is opened once to read its entries and closed again, only
+     * the plugin selectPlatform() picks stays loaded.
+     *
+     * @param directory Empty searches "plugins" next to the executable, then the plugin directory of the build tree
+     */
+    export void setPlatformPluginDirectory(std::string directory);
+
+    /// Entries of every plugin found, with platformCreateInfo empty until loadPlatformPlugin() loads that plugin
+    std::vector<ScoredType<Types::Platform::PlatformManager::PlatformSpecification>> scanPlatformPlugins();
+
+    /// Runs the probe of a plugin's configuration, with the plugin opened only for as long as the probe takes
+    bool probePlatformPlugin(Types::Platform::PlatformType platformType, Types::Platform::BackendType backendType, std::string* reason);
+
+    /// Path of the running executable, empty if it cannot be determined
+    std::string getExecutablePath();
+
+    /// Loads the plugin that offered this combination during the scan, and keeps it loaded for the rest of the process
+    std::optional<Types::Platform::PlatformManager::PlatformSpecification::PlatformCreateInfo> loadPlatformPlugin(
+        Types::Platform::PlatformType platformType, Types::Platform::BackendType backendType);
+
 }
\ No newline at end of file
@@ -19,6 +19,8 @@
 //
 // Created by Matthew Krueger on 1/5/26.
 //
+module;
+#include <VKING/Profiler.hpp>
 
 module VKING.EngineConfig;
 import VKING.Types.Platform;
@@ -37,6 +39,18 @@ import VKING.Platform.Glue.GLFWVulkan;
 //extern "C" VKING::Platform::PlatformManager* VKING_Platform_Glue_GLFWVulkan_Create();
 #endif
 
+#if (VKING_HAS_WAYLAND_VULKAN_GLUE == 1)
+import VKING.Platform.Glue.WaylandVulkan;
+#endif
+
+#if (VKING_HAS_X11_VULKAN_GLUE == 1)
+import VKING.Platform.Glue.X11Vulkan;
+#endif
+
+#if (VKING_HAS_HEADLESS == 1)
+import VKING.Platform.Headless;
+#endif
+
 #if (VKING_HAS_AT_LEAST_ONE_PLATFORM == 0)
 #error "VKING Engine cannot be built: At least one platform (e.g., GLFW) must be enabled."
 #endif
@@ -55,12 +69,16 @@ namespace VKING::EngineConfig {
 
     using EngineConfigurationLogger = Log::Named<"EngineConfig">;
 
+    /// Headless only wins when requested explicitly, or when nothing else exists
+    constexpr uint16_t HEADLESS_SCORE = std::numeric_limits<uint16_t>::max() - 1;
+
     // === Full config table with precomputed scores and factory ===
     const std::vector<ScoredType<Types::Platform::PlatformManager::PlatformSpecification>> &getAvailablePlatformConfigurations() {
 
         // meyers singleton since the cartesian product of available products may become large
         // and the function is not constexpr-able due to the need for link time addresses
         static std::vector<ScoredType<Types::Platform::PlatformManager::PlatformSpecification>> s_Table = [] {
+            VKING_PROFILE_SCOPE("EngineConfig::buildPlatformTable");
             std::vector<ScoredType<Types::Platform::PlatformManager::PlatformSpecification>> table;
 
 #if VKING_HAS_GLFW_VULKAN_GLUE == 1
@@ -68,16 +86,65 @@ namespace VKING::EngineConfig {
                 {
                     .value = {
                         .platformCreateInfo = std::make_optional(Types::Platform::PlatformManager::PlatformSpecification::PlatformCreateInfo{
-                            .pfn_PlatformManagerCreate = VKING_Platform_Glue_GLFWVulkan_Create
+                            .pfn_PlatformManagerCreate = VKING_Platform_Glue_GLFWVulkan_Create,
+                            .pfn_PlatformManagerDestroy = VKING_Platform_Glue_GLFWVulkan_Destroy,
+                            .pfn_PlatformProbe = VKING_Platform_Glue_GLFWVulkan_Probe
                         }),
                         .platformType = Types::Platform::PlatformType::GLFW,
                         .backendType = Types::Platform::BackendType::VULKAN
                     },
                     .score = static_cast<uint16_t>(getPlatformScore(getPlatformScores(), Types::Platform::PlatformType::GLFW) * getBackendScore(getBackendScores(), Types::Platform::BackendType::VULKAN))
                 });
+#endif
+#if VKING_HAS_WAYLAND_VULKAN_GLUE == 1
+            table.push_back(
+                {
+                    .value = {
+                        .platformCreateInfo = std::make_optional(Types::Platform::PlatformManager::PlatformSpecification::PlatformCreateInfo{
+                            .pfn_PlatformManagerCreate = VKING_Platform_Glue_WaylandVulkan_Create,
+                            .pfn_PlatformManagerDestroy = VKING_Platform_Glue_WaylandVulkan_Destroy,
+                            .pfn_PlatformProbe = VKING_Platform_Glue_WaylandVulkan_Probe
+                        }),
+                        .platformType = Types::Platform::PlatformType::WAYLAND,
+                        .backendType = Types::Platform::BackendType::VULKAN
+                    },
+                    .score = static_cast<uint16_t>(getPlatformScore(getPlatformScores(), Types::Platform::PlatformType::WAYLAND) * getBackendScore(getBackendScores(), Types::Platform::BackendType::VULKAN))
+                });
+#endif
+#if VKING_HAS_X11_VULKAN_GLUE == 1
+            table.push_back(
+                {
+                    .value = {
+                        .platformCreateInfo = std::make_optional(Types::Platform::PlatformManager::PlatformSpecification::PlatformCreateInfo{
+                            .pfn_PlatformManagerCreate = VKING_Platform_Glue_X11Vulkan_Create,
+                            .pfn_PlatformManagerDestroy = VKING_Platform_Glue_X11Vulkan_Destroy,
+                            .pfn_PlatformProbe = VKING_Platform_Glue_X11Vulkan_Probe
+                        }),
+                        .platformType = Types::Platform::PlatformType::X11,
+                        .backendType = Types::Platform::BackendType::VULKAN
+                    },
+                    .score = static_cast<uint16_t>(getPlatformScore(getPlatformScores(), Types::Platform::PlatformType::X11) * getBackendScore(getBackendScores(), Types::Platform::BackendType::VULKAN))
+                });
+#endif
+#if VKING_HAS_HEADLESS == 1
+            table.push_back(
+                {
+                    .value = {
+                        .platformCreateInfo = std::make_optional(Types::Platform::PlatformManager::PlatformSpecification::PlatformCreateInfo{
+                            .pfn_PlatformManagerCreate = VKING_Platform_Headless_Create
+                        }),
+                        .platformType = Types::Platform::PlatformType::HEADLESS,
+                        .backendType = Types::Platform::BackendType::HEADLESS
+                    },
+                    .score = HEADLESS_SCORE
+                });
 #endif
             // Add more as implemented...
 
+            for (auto& entry : scanPlatformPlugins()) {
+                table.push_back(std::move(entry));
+            }
+
             return table;
         }();
 
@@ -88,18 +155,24 @@ namespace VKING::EngineConfig {
     std::unique_ptr<Types::Platform::PlatformManager> selectPlatform(
         Types::Platform::PlatformManager::PlatformSpecification desiredSpecification
     ) {
+        VKING_PROFILE_SCOPE("EngineConfig::selectPlatform");
 
         EngineConfigurationLogger::record().info("Attempting to select platform: {}", platformToString(desiredSpecification.platformType));
         EngineConfigurationLogger::record().info("Attempting to select backend: {}", backendToString(desiredSpecification.backendType));
 
-        // first, let's get the config table
+        // first, let's get the config table, and what of it can work on this machine
         const auto &table = getAvailablePlatformConfigurations();
+        const auto &probes = getPlatformProbeResults();
 
         // --- Step 1: Try to find an exact match first ---
         std::optional<ScoredType<Types::Platform::PlatformManager::PlatformSpecification>> preferredCandidate;
         uint16_t minPreferredScore = std::numeric_limits<uint16_t>::max();
 
-        for (const auto& entry : table) {
+        for (size_t i = 0; i < table.size(); i++) {
+            const auto& entry = table[i];
+            // never pay for an init that is known to fail
+            if (!probes[i].available) continue;
+
             const bool platformMatches = (desiredSpecification.platformType == Types::Platform::PlatformType::PLATFORM_NO_PREFERENCE ||
                                     desiredSpecification.platformType == entry.value.platformType);
             const bool backendMatches = (desiredSpecification.backendType == Types::Platform::BackendType::BACKEND_NO_PREFERENCE ||
@@ -122,7 +195,9 @@ namespace VKING::EngineConfig {
             preferredCandidate = std::nullopt; // Reset to find best overall
 
             minPreferredScore = std::numeric_limits<uint16_t>::max();
-            for (const auto& entry : table) {
+            for (size_t i = 0; i < table.size(); i++) {
+                const auto& entry = table[i];
+                if (!probes[i].available) continue;
                 if (entry.score < minPreferredScore && entry.score != std::numeric_limits<uint16_t>::max()) {
                     minPreferredScore = entry.score;
                     preferredCandidate = entry;
@@ -146,7 +221,13 @@ namespace VKING::EngineConfig {
 
         Types::Platform::PlatformManager* result = nullptr;
 
+        // Plugin entries get their create function once the plugin is loaded
+        if (!preferredCandidate->value.platformCreateInfo.has_value()) {
+            preferredCandidate->value.platformCreateInfo = loadPlatformPlugin(preferredCandidate->value.platformType, preferredCandidate->value.backendType);
+        }
+
         if (preferredCandidate->value.platformCreateInfo.has_value()) {
+            VKING_PROFILE_SCOPE("EngineConfig::createPlatformManager");
             result = preferredCandidate->value.platformCreateInfo->pfn_PlatformManagerCreate();
         }else {
             EngineConfigurationLogger::record().critical("Platform creation function not found in the previously mentioned best viable candidate.");
@@ -0,0 +1,282 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <VKING/Profiler.hpp>
+
+#if defined(__linux__) || defined(__APPLE__)
+#   include <dlfcn.h>
+#endif
+#if defined(__APPLE__)
+#   include <mach-o/dyld.h>
+#endif
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#endif
+
+module VKING.EngineConfig;
+import VKING.Types.Platform;
+import VKING.Log;
+
+namespace VKING::EngineConfig {
+
+    using PlatformSpecification = Types::Platform::PlatformManager::PlatformSpecification;
+
+    namespace {
+
+        using PluginLogger = Log::Named<"PlatformPlugins">;
+
+        /// A combination a plugin offered during the scan
+        struct PluginRecord {
+            std::filesystem::path path;
+            std::string name;
+            Types::Platform::PlatformType platformType;
+            Types::Platform::BackendType backendType;
+            /// Set once the plugin is loaded for good
+            std::optional<Types::Platform::PlatformManager::PlatformSpecification::PlatformCreateInfo> createInfo;
+        };
+
+        struct PluginRegistry {
+            std::mutex mutex;
+            std::string directory;
+            std::vector<PluginRecord> records;
+        };
+
+        PluginRegistry& getRegistry() {
+            static PluginRegistry* s_Registry = new PluginRegistry();
+            return *s_Registry;
+        }
+
+#if defined(__linux__) || defined(__APPLE__)
+#   if defined(__APPLE__)
+        constexpr const char* PLUGIN_EXTENSION = ".dylib";
+#   else
+        constexpr const char* PLUGIN_EXTENSION = ".so";
+#   endif
+
+        std::vector<std::filesystem::path> getSearchDirectories(const std::string& directory) {
+            if (!directory.empty()) return {directory};
+
+            std::vector<std::filesystem::path> directories;
+            if (const std::string executable = getExecutablePath(); !executable.empty()) {
+                directories.push_back(std::filesystem::path(executable).parent_path() / "plugins");
+            }
+#   if defined(VKING_PLATFORM_PLUGIN_BUILD_DIRECTORY)
+            directories.emplace_back(VKING_PLATFORM_PLUGIN_BUILD_DIRECTORY);
+#   endif
+            return directories;
+        }
+
+        /**
+         * @return The plugin's info, nullptr (handle closed again) if the library is not a usable platform plugin
+         */
+        const Types::Platform::PlatformPluginInfo* openPlugin(const std::filesystem::path& path, const int flags, void*& handle) {
+            handle = dlopen(path.c_str(), flags);
+            if (!handle) {
+                const char* error = dlerror();
+                PluginLogger::record().warn("Could not load {}: {}", path.string(), error ? error : "unknown error");
+                return nullptr;
+            }
+
+            const auto registerPlugin = reinterpret_cast<Types::Platform::PlatformPluginRegisterFn>(
+                dlsym(handle, Types::Platform::PLATFORM_PLUGIN_REGISTER_SYMBOL));
+            const Types::Platform::PlatformPluginInfo* info = registerPlugin ? registerPlugin() : nullptr;
+            if (!info) {
+                PluginLogger::record().debug("{} does not export {}, not a platform plugin.", path.string(), Types::Platform::PLATFORM_PLUGIN_REGISTER_SYMBOL);
+            } else if (info->abiVersion != Types::Platform::PLATFORM_PLUGIN_ABI_VERSION) {
+                PluginLogger::record().warn("Skipping {}: built for plugin ABI {}, the engine uses {}.", path.string(), info->abiVersion,
+                                            Types::Platform::PLATFORM_PLUGIN_ABI_VERSION);
+                info = nullptr;
+            }
+
+            if (!info) {
+                dlclose(handle);
+                handle = nullptr;
+            }
+            return info;
+        }
+#endif
+
+    }
+
+    std::string getExecutablePath() {
+#if defined(_WIN32)
+        char buffer[MAX_PATH];
+        const DWORD length = GetModuleFileNameA(nullptr, buffer, MAX_PATH);
+        return length > 0 && length < MAX_PATH ? std::string(buffer, length) : std::string();
+#elif defined(__APPLE__)
+        char buffer[4096];
+        uint32_t size = sizeof(buffer);
+        if (_NSGetExecutablePath(buffer, &size) != 0) return {};
+        std::error_code error;
+        const std::filesystem::path executable = std::filesystem::canonical(buffer, error);
+        return error ? std::string() : executable.string();
+#elif defined(__linux__)
+        std::error_code error;
+        const std::filesystem::path executable = std::filesystem::read_symlink("/proc/self/exe", error);
+        return error ? std::string() : executable.string();
+#else
+        return {};
+#endif
+    }
+
+    void setPlatformPluginDirectory(std::string directory) {
+        PluginRegistry& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+        registry.directory = std::move(directory);
+    }
+
+    std::vector<ScoredType<PlatformSpecification>> scanPlatformPlugins() {
+        std::vector<ScoredType<PlatformSpecification>> entries;
+#if defined(__linux__) || defined(__APPLE__)
+        VKING_PROFILE_SCOPE("EngineConfig::scanPlatformPlugins");
+        PluginRegistry& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+
+        for (const std::filesystem::path& directory : getSearchDirectories(registry.directory)) {
+            std::error_code error;
+            if (!std::filesystem::is_directory(directory, error)) continue;
+
+            std::vector<std::filesystem::path> libraries;
+            for (const auto& file : std::filesystem::directory_iterator(directory, error)) {
+                if (file.is_regular_file(error) && file.path().extension() == PLUGIN_EXTENSION) libraries.push_back(file.path());
+            }
+            // Same order on every run, so equal scores always resolve the same way
+            std::ranges::sort(libraries);
+
+            for (const std::filesystem::path& library : libraries) {
+                // Only to read the entries, the selected plugin is opened again by loadPlatformPlugin()
+                void* handle = nullptr;
+                const Types::Platform::PlatformPluginInfo* info = openPlugin(library, RTLD_LAZY | RTLD_LOCAL, handle);
+                if (!info) continue;
+
+                const std::string name = info->name ? info->name : library.stem().string();
+                for (uint32_t i = 0; i < info->entryCount; i++) {
+                    ScoredType<PlatformSpecification> entry = info->entries[i];
+                    entry.value.platformCreateInfo = std::nullopt;
+                    entries.push_back(entry);
+                    registry.records.push_back({library, name, entry.value.platformType, entry.value.backendType, std::nullopt});
+                }
+                PluginLogger::record().info("Found platform plugin {} with {} configurations in {}.", name, info->entryCount, library.string());
+                dlclose(handle);
+            }
+
+            // The first directory that exists is the one in use
+            PluginLogger::record().debug("Scanned {} for platform plugins, {} configurations found.", directory.string(), entries.size());
+            break;
+        }
+#endif
+        return entries;
+    }
+
+    bool probePlatformPlugin(const Types::Platform::PlatformType platformType, const Types::Platform::BackendType backendType, std::string* reason) {
+#if defined(__linux__) || defined(__APPLE__)
+        std::filesystem::path path;
+        {
+            PluginRegistry& registry = getRegistry();
+            std::lock_guard lock(registry.mutex);
+            const auto record = std::ranges::find_if(registry.records, [&](const PluginRecord& candidate) {
+                return candidate.platformType == platformType && candidate.backendType == backendType;
+            });
+            if (record == registry.records.end()) {
+                if (reason) *reason = "no plugin offers this configuration";
+                return false;
+            }
+            if (record->createInfo) {
+                return !record->createInfo->pfn_PlatformProbe || record->createInfo->pfn_PlatformProbe(reason);
+            }
+            path = record->path;
+        }
+
+        // Probes run in parallel, so the plugin may be opened by several at once, the loader counts references
+        void* handle = nullptr;
+        const Types::Platform::PlatformPluginInfo* info = openPlugin(path, RTLD_LAZY | RTLD_LOCAL, handle);
+        if (!info) {
+            if (reason) *reason = "the plugin could not be loaded";
+            return false;
+        }
+        bool available = false;
+        if (reason) *reason = "the plugin no longer offers this configuration";
+        for (uint32_t i = 0; i < info->entryCount; i++) {
+            const PlatformSpecification& specification = info->entries[i].value;
+            if (specification.platformType == platformType && specification.backendType == backendType && specification.platformCreateInfo) {
+                const auto probe = specification.platformCreateInfo->pfn_PlatformProbe;
+                available = !probe || probe(reason);
+                break;
+            }
+        }
+        dlclose(handle);
+        return available;
+#else
+        static_cast<void>(platformType);
+        static_cast<void>(backendType);
+        if (reason) *reason = "platform plugins are not supported here";
+        return false;
+#endif
+    }
+
+    std::optional<PlatformSpecification::PlatformCreateInfo> loadPlatformPlugin(
+        const Types::Platform::PlatformType platformType, const Types::Platform::BackendType backendType) {
+#if defined(__linux__) || defined(__APPLE__)
+        VKING_PROFILE_SCOPE("EngineConfig::loadPlatformPlugin");
+        PluginRegistry& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+
+        const auto record = std::ranges::find_if(registry.records, [&](const PluginRecord& candidate) {
+            return candidate.platformType == platformType && candidate.backendType == backendType;
+        });
+        if (record == registry.records.end()) return std::nullopt;
+        if (record->createInfo) return record->createInfo;
+
+        // Never closed: the platform manager, its windows and RHI all run code from the plugin
+        void* handle = nullptr;
+        const Types::Platform::PlatformPluginInfo* info = openPlugin(record->path, RTLD_NOW | RTLD_LOCAL, handle);
+        if (!info) return std::nullopt;
+
+        for (uint32_t i = 0; i < info->entryCount; i++) {
+            const PlatformSpecification& specification = info->entries[i].value;
+            if (specification.platformType == platformType && specification.backendType == backendType && specification.platformCreateInfo) {
+                PluginLogger::record().info("Loaded platform plugin {} from {}.", record->name, record->path.string());
+                record->createInfo = specification.platformCreateInfo;
+                return record->createInfo;
+            }
+        }
+        PluginLogger::record().error("{} no longer offers the configuration it offered during the scan.", record->path.string());
+        dlclose(handle);
+#else
+        static_cast<void>(platformType);
+        static_cast<void>(backendType);
+#endif
+        return std::nullopt;
+    }
+
+}
@@ -0,0 +1,281 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <VKING/Profiler.hpp>
+
+#if defined(__linux__) || defined(__APPLE__)
+#   include <sys/utsname.h>
+#endif
+
+module VKING.EngineConfig;
+import VKING.Types.Platform;
+import VKING.Log;
+import VKING.Json;
+import VKING.JobSystem;
+
+namespace VKING::EngineConfig {
+
+    namespace {
+
+        using ProbeLogger = Log::Named<"PlatformProbe">;
+
+        /// Bumped whenever the cache file changes meaning. Version 2 lists only the configurations that passed
+        constexpr uint32_t PROBE_CACHE_VERSION = 2;
+
+        /// Variables that decide whether a window system or driver can be reached
+        constexpr const char* FINGERPRINT_VARIABLES[] = {
+            "DISPLAY", "WAYLAND_DISPLAY", "XDG_SESSION_TYPE",
+            "VK_ICD_FILENAMES", "VK_DRIVER_FILES", "VK_ADD_DRIVER_FILES", "VK_LOADER_DRIVERS_SELECT", "VK_LOADER_DRIVERS_DISABLE",
+        };
+
+        std::atomic_bool s_CacheIgnored{false};
+
+        uint64_t hashText(uint64_t hash, const std::string_view text) {
+            for (const char character : text) {
+                hash ^= static_cast<uint8_t>(character);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        /// Size and modification time, which change whenever a driver package replaces the file
+        void appendFileIdentity(std::string& identity, const std::filesystem::path& path) {
+            std::error_code error;
+            const auto size = std::filesystem::file_size(path, error);
+            if (error) return;
+            const auto modified = std::filesystem::last_write_time(path, error);
+            if (error) return;
+            identity += path.string() + ' ' + std::to_string(size) + ' ' + std::to_string(modified.time_since_epoch().count()) + '\n';
+        }
+
+        std::vector<std::filesystem::path> getDriverManifestDirectories() {
+            std::vector<std::filesystem::path> directories;
+#if defined(__linux__) || defined(__APPLE__)
+            for (const char* directory : {"/etc/vulkan/icd.d", "/usr/share/vulkan/icd.d", "/usr/local/etc/vulkan/icd.d",
+                                          "/usr/local/share/vulkan/icd.d", "/opt/homebrew/share/vulkan/icd.d"}) {
+                directories.emplace_back(directory);
+            }
+            if (const char* home = std::getenv("HOME")) directories.push_back(std::filesystem::path(home) / ".local/share/vulkan/icd.d");
+#endif
+            return directories;
+        }
+
+        /**
+         * @brief Identifies the drivers and environment probes depend on. Any change to them (a driver update, another
+         *        session type, a rebuilt executable) makes the cached results stale.
+         */
+        std::string getFingerprint() {
+            std::string identity = "plugin abi " + std::to_string(Types::Platform::PLATFORM_PLUGIN_ABI_VERSION) + '\n';
+            for (const char* variable : FINGERPRINT_VARIABLES) {
+                const char* value = std::getenv(variable);
+                identity += std::string(variable) + '=' + (value ? value : "") + '\n';
+            }
+
+            if (const std::string executable = getExecutablePath(); !executable.empty()) appendFileIdentity(identity, executable);
+
+#if defined(__linux__) || defined(__APPLE__)
+            // Kernel drivers come with the kernel
+            utsname system{};
+            if (uname(&system) == 0) identity += std::string(system.release) + ' ' + system.version + '\n';
+#endif
+#if defined(_WIN32)
+            // Drivers install the loader into the system directory
+            if (const char* root = std::getenv("SystemRoot")) appendFileIdentity(identity, std::filesystem::path(root) / "System32" / "vulkan-1.dll");
+#endif
+
+            for (const std::filesystem::path& directory : getDriverManifestDirectories()) {
+                std::error_code error;
+                if (!std::filesystem::is_directory(directory, error)) continue;
+                std::vector<std::filesystem::path> manifests;
+                for (const auto& file : std::filesystem::directory_iterator(directory, error)) manifests.push_back(file.path());
+                std::ranges::sort(manifests);
+                for (const std::filesystem::path& manifest : manifests) appendFileIdentity(identity, manifest);
+            }
+
+            char hex[17];
+            std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hashText(14695981039346656037ull, identity)));
+            return hex;
+        }
+
+        bool runProbe(const ScoredType<Types::Platform::PlatformManager::PlatformSpecification>& entry, std::string* reason) {
+            if (!entry.value.platformCreateInfo) return probePlatformPlugin(entry.value.platformType, entry.value.backendType, reason);
+            const auto probe = entry.value.platformCreateInfo->pfn_PlatformProbe;
+            return !probe || probe(reason);
+        }
+
+        std::optional<Json::Value> readCache(const std::string& path, const std::string& fingerprint) {
+            std::ifstream file(path, std::ios::binary);
+            if (!file) return std::nullopt;
+            const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            std::optional<Json::Value> cache = Json::parse(text);
+            if (!cache || (*cache)["version"].asNumber<uint32_t>() != PROBE_CACHE_VERSION || (*cache)["fingerprint"].asString() != fingerprint) {
+                return std::nullopt;
+            }
+            return cache;
+        }
+
+        void writeCache(const std::string& path, const std::string& fingerprint,
+                        const std::vector<ScoredType<Types::Platform::PlatformManager::PlatformSpecification>>& table,
+                        const std::vector<PlatformProbeResult>& results) {
+            Json::Value cache = Json::Value::Object{};
+            cache.set("version", PROBE_CACHE_VERSION);
+            cache.set("fingerprint", fingerprint);
+            Json::Value entries = Json::Value::Array{};
+            for (size_t i = 0; i < table.size(); i++) {
+                // A failure may be transient (a display server that is not up yet), so it is probed again next launch
+                if (!results[i].available) continue;
+                Json::Value entry = Json::Value::Object{};
+                entry.set("platform", Types::Platform::platformToString(table[i].value.platformType));
+                entry.set("backend", Types::Platform::backendToString(table[i].value.backendType));
+                entries.push(std::move(entry));
+            }
+            cache.set("results", std::move(entries));
+
+            // Written aside and renamed, so a concurrent launch never reads half a file
+            std::error_code error;
+            std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+            const std::string temporary = path + ".tmp" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+            {
+                std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+                file << cache.dump(2) << '\n';
+                if (!file) {
+                    ProbeLogger::record().debug("Could not write the probe cache to {}.", path);
+                    return;
+                }
+            }
+            std::filesystem::rename(temporary, path, error);
+            if (error) {
+                std::filesystem::remove(temporary, error);
+                ProbeLogger::record().debug("Could not write the probe cache to {}.", path);
+            }
+        }
+
+        std::vector<PlatformProbeResult> probeAll() {
+            VKING_PROFILE_SCOPE("EngineConfig::probePlatforms");
+            using clock = std::chrono::steady_clock;
+            const auto start = clock::now();
+
+            const auto& table = getAvailablePlatformConfigurations();
+            std::vector<PlatformProbeResult> results(table.size());
+            const std::string path = getPlatformProbeCachePath();
+            const std::string fingerprint = getFingerprint();
+
+            // === Cached results ===
+            std::vector<uint32_t> pending;
+            const std::optional<Json::Value> cache = path.empty() || s_CacheIgnored.load() ? std::nullopt : readCache(path, fingerprint);
+            for (uint32_t i = 0; i < table.size(); i++) {
+                const Json::Value* cached = nullptr;
+                if (cache) {
+                    for (const Json::Value& entry : (*cache)["results"].asArray()) {
+                        if (entry["platform"].asString() == Types::Platform::platformToString(table[i].value.platformType) &&
+                            entry["backend"].asString() == Types::Platform::backendToString(table[i].value.backendType)) {
+                            cached = &entry;
+                            break;
+                        }
+                    }
+                }
+                if (cached) {
+                    results[i].cached = true;
+                } else {
+                    pending.push_back(i);
+                }
+            }
+
+            // === Probe the rest, concurrently ===
+            JobSystem::getDefault().parallelFor(static_cast<uint32_t>(pending.size()), 1, [&](const uint32_t begin, const uint32_t end) {
+                for (uint32_t i = begin; i < end; i++) {
+                    PlatformProbeResult& result = results[pending[i]];
+                    const auto probeStart = clock::now();
+                    result.available = runProbe(table[pending[i]], &result.reason);
+                    if (result.available) result.reason.clear();
+                    result.milliseconds = std::chrono::duration<double, std::milli>(clock::now() - probeStart).count();
+                }
+            });
+
+            for (size_t i = 0; i < table.size(); i++) {
+                if (results[i].available) continue;
+                ProbeLogger::record().info("{} + {} is unavailable: {}", Types::Platform::platformToString(table[i].value.platformType),
+                                           Types::Platform::backendToString(table[i].value.backendType), results[i].reason);
+            }
+            // Failures are probed on every launch but never cached, so only a newly available configuration changes the cache
+            const bool newlyAvailable = std::ranges::any_of(pending, [&results](const uint32_t i) { return results[i].available; });
+            if (newlyAvailable && !path.empty()) writeCache(path, fingerprint, table, results);
+
+            ProbeLogger::record().debug("Platform probes took {:.2f} ms, {} probed, {} from the cache.",
+                                        std::chrono::duration<double, std::milli>(clock::now() - start).count(), pending.size(),
+                                        table.size() - pending.size());
+            return results;
+        }
+
+    }
+
+    const std::vector<PlatformProbeResult>& getPlatformProbeResults() {
+        static const std::vector<PlatformProbeResult> s_Results = probeAll();
+        return s_Results;
+    }
+
+    void setPlatformProbeCacheIgnored(const bool ignored) {
+        s_CacheIgnored.store(ignored);
+    }
+
+    std::string getPlatformProbeCachePath() {
+        std::filesystem::path directory;
+#if defined(_WIN32)
+        if (const char* localAppData = std::getenv("LOCALAPPDATA")) directory = std::filesystem::path(localAppData) / "VKING";
+#elif defined(__APPLE__)
+        if (const char* home = std::getenv("HOME")) directory = std::filesystem::path(home) / "Library/Caches/VKING";
+#else
+        if (const char* cacheHome = std::getenv("XDG_CACHE_HOME"); cacheHome && *cacheHome) {
+            directory = std::filesystem::path(cacheHome) / "VKING";
+        } else if (const char* home = std::getenv("HOME")) {
+            directory = std::filesystem::path(home) / ".cache/VKING";
+        }
+#endif
+        if (directory.empty()) return {};
+
+        // One file per executable: the executable is part of the fingerprint, so the Editor and the benchmarks
+        // sharing a file would make every launch of one invalidate the other's results
+        std::string name = "PlatformProbes";
+        if (const std::string executable = getExecutablePath(); !executable.empty()) {
+            char hex[9];
+            std::snprintf(hex, sizeof(hex), "%08llx", static_cast<unsigned long long>(hashText(14695981039346656037ull, executable) & 0xFFFFFFFFull));
+            name += '-' + std::filesystem::path(executable).stem().string() + '-' + hex;
+        }
+        return (directory / (name + ".json")).string();
+    }
+
+}
@@ -0,0 +1,148 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+
+#include <VKING/Signals.hpp>
+
+module VKING.EngineContext;
+
+import VKING.Log;
+import VKING.JobSystem;
+
+namespace VKING {
+
+    namespace {
+
+        using EngineContextLogger = Log::Named<"EngineContext">;
+
+        /// Weight of the newest frame in InstanceStats::averageFrameMilliseconds
+        constexpr double AVERAGE_WEIGHT = 0.05;
+
+        constinit thread_local EngineInstance* t_Instance = nullptr;
+
+    }
+
+    EngineContext::EngineContext()
+        : EngineContext(CreateInfo{}) {}
+
+    EngineContext::EngineContext(const CreateInfo& createInfo) {
+        if (createInfo.jobWorkers > 0) {
+            m_OwnedJobSystem = std::make_unique<JobSystem>(createInfo.jobWorkers);
+            m_JobSystem = m_OwnedJobSystem.get();
+        } else {
+            m_JobSystem = &JobSystem::getDefault();
+        }
+    }
+
+    EngineContext& EngineContext::getDefault() {
+        // Leaked, instances may still be running in it while statics are destroyed
+        static EngineContext* s_Context = new EngineContext();
+        return *s_Context;
+    }
+
+    std::shared_ptr<const void> EngineContext::findAsset(const std::string_view key, const std::type_index type, bool& conflict) const {
+        std::lock_guard lock(m_AssetMutex);
+        const auto found = m_Assets.find(std::string(key));
+        if (found == m_Assets.end()) return nullptr;
+
+        std::shared_ptr<const void> asset = found->second.asset.lock();
+        if (asset && found->second.type != type) {
+            EngineContextLogger::record().error("Asset '{}' is cached as {}, not {}.", key, found->second.type.name(), type.name());
+            conflict = true;
+            return nullptr;
+        }
+        return asset;
+    }
+
+    std::shared_ptr<const void> EngineContext::storeAsset(const std::string_view key, const std::type_index type, std::shared_ptr<const void> asset) {
+        std::lock_guard lock(m_AssetMutex);
+        // Misses are rare next to hits, so they pay for sweeping out what no instance holds anymore
+        std::erase_if(m_Assets, [](const auto& entry) { return entry.second.asset.expired(); });
+
+        const auto [entry, inserted] = m_Assets.try_emplace(std::string(key), CachedAsset{type, asset});
+        if (inserted) return asset;
+        // Another instance stored it while this one was loading
+        if (entry->second.type != type) return nullptr;
+        return entry->second.asset.lock();
+    }
+
+    size_t EngineContext::getCachedAssetCount() const {
+        std::lock_guard lock(m_AssetMutex);
+        return static_cast<size_t>(std::ranges::count_if(m_Assets, [](const auto& entry) { return !entry.second.asset.expired(); }));
+    }
+
+    EngineInstance::EngineInstance(EngineContext& context, std::string name)
+        : m_Context(context), m_Name(std::move(name)), m_Shutdown(&m_OwnShutdown) {}
+
+    EngineInstance::EngineInstance(ProcessTag)
+        : m_Context(EngineContext::getDefault()), m_Name("Process"), m_Shutdown(&Shutdown::getProcessState()) {}
+
+    void EngineInstance::recordFrame(const double milliseconds) {
+        // Only the instance's own thread writes, so load and store need no read-modify-write
+        const uint64_t frames = m_Frames.load(std::memory_order_relaxed) + 1;
+        const double average = frames == 1 ? milliseconds
+                                           : m_AverageFrameMilliseconds.load(std::memory_order_relaxed) * (1.0 - AVERAGE_WEIGHT) + milliseconds * AVERAGE_WEIGHT;
+        m_LastFrameMilliseconds.store(milliseconds, std::memory_order_relaxed);
+        m_AverageFrameMilliseconds.store(average, std::memory_order_relaxed);
+        m_Frames.store(frames, std::memory_order_release);
+    }
+
+    InstanceStats EngineInstance::getStats() const {
+        InstanceStats stats;
+        stats.frames = m_Frames.load(std::memory_order_acquire);
+        stats.lastFrameMilliseconds = m_LastFrameMilliseconds.load(std::memory_order_relaxed);
+        stats.averageFrameMilliseconds = m_AverageFrameMilliseconds.load(std::memory_order_relaxed);
+        stats.restarts = m_Restarts.load(std::memory_order_relaxed);
+        stats.running = m_Running.load(std::memory_order_acquire);
+        return stats;
+    }
+
+    EngineInstance& EngineInstance::getCurrent() {
+        return t_Instance ? *t_Instance : getProcess();
+    }
+
+    EngineInstance& EngineInstance::getProcess() {
+        static EngineInstance* s_Instance = new EngineInstance(ProcessTag{});
+        return *s_Instance;
+    }
+
+    EngineInstance::Binding::Binding(EngineInstance& instance)
+        : m_PreviousInstance(t_Instance), m_PreviousShutdown(Shutdown::getThreadState()) {
+        t_Instance = &instance;
+        Shutdown::bindThreadState(instance.isProcess() ? nullptr : &instance.getShutdown());
+    }
+
+    EngineInstance::Binding::~Binding() {
+        t_Instance = m_PreviousInstance;
+        Shutdown::bindThreadState(m_PreviousShutdown);
+    }
+
+}
@@ -0,0 +1,204 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include <VKING/Signals.hpp>
+
+export module VKING.EngineContext;
+
+export import VKING.JobSystem;
+
+export namespace VKING {
+
+    /**
+     * @brief What every engine instance in a process shares: the job system and a cache of immutable assets.
+     *
+     * VKING_Main runs its application in getDefault(). A server hosting many matches runs them as instances of one
+     * context (see ApplicationHost), so they share one pool of worker threads and load each shared asset once,
+     * while shutdown, restart and stats stay with each EngineInstance.
+     */
+    class EngineContext {
+    public:
+        struct CreateInfo {
+            /// Worker threads of the context's own job system, 0 shares JobSystem::getDefault()
+            uint32_t jobWorkers = 0;
+        };
+
+        EngineContext();
+        explicit EngineContext(const CreateInfo& createInfo);
+
+        EngineContext(const EngineContext&) = delete;
+        EngineContext& operator=(const EngineContext&) = delete;
+
+        [[nodiscard]] JobSystem& getJobSystem() const { return *m_JobSystem; }
+
+        /**
+         * @brief Returns the asset cached under key, loading it first if no instance holds it right now.
+         *
+         * Assets are immutable once loaded and kept alive by the instances using them alone, so the last one to let
+         * go frees it. Loads run outside the cache's lock: two instances missing the same key at once both load it,
+         * and both get the copy stored first.
+         *
+         * @return nullptr if load() failed, or if key holds an asset of another type
+         */
+        template<typename T>
+        std::shared_ptr<const T> acquireAsset(std::string_view key, const std::function<std::shared_ptr<const T>()>& load);
+
+        /**
+         * @return Assets some instance still holds
+         */
+        [[nodiscard]] size_t getCachedAssetCount() const;
+
+        /**
+         * @brief The process's context, sharing JobSystem::getDefault(). Created on first use.
+         */
+        static EngineContext& getDefault();
+
+    private:
+        struct CachedAsset {
+            std::type_index type;
+            std::weak_ptr<const void> asset;
+        };
+
+        /**
+         * @param conflict Set if key holds a live asset of another type
+         */
+        std::shared_ptr<const void> findAsset(std::string_view key, std::type_index type, bool& conflict) const;
+        /**
+         * @return The asset now cached under key: asset, or the one another instance stored first
+         */
+        std::shared_ptr<const void> storeAsset(std::string_view key, std::type_index type, std::shared_ptr<const void> asset);
+
+        std::unique_ptr<JobSystem> m_OwnedJobSystem;
+        JobSystem* m_JobSystem = nullptr;
+        mutable std::mutex m_AssetMutex;
+        std::unordered_map<std::string, CachedAsset> m_Assets;
+    };
+
+    template<typename T>
+    std::shared_ptr<const T> EngineContext::acquireAsset(const std::string_view key, const std::function<std::shared_ptr<const T>()>& load) {
+        bool conflict = false;
+        if (std::shared_ptr<const void> cached = findAsset(key, typeid(T), conflict)) return std::static_pointer_cast<const T>(cached);
+        if (conflict) return nullptr;
+
+        std::shared_ptr<const T> loaded = load();
+        if (!loaded) return nullptr;
+        return std::static_pointer_cast<const T>(storeAsset(key, typeid(T), std::move(loaded)));
+    }
+
+    /// One instance's counters, written by the instance's thread and read from any
+    struct InstanceStats {
+        uint64_t frames = 0;
+        double lastFrameMilliseconds = 0.0;
+        /// Moving average, recent frames weigh the most
+        double averageFrameMilliseconds = 0.0;
+        uint32_t restarts = 0;
+        bool running = false;
+    };
+
+    /**
+     * @brief One engine instance in a context: its own shutdown state and stats.
+     *
+     * An application runs in the instance its thread is bound to when it is constructed (see Binding), or in the
+     * process's instance when there is none, as under VKING_Main. Shutdown::request() from a bound thread stops that
+     * instance alone, while a signal still stops all of them.
+     */
+    class EngineInstance {
+    public:
+        EngineInstance(EngineContext& context, std::string name);
+
+        EngineInstance(const EngineInstance&) = delete;
+        EngineInstance& operator=(const EngineInstance&) = delete;
+
+        [[nodiscard]] EngineContext& getContext() const { return m_Context; }
+        [[nodiscard]] const std::string& getName() const { return m_Name; }
+        [[nodiscard]] Shutdown::State& getShutdown() const { return *m_Shutdown; }
+
+        /**
+         * @return true for the process's instance, the one VKING_Main runs its application in
+         */
+        [[nodiscard]] bool isProcess() const { return m_Shutdown == &Shutdown::getProcessState(); }
+
+        /**
+         * @brief Counts one frame or tick of the instance's main loop.
+         */
+        void recordFrame(double milliseconds);
+        void recordRestart() { m_Restarts.fetch_add(1, std::memory_order_relaxed); }
+        void setRunning(const bool running) { m_Running.store(running, std::memory_order_release); }
+
+        [[nodiscard]] InstanceStats getStats() const;
+
+        /**
+         * @return The instance the calling thread is bound to, or the process's
+         */
+        static EngineInstance& getCurrent();
+
+        /**
+         * @brief The process's instance, in the default context. Its shutdown state is Shutdown::getProcessState().
+         */
+        static EngineInstance& getProcess();
+
+        /**
+         * @brief Binds the calling thread to an instance for as long as it lives: applications constructed on the
+         *        thread run in it, and the thread's Shutdown requests go to it.
+         */
+        class Binding {
+        public:
+            explicit Binding(EngineInstance& instance);
+            ~Binding();
+
+            Binding(const Binding&) = delete;
+            Binding& operator=(const Binding&) = delete;
+
+        private:
+            EngineInstance* m_PreviousInstance;
+            Shutdown::State* m_PreviousShutdown;
+        };
+
+    private:
+        struct ProcessTag {};
+        explicit EngineInstance(ProcessTag);
+
+        EngineContext& m_Context;
+        std::string m_Name;
+        Shutdown::State m_OwnShutdown;
+        /// m_OwnShutdown, or the process's state for the process's instance
+        Shutdown::State* m_Shutdown;
+
+        std::atomic<uint64_t> m_Frames{0};
+        std::atomic<double> m_LastFrameMilliseconds{0.0};
+        std::atomic<double> m_AverageFrameMilliseconds{0.0};
+        std::atomic<uint32_t> m_Restarts{0};
+        std::atomic_bool m_Running{false};
+    };
+
+}
@@ -23,32 +23,154 @@
 #define VKING_SUPPRESS_ENTRY_POINT_MESSAGES
 #include <VKING/MainCreator.hpp>
 #include <VKING/Signals.hpp>
+#include <VKING/Profiler.hpp>
+#include <VKING/SamplingProfiler.hpp>
+#include <VKING/AllocationProfiler.hpp>
+#include <VKING/LiveMetrics.hpp>
+#include <VKING/ProfilerStream.hpp>
+#include <VKING/Watchdog.hpp>
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
 
 import VKING.Application;
 import VKING.Log;
 import VKING.EntryPointCallbacks;
+import VKING.LaunchOptions;
+import VKING.EngineConfig;
+import VKING.Startup;
+import VKING.CVar;
+import VKING.GameModule;
+
+/// Level the entry point's own lifecycle messages are logged at, whatever level the application chose
+static VKING::CVars::CVar<std::string> s_LifecycleLogLevel{"log.lifecycleLevel", "trace",
+                                                           "Level of the entry point's lifecycle messages (trace, debug, info, warn, err, critical, off)"};
+
+static VKING::Log::Level getLifecycleLogLevel() {
+    return VKING::Log::parseLevel(s_LifecycleLogLevel.get()).value_or(VKING::Log::Level::trace);
+}
+
+/// Reads console commands from stdin for the rest of the process. Changes take effect on the main thread
+static void startConsole() {
+    std::thread([] {
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            const std::string response = VKING::CVars::execute(line);
+            if (!response.empty()) std::cout << response << std::endl;
+        }
+    }).detach();
+}
 
-static constexpr VKING::Log::Level VKING_CONTROLLED_LIFECYCLE_LOG_LEVEL = VKING::Log::Level::trace;
+/// If set, the profiler's history is written to this path as a Chrome trace when VKING_Main returns
+static constexpr auto VKING_PROFILE_TRACE_ENVIRONMENT_VARIABLE = "VKING_PROFILE_TRACE";
 
 /* Actual Main function */
-int VKING_Main([[maybe_unused]] int argc, [[maybe_unused]] const char ** _argv){
+int VKING_Main(int argc, const char ** _argv){
+
+    VKING::Startup::markMainEntered();
+    VKING_PROFILE_THREAD("Main");
+    VKING::Profiler::Sampling::registerCurrentThread("Main");
+
+    {
+        VKING_PROFILE_SCOPE("VKING::registerLogger");
+        VKING::Startup::Phase phase("Logger");
+        VKING::registerLogger();
+    }
 
-    VKING::registerLogger();
+    // CVars before anything reads them, the lifecycle log level included. The command line overrides the config file
+    {
+        VKING_PROFILE_SCOPE("VKING::loadConfiguration");
+        VKING::Startup::Phase phase("Configuration");
+        VKING::setLaunchOptions(VKING::parseLaunchOptions(argc, _argv));
+        if (!VKING::getLaunchOptions().configPath.empty()) VKING::CVars::loadConfigFile(VKING::getLaunchOptions().configPath);
+        VKING::CVars::parseCommandLine(argc, _argv);
+    }
 
     // no matter what we will override the logger level here
     // save what the consumer had set
     // and put it back right before we start
     VKING::Log::Level previousLevel = VKING::Log::getLevel();
-    VKING::Log::setLevel(VKING_CONTROLLED_LIFECYCLE_LOG_LEVEL);
+    VKING::Log::setLevel(getLifecycleLogLevel());
 
     using EntryPointLogger = VKING::Log::Named<"EntryPoint">;
     EntryPointLogger::record().info("Global Logger Sinks Registered via VKING::RegisterLogger() callback. Starting VKING");
 
+    // Everything up to the application, the diagnostics are started here too
+    std::optional<VKING::Startup::Phase> entryPointPhase(std::in_place, "EntryPoint");
+
     VKING::Shutdown::registerInterruptHandler();
     EntryPointLogger::record().info("Interrupt handler registered.");
 
+    const VKING::LaunchOptions& launchOptions = VKING::getLaunchOptions();
+    EntryPointLogger::record().info("Launch options: headless {}, server {}, harness {}, scene '{}'.", launchOptions.headless, launchOptions.server, launchOptions.harness, launchOptions.scenePath);
+    VKING::EngineConfig::setPlatformPluginDirectory(launchOptions.pluginDirectory);
+    VKING::EngineConfig::setPlatformProbeCacheIgnored(launchOptions.reprobePlatforms);
+    // The trace written on exit covers as much of the run as the profiler can keep, not just the last few frames
+    if (std::getenv(VKING_PROFILE_TRACE_ENVIRONMENT_VARIABLE)) VKING::Profiler::setRetainedFrames(VKING::Profiler::MAX_RETAINED_FRAMES);
+    if (launchOptions.hardwareCounters) {
+        if (VKING::Profiler::setHardwareCountersEnabled(true)) {
+            EntryPointLogger::record().info("Hardware counters enabled for profiler zones.");
+        } else {
+            EntryPointLogger::record().warn("Hardware counters are unavailable (unsupported platform, no PMU, or perf_event_paranoid too strict).");
+        }
+    }
+    if (launchOptions.sampleFrequency > 0) {
+        if (VKING::Profiler::Sampling::start(launchOptions.sampleFrequency)) {
+            EntryPointLogger::record().info("Sampling profiler started at {} Hz.", launchOptions.sampleFrequency);
+        } else {
+            EntryPointLogger::record().warn("The sampling profiler is unavailable on this platform.");
+        }
+    }
+    if (launchOptions.liveMetrics) {
+        const std::string application = argc > 0 ? std::filesystem::path(_argv[0]).filename().string() : "VKING";
+        if (VKING::LiveMetrics::open(application)) {
+            EntryPointLogger::record().info("Publishing live metrics for VKING_Top.");
+        } else {
+            EntryPointLogger::record().warn("Live metrics are unavailable, shared memory could not be created.");
+        }
+    }
+    if (launchOptions.profilerStream) {
+        if (VKING::Profiler::Stream::start(launchOptions.profilerStreamPath)) {
+            EntryPointLogger::record().info("Profiler stream listening for VKING_ProfilerViewer.");
+        } else {
+            EntryPointLogger::record().warn("The profiler stream is unavailable, its socket could not be created or its path is taken by another file.");
+        }
+    }
+    if (launchOptions.watchdogHangMilliseconds > 0) {
+        if (VKING::Watchdog::start({launchOptions.watchdogHangMilliseconds, launchOptions.watchdogFatalMilliseconds})) {
+            EntryPointLogger::record().info("Watchdog diagnoses stalls after {} ms and ends the process after {} ms.",
+                                            launchOptions.watchdogHangMilliseconds, launchOptions.watchdogFatalMilliseconds);
+        } else {
+            EntryPointLogger::record().warn("The watchdog is unavailable on this platform.");
+        }
+    }
+    if (launchOptions.console) {
+        startConsole();
+        EntryPointLogger::record().info("Console reading CVar commands from stdin, 'help' lists them.");
+    }
+    if (launchOptions.allocationSampleInterval > 0) {
+        VKING::Profiler::Allocations::setEnabled(true, launchOptions.allocationSampleInterval);
+        EntryPointLogger::record().info("Allocation profiler sampling every {} bytes.", launchOptions.allocationSampleInterval);
+    }
+
+    // Applications come from the game module instead of createApplication(), a rebuild of it restarts into the new code
+    std::unique_ptr<VKING::GameModule> gameModule;
+    if (!launchOptions.gameModulePath.empty()) {
+        gameModule = std::make_unique<VKING::GameModule>(launchOptions.gameModulePath);
+        if (gameModule->load()) {
+            gameModule->startWatching();
+            EntryPointLogger::record().info("Watching game module {} for rebuilds.", launchOptions.gameModulePath);
+        }
+    }
+
     //atexit(VKING::atExitCallback);
     EntryPointLogger::record().info("Registered AtExit callback.");
+    entryPointPhase.reset();
 
     // now put it back (before we enter the loop, so we can reuse the variable
     // otherwise there's some weird issues, so we're doing the level dance and pulling it right back out
@@ -57,12 +179,14 @@ int VKING_Main([[maybe_unused]] int argc, [[maybe_unused]] const char ** _argv){
 
     bool shouldRestart = true;
     uint32_t restartCount = 0;
+    // The scene handed from one application to the next when running from a game module
+    VKING::Application::PreservedWorld preservedWorld;
     while (shouldRestart) {
         // no matter what we will override the logger level here
         // save what the consumer had set
         // and put it back right before we start
         previousLevel = VKING::Log::getLevel();
-        VKING::Log::setLevel(VKING_CONTROLLED_LIFECYCLE_LOG_LEVEL);
+        VKING::Log::setLevel(getLifecycleLogLevel());
 
         // print a helpful message about whether or not this is the first start
         // in this invocation
@@ -75,7 +199,27 @@ int VKING_Main([[maybe_unused]] int argc, [[maybe_unused]] const char ** _argv){
         // start the application respecting consumer's log level
         EntryPointLogger::record().info("Starting new application, calling VKING::createApplication(), respecting consumer log level");
         VKING::Log::setLevel(previousLevel);
-        auto application = VKING::createApplication();
+        std::unique_ptr<VKING::Application> application;
+        {
+            VKING_PROFILE_SCOPE("VKING::createApplication");
+            VKING::Startup::Phase phase("Application");
+            if (gameModule) {
+                // A build that fails to load keeps the previous generation running
+                if (gameModule->hasChanged()) gameModule->load();
+                application = gameModule->createApplication();
+            } else {
+                application = VKING::createApplication();
+            }
+            if (application && preservedWorld.scene) application->adoptWorld(std::move(preservedWorld));
+            preservedWorld = {};
+        }
+
+        if (!application) {
+            VKING::Log::setLevel(getLifecycleLogLevel());
+            EntryPointLogger::record().critical("No application was created, exiting.");
+            VKING::Log::setLevel(previousLevel);
+            break;
+        }
 
         // run the event loop
         EntryPointLogger::record().info("Application created. Calling application->run()");
@@ -85,7 +229,7 @@ int VKING_Main([[maybe_unused]] int argc, [[maybe_unused]] const char ** _argv){
         // save what the consumer had set
         // and put it back right before we start
         previousLevel = VKING::Log::getLevel();
-        VKING::Log::setLevel(VKING_CONTROLLED_LIFECYCLE_LOG_LEVEL);
+        VKING::Log::setLevel(getLifecycleLogLevel());
 
         // Check the shutdown condition and whether or not we should restart
         EntryPointLogger::record().info("Application finished running. Checking for shutdown condition.");
@@ -100,14 +244,23 @@ int VKING_Main([[maybe_unused]] int argc, [[maybe_unused]] const char ** _argv){
         }
 
 
+        // the scene lives on in engine memory while the game module's code is replaced
+        if (shouldRestart && gameModule) {
+            preservedWorld = application->releaseWorld();
+            if (preservedWorld.scene) EntryPointLogger::record().info("Keeping the scene for the next application.");
+        }
+
         // call the destructor, respecting the consumer's log level choice
         EntryPointLogger::record().info("Deleting application.");
         // once more with the log level dance
         VKING::Log::setLevel(previousLevel);
-        application.reset(); // to control the lifetime and invalidate this pointer.
+        {
+            VKING_PROFILE_SCOPE("VKING::destroyApplication");
+            application.reset(); // to control the lifetime and invalidate this pointer.
+        }
 
         previousLevel = VKING::Log::getLevel();
-        VKING::Log::setLevel(VKING_CONTROLLED_LIFECYCLE_LOG_LEVEL);
+        VKING::Log::setLevel(getLifecycleLogLevel());
 
         EntryPointLogger::record().info("Application deleted.");
 
@@ -121,7 +274,35 @@ int VKING_Main([[maybe_unused]] int argc, [[maybe_unused]] const char ** _argv){
     // one last message at *our* controlled log level, doing the dance one last time
     // putting it back for global destructors
     previousLevel = VKING::Log::getLevel();
-    VKING::Log::setLevel(VKING_CONTROLLED_LIFECYCLE_LOG_LEVEL);
+    VKING::Log::setLevel(getLifecycleLogLevel());
+    if (const char* tracePath = std::getenv(VKING_PROFILE_TRACE_ENVIRONMENT_VARIABLE)) {
+        if (VKING::Profiler::exportChromeTrace(tracePath)) {
+            EntryPointLogger::record().info("Profiler trace written to {}.", tracePath);
+        } else {
+            EntryPointLogger::record().error("Could not write profiler trace to {}.", tracePath);
+        }
+    }
+    if (VKING::Profiler::Sampling::isRunning()) {
+        VKING::Profiler::Sampling::stop();
+        const VKING::Profiler::Sampling::Stats sampleStats = VKING::Profiler::Sampling::getStats();
+        if (VKING::Profiler::Sampling::exportFoldedStacks(launchOptions.sampleOutputPath)) {
+            EntryPointLogger::record().info("{} samples ({} dropped) written to {}.", sampleStats.samples, sampleStats.droppedSamples, launchOptions.sampleOutputPath);
+        } else {
+            EntryPointLogger::record().error("Could not write samples to {}.", launchOptions.sampleOutputPath);
+        }
+    }
+    if (VKING::Profiler::Allocations::isEnabled()) {
+        // Every application is destroyed by now, so whatever is still live leaked
+        VKING::Profiler::Allocations::setEnabled(false);
+        if (VKING::Profiler::Allocations::writeReport(launchOptions.allocationReportPath)) {
+            EntryPointLogger::record().info("Allocation report written to {}.", launchOptions.allocationReportPath);
+        } else {
+            EntryPointLogger::record().error("Could not write the allocation report to {}.", launchOptions.allocationReportPath);
+        }
+    }
+    VKING::Watchdog::stop();
+    VKING::Profiler::Stream::stop();
+    VKING::LiveMetrics::close();
     EntryPointLogger::record().info("Exiting, no restart requested. BYE!");
     VKING::Log::setLevel(previousLevel);
 
@@ -0,0 +1,211 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <VKING/Signals.hpp>
+#include <VKING/Profiler.hpp>
+
+#if defined(__linux__) || defined(__APPLE__)
+#   include <dlfcn.h>
+#   include <unistd.h>
+#endif
+
+module VKING.GameModule;
+
+import VKING.Log;
+import VKING.Application;
+import VKING.CVar;
+
+namespace VKING {
+
+    namespace {
+
+        using GameModuleLogger = Log::Named<"GameModule">;
+
+        /// How often the watcher looks at the library. A change is acted on once it held for a whole interval, so a
+        /// library the linker is still writing is not loaded
+        constexpr auto WATCH_INTERVAL = std::chrono::milliseconds(250);
+
+    }
+
+    GameModule::GameModule(std::filesystem::path path)
+        : m_Path(std::move(path)) {}
+
+    GameModule::~GameModule() {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Stopping = true;
+        }
+        m_StopCondition.notify_all();
+        if (m_Watcher.joinable()) m_Watcher.join();
+
+        // Still mapped, removing them only drops the names
+        std::error_code error;
+        for (const std::filesystem::path& copy : m_Copies) std::filesystem::remove(copy, error);
+    }
+
+    std::optional<GameModule::FileStamp> GameModule::getStamp(const std::filesystem::path& path) {
+        std::error_code error;
+        FileStamp stamp;
+        stamp.writeTime = std::filesystem::last_write_time(path, error);
+        if (error) return std::nullopt;
+        stamp.size = std::filesystem::file_size(path, error);
+        if (error) return std::nullopt;
+        return stamp;
+    }
+
+    bool GameModule::load() {
+        VKING_PROFILE_SCOPE("GameModule::load");
+
+#if defined(__linux__) || defined(__APPLE__)
+        const std::optional<FileStamp> stamp = getStamp(m_Path);
+        if (!stamp) {
+            GameModuleLogger::record().error("Game module {} does not exist.", m_Path.string());
+            return false;
+        }
+
+        std::error_code error;
+        const std::filesystem::path directory = std::filesystem::temp_directory_path(error) / "VKING-GameModules";
+        std::filesystem::create_directories(directory, error);
+        const std::filesystem::path copy = directory / (m_Path.stem().string() + "-" + std::to_string(getpid()) + "-" +
+                                                        std::to_string(getGeneration() + 1) + m_Path.extension().string());
+        if (!std::filesystem::copy_file(m_Path, copy, std::filesystem::copy_options::overwrite_existing, error)) {
+            GameModuleLogger::record().error("Could not copy game module {} to {}: {}", m_Path.string(), copy.string(), error.message());
+            return false;
+        }
+
+        // The previous generation stays mapped, but the CVars it declared make way for the new generation's
+        std::vector<CVars::detail::Entry*> retiredCVars;
+        if (const void* retiredImage = getLoadedImage()) {
+            retiredCVars = CVars::detachDeclarations([retiredImage](const void* declaration) {
+                Dl_info declarationInfo{};
+                return dladdr(declaration, &declarationInfo) != 0 && declarationInfo.dli_fbase == retiredImage;
+            });
+        }
+        const auto keepPrevious = [&] {
+            for (CVars::detail::Entry* entry : retiredCVars) entry->attach();
+            std::filesystem::remove(copy, error);
+            return false;
+        };
+
+        // Local, so one generation's gameplay symbols never bind to another's. The module is not linked against the
+        // engine, its engine symbols all resolve to the executable
+        void* handle = dlopen(copy.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if (!handle) {
+            const char* loadError = dlerror();
+            GameModuleLogger::record().error("Could not load game module {}: {}", m_Path.string(), loadError ? loadError : "unknown error");
+            return keepPrevious();
+        }
+
+        const auto registerModule = reinterpret_cast<GameModuleRegisterFn>(dlsym(handle, GAME_MODULE_REGISTER_SYMBOL));
+        const GameModuleInfo* info = registerModule ? registerModule() : nullptr;
+        if (!info || !info->createApplication) {
+            GameModuleLogger::record().error("{} is not a game module, it does not export {}.", m_Path.string(), GAME_MODULE_REGISTER_SYMBOL);
+            info = nullptr;
+        } else if (info->abiVersion != GAME_MODULE_ABI_VERSION) {
+            GameModuleLogger::record().error("Game module {} is built for ABI {}, the engine uses {}.", m_Path.string(), info->abiVersion,
+                                             GAME_MODULE_ABI_VERSION);
+            info = nullptr;
+        }
+        if (!info) {
+            dlclose(handle);
+            return keepPrevious();
+        }
+
+        // Never closed, see the class description
+        m_Copies.push_back(copy);
+        Dl_info imageInfo{};
+        uint32_t generation = 0;
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Info = info;
+            m_LoadedImage = dladdr(info, &imageInfo) != 0 ? imageInfo.dli_fbase : nullptr;
+            m_LoadedStamp = stamp;
+            generation = ++m_Generation;
+        }
+        GameModuleLogger::record().info("Loaded game module {} ({}), generation {}.", info->name ? info->name : "unnamed", m_Path.string(), generation);
+        return true;
+#else
+        GameModuleLogger::record().error("Game modules are not supported on this platform, cannot load {}.", m_Path.string());
+        return false;
+#endif
+    }
+
+    bool GameModule::hasChanged() const {
+        const std::optional<FileStamp> stamp = getStamp(m_Path);
+        std::lock_guard lock(m_Mutex);
+        return stamp && stamp != m_LoadedStamp;
+    }
+
+    std::unique_ptr<Application> GameModule::createApplication() const {
+        const GameModuleInfo* info = nullptr;
+        {
+            std::lock_guard lock(m_Mutex);
+            info = m_Info;
+        }
+        return info ? info->createApplication() : nullptr;
+    }
+
+    uint32_t GameModule::getGeneration() const {
+        std::lock_guard lock(m_Mutex);
+        return m_Generation;
+    }
+
+    const void* GameModule::getLoadedImage() const {
+        std::lock_guard lock(m_Mutex);
+        return m_LoadedImage;
+    }
+
+    void GameModule::startWatching() {
+        if (m_Watcher.joinable()) return;
+        m_Watcher = std::thread([this] { watch(); });
+    }
+
+    void GameModule::watch() {
+        VKING_PROFILE_THREAD("Game Module Watcher");
+
+        std::optional<FileStamp> previous;
+        std::unique_lock lock(m_Mutex);
+        while (!m_StopCondition.wait_for(lock, WATCH_INTERVAL, [this] { return m_Stopping; })) {
+            const std::optional<FileStamp> stamp = getStamp(m_Path);
+            const bool settled = stamp && stamp == previous;
+            previous = stamp;
+            if (!settled || stamp == m_LoadedStamp || stamp == m_RequestedStamp) continue;
+
+            m_RequestedStamp = stamp;
+            GameModuleLogger::record().info("Game module {} was rebuilt, restarting to reload it.", m_Path.string());
+            Shutdown::getProcessState().request(Shutdown::Reason::REASON_USER_RESTART, "Game module changed, reloading.");
+        }
+    }
+
+}
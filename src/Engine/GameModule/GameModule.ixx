@@ -0,0 +1,130 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+export module VKING.GameModule;
+
+import VKING.Application;
+
+export namespace VKING {
+
+    /// Bumped whenever GameModuleInfo or the Application it creates changes layout
+    constexpr uint32_t GAME_MODULE_ABI_VERSION = 1;
+    /// extern "C" function every game module exports, returning its GameModuleInfo
+    constexpr const char* GAME_MODULE_REGISTER_SYMBOL = "VKING_Game_RegisterModule";
+
+    struct GameModuleInfo {
+        uint32_t abiVersion = GAME_MODULE_ABI_VERSION;
+        const char* name = nullptr;
+        /// Takes the place of the linked in createApplication()
+        std::unique_ptr<Application> (*createApplication)() = nullptr;
+    };
+
+    using GameModuleRegisterFn = const GameModuleInfo* (*)();
+
+    /**
+     * @brief Gameplay code built as a shared library, so a change only relinks the library instead of the executable.
+     *
+     * The watcher requests a REASON_USER_RESTART once the library on disk changed and the build finished writing it.
+     * VKING_Main's restart loop then reloads it and creates the next application from it, handing the scene over
+     * (see Application::releaseWorld()).
+     *
+     * The library is not linked against the engine: every engine symbol it uses resolves to the executable, which
+     * exports them, so there is one copy of the engine's state however many generations are loaded.
+     *
+     * Every load opens a fresh copy, since the loader hands out the library already loaded for a path it has seen,
+     * and the build must be free to overwrite the original. Copies are never closed, since profiler zones recorded
+     * by earlier generations point into them. The CVars a generation declares are detached before the next one loads,
+     * so the next one declares them again and picks up their values.
+     */
+    class GameModule {
+    public:
+        explicit GameModule(std::filesystem::path path);
+        ~GameModule();
+
+        GameModule(const GameModule&) = delete;
+        GameModule& operator=(const GameModule&) = delete;
+
+        /**
+         * @brief Loads the library as it is on disk now.
+         *
+         * @return false if it could not be loaded, the generation loaded before stays in use
+         */
+        bool load();
+
+        /**
+         * @return true if the library on disk is not the one loaded last, a build finished since
+         */
+        [[nodiscard]] bool hasChanged() const;
+
+        /**
+         * @return A new application from the loaded generation, nullptr if none is loaded
+         */
+        [[nodiscard]] std::unique_ptr<Application> createApplication() const;
+
+        /**
+         * @brief Starts watching the library for new builds, until destruction.
+         */
+        void startWatching();
+
+        [[nodiscard]] const std::filesystem::path& getPath() const { return m_Path; }
+        /// Number of generations loaded so far, 0 until load() first succeeds
+        [[nodiscard]] uint32_t getGeneration() const;
+
+    private:
+        struct FileStamp {
+            std::filesystem::file_time_type writeTime;
+            uintmax_t size = 0;
+
+            bool operator==(const FileStamp&) const = default;
+        };
+
+        static std::optional<FileStamp> getStamp(const std::filesystem::path& path);
+        void watch();
+        /// Base address of the loaded generation's image, nullptr until load() first succeeds
+        [[nodiscard]] const void* getLoadedImage() const;
+
+        std::filesystem::path m_Path;
+        /// Loaded copies, removed from disk on destruction
+        std::vector<std::filesystem::path> m_Copies;
+
+        mutable std::mutex m_Mutex;
+        std::condition_variable m_StopCondition;
+        const GameModuleInfo* m_Info = nullptr;
+        const void* m_LoadedImage = nullptr;
+        uint32_t m_Generation = 0;
+        std::optional<FileStamp> m_LoadedStamp;
+        /// The build a restart was last requested for, so a build that fails to load is not restarted into again
+        std::optional<FileStamp> m_RequestedStamp;
+        bool m_Stopping = false;
+        std::thread m_Watcher;
+    };
+
+}
@@ -0,0 +1,265 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <VKING/Profiler.hpp>
+
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#   include <psapi.h>
+#else
+#   include <sys/resource.h>
+#endif
+
+module VKING.FrameHarness;
+
+import VKING.Log;
+import VKING.Startup;
+
+namespace VKING {
+
+    namespace {
+
+        using FrameHarnessLogger = Log::Named<"FrameHarness">;
+
+        constexpr double NANOSECONDS_PER_MILLISECOND = 1'000'000.0;
+
+        /// Nearest-rank percentile of already sorted samples
+        double percentile(const std::vector<double>& sorted, const double fraction) {
+            if (sorted.empty()) return 0.0;
+            const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+            return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+        }
+
+        double mean(const std::vector<double>& samples) {
+            if (samples.empty()) return 0.0;
+            double sum = 0.0;
+            for (const double sample : samples) sum += sample;
+            return sum / static_cast<double>(samples.size());
+        }
+
+        double standardDeviation(const std::vector<double>& samples, const double average) {
+            if (samples.size() < 2) return 0.0;
+            double variance = 0.0;
+            for (const double sample : samples) variance += (sample - average) * (sample - average);
+            return std::sqrt(variance / static_cast<double>(samples.size() - 1));
+        }
+
+        /// Frame-time summary in milliseconds
+        Json::Value describeMilliseconds(const std::vector<double>& nanoseconds) {
+            std::vector<double> sorted = nanoseconds;
+            std::ranges::sort(sorted);
+            const double average = mean(sorted);
+
+            Json::Value description = Json::Value::Object{};
+            description.set("mean", average / NANOSECONDS_PER_MILLISECOND);
+            description.set("stddev", standardDeviation(sorted, average) / NANOSECONDS_PER_MILLISECOND);
+            description.set("min", sorted.empty() ? 0.0 : sorted.front() / NANOSECONDS_PER_MILLISECOND);
+            description.set("p50", percentile(sorted, 0.50) / NANOSECONDS_PER_MILLISECOND);
+            description.set("p90", percentile(sorted, 0.90) / NANOSECONDS_PER_MILLISECOND);
+            description.set("p95", percentile(sorted, 0.95) / NANOSECONDS_PER_MILLISECOND);
+            description.set("p99", percentile(sorted, 0.99) / NANOSECONDS_PER_MILLISECOND);
+            description.set("max", sorted.empty() ? 0.0 : sorted.back() / NANOSECONDS_PER_MILLISECOND);
+            return description;
+        }
+
+        /// Entry of the "results" array, same layout as the VKING_Benchmarks report
+        Json::Value makeResult(const std::string& name, const std::vector<double>& nanoseconds) {
+            std::vector<double> sorted = nanoseconds;
+            std::ranges::sort(sorted);
+            const double average = mean(sorted);
+
+            Json::Value result = Json::Value::Object{};
+            result.set("name", name);
+            result.set("threads", 1);
+            result.set("iterations", 1);
+            result.set("meanNs", average);
+            result.set("medianNs", percentile(sorted, 0.50));
+            result.set("stddevNs", standardDeviation(sorted, average));
+            result.set("minNs", sorted.empty() ? 0.0 : sorted.front());
+            result.set("maxNs", sorted.empty() ? 0.0 : sorted.back());
+            Json::Value samples = Json::Value::Array{};
+            for (const double sample : nanoseconds) samples.push(sample);
+            result.set("samples", std::move(samples));
+            return result;
+        }
+
+        /// Counter totals of a zone, with IPC and misses per thousand instructions to compare systems by
+        Json::Value describeCounters(const Profiler::ZoneSummary& zone) {
+            Json::Value counters = Json::Value::Object{};
+            counters.set("calls", zone.countedCalls);
+            for (uint32_t i = 0; i < Profiler::COUNTER_COUNT; i++) {
+                counters.set(Profiler::getCounterName(static_cast<Profiler::Counter>(i)), zone.counters[i]);
+            }
+
+            const auto cycles = static_cast<double>(zone.counters[static_cast<uint32_t>(Profiler::Counter::CYCLES)]);
+            const auto instructions = static_cast<double>(zone.counters[static_cast<uint32_t>(Profiler::Counter::INSTRUCTIONS)]);
+            const auto llcMisses = static_cast<double>(zone.counters[static_cast<uint32_t>(Profiler::Counter::LLC_MISSES)]);
+            const auto branchMisses = static_cast<double>(zone.counters[static_cast<uint32_t>(Profiler::Counter::BRANCH_MISSES)]);
+            counters.set("ipc", cycles > 0.0 ? instructions / cycles : 0.0);
+            counters.set("llcMissesPerKiloInstruction", instructions > 0.0 ? llcMisses * 1000.0 / instructions : 0.0);
+            counters.set("branchMissesPerKiloInstruction", instructions > 0.0 ? branchMisses * 1000.0 / instructions : 0.0);
+            return counters;
+        }
+
+        std::string getUtcTimestamp() {
+            const std::time_t now = std::time(nullptr);
+            std::tm utc{};
+#if defined(_WIN32)
+            gmtime_s(&utc, &now);
+#else
+            gmtime_r(&now, &utc);
+#endif
+            char buffer[32];
+            std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+            return buffer;
+        }
+
+    }
+
+    FrameHarness::FrameHarness(RunInfo info, const uint32_t measuredFrames)
+        : m_Info(std::move(info)) {
+        m_FrameNanoseconds.reserve(measuredFrames);
+        // buildReport() summarizes every measured frame, the profiler keeps only the last few by default
+        Profiler::setRetainedFrames(std::max(Profiler::getRetainedFrames(), measuredFrames));
+    }
+
+    uint64_t FrameHarness::getPeakResidentBytes() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+        return counters.PeakWorkingSetSize;
+#else
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#   if defined(__APPLE__)
+        return static_cast<uint64_t>(usage.ru_maxrss);          // bytes on macOS
+#   else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;   // kilobytes elsewhere
+#   endif
+#endif
+    }
+
+    Json::Value FrameHarness::buildReport() const {
+        Json::Value report = Json::Value::Object{};
+        report.set("schema", FRAME_REPORT_SCHEMA_VERSION);
+        report.set("suite", "VKING_Main --harness");
+        report.set("timestamp", getUtcTimestamp());
+
+        Json::Value run = Json::Value::Object{};
+        run.set("scene", m_Info.scenePath);
+        run.set("sceneEntities", m_Info.sceneEntities);
+        run.set("sceneLoadMilliseconds", m_Info.sceneLoadMilliseconds);
+        run.set("platform", m_Info.platform);
+        run.set("backend", m_Info.backend);
+        run.set("warmupFrames", m_Info.warmupFrames);
+        run.set("measuredFrames", getRecordedFrames());
+        run.set("hardwareThreads", std::thread::hardware_concurrency());
+#if defined(NDEBUG)
+        run.set("buildType", "Release");
+#else
+        run.set("buildType", "Debug");
+#endif
+        run.set("profiler", VKING_PROFILER_ENABLED != 0);
+        run.set("hardwareCounters", Profiler::areHardwareCountersEnabled() && Profiler::getStats().countedThreadCount > 0);
+        report.set("run", std::move(run));
+
+        report.set("frameTimeMilliseconds", describeMilliseconds(m_FrameNanoseconds));
+
+        Json::Value results = Json::Value::Array{};
+        results.push(makeResult("frameTime", m_FrameNanoseconds));
+
+        // === Per-zone CPU time, summed over threads ===
+        Json::Value zones = Json::Value::Array{};
+        const Profiler::FrameSummary summary = Profiler::summarizeFrames(getRecordedFrames());
+        for (const Profiler::ZoneSummary& zone : summary.zones) {
+            double total = 0.0;
+            for (const double frame : zone.frameNanoseconds) total += frame;
+
+            Json::Value entry = describeMilliseconds(zone.frameNanoseconds);
+            entry.set("name", zone.name);
+            entry.set("calls", zone.calls);
+            entry.set("totalMilliseconds", total / NANOSECONDS_PER_MILLISECOND);
+            if (zone.countedCalls > 0) entry.set("counters", describeCounters(zone));
+            zones.push(std::move(entry));
+
+            results.push(makeResult(std::string("zone/") + zone.name, zone.frameNanoseconds));
+        }
+        report.set("zones", std::move(zones));
+
+        // Filled in once an RHI reports timestamp queries. The headless platform never has any
+        report.set("gpuPasses", Json::Value::Array{});
+
+        Json::Value memory = Json::Value::Object{};
+        memory.set("peakResidentBytes", getPeakResidentBytes());
+        report.set("memory", std::move(memory));
+
+        // === Startup, one sample per process ===
+        if (const std::optional<Startup::Report> startupReport = Startup::getReport()) {
+            Json::Value startup = Json::Value::Object{};
+            startup.set("preMainMilliseconds", startupReport->preMainMilliseconds);
+            startup.set("timeToFirstFrameMilliseconds", startupReport->timeToFirstFrameMilliseconds);
+            Json::Value phases = Json::Value::Array{};
+            for (const Startup::PhaseTiming& phase : startupReport->phases) {
+                Json::Value entry = Json::Value::Object{};
+                entry.set("name", phase.name);
+                entry.set("beginMilliseconds", phase.beginMilliseconds);
+                entry.set("endMilliseconds", phase.endMilliseconds);
+                entry.set("mainThread", phase.mainThread);
+                entry.set("succeeded", phase.succeeded);
+                phases.push(std::move(entry));
+            }
+            startup.set("phases", std::move(phases));
+            report.set("startup", std::move(startup));
+
+            results.push(makeResult("timeToFirstFrame", {startupReport->timeToFirstFrameMilliseconds * NANOSECONDS_PER_MILLISECOND}));
+        }
+
+        report.set("results", std::move(results));
+        return report;
+    }
+
+    bool FrameHarness::writeReport(const std::filesystem::path& path) const {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << buildReport().dump(2) << '\n';
+        if (!file) {
+            FrameHarnessLogger::record().error("Could not write the frame report to {}.", path.string());
+            return false;
+        }
+        FrameHarnessLogger::record().info("Frame report with {} frames written to {}.", getRecordedFrames(), path.string());
+        return true;
+    }
+
+}
@@ -0,0 +1,85 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+export module VKING.FrameHarness;
+
+export import VKING.Json;
+
+export namespace VKING {
+
+    /// Version of the frame report layout, bumped whenever a field changes meaning
+    constexpr uint32_t FRAME_REPORT_SCHEMA_VERSION = 1;
+
+    /**
+     * @brief Collects frame times of a harness run and turns them into a JSON report.
+     *
+     * The report holds frame-time percentiles, per-zone CPU times from the profiler (with IPC and miss rates when
+     * hardware counters are enabled), GPU pass times and the memory high-water mark. Its "results" array uses the same layout as the VKING_Benchmarks reports (a name
+     * and raw samples in nanoseconds), so VKING_BenchmarkCompare can test either against a baseline.
+     */
+    class FrameHarness {
+    public:
+        struct RunInfo {
+            std::string scenePath;
+            uint64_t sceneEntities = 0;
+            double sceneLoadMilliseconds = 0.0;
+            std::string platform;
+            std::string backend;
+            uint32_t warmupFrames = 0;
+        };
+
+        explicit FrameHarness(RunInfo info, uint32_t measuredFrames);
+
+        /**
+         * @brief Records the duration of one measured frame.
+         */
+        void recordFrame(double nanoseconds) { m_FrameNanoseconds.push_back(nanoseconds); }
+
+        [[nodiscard]] uint32_t getRecordedFrames() const { return static_cast<uint32_t>(m_FrameNanoseconds.size()); }
+
+        /**
+         * @brief Builds the report. Per-zone times cover the last getRecordedFrames() frames the profiler saw,
+         *        and are empty when the profiler is compiled out.
+         */
+        [[nodiscard]] Json::Value buildReport() const;
+
+        /**
+         * @return false if the report could not be written
+         */
+        bool writeReport(const std::filesystem::path& path) const;
+
+        /**
+         * @return The most memory the process has had resident at once, in bytes. 0 if the platform cannot tell
+         */
+        static uint64_t getPeakResidentBytes();
+
+    private:
+        RunInfo m_Info;
+        std::vector<double> m_FrameNanoseconds;
+    };
+
+}
@@ -0,0 +1,126 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+module VKING.LaunchOptions;
+
+import VKING.Log;
+
+namespace VKING {
+
+    namespace {
+
+        using LaunchOptionsLogger = Log::Named<"LaunchOptions">;
+
+        LaunchOptions s_LaunchOptions;
+
+        void parseCount(const std::string_view key, const std::string_view value, uint32_t& out) {
+            uint32_t parsed = 0;
+            const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+            if (error != std::errc() || end != value.data() + value.size()) {
+                LaunchOptionsLogger::record().warn("Ignoring {}={}, expected a non-negative integer. Keeping {}.", key, value, out);
+                return;
+            }
+            out = parsed;
+        }
+
+    }
+
+    LaunchOptions parseLaunchOptions(const int argc, const char* const* argv) {
+        LaunchOptions options;
+        for (int i = 1; i < argc; i++) {
+            const std::string_view argument = argv[i];
+            const size_t equals = argument.find('=');
+            const std::string_view key = argument.substr(0, equals);
+            const std::string_view value = equals == std::string_view::npos ? std::string_view() : argument.substr(equals + 1);
+
+            if (key == "--headless") {
+                options.headless = true;
+            } else if (key == "--harness") {
+                options.harness = true;
+            } else if (key == "--server") {
+                options.server = true;
+            } else if (key == "--perf-counters") {
+                options.hardwareCounters = true;
+            } else if (key == "--no-live-metrics") {
+                options.liveMetrics = false;
+            } else if (key == "--profiler-stream") {
+                options.profilerStream = true;
+                options.profilerStreamPath = value;
+            } else if (key == "--scene") {
+                options.scenePath = value;
+            } else if (key == "--warmup-frames") {
+                parseCount(key, value, options.warmupFrames);
+            } else if (key == "--frames") {
+                parseCount(key, value, options.measuredFrames);
+            } else if (key == "--report" && !value.empty()) {
+                options.reportPath = value;
+            } else if (key == "--sample-hz") {
+                parseCount(key, value, options.sampleFrequency);
+            } else if (key == "--sample-output" && !value.empty()) {
+                options.sampleOutputPath = value;
+            } else if (key == "--alloc-sample") {
+                parseCount(key, value, options.allocationSampleInterval);
+            } else if (key == "--alloc-report" && !value.empty()) {
+                options.allocationReportPath = value;
+            } else if (key == "--watchdog-ms") {
+                parseCount(key, value, options.watchdogHangMilliseconds);
+            } else if (key == "--watchdog-fatal-ms") {
+                parseCount(key, value, options.watchdogFatalMilliseconds);
+            } else if (key == "--plugin-dir" && !value.empty()) {
+                options.pluginDirectory = value;
+            } else if (key == "--reprobe") {
+                options.reprobePlatforms = true;
+            } else if (key == "--config") {
+                // --config= with no path runs without a config file
+                options.configPath = value;
+            } else if (key == "--console") {
+                options.console = true;
+            } else if (key == "--game-module" && !value.empty()) {
+                options.gameModulePath = value;
+            }
+        }
+
+        if (options.server && options.harness) {
+            LaunchOptionsLogger::record().warn("--harness measures rendered frames and is ignored with --server.");
+            options.harness = false;
+        }
+        if (options.harness && options.measuredFrames == 0) {
+            LaunchOptionsLogger::record().warn("--frames=0 measures nothing, measuring 1 frame instead.");
+            options.measuredFrames = 1;
+        }
+        return options;
+    }
+
+    const LaunchOptions& getLaunchOptions() {
+        return s_LaunchOptions;
+    }
+
+    void setLaunchOptions(LaunchOptions options) {
+        s_LaunchOptions = std::move(options);
+    }
+
+}
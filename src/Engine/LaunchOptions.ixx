@@ -0,0 +1,112 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <string>
+
+export module VKING.LaunchOptions;
+
+export namespace VKING {
+
+    /**
+     * @brief Engine options taken from the command line of VKING_Main.
+     *
+     * Recognized:
+     * - --headless: use the headless platform, no window system and no GPU
+     * - --harness: run the frame-time harness instead of the interactive loop, then exit
+     * - --server: dedicated server, no platform, window or RHI at all. Runs fixed ticks at server.tickHz instead of
+     *   frames, see Application::runServer(). Implies --headless, and --harness is ignored
+     * - --scene=<path>: scene loaded before the first frame
+     * - --warmup-frames=<n>: harness frames run before measuring (default 120)
+     * - --frames=<n>: harness frames measured (default 1000)
+     * - --report=<path>: where the harness writes its JSON report (default VKING_FrameReport.json)
+     * - --perf-counters: sample hardware counters in every profiler zone, see Profiler::setHardwareCountersEnabled()
+     * - --sample-hz=<n>: run the sampling profiler at n samples per second of CPU time, see Profiler::Sampling::start()
+     * - --sample-output=<path>: where the folded stacks are written on exit (default VKING_Samples.folded)
+     * - --alloc-sample=<bytes>: sample one engine allocation per that many bytes on average, see Profiler::Allocations
+     * - --alloc-report=<path>: where the allocation report is written on exit (default VKING_Allocations.txt)
+     * - --no-live-metrics: do not publish live metrics in shared memory for VKING_Top, see LiveMetrics::open()
+     * - --profiler-stream[=<path>]: stream profiler frames and logs to VKING_ProfilerViewer over a Unix domain
+     *   socket, by default Profiler::Stream::getDefaultSocketPath()
+     * - --watchdog-ms=<ms>: write hang diagnostics once the main loop stalls this long (default 10000, 0 disables
+     *   the watchdog), see Watchdog::start()
+     * - --watchdog-fatal-ms=<ms>: end the process once the main loop stalls this long (default 30000, 0 never does)
+     * - --plugin-dir=<path>: where platform plugins are searched for, see EngineConfig::setPlatformPluginDirectory()
+     * - --reprobe: probe every platform configuration again instead of trusting the probe cache, see
+     *   EngineConfig::getPlatformProbeResults()
+     * - --config=<path>: JSON file of CVar values, reloaded when it changes (default VKING_Config.json, empty for
+     *   none), see CVars::loadConfigFile()
+     * - --console: read CVar commands from stdin while running, see CVars::execute()
+     * - --game-module=<path>: create the application from a game module instead of the linked in createApplication(),
+     *   and reload it whenever it is rebuilt, see GameModule
+     * - +<name>=<value>: sets a CVar, overriding the config file. Handled by CVars::parseCommandLine(), not here
+     *
+     * Anything else is left to the application and ignored here.
+     */
+    struct LaunchOptions {
+        bool headless = false;
+        bool harness = false;
+        bool server = false;
+        bool hardwareCounters = false;
+        bool liveMetrics = true;
+        bool profilerStream = false;
+        /// Empty uses the default socket path for this process
+        std::string profilerStreamPath;
+        std::string scenePath;
+        uint32_t warmupFrames = 120;
+        uint32_t measuredFrames = 1000;
+        std::string reportPath = "VKING_FrameReport.json";
+        /// 0 leaves the sampling profiler off
+        uint32_t sampleFrequency = 0;
+        std::string sampleOutputPath = "VKING_Samples.folded";
+        /// 0 leaves the allocation profiler off
+        uint32_t allocationSampleInterval = 0;
+        std::string allocationReportPath = "VKING_Allocations.txt";
+        /// 0 leaves the watchdog off
+        uint32_t watchdogHangMilliseconds = 10'000;
+        uint32_t watchdogFatalMilliseconds = 30'000;
+        /// Empty searches the default plugin directories
+        std::string pluginDirectory;
+        bool reprobePlatforms = false;
+        /// Empty loads no config file
+        std::string configPath = "VKING_Config.json";
+        bool console = false;
+        /// Empty uses the linked in createApplication()
+        std::string gameModulePath;
+    };
+
+    /**
+     * @brief Parses the engine's options out of argv. Malformed values are logged and keep their default.
+     */
+    LaunchOptions parseLaunchOptions(int argc, const char* const* argv);
+
+    /**
+     * @return The options VKING_Main was started with
+     */
+    const LaunchOptions& getLaunchOptions();
+
+    /**
+     * @brief Replaces the current options. Called by VKING_Main before the application is created.
+     */
+    void setLaunchOptions(LaunchOptions options);
+
+}
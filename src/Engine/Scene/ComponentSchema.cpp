@@ -0,0 +1,252 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+module VKING.Scene.Schema;
+
+import VKING.Log;
+
+namespace VKING::Scene {
+
+    using SceneSchemaLogger = Log::Named<"SceneSchema">;
+
+    namespace {
+
+        constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ull;
+        constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+
+        void hashBytes(uint64_t& hash, const void* data, const size_t size) {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; i++) {
+                hash ^= bytes[i];
+                hash *= FNV_PRIME;
+            }
+        }
+
+        void hashValue(uint64_t& hash, const uint32_t value) {
+            hashBytes(hash, &value, sizeof(value));
+        }
+
+        std::string makeMigrationKey(const std::string_view componentName, const uint64_t fromHash) {
+            std::string key(componentName);
+            key += '#';
+            key += std::to_string(fromHash);
+            return key;
+        }
+
+        constexpr uint32_t alignUp(const uint32_t value, const uint32_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        /// Reads one element of any numeric field type as a double. BLOB_REF is never converted
+        double readScalar(const FieldType type, const std::byte* source) {
+            switch (type) {
+                case FieldType::UINT8:   { uint8_t v;  std::memcpy(&v, source, sizeof(v)); return v; }
+                case FieldType::INT8:    { int8_t v;   std::memcpy(&v, source, sizeof(v)); return v; }
+                case FieldType::UINT16:  { uint16_t v; std::memcpy(&v, source, sizeof(v)); return v; }
+                case FieldType::INT16:   { int16_t v;  std::memcpy(&v, source, sizeof(v)); return v; }
+                case FieldType::UINT32:  { uint32_t v; std::memcpy(&v, source, sizeof(v)); return v; }
+                case FieldType::INT32:   { int32_t v;  std::memcpy(&v, source, sizeof(v)); return v; }
+                case FieldType::UINT64:  { uint64_t v; std::memcpy(&v, source, sizeof(v)); return static_cast<double>(v); }
+                case FieldType::INT64:   { int64_t v;  std::memcpy(&v, source, sizeof(v)); return static_cast<double>(v); }
+                case FieldType::FLOAT32: { float v;    std::memcpy(&v, source, sizeof(v)); return v; }
+                case FieldType::FLOAT64: { double v;   std::memcpy(&v, source, sizeof(v)); return v; }
+                default: return 0.0;
+            }
+        }
+
+        /// Integer fields saturate at the limits of the type and take NaN as 0, a plain cast of either is undefined
+        template<typename T>
+        void storeAs(const double value, std::byte* destination) {
+            T converted;
+            if constexpr (std::is_integral_v<T>) {
+                // max() itself may not be representable as a double, the first value past it always is
+                constexpr double BEYOND_MAX = static_cast<double>(std::numeric_limits<T>::max() / 2 + 1) * 2.0;
+                if (std::isnan(value)) converted = 0;
+                else if (value >= BEYOND_MAX) converted = std::numeric_limits<T>::max();
+                else if (value <= static_cast<double>(std::numeric_limits<T>::lowest())) converted = std::numeric_limits<T>::lowest();
+                else converted = static_cast<T>(value);
+            } else {
+                converted = static_cast<T>(value);
+            }
+            std::memcpy(destination, &converted, sizeof(T));
+        }
+
+        void writeScalar(const FieldType type, const double value, std::byte* destination) {
+            switch (type) {
+                case FieldType::UINT8:   storeAs<uint8_t>(value, destination); break;
+                case FieldType::INT8:    storeAs<int8_t>(value, destination); break;
+                case FieldType::UINT16:  storeAs<uint16_t>(value, destination); break;
+                case FieldType::INT16:   storeAs<int16_t>(value, destination); break;
+                case FieldType::UINT32:  storeAs<uint32_t>(value, destination); break;
+                case FieldType::INT32:   storeAs<int32_t>(value, destination); break;
+                case FieldType::UINT64:  storeAs<uint64_t>(value, destination); break;
+                case FieldType::INT64:   storeAs<int64_t>(value, destination); break;
+                case FieldType::FLOAT32: storeAs<float>(value, destination); break;
+                case FieldType::FLOAT64: storeAs<double>(value, destination); break;
+                default: break;
+            }
+        }
+
+    }
+
+    uint64_t computeSchemaHash(const ComponentSchema& schema) {
+        uint64_t hash = FNV_OFFSET_BASIS;
+        hashBytes(hash, schema.name.data(), schema.name.size());
+        hashValue(hash, schema.size);
+        hashValue(hash, schema.alignment);
+        for (const FieldDescriptor& field : schema.fields) {
+            hashBytes(hash, field.name.data(), field.name.size());
+            hashValue(hash, static_cast<uint32_t>(field.type));
+            hashValue(hash, field.offset);
+            hashValue(hash, field.count);
+        }
+        return hash;
+    }
+
+    uint32_t ComponentRegistry::registerComponent(ComponentSchema schema) {
+        if (schema.size == 0 || schema.alignment == 0 || schema.alignment > CHUNK_COLUMN_ALIGNMENT) {
+            SceneSchemaLogger::record().error("Component '{}' has an invalid size ({}) or alignment ({}).", schema.name, schema.size, schema.alignment);
+            return UINT32_MAX;
+        }
+
+        for (const FieldDescriptor& field : schema.fields) {
+            if (field.offset + getFieldTypeSize(field.type) * field.count > schema.size) {
+                SceneSchemaLogger::record().error("Field '{}' of component '{}' runs past the end of the component.", field.name, schema.name);
+                return UINT32_MAX;
+            }
+        }
+
+        if (!schema.defaultValue.empty() && schema.defaultValue.size() != schema.size) {
+            SceneSchemaLogger::record().warn("Default value of component '{}' has the wrong size and will be ignored.", schema.name);
+            schema.defaultValue.clear();
+        }
+
+        schema.hash = computeSchemaHash(schema);
+
+        if (const auto existing = m_SchemaIndices.find(schema.name); existing != m_SchemaIndices.end()) {
+            SceneSchemaLogger::record().warn("Component '{}' registered twice, replacing the earlier schema.", schema.name);
+            m_Schemas[existing->second] = std::move(schema);
+            return existing->second;
+        }
+
+        const auto index = static_cast<uint32_t>(m_Schemas.size());
+        SceneSchemaLogger::record().trace("Registered component '{}' ({} bytes, hash {:016x}).", schema.name, schema.size, schema.hash);
+        m_SchemaIndices.emplace(schema.name, index);
+        m_Schemas.push_back(std::move(schema));
+        return index;
+    }
+
+    void ComponentRegistry::registerMigration(const std::string_view componentName, const uint64_t fromHash, MigrationFn migration) {
+        m_Migrations[makeMigrationKey(componentName, fromHash)] = std::move(migration);
+    }
+
+    uint32_t ComponentRegistry::findComponent(const std::string_view name) const {
+        const auto found = m_SchemaIndices.find(std::string(name));
+        return found == m_SchemaIndices.end() ? UINT32_MAX : found->second;
+    }
+
+    const MigrationFn* ComponentRegistry::findMigration(const std::string_view componentName, const uint64_t fromHash) const {
+        const auto found = m_Migrations.find(makeMigrationKey(componentName, fromHash));
+        return found == m_Migrations.end() ? nullptr : &found->second;
+    }
+
+    void ComponentRegistry::migrateByFieldName(const ComponentSchema& oldSchema, const std::byte* oldData,
+                                               const ComponentSchema& newSchema, std::byte* newData, const uint32_t count) {
+        // resolve the field mapping once per column, then apply it to every component
+        struct FieldMapping {
+            const FieldDescriptor* from;
+            const FieldDescriptor* to;
+        };
+        std::vector<FieldMapping> mappings;
+        for (const FieldDescriptor& newField : newSchema.fields) {
+            const auto oldField = std::ranges::find(oldSchema.fields, newField.name, &FieldDescriptor::name);
+            if (oldField == oldSchema.fields.end()) continue;
+            if ((oldField->type == FieldType::BLOB_REF) != (newField.type == FieldType::BLOB_REF)) {
+                SceneSchemaLogger::record().warn("Field '{}' of component '{}' changed to or from a blob reference, it will be reset.", newField.name, newSchema.name);
+                continue;
+            }
+            mappings.push_back({&*oldField, &newField});
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            const std::byte* source = oldData + static_cast<size_t>(i) * oldSchema.size;
+            std::byte* destination = newData + static_cast<size_t>(i) * newSchema.size;
+
+            if (newSchema.defaultValue.empty()) std::memset(destination, 0, newSchema.size);
+            else std::memcpy(destination, newSchema.defaultValue.data(), newSchema.size);
+
+            for (const auto& [from, to] : mappings) {
+                const uint32_t elements = std::min(from->count, to->count);
+                if (from->type == to->type) {
+                    std::memcpy(destination + to->offset, source + from->offset, static_cast<size_t>(elements) * getFieldTypeSize(to->type));
+                    continue;
+                }
+                for (uint32_t element = 0; element < elements; element++) {
+                    const double value = readScalar(from->type, source + from->offset + element * getFieldTypeSize(from->type));
+                    writeScalar(to->type, value, destination + to->offset + element * getFieldTypeSize(to->type));
+                }
+            }
+        }
+    }
+
+    ChunkLayout computeChunkLayoutForCapacity(const std::span<const ComponentSchema* const> components, const uint32_t capacity) {
+        ChunkLayout layout;
+        layout.capacity = capacity;
+        layout.columns.reserve(components.size());
+
+        uint32_t offset = alignUp(static_cast<uint32_t>(sizeof(EntityId)) * capacity, CHUNK_COLUMN_ALIGNMENT);
+        for (const ComponentSchema* schema : components) {
+            layout.columns.push_back({.schemaHash = schema->hash, .offset = offset, .elementSize = schema->size});
+            offset = alignUp(offset + schema->size * capacity, CHUNK_COLUMN_ALIGNMENT);
+        }
+        layout.strideBytes = offset;
+        return layout;
+    }
+
+    ChunkLayout computeChunkLayout(const std::span<const ComponentSchema* const> components, const uint32_t targetChunkBytes) {
+        uint32_t bytesPerEntity = sizeof(EntityId);
+        for (const ComponentSchema* schema : components) bytesPerEntity += schema->size;
+
+        // estimate ignoring padding, then back off until the padded columns fit
+        uint32_t capacity = std::max(targetChunkBytes / bytesPerEntity, 1u);
+        ChunkLayout layout = computeChunkLayoutForCapacity(components, capacity);
+        while (capacity > 1 && layout.strideBytes > targetChunkBytes) {
+            const uint32_t step = std::max((layout.strideBytes - targetChunkBytes) / bytesPerEntity, 1u);
+            capacity = capacity > step ? capacity - step : 1;
+            layout = computeChunkLayoutForCapacity(components, capacity);
+        }
+        return layout;
+    }
+
+}
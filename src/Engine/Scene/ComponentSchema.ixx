@@ -0,0 +1,260 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+export module VKING.Scene.Schema;
+
+export namespace VKING::Scene {
+
+    /**
+     * @brief Scalar type of a single component field.
+     *
+     * BLOB_REF fields hold a BlobRef, an offset into the scene's blob section rather than a pointer,
+     * so variable length data (names, paths, arrays) survives being written to and mapped from disk.
+     */
+    enum class FieldType : uint16_t {
+        UINT8,
+        INT8,
+        UINT16,
+        INT16,
+        UINT32,
+        INT32,
+        UINT64,
+        INT64,
+        FLOAT32,
+        FLOAT64,
+        BLOB_REF
+    };
+
+    /**
+     * @brief Reference to variable length data stored in a scene's blob section.
+     */
+    struct BlobRef {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+    /// Entity identifiers as stored in every chunk's entity column
+    using EntityId = uint64_t;
+
+    /**
+     * @return The size of a single element of the given field type in bytes
+     */
+    constexpr uint32_t getFieldTypeSize(const FieldType type) {
+        switch (type) {
+            case FieldType::UINT8:
+            case FieldType::INT8:    return 1;
+            case FieldType::UINT16:
+            case FieldType::INT16:   return 2;
+            case FieldType::UINT32:
+            case FieldType::INT32:
+            case FieldType::FLOAT32: return 4;
+            case FieldType::UINT64:
+            case FieldType::INT64:
+            case FieldType::FLOAT64: return 8;
+            case FieldType::BLOB_REF: return sizeof(BlobRef);
+            default: return 0;
+        }
+    }
+
+    struct FieldDescriptor {
+        std::string name;
+        FieldType type = FieldType::FLOAT32;
+        /// Byte offset of the field inside the component
+        uint32_t offset = 0;
+        /// Number of consecutive elements, e.g. 3 for a float[3] position
+        uint32_t count = 1;
+    };
+
+    /**
+     * @brief Describes the memory layout of one component type.
+     *
+     * The hash covers the name, size, alignment and every field, so any layout change a loader could observe
+     * produces a different hash. Scene files store the hash of every component they contain and only the
+     * columns whose hash differs from the running build go through migration.
+     */
+    struct ComponentSchema {
+        std::string name;
+        uint32_t size = 0;
+        uint32_t alignment = 1;
+        std::vector<FieldDescriptor> fields;
+        /// Bytes of a default constructed instance, used to fill fields that did not exist in an older schema. May be empty
+        std::vector<std::byte> defaultValue;
+        uint64_t hash = 0;
+    };
+
+    /**
+     * @brief Computes the layout hash of a schema (FNV-1a 64 over the name, size, alignment and fields).
+     */
+    uint64_t computeSchemaHash(const ComponentSchema& schema);
+
+    /**
+     * @brief Converts one column of components between two schemas of the same component.
+     *
+     * Called once per chunk column, not per entity. oldData is laid out with oldSchema, newData with the
+     * current schema and has room for count components.
+     */
+    using MigrationFn = std::function<void(const ComponentSchema& oldSchema, const std::byte* oldData,
+                                           const ComponentSchema& newSchema, std::byte* newData, uint32_t count)>;
+
+    /**
+     * @brief Registry of every component type the running build knows about, keyed by name.
+     *
+     * Not thread safe for registration. Register everything at startup, lookups afterward may happen from any thread.
+     */
+    class ComponentRegistry {
+    public:
+        /**
+         * @brief Registers a component type with an explicit field list.
+         *
+         * @return The index of the schema, or UINT32_MAX if the fields do not fit inside the component
+         */
+        uint32_t registerComponent(ComponentSchema schema);
+
+        /**
+         * @brief Registers a trivially copyable component type, capturing its size, alignment and default value.
+         */
+        template<typename T>
+        uint32_t registerComponent(std::string name, std::vector<FieldDescriptor> fields) {
+            static_assert(std::is_trivially_copyable_v<T>, "Scene components are stored as raw bytes and must be trivially copyable.");
+
+            ComponentSchema schema;
+            schema.name = std::move(name);
+            schema.size = sizeof(T);
+            schema.alignment = alignof(T);
+            schema.fields = std::move(fields);
+            if constexpr (std::is_default_constructible_v<T>) {
+                const T defaultInstance{};
+                schema.defaultValue.resize(sizeof(T));
+                std::memcpy(schema.defaultValue.data(), &defaultInstance, sizeof(T));
+            }
+            return registerComponent(std::move(schema));
+        }
+
+        /**
+         * @brief Registers a hand written migration from a specific older layout of a component.
+         *
+         * Without a registered migration, columns are converted field by field: fields are matched by name,
+         * numeric types are converted, fields that no longer exist are dropped and new fields take their
+         * default value.
+         */
+        void registerMigration(std::string_view componentName, uint64_t fromHash, MigrationFn migration);
+
+        /**
+         * @return The schema index for the name, or UINT32_MAX if the component is unknown
+         */
+        [[nodiscard]] uint32_t findComponent(std::string_view name) const;
+
+        [[nodiscard]] const ComponentSchema& getSchema(uint32_t index) const { return m_Schemas[index]; }
+        [[nodiscard]] std::span<const ComponentSchema> getSchemas() const { return m_Schemas; }
+
+        /**
+         * @return The migration registered for this name and old hash, or nullptr if none
+         */
+        [[nodiscard]] const MigrationFn* findMigration(std::string_view componentName, uint64_t fromHash) const;
+
+        /**
+         * @brief Field by field conversion used when no explicit migration is registered.
+         */
+        static void migrateByFieldName(const ComponentSchema& oldSchema, const std::byte* oldData,
+                                       const ComponentSchema& newSchema, std::byte* newData, uint32_t count);
+
+    private:
+        std::vector<ComponentSchema> m_Schemas;
+        std::unordered_map<std::string, uint32_t> m_SchemaIndices;
+        std::unordered_map<std::string, MigrationFn> m_Migrations;
+    };
+
+    /**
+     * @brief Placement of one component column inside a chunk.
+     */
+    struct ColumnLayout {
+        uint64_t schemaHash = 0;
+        uint32_t offset = 0;
+        uint32_t elementSize = 0;
+    };
+
+    /**
+     * @brief Layout of every chunk of one archetype.
+     *
+     * A chunk is a single block of strideBytes: the entity id column at offset 0 followed by one
+     * structure-of-arrays column per component, each aligned to CHUNK_COLUMN_ALIGNMENT. The layout is
+     * identical in memory and on disk, so a mapped chunk can be used in place.
+     */
+    struct ChunkLayout {
+        uint32_t capacity = 0;
+        uint32_t strideBytes = 0;
+        std::vector<ColumnLayout> columns;
+    };
+
+    /// Column starts are cache line aligned so each column can be streamed with aligned loads
+    constexpr uint32_t CHUNK_COLUMN_ALIGNMENT = 64;
+
+    /// Default chunk size. Large enough to amortize per-chunk overhead, small enough to stay L2 resident
+    constexpr uint32_t DEFAULT_CHUNK_BYTES = 64 * 1024;
+
+    /**
+     * @brief Computes the largest capacity whose chunk fits in targetChunkBytes.
+     *
+     * A single entity always fits, even if that makes the chunk larger than the target.
+     */
+    ChunkLayout computeChunkLayout(std::span<const ComponentSchema* const> components, uint32_t targetChunkBytes);
+
+    /**
+     * @brief Computes the layout with a fixed capacity. Used when migrating, where chunks must keep their entity count.
+     */
+    ChunkLayout computeChunkLayoutForCapacity(std::span<const ComponentSchema* const> components, uint32_t capacity);
+
+    /**
+     * @brief Non-owning view of one chunk.
+     */
+    struct ChunkView {
+        std::byte* data = nullptr;
+        uint32_t entityCount = 0;
+        const ChunkLayout* layout = nullptr;
+
+        [[nodiscard]] EntityId* getEntities() const { return reinterpret_cast<EntityId*>(data); }
+
+        /**
+         * @param componentIndex Index of the component within the archetype, not the registry
+         */
+        [[nodiscard]] std::byte* getColumn(const uint32_t componentIndex) const {
+            return data + layout->columns[componentIndex].offset;
+        }
+
+        template<typename T>
+        [[nodiscard]] T* getColumn(const uint32_t componentIndex) const {
+            return reinterpret_cast<T*>(getColumn(componentIndex));
+        }
+    };
+
+}
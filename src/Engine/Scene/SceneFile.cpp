@@ -0,0 +1,640 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+module VKING.Scene.Serialization;
+
+import VKING.JobSystem;
+import VKING.Log;
+
+namespace VKING::Scene {
+
+    using SceneSerializationLogger = Log::Named<"SceneSerialization">;
+
+    namespace {
+
+        // On-disk layout. Every table is an array of fixed size records addressed by byte offset from the
+        // start of the file, names live in a shared string table and chunk data starts page aligned so the
+        // mapping hands out chunks with the same alignment they had when they were written.
+
+        constexpr uint32_t SCENE_MAGIC = 0x43534B56; // "VKSC"
+        constexpr uint64_t CHUNK_DATA_ALIGNMENT = 4096;
+
+        struct FileHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t fileSize;
+            uint64_t entityCount;
+            uint32_t schemaCount;
+            uint32_t fieldCount;
+            uint32_t archetypeCount;
+            uint32_t archetypeComponentCount;
+            uint32_t chunkCount;
+            uint32_t reserved;
+            uint64_t schemaTableOffset;
+            uint64_t fieldTableOffset;
+            uint64_t archetypeTableOffset;
+            uint64_t archetypeComponentTableOffset;
+            uint64_t chunkTableOffset;
+            uint64_t stringTableOffset;
+            uint64_t stringTableSize;
+            uint64_t blobOffset;
+            uint64_t blobSize;
+        };
+
+        struct SchemaRecord {
+            uint64_t hash;
+            uint32_t nameOffset;
+            uint32_t nameLength;
+            uint32_t size;
+            uint32_t alignment;
+            uint32_t firstField;
+            uint32_t fieldCount;
+        };
+
+        struct FieldRecord {
+            uint32_t nameOffset;
+            uint32_t nameLength;
+            uint32_t offset;
+            uint32_t count;
+            uint32_t type;
+        };
+
+        struct ArchetypeRecord {
+            uint32_t firstComponent;
+            uint32_t componentCount;
+            uint32_t capacity;
+            uint32_t strideBytes;
+            uint32_t firstChunk;
+            uint32_t chunkCount;
+        };
+
+        struct ArchetypeComponentRecord {
+            uint32_t schemaIndex;
+            uint32_t columnOffset;
+        };
+
+        struct ChunkRecord {
+            uint64_t dataOffset;
+            uint32_t archetypeIndex;
+            uint32_t entityCount;
+        };
+
+        constexpr uint64_t alignUp(const uint64_t value, const uint64_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        AlignedChunk allocateChunk(const uint32_t strideBytes) {
+            auto* memory = static_cast<std::byte*>(::operator new(strideBytes, std::align_val_t{CHUNK_COLUMN_ALIGNMENT}));
+            return AlignedChunk(memory);
+        }
+
+        double millisecondsSince(const std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        /// Bounds checked view of a table inside the mapping
+        template<typename T>
+        bool getTable(const std::byte* mapping, const uint64_t mappingSize, const uint64_t offset, const uint32_t count, const T*& table) {
+            if (offset % alignof(T) != 0 || offset > mappingSize || (mappingSize - offset) / sizeof(T) < count) return false;
+            table = reinterpret_cast<const T*>(mapping + offset);
+            return true;
+        }
+
+        /// The schema a column was written with, rebuilt from the file so it can be handed to migrations
+        struct FileSchema {
+            ComponentSchema schema;
+            uint32_t registryIndex = UINT32_MAX;
+            bool matches = false;
+        };
+
+    }
+
+    void AlignedChunkDeleter::operator()(std::byte* chunk) const {
+        ::operator delete(chunk, std::align_val_t{CHUNK_COLUMN_ALIGNMENT});
+    }
+
+    // === SceneWriter ===
+
+    SceneWriter::SceneWriter(const ComponentRegistry& registry, const uint32_t targetChunkBytes)
+        : m_Registry(registry), m_TargetChunkBytes(targetChunkBytes) {
+    }
+
+    uint32_t SceneWriter::addArchetype(const std::span<const std::string_view> componentNames) {
+        Archetype archetype;
+        std::vector<const ComponentSchema*> schemas;
+        for (const std::string_view name : componentNames) {
+            const uint32_t index = m_Registry.findComponent(name);
+            if (index == UINT32_MAX) {
+                SceneSerializationLogger::record().error("Cannot add archetype: component '{}' is not registered.", name);
+                return INVALID_ARCHETYPE;
+            }
+            if (std::ranges::find(archetype.schemaIndices, index) != archetype.schemaIndices.end()) {
+                SceneSerializationLogger::record().error("Cannot add archetype: component '{}' is listed twice.", name);
+                return INVALID_ARCHETYPE;
+            }
+            archetype.schemaIndices.push_back(index);
+            schemas.push_back(&m_Registry.getSchema(index));
+        }
+
+        archetype.layout = computeChunkLayout(schemas, m_TargetChunkBytes);
+        m_Archetypes.push_back(std::move(archetype));
+        return static_cast<uint32_t>(m_Archetypes.size() - 1);
+    }
+
+    void SceneWriter::appendEntities(const uint32_t archetypeIndex, uint32_t count, const FillFn& fill) {
+        if (archetypeIndex >= m_Archetypes.size()) {
+            SceneSerializationLogger::record().error("Cannot append entities to unknown archetype {}.", archetypeIndex);
+            return;
+        }
+
+        Archetype& archetype = m_Archetypes[archetypeIndex];
+        m_EntityCount += count;
+        while (count > 0) {
+            if (archetype.chunks.empty() || archetype.entityCounts.back() == archetype.layout.capacity) {
+                archetype.chunks.push_back(allocateChunk(archetype.layout.strideBytes));
+                // padding between columns is written to disk too, keep it deterministic
+                std::memset(archetype.chunks.back().get(), 0, archetype.layout.strideBytes);
+                archetype.entityCounts.push_back(0);
+            }
+
+            uint32_t& chunkCount = archetype.entityCounts.back();
+            const uint32_t begin = chunkCount;
+            const uint32_t end = begin + std::min(count, archetype.layout.capacity - begin);
+            chunkCount = end;
+            count -= end - begin;
+
+            fill(ChunkView{archetype.chunks.back().get(), end, &archetype.layout}, begin, end);
+        }
+    }
+
+    BlobRef SceneWriter::addBlob(const std::span<const std::byte> data) {
+        const BlobRef blob{.offset = m_Blob.size(), .size = data.size()};
+        m_Blob.insert(m_Blob.end(), data.begin(), data.end());
+        return blob;
+    }
+
+    BlobRef SceneWriter::addString(const std::string_view string) {
+        return addBlob(std::as_bytes(std::span(string.data(), string.size())));
+    }
+
+    bool SceneWriter::save(const std::filesystem::path& path) const {
+        std::string strings;
+        auto addName = [&strings](const std::string_view name) {
+            const auto offset = static_cast<uint32_t>(strings.size());
+            strings += name;
+            return offset;
+        };
+
+        // only schemas that are actually used end up in the file
+        std::vector<uint32_t> fileSchemaIndex(m_Registry.getSchemas().size(), UINT32_MAX);
+        std::vector<SchemaRecord> schemaRecords;
+        std::vector<FieldRecord> fieldRecords;
+        std::vector<ArchetypeRecord> archetypeRecords;
+        std::vector<ArchetypeComponentRecord> componentRecords;
+        std::vector<ChunkRecord> chunkRecords;
+
+        for (const Archetype& archetype : m_Archetypes) {
+            for (const uint32_t registryIndex : archetype.schemaIndices) {
+                if (fileSchemaIndex[registryIndex] != UINT32_MAX) continue;
+                const ComponentSchema& schema = m_Registry.getSchema(registryIndex);
+                fileSchemaIndex[registryIndex] = static_cast<uint32_t>(schemaRecords.size());
+                schemaRecords.push_back({
+                    .hash = schema.hash,
+                    .nameOffset = addName(schema.name),
+                    .nameLength = static_cast<uint32_t>(schema.name.size()),
+                    .size = schema.size,
+                    .alignment = schema.alignment,
+                    .firstField = static_cast<uint32_t>(fieldRecords.size()),
+                    .fieldCount = static_cast<uint32_t>(schema.fields.size())
+                });
+                for (const FieldDescriptor& field : schema.fields) {
+                    fieldRecords.push_back({
+                        .nameOffset = addName(field.name),
+                        .nameLength = static_cast<uint32_t>(field.name.size()),
+                        .offset = field.offset,
+                        .count = field.count,
+                        .type = static_cast<uint32_t>(field.type)
+                    });
+                }
+            }
+        }
+
+        // header and tables first, then the blob, then the page aligned chunk data
+        uint64_t cursor = sizeof(FileHeader);
+        auto place = [&cursor](const uint64_t bytes, const uint64_t alignment) {
+            cursor = alignUp(cursor, alignment);
+            const uint64_t offset = cursor;
+            cursor += bytes;
+            return offset;
+        };
+
+        uint32_t totalChunks = 0;
+        uint32_t totalComponents = 0;
+        for (const Archetype& archetype : m_Archetypes) {
+            totalChunks += static_cast<uint32_t>(archetype.chunks.size());
+            totalComponents += static_cast<uint32_t>(archetype.schemaIndices.size());
+        }
+
+        FileHeader header{};
+        header.magic = SCENE_MAGIC;
+        header.version = SCENE_FILE_VERSION;
+        header.entityCount = m_EntityCount;
+        header.schemaCount = static_cast<uint32_t>(schemaRecords.size());
+        header.fieldCount = static_cast<uint32_t>(fieldRecords.size());
+        header.archetypeCount = static_cast<uint32_t>(m_Archetypes.size());
+        header.archetypeComponentCount = totalComponents;
+        header.chunkCount = totalChunks;
+        header.schemaTableOffset = place(sizeof(SchemaRecord) * schemaRecords.size(), alignof(SchemaRecord));
+        header.fieldTableOffset = place(sizeof(FieldRecord) * fieldRecords.size(), alignof(FieldRecord));
+        header.archetypeTableOffset = place(sizeof(ArchetypeRecord) * m_Archetypes.size(), alignof(ArchetypeRecord));
+        header.archetypeComponentTableOffset = place(sizeof(ArchetypeComponentRecord) * totalComponents, alignof(ArchetypeComponentRecord));
+        header.chunkTableOffset = place(sizeof(ChunkRecord) * totalChunks, alignof(ChunkRecord));
+        header.stringTableOffset = place(strings.size(), 1);
+        header.stringTableSize = strings.size();
+        header.blobOffset = place(m_Blob.size(), 16);
+        header.blobSize = m_Blob.size();
+
+        uint64_t dataCursor = alignUp(cursor, CHUNK_DATA_ALIGNMENT);
+        for (const Archetype& archetype : m_Archetypes) {
+            ArchetypeRecord record{
+                .firstComponent = static_cast<uint32_t>(componentRecords.size()),
+                .componentCount = static_cast<uint32_t>(archetype.schemaIndices.size()),
+                .capacity = archetype.layout.capacity,
+                .strideBytes = archetype.layout.strideBytes,
+                .firstChunk = static_cast<uint32_t>(chunkRecords.size()),
+                .chunkCount = static_cast<uint32_t>(archetype.chunks.size())
+            };
+            for (size_t i = 0; i < archetype.schemaIndices.size(); i++) {
+                componentRecords.push_back({fileSchemaIndex[archetype.schemaIndices[i]], archetype.layout.columns[i].offset});
+            }
+            for (const uint32_t entityCount : archetype.entityCounts) {
+                chunkRecords.push_back({dataCursor, static_cast<uint32_t>(archetypeRecords.size()), entityCount});
+                dataCursor += archetype.layout.strideBytes;
+            }
+            archetypeRecords.push_back(record);
+        }
+        header.fileSize = dataCursor;
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            SceneSerializationLogger::record().error("Could not open '{}' for writing.", path.string());
+            return false;
+        }
+
+        uint64_t written = 0;
+        auto writeAt = [&file, &written](const uint64_t offset, const void* data, const uint64_t size) {
+            static constexpr char ZEROES[256] = {};
+            while (written < offset) {
+                const uint64_t padding = std::min<uint64_t>(offset - written, sizeof(ZEROES));
+                file.write(ZEROES, static_cast<std::streamsize>(padding));
+                written += padding;
+            }
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            written += size;
+        };
+
+        writeAt(0, &header, sizeof(header));
+        writeAt(header.schemaTableOffset, schemaRecords.data(), sizeof(SchemaRecord) * schemaRecords.size());
+        writeAt(header.fieldTableOffset, fieldRecords.data(), sizeof(FieldRecord) * fieldRecords.size());
+        writeAt(header.archetypeTableOffset, archetypeRecords.data(), sizeof(ArchetypeRecord) * archetypeRecords.size());
+        writeAt(header.archetypeComponentTableOffset, componentRecords.data(), sizeof(ArchetypeComponentRecord) * componentRecords.size());
+        writeAt(header.chunkTableOffset, chunkRecords.data(), sizeof(ChunkRecord) * chunkRecords.size());
+        writeAt(header.stringTableOffset, strings.data(), strings.size());
+        writeAt(header.blobOffset, m_Blob.data(), m_Blob.size());
+
+        uint32_t chunkIndex = 0;
+        for (const Archetype& archetype : m_Archetypes) {
+            for (const AlignedChunk& chunk : archetype.chunks) {
+                writeAt(chunkRecords[chunkIndex++].dataOffset, chunk.get(), archetype.layout.strideBytes);
+            }
+        }
+
+        if (!file) {
+            SceneSerializationLogger::record().error("Failed while writing scene '{}'.", path.string());
+            return false;
+        }
+
+        SceneSerializationLogger::record().info("Saved scene '{}': {} entities in {} chunks, {} KiB.",
+                                                path.string(), m_EntityCount, totalChunks, header.fileSize / 1024);
+        return true;
+    }
+
+    // === SceneFile ===
+
+    uint32_t SceneArchetype::findComponent(const uint32_t registryIndex) const {
+        const auto found = std::ranges::find(components, registryIndex);
+        return found == components.end() ? UINT32_MAX : static_cast<uint32_t>(found - components.begin());
+    }
+
+    SceneFile::~SceneFile() {
+        if (!m_Mapping) return;
+#if defined(_WIN32)
+        UnmapViewOfFile(m_Mapping);
+#else
+        munmap(m_Mapping, m_MappingSize);
+#endif
+    }
+
+    std::unique_ptr<SceneFile> SceneFile::load(const std::filesystem::path& path, const ComponentRegistry& registry, const SceneLoadOptions& options) {
+        const auto mapStart = std::chrono::steady_clock::now();
+        std::unique_ptr<SceneFile> scene(new SceneFile());
+
+        // map copy-on-write: chunks are edited in place by the game, the file never changes
+#if defined(_WIN32)
+        const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            SceneSerializationLogger::record().error("Could not open scene '{}'.", path.string());
+            return nullptr;
+        }
+        LARGE_INTEGER fileSize;
+        GetFileSizeEx(file, &fileSize);
+        scene->m_MappingSize = static_cast<uint64_t>(fileSize.QuadPart);
+        const HANDLE mapping = scene->m_MappingSize ? CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr) : nullptr;
+        CloseHandle(file);
+        if (mapping) {
+            scene->m_Mapping = static_cast<std::byte*>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+            CloseHandle(mapping);
+        }
+        if (scene->m_Mapping && options.prefault) {
+            WIN32_MEMORY_RANGE_ENTRY range{scene->m_Mapping, scene->m_MappingSize};
+            PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+        }
+#else
+        const int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0) {
+            SceneSerializationLogger::record().error("Could not open scene '{}'.", path.string());
+            return nullptr;
+        }
+        struct stat fileStat{};
+        fstat(file, &fileStat);
+        scene->m_MappingSize = static_cast<uint64_t>(fileStat.st_size);
+        if (scene->m_MappingSize > 0) {
+            int flags = MAP_PRIVATE;
+#   if defined(MAP_POPULATE)
+            if (options.prefault) flags |= MAP_POPULATE;
+#   endif
+            void* mapping = mmap(nullptr, scene->m_MappingSize, PROT_READ | PROT_WRITE, flags, file, 0);
+            if (mapping != MAP_FAILED) scene->m_Mapping = static_cast<std::byte*>(mapping);
+        }
+        close(file);
+#endif
+        if (!scene->m_Mapping) {
+            SceneSerializationLogger::record().error("Could not map scene '{}' ({} bytes).", path.string(), scene->m_MappingSize);
+            return nullptr;
+        }
+        scene->m_Stats.mapMilliseconds = millisecondsSince(mapStart);
+        scene->m_Stats.fileBytes = scene->m_MappingSize;
+
+        // === Validate the container ===
+        const auto fixupStart = std::chrono::steady_clock::now();
+        const std::byte* base = scene->m_Mapping;
+        const uint64_t size = scene->m_MappingSize;
+
+        if (size < sizeof(FileHeader)) {
+            SceneSerializationLogger::record().error("Scene '{}' is too small to be a scene file.", path.string());
+            return nullptr;
+        }
+        const auto& header = *reinterpret_cast<const FileHeader*>(base);
+        if (header.magic != SCENE_MAGIC || header.version != SCENE_FILE_VERSION || header.fileSize != size) {
+            SceneSerializationLogger::record().error("Scene '{}' is not a version {} scene file or is truncated (version {}, {} of {} bytes).",
+                                                     path.string(), SCENE_FILE_VERSION, header.version, size, header.fileSize);
+            return nullptr;
+        }
+
+        const SchemaRecord* schemaRecords = nullptr;
+        const FieldRecord* fieldRecords = nullptr;
+        const ArchetypeRecord* archetypeRecords = nullptr;
+        const ArchetypeComponentRecord* componentRecords = nullptr;
+        const ChunkRecord* chunkRecords = nullptr;
+        if (!getTable(base, size, header.schemaTableOffset, header.schemaCount, schemaRecords)
+            || !getTable(base, size, header.fieldTableOffset, header.fieldCount, fieldRecords)
+            || !getTable(base, size, header.archetypeTableOffset, header.archetypeCount, archetypeRecords)
+            || !getTable(base, size, header.archetypeComponentTableOffset, header.archetypeComponentCount, componentRecords)
+            || !getTable(base, size, header.chunkTableOffset, header.chunkCount, chunkRecords)
+            || header.stringTableOffset > size || size - header.stringTableOffset < header.stringTableSize
+            || header.blobOffset > size || size - header.blobOffset < header.blobSize) {
+            SceneSerializationLogger::record().error("Scene '{}' has tables outside the file.", path.string());
+            return nullptr;
+        }
+
+        const std::string_view strings(reinterpret_cast<const char*>(base + header.stringTableOffset), header.stringTableSize);
+        auto getString = [&strings](const uint32_t offset, const uint32_t length) {
+            return offset <= strings.size() ? strings.substr(offset, length) : std::string_view{};
+        };
+        scene->m_Blob = {base + header.blobOffset, header.blobSize};
+
+        // === Compare schemas against the running build ===
+        std::vector<FileSchema> fileSchemas(header.schemaCount);
+        for (uint32_t i = 0; i < header.schemaCount; i++) {
+            const SchemaRecord& record = schemaRecords[i];
+            FileSchema& fileSchema = fileSchemas[i];
+            fileSchema.schema.name = getString(record.nameOffset, record.nameLength);
+            fileSchema.schema.size = record.size;
+            fileSchema.schema.alignment = record.alignment;
+            fileSchema.schema.hash = record.hash;
+            fileSchema.registryIndex = registry.findComponent(fileSchema.schema.name);
+
+            if (fileSchema.registryIndex == UINT32_MAX) {
+                SceneSerializationLogger::record().warn("Scene '{}' contains unknown component '{}', it will be dropped.", path.string(), fileSchema.schema.name);
+                scene->m_Stats.droppedComponents++;
+                continue;
+            }
+
+            fileSchema.matches = registry.getSchema(fileSchema.registryIndex).hash == record.hash;
+            if (fileSchema.matches) continue;
+
+            // only needed for migration, so only rebuilt when the layouts differ
+            if (record.firstField > header.fieldCount || header.fieldCount - record.firstField < record.fieldCount) {
+                SceneSerializationLogger::record().error("Scene '{}' has a corrupt field table for component '{}'.", path.string(), fileSchema.schema.name);
+                return nullptr;
+            }
+            for (uint32_t field = 0; field < record.fieldCount; field++) {
+                const FieldRecord& fieldRecord = fieldRecords[record.firstField + field];
+                const uint64_t fieldBytes = static_cast<uint64_t>(getFieldTypeSize(static_cast<FieldType>(fieldRecord.type))) * fieldRecord.count;
+                if (fieldBytes == 0 || fieldRecord.offset + fieldBytes > record.size) continue;
+                fileSchema.schema.fields.push_back({
+                    .name = std::string(getString(fieldRecord.nameOffset, fieldRecord.nameLength)),
+                    .type = static_cast<FieldType>(fieldRecord.type),
+                    .offset = fieldRecord.offset,
+                    .count = fieldRecord.count
+                });
+            }
+            scene->m_Stats.migratedComponents++;
+            SceneSerializationLogger::record().info("Component '{}' changed since '{}' was saved ({:016x} -> {:016x}), migrating.",
+                                                    fileSchema.schema.name, path.string(), record.hash,
+                                                    registry.getSchema(fileSchema.registryIndex).hash);
+        }
+
+        // === Resolve archetypes and chunks ===
+        struct PendingMigration {
+            uint32_t archetype;
+            uint32_t fileArchetype;
+            std::vector<uint32_t> fileSchemas;
+            std::vector<uint32_t> fileColumnOffsets;
+        };
+        std::vector<PendingMigration> migrations;
+
+        scene->m_Archetypes.resize(header.archetypeCount);
+        for (uint32_t a = 0; a < header.archetypeCount; a++) {
+            const ArchetypeRecord& record = archetypeRecords[a];
+            SceneArchetype& archetype = scene->m_Archetypes[a];
+
+            if (record.firstComponent > header.archetypeComponentCount || header.archetypeComponentCount - record.firstComponent < record.componentCount
+                || record.firstChunk > header.chunkCount || header.chunkCount - record.firstChunk < record.chunkCount
+                || record.strideBytes % CHUNK_COLUMN_ALIGNMENT != 0
+                || static_cast<uint64_t>(sizeof(EntityId)) * record.capacity > record.strideBytes) {
+                SceneSerializationLogger::record().error("Scene '{}' has a corrupt archetype {}.", path.string(), a);
+                return nullptr;
+            }
+
+            PendingMigration migration{.archetype = a, .fileArchetype = a, .fileSchemas = {}, .fileColumnOffsets = {}};
+            bool needsMigration = false;
+            for (uint32_t c = 0; c < record.componentCount; c++) {
+                const ArchetypeComponentRecord& component = componentRecords[record.firstComponent + c];
+                if (component.schemaIndex >= header.schemaCount || component.columnOffset % CHUNK_COLUMN_ALIGNMENT != 0
+                    || static_cast<uint64_t>(component.columnOffset) + static_cast<uint64_t>(schemaRecords[component.schemaIndex].size) * record.capacity > record.strideBytes) {
+                    SceneSerializationLogger::record().error("Scene '{}' has a column outside its chunk in archetype {}.", path.string(), a);
+                    return nullptr;
+                }
+
+                const FileSchema& fileSchema = fileSchemas[component.schemaIndex];
+                if (fileSchema.registryIndex == UINT32_MAX) continue;
+
+                archetype.components.push_back(fileSchema.registryIndex);
+                archetype.layout.columns.push_back({.schemaHash = fileSchema.schema.hash, .offset = component.columnOffset, .elementSize = fileSchema.schema.size});
+                migration.fileSchemas.push_back(component.schemaIndex);
+                migration.fileColumnOffsets.push_back(component.columnOffset);
+                needsMigration |= !fileSchema.matches;
+            }
+            archetype.layout.capacity = record.capacity;
+            archetype.layout.strideBytes = record.strideBytes;
+
+            archetype.chunks.reserve(record.chunkCount);
+            for (uint32_t c = 0; c < record.chunkCount; c++) {
+                const ChunkRecord& chunk = chunkRecords[record.firstChunk + c];
+                if (chunk.entityCount > record.capacity || chunk.dataOffset % CHUNK_COLUMN_ALIGNMENT != 0
+                    || chunk.dataOffset > size || size - chunk.dataOffset < record.strideBytes) {
+                    SceneSerializationLogger::record().error("Scene '{}' has a corrupt chunk {} in archetype {}.", path.string(), c, a);
+                    return nullptr;
+                }
+                // the only fix-up a zero-copy chunk needs: file offset to address
+                archetype.chunks.push_back({scene->m_Mapping + chunk.dataOffset, chunk.entityCount, nullptr});
+                archetype.entityCount += chunk.entityCount;
+            }
+            scene->m_Stats.chunkCount += record.chunkCount;
+            scene->m_Stats.entityCount += archetype.entityCount;
+
+            if (needsMigration) migrations.push_back(std::move(migration));
+            else scene->m_Stats.zeroCopyChunks += record.chunkCount;
+        }
+        scene->m_Stats.fixupMilliseconds = millisecondsSince(fixupStart);
+
+        // === Migrate archetypes whose schemas changed ===
+        const auto migrationStart = std::chrono::steady_clock::now();
+        for (const PendingMigration& migration : migrations) {
+            SceneArchetype& archetype = scene->m_Archetypes[migration.archetype];
+
+            std::vector<const ComponentSchema*> currentSchemas;
+            for (const uint32_t registryIndex : archetype.components) currentSchemas.push_back(&registry.getSchema(registryIndex));
+            archetype.layout = computeChunkLayoutForCapacity(currentSchemas, archetype.layout.capacity);
+            archetype.migrated = true;
+
+            const size_t firstMigratedChunk = scene->m_MigratedChunks.size();
+            for (size_t c = 0; c < archetype.chunks.size(); c++) scene->m_MigratedChunks.push_back(allocateChunk(archetype.layout.strideBytes));
+
+            JobSystem::getDefault().parallelFor(static_cast<uint32_t>(archetype.chunks.size()), 4, [&](const uint32_t begin, const uint32_t end) {
+                for (uint32_t c = begin; c < end; c++) {
+                    const std::byte* source = archetype.chunks[c].data;
+                    std::byte* destination = scene->m_MigratedChunks[firstMigratedChunk + c].get();
+                    const uint32_t entityCount = archetype.chunks[c].entityCount;
+
+                    std::memcpy(destination, source, sizeof(EntityId) * entityCount);
+                    for (size_t column = 0; column < archetype.components.size(); column++) {
+                        const FileSchema& fileSchema = fileSchemas[migration.fileSchemas[column]];
+                        const ComponentSchema& currentSchema = *currentSchemas[column];
+                        const std::byte* sourceColumn = source + migration.fileColumnOffsets[column];
+                        std::byte* destinationColumn = destination + archetype.layout.columns[column].offset;
+
+                        if (fileSchema.matches) {
+                            std::memcpy(destinationColumn, sourceColumn, static_cast<size_t>(currentSchema.size) * entityCount);
+                        } else if (const MigrationFn* custom = registry.findMigration(currentSchema.name, fileSchema.schema.hash)) {
+                            (*custom)(fileSchema.schema, sourceColumn, currentSchema, destinationColumn, entityCount);
+                        } else {
+                            ComponentRegistry::migrateByFieldName(fileSchema.schema, sourceColumn, currentSchema, destinationColumn, entityCount);
+                        }
+                    }
+                    archetype.chunks[c].data = destination;
+                }
+            });
+            scene->m_Stats.migratedChunks += static_cast<uint32_t>(archetype.chunks.size());
+        }
+        scene->m_Stats.migrationMilliseconds = millisecondsSince(migrationStart);
+
+        // layouts are final now, point every chunk at its archetype's layout
+        for (SceneArchetype& archetype : scene->m_Archetypes) {
+            for (ChunkView& chunk : archetype.chunks) chunk.layout = &archetype.layout;
+        }
+
+        SceneSerializationLogger::record().info("Loaded scene '{}': {} entities, {} chunks ({} in place, {} migrated) in {:.2f} ms.",
+                                                path.string(), scene->m_Stats.entityCount, scene->m_Stats.chunkCount,
+                                                scene->m_Stats.zeroCopyChunks, scene->m_Stats.migratedChunks,
+                                                scene->m_Stats.mapMilliseconds + scene->m_Stats.fixupMilliseconds + scene->m_Stats.migrationMilliseconds);
+        return scene;
+    }
+
+    std::span<const std::byte> SceneFile::resolveBlob(const BlobRef blob) const {
+        if (blob.offset > m_Blob.size() || m_Blob.size() - blob.offset < blob.size) return {};
+        return m_Blob.subspan(blob.offset, blob.size);
+    }
+
+    std::string_view SceneFile::resolveString(const BlobRef blob) const {
+        const std::span<const std::byte> bytes = resolveBlob(blob);
+        return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+    }
+
+}
@@ -0,0 +1,195 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+export module VKING.Scene.Serialization;
+
+export import VKING.Scene.Schema;
+
+namespace VKING::Scene {
+
+    struct AlignedChunkDeleter {
+        void operator()(std::byte* chunk) const;
+    };
+
+    using AlignedChunk = std::unique_ptr<std::byte[], AlignedChunkDeleter>;
+
+}
+
+export namespace VKING::Scene {
+
+    /// Returned by SceneWriter::addArchetype() when the archetype could not be created
+    constexpr uint32_t INVALID_ARCHETYPE = UINT32_MAX;
+
+    /// Bumped whenever the container layout (not a component schema) changes
+    constexpr uint32_t SCENE_FILE_VERSION = 1;
+
+    /**
+     * @brief Builds a scene in chunk layout and writes it to disk.
+     *
+     * Entities are appended straight into chunks laid out exactly like the loader will see them, so
+     * saving is a handful of large writes and loading needs no per-entity work at all.
+     */
+    class SceneWriter {
+    public:
+        /**
+         * @brief Fills entities [begin, end) of a chunk. Entity ids and every component column must be written.
+         */
+        using FillFn = std::function<void(const ChunkView& chunk, uint32_t begin, uint32_t end)>;
+
+        explicit SceneWriter(const ComponentRegistry& registry, uint32_t targetChunkBytes = DEFAULT_CHUNK_BYTES);
+
+        /**
+         * @brief Declares a set of components that entities can share.
+         *
+         * Column order follows the order of componentNames, which is also the component index used with ChunkView.
+         *
+         * @return The archetype index, or INVALID_ARCHETYPE if a component is unknown or listed twice
+         */
+        uint32_t addArchetype(std::span<const std::string_view> componentNames);
+
+        /**
+         * @brief Appends count entities to an archetype, allocating chunks as needed.
+         *
+         * fill is called once per touched chunk with the range of freshly appended slots.
+         */
+        void appendEntities(uint32_t archetype, uint32_t count, const FillFn& fill);
+
+        /**
+         * @brief Copies data into the blob section.
+         *
+         * @return A reference that stays valid once the scene is loaded, see SceneFile::resolveBlob()
+         */
+        BlobRef addBlob(std::span<const std::byte> data);
+        BlobRef addString(std::string_view string);
+
+        /**
+         * @return false if the file could not be written
+         */
+        [[nodiscard]] bool save(const std::filesystem::path& path) const;
+
+        [[nodiscard]] uint64_t getEntityCount() const { return m_EntityCount; }
+
+    private:
+        struct Archetype {
+            std::vector<uint32_t> schemaIndices;
+            ChunkLayout layout;
+            std::vector<AlignedChunk> chunks;
+            std::vector<uint32_t> entityCounts;
+        };
+
+        const ComponentRegistry& m_Registry;
+        uint32_t m_TargetChunkBytes;
+        std::vector<Archetype> m_Archetypes;
+        std::vector<std::byte> m_Blob;
+        uint64_t m_EntityCount = 0;
+    };
+
+    struct SceneLoadOptions {
+        /// Fault in every page up front instead of on first touch. Slower to load, no stalls afterwards
+        bool prefault = false;
+    };
+
+    /**
+     * @brief One archetype of a loaded scene.
+     */
+    struct SceneArchetype {
+        /// Registry index of each component, in column order. Components the registry does not know are dropped
+        std::vector<uint32_t> components;
+        ChunkLayout layout;
+        std::vector<ChunkView> chunks;
+        uint64_t entityCount = 0;
+        /// true if the chunks were rebuilt because at least one component schema changed
+        bool migrated = false;
+
+        /**
+         * @return The component index to use with ChunkView::getColumn(), or UINT32_MAX if the archetype lacks the component
+         */
+        [[nodiscard]] uint32_t findComponent(uint32_t registryIndex) const;
+    };
+
+    /**
+     * @brief A scene mapped into memory.
+     *
+     * Loading maps the file copy-on-write and then only resolves offsets: every chunk whose component schemas
+     * match the running build is used in place, straight from the mapping, and may be modified freely without
+     * touching the file. Only archetypes containing a component whose schema hash differs are copied into
+     * fresh chunks and converted, in parallel on the default JobSystem.
+     *
+     * The file is in native (little endian) byte order and is not meant to be shared between architectures.
+     */
+    class SceneFile {
+    public:
+        struct LoadStats {
+            uint64_t fileBytes = 0;
+            uint64_t entityCount = 0;
+            uint32_t chunkCount = 0;
+            uint32_t zeroCopyChunks = 0;
+            uint32_t migratedChunks = 0;
+            uint32_t migratedComponents = 0;
+            uint32_t droppedComponents = 0;
+            double mapMilliseconds = 0.0;
+            double fixupMilliseconds = 0.0;
+            double migrationMilliseconds = 0.0;
+        };
+
+        ~SceneFile();
+
+        SceneFile(const SceneFile&) = delete;
+        SceneFile& operator=(const SceneFile&) = delete;
+
+        /**
+         * @return The loaded scene, or nullptr if the file is missing, truncated or not a scene file
+         */
+        static std::unique_ptr<SceneFile> load(const std::filesystem::path& path, const ComponentRegistry& registry, const SceneLoadOptions& options = {});
+
+        [[nodiscard]] std::span<const SceneArchetype> getArchetypes() const { return m_Archetypes; }
+        [[nodiscard]] const LoadStats& getStats() const { return m_Stats; }
+        [[nodiscard]] uint64_t getEntityCount() const { return m_Stats.entityCount; }
+
+        /**
+         * @return The referenced bytes, or an empty span if the reference lies outside the blob section
+         */
+        [[nodiscard]] std::span<const std::byte> resolveBlob(BlobRef blob) const;
+        [[nodiscard]] std::string_view resolveString(BlobRef blob) const;
+
+    private:
+        SceneFile() = default;
+
+        std::byte* m_Mapping = nullptr;
+        uint64_t m_MappingSize = 0;
+        std::span<const std::byte> m_Blob;
+        std::vector<SceneArchetype> m_Archetypes;
+        std::vector<AlignedChunk> m_MigratedChunks;
+        LoadStats m_Stats;
+    };
+
+}
@@ -0,0 +1,91 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#   include <sys/timerfd.h>
+#   include <unistd.h>
+#endif
+
+module VKING.TickTimer;
+
+import VKING.Log;
+
+namespace VKING {
+
+    namespace {
+
+        using TickTimerLogger = Log::Named<"TickTimer">;
+
+    }
+
+    TickTimer::TickTimer(const std::chrono::nanoseconds interval)
+        : m_Interval(std::max(interval, std::chrono::nanoseconds(1))),
+          m_NextTick(std::chrono::steady_clock::now() + m_Interval) {
+#if defined(__linux__)
+        m_TimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+        if (m_TimerFd == -1) {
+            TickTimerLogger::record().warn("timerfd_create failed (errno {}), ticking on sleeps instead.", errno);
+            return;
+        }
+
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(m_Interval);
+        itimerspec specification{};
+        specification.it_interval.tv_sec = static_cast<time_t>(seconds.count());
+        specification.it_interval.tv_nsec = static_cast<long>((m_Interval - seconds).count());
+        specification.it_value = specification.it_interval;
+        if (timerfd_settime(m_TimerFd, 0, &specification, nullptr) != 0) {
+            TickTimerLogger::record().warn("timerfd_settime failed (errno {}), ticking on sleeps instead.", errno);
+            close(m_TimerFd);
+            m_TimerFd = -1;
+        }
+#endif
+    }
+
+    TickTimer::~TickTimer() {
+#if defined(__linux__)
+        if (m_TimerFd != -1) close(m_TimerFd);
+#endif
+    }
+
+    uint64_t TickTimer::wait() {
+#if defined(__linux__)
+        if (m_TimerFd != -1) {
+            // Blocks until at least one expiration, then reads how many there were since the last read
+            uint64_t expirations = 0;
+            if (read(m_TimerFd, &expirations, sizeof(expirations)) != static_cast<ssize_t>(sizeof(expirations))) return 0;
+            return expirations;
+        }
+#endif
+        std::this_thread::sleep_until(m_NextTick);
+        const auto now = std::chrono::steady_clock::now();
+        const uint64_t expirations = 1 + static_cast<uint64_t>((now - m_NextTick) / m_Interval);
+        m_NextTick += m_Interval * static_cast<int64_t>(expirations);
+        return expirations;
+    }
+
+}
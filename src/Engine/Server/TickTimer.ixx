@@ -0,0 +1,65 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <chrono>
+#include <cstdint>
+
+export module VKING.TickTimer;
+
+export namespace VKING {
+
+    /**
+     * @brief Wakes a thread at a fixed rate, for loops that tick rather than render.
+     *
+     * Backed by a timerfd on Linux, so the kernel keeps the schedule: ticks do not drift with the time the loop
+     * spends working, and ticks that were missed are counted rather than lost. Elsewhere it sleeps until the next
+     * tick on steady_clock, which keeps the same schedule at the cost of a little more wake-up jitter.
+     */
+    class TickTimer {
+    public:
+        /**
+         * @param interval Time between ticks, the first one is an interval from now
+         */
+        explicit TickTimer(std::chrono::nanoseconds interval);
+        ~TickTimer();
+
+        TickTimer(const TickTimer&) = delete;
+        TickTimer& operator=(const TickTimer&) = delete;
+
+        /**
+         * @brief Blocks until the next tick is due.
+         *
+         * @return Ticks that came due since the previous call, more than 1 if the caller fell behind. 0 if the wait
+         *         was interrupted by a signal, so a shutdown request is seen without waiting out the tick
+         */
+        uint64_t wait();
+
+        [[nodiscard]] std::chrono::nanoseconds getInterval() const { return m_Interval; }
+
+    private:
+        std::chrono::nanoseconds m_Interval;
+        /// -1 on platforms without timerfd, or if it could not be created
+        int m_TimerFd = -1;
+        std::chrono::steady_clock::time_point m_NextTick;
+    };
+
+}
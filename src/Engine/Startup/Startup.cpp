@@ -0,0 +1,327 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <VKING/Profiler.hpp>
+
+#if defined(_WIN32)
+#   include <Windows.h>
+#elif defined(__APPLE__)
+#   include <sys/sysctl.h>
+#   include <sys/time.h>
+#   include <unistd.h>
+#elif defined(__linux__)
+#   include <ctime>
+#   include <unistd.h>
+#endif
+
+module VKING.Startup;
+
+import VKING.Log;
+import VKING.JobSystem;
+
+namespace VKING::Startup {
+
+    namespace {
+
+        using StartupLogger = Log::Named<"Startup">;
+        using clock = std::chrono::steady_clock;
+
+        /// How long ago the process was created, in milliseconds. 0 where the platform cannot tell
+        double getProcessAgeMilliseconds() {
+#if defined(_WIN32)
+            FILETIME creation{}, exit{}, kernel{}, user{};
+            if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) return 0.0;
+            FILETIME now{};
+            GetSystemTimePreciseAsFileTime(&now);
+            const auto toTicks = [](const FILETIME& time) {
+                return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+            };
+            // FILETIME counts 100 ns intervals
+            return static_cast<double>(toTicks(now) - toTicks(creation)) / 10'000.0;
+#elif defined(__APPLE__)
+            int mib[4] = {CTL_KERN, KERN_PROC, KERN_PROC_PID, getpid()};
+            kinfo_proc info{};
+            size_t size = sizeof(info);
+            if (sysctl(mib, 4, &info, &size, nullptr, 0) != 0) return 0.0;
+            timeval now{};
+            gettimeofday(&now, nullptr);
+            const timeval& start = info.kp_proc.p_starttime;
+            return static_cast<double>(now.tv_sec - start.tv_sec) * 1000.0 + static_cast<double>(now.tv_usec - start.tv_usec) / 1000.0;
+#elif defined(__linux__)
+            // Field 22 of /proc/self/stat is the start time in clock ticks since boot. The command name (field 2)
+            // may contain spaces, so count from the closing parenthesis
+            std::ifstream stat("/proc/self/stat");
+            std::string line;
+            if (!std::getline(stat, line)) return 0.0;
+            const size_t nameEnd = line.rfind(')');
+            if (nameEnd == std::string::npos) return 0.0;
+            std::istringstream fields(line.substr(nameEnd + 2));
+            std::string field;
+            for (uint32_t i = 3; i <= 22 && fields >> field; i++) {}
+            if (!fields) return 0.0;
+            const long ticksPerSecond = sysconf(_SC_CLK_TCK);
+            timespec sinceBoot{};
+            if (ticksPerSecond <= 0 || clock_gettime(CLOCK_BOOTTIME, &sinceBoot) != 0) return 0.0;
+            const double startMilliseconds = static_cast<double>(std::stoull(field)) * 1000.0 / static_cast<double>(ticksPerSecond);
+            const double nowMilliseconds = static_cast<double>(sinceBoot.tv_sec) * 1000.0 + static_cast<double>(sinceBoot.tv_nsec) / 1'000'000.0;
+            return std::max(0.0, nowMilliseconds - startMilliseconds);
+#else
+            return 0.0;
+#endif
+        }
+
+        struct Timeline {
+            clock::time_point origin;
+            std::mutex mutex;
+            double mainEnteredMilliseconds = 0.0;
+            std::vector<PhaseTiming> phases;
+            std::optional<Report> report;
+            std::atomic_bool firstFrameMarked{false};
+        };
+
+        Timeline& getTimeline() {
+            static Timeline* s_Timeline = [] {
+                auto* timeline = new Timeline();
+                timeline->origin = clock::now() - std::chrono::duration_cast<clock::duration>(
+                                       std::chrono::duration<double, std::milli>(getProcessAgeMilliseconds()));
+                return timeline;
+            }();
+            return *s_Timeline;
+        }
+
+        double now() {
+            return std::chrono::duration<double, std::milli>(clock::now() - getTimeline().origin).count();
+        }
+
+        enum class TaskStatus {
+            WAITING,
+            QUEUED,
+            SUCCEEDED,
+            FAILED,
+            SKIPPED
+        };
+
+    }
+
+    double getMillisecondsSinceProcessStart() {
+        return now();
+    }
+
+    void markMainEntered() {
+        const double entered = now();
+        std::lock_guard lock(getTimeline().mutex);
+        getTimeline().mainEnteredMilliseconds = entered;
+    }
+
+    Phase::Phase(const std::string_view name)
+        : m_Name(name), m_BeginMilliseconds(now()) {}
+
+    Phase::~Phase() {
+        recordPhase({std::move(m_Name), m_BeginMilliseconds, now(), true, true});
+    }
+
+    void recordPhase(PhaseTiming timing) {
+        Timeline& timeline = getTimeline();
+        std::lock_guard lock(timeline.mutex);
+        timeline.phases.push_back(std::move(timing));
+    }
+
+    void markFirstFrame() {
+        Timeline& timeline = getTimeline();
+        if (timeline.firstFrameMarked.exchange(true, std::memory_order_acq_rel)) return;
+
+        Report report;
+        report.timeToFirstFrameMilliseconds = now();
+        {
+            std::lock_guard lock(timeline.mutex);
+            report.preMainMilliseconds = timeline.mainEnteredMilliseconds;
+            report.phases = timeline.phases;
+        }
+        std::ranges::stable_sort(report.phases, {}, &PhaseTiming::beginMilliseconds);
+
+        StartupLogger::record().info("Time to first frame: {:.1f} ms ({:.1f} ms before VKING_Main).", report.timeToFirstFrameMilliseconds,
+                                     report.preMainMilliseconds);
+        for (const PhaseTiming& phase : report.phases) {
+            StartupLogger::record().info("  {:<28} {:9.2f} -> {:9.2f} ms {:9.2f} ms {}{}", phase.name, phase.beginMilliseconds, phase.endMilliseconds,
+                                         phase.endMilliseconds - phase.beginMilliseconds, phase.mainThread ? "main" : "worker",
+                                         phase.succeeded ? "" : " FAILED");
+        }
+
+        std::lock_guard lock(timeline.mutex);
+        timeline.report = std::move(report);
+    }
+
+    std::optional<Report> getReport() {
+        Timeline& timeline = getTimeline();
+        std::lock_guard lock(timeline.mutex);
+        return timeline.report;
+    }
+
+    void InitGraph::add(Task task) {
+        m_Tasks.push_back(std::move(task));
+    }
+
+    bool InitGraph::run(JobSystem& jobs) {
+        VKING_PROFILE_SCOPE("InitGraph::run");
+        const size_t count = m_Tasks.size();
+        m_Timings.clear();
+
+        // === Resolve dependencies ===
+        std::unordered_map<std::string_view, size_t> indices;
+        for (size_t i = 0; i < count; i++) {
+            if (!indices.emplace(m_Tasks[i].name, i).second) {
+                StartupLogger::record().error("Startup task {} is defined twice.", m_Tasks[i].name);
+                return false;
+            }
+        }
+        std::vector<std::vector<size_t>> dependents(count);
+        std::vector<uint32_t> remaining(count, 0);
+        for (size_t i = 0; i < count; i++) {
+            for (const std::string& dependency : m_Tasks[i].dependencies) {
+                const auto found = indices.find(dependency);
+                if (found == indices.end()) {
+                    StartupLogger::record().error("Startup task {} depends on unknown task {}.", m_Tasks[i].name, dependency);
+                    return false;
+                }
+                dependents[found->second].push_back(i);
+                remaining[i]++;
+            }
+        }
+
+        // A graph that can be ordered has no cycles
+        {
+            std::vector<uint32_t> unresolved = remaining;
+            std::vector<size_t> ordered;
+            for (size_t i = 0; i < count; i++) {
+                if (unresolved[i] == 0) ordered.push_back(i);
+            }
+            for (size_t next = 0; next < ordered.size(); next++) {
+                for (const size_t dependent : dependents[ordered[next]]) {
+                    if (--unresolved[dependent] == 0) ordered.push_back(dependent);
+                }
+            }
+            if (ordered.size() != count) {
+                StartupLogger::record().error("Startup tasks depend on each other in a cycle, nothing was run.");
+                return false;
+            }
+        }
+
+        // === Run ===
+        // Everything below is guarded by mutex. Jobs finish under it, so none touches this frame once run() returns
+        std::mutex mutex;
+        std::condition_variable progress;
+        std::vector<TaskStatus> status(count, TaskStatus::WAITING);
+        std::deque<size_t> mainReady;
+        size_t finished = 0;
+        size_t pendingMain = static_cast<size_t>(std::ranges::count_if(m_Tasks, &Task::mainThread));
+        bool succeeded = true;
+
+        std::function<void(size_t)> execute;
+
+        auto dispatch = [&](const size_t index) {
+            status[index] = TaskStatus::QUEUED;
+            if (m_Tasks[index].mainThread) {
+                mainReady.push_back(index);
+            } else {
+                jobs.submit([&execute, index] { execute(index); });
+            }
+        };
+
+        std::function<void(size_t, const std::string&)> skip = [&](const size_t index, const std::string& cause) {
+            if (status[index] == TaskStatus::SKIPPED) return;
+            status[index] = TaskStatus::SKIPPED;
+            finished++;
+            if (m_Tasks[index].mainThread) pendingMain--;
+            StartupLogger::record().warn("Startup task {} skipped, {} did not succeed.", m_Tasks[index].name, cause);
+            for (const size_t dependent : dependents[index]) skip(dependent, cause);
+        };
+
+        execute = [&](const size_t index) {
+            const Task& task = m_Tasks[index];
+            PhaseTiming timing{task.name, now(), 0.0, task.mainThread, true};
+            {
+                VKING_PROFILE_SCOPE("InitGraph::task");
+                timing.succeeded = !task.run || task.run();
+            }
+            timing.endMilliseconds = now();
+
+            std::lock_guard lock(mutex);
+            m_Timings.push_back(timing);
+            status[index] = timing.succeeded ? TaskStatus::SUCCEEDED : TaskStatus::FAILED;
+            finished++;
+            if (task.mainThread) pendingMain--;
+            if (timing.succeeded) {
+                for (const size_t dependent : dependents[index]) {
+                    if (--remaining[dependent] == 0 && status[dependent] == TaskStatus::WAITING) dispatch(dependent);
+                }
+            } else {
+                succeeded = false;
+                StartupLogger::record().error("Startup task {} failed.", task.name);
+                for (const size_t dependent : dependents[index]) skip(dependent, task.name);
+            }
+            progress.notify_all();
+        };
+
+        std::unique_lock lock(mutex);
+        for (size_t i = 0; i < count; i++) {
+            if (remaining[i] == 0) dispatch(i);
+        }
+        while (finished < count) {
+            if (!mainReady.empty()) {
+                const size_t index = mainReady.front();
+                mainReady.pop_front();
+                lock.unlock();
+                execute(index);
+                lock.lock();
+            } else if (pendingMain == 0) {
+                // No main thread work can arrive anymore, help the workers instead
+                lock.unlock();
+                const bool ran = jobs.tryRunOne();
+                lock.lock();
+                if (!ran) progress.wait(lock, [&] { return finished == count; });
+            } else {
+                progress.wait(lock, [&] { return finished == count || !mainReady.empty(); });
+            }
+        }
+        lock.unlock();
+
+        for (const PhaseTiming& timing : m_Timings) recordPhase(timing);
+        return succeeded;
+    }
+
+}
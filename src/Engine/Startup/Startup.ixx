@@ -0,0 +1,142 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+export module VKING.Startup;
+
+import VKING.JobSystem;
+
+export namespace VKING::Startup {
+
+    /// One timed piece of startup, relative to the moment the process was created
+    struct PhaseTiming {
+        std::string name;
+        double beginMilliseconds = 0.0;
+        double endMilliseconds = 0.0;
+        bool mainThread = true;
+        bool succeeded = true;
+    };
+
+    struct Report {
+        /// Process creation to VKING_Main. Resolution is the kernel's clock tick, 0 where the platform cannot tell
+        double preMainMilliseconds = 0.0;
+        double timeToFirstFrameMilliseconds = 0.0;
+        /// In the order they began
+        std::vector<PhaseTiming> phases;
+    };
+
+    /**
+     * @return Milliseconds since the process was created, or since the first call where that is unknown
+     */
+    double getMillisecondsSinceProcessStart();
+
+    /**
+     * @brief Marks the start of VKING_Main, the end of the pre-main phase. Called by the entry point.
+     */
+    void markMainEntered();
+
+    /**
+     * @brief Times the enclosing scope as a startup phase.
+     *
+     * @code
+     * {
+     *     Startup::Phase phase("Logger");
+     *     registerLogger();
+     * }
+     * @endcode
+     */
+    class Phase {
+    public:
+        explicit Phase(std::string_view name);
+        ~Phase();
+
+        Phase(const Phase&) = delete;
+        Phase& operator=(const Phase&) = delete;
+
+    private:
+        std::string m_Name;
+        double m_BeginMilliseconds;
+    };
+
+    void recordPhase(PhaseTiming timing);
+
+    /**
+     * @brief Called by the application once its first frame completed. Logs the time to first frame and every
+     *        phase that led up to it. Only the first call in a process does anything.
+     */
+    void markFirstFrame();
+
+    /**
+     * @return The report, once markFirstFrame() was called
+     */
+    std::optional<Report> getReport();
+
+    /**
+     * @brief Startup work as a dependency graph: each task runs as soon as everything it depends on finished,
+     *        so independent tasks run concurrently on the job system.
+     *
+     * @code
+     * Startup::InitGraph graph;
+     * graph.add({"Platform", {}, [&] { return selectPlatform(); }});
+     * graph.add({"Window", {"Platform"}, [&] { return createWindow(); }, true});
+     * graph.add({"RHI", {"Platform"}, [&] { return createRHI(); }});
+     * graph.run();
+     * @endcode
+     *
+     * Main thread tasks run on the thread calling run(), which does not pick up other work until they are done,
+     * so a long worker task never delays them. Every task is recorded as a startup phase.
+     */
+    class InitGraph {
+    public:
+        struct Task {
+            std::string name;
+            std::vector<std::string> dependencies;
+            /// false fails the task, and everything depending on it is skipped
+            std::function<bool()> run;
+            /// Must run on the thread that calls run(), e.g. window creation, which most window systems require
+            bool mainThread = false;
+        };
+
+        void add(Task task);
+
+        /**
+         * @return false if a task failed or was skipped, or if a dependency is unknown or circular (then nothing runs)
+         */
+        bool run(JobSystem& jobs = JobSystem::getDefault());
+
+        /**
+         * @return Timings of the tasks that ran, after run()
+         */
+        [[nodiscard]] const std::vector<PhaseTiming>& getTimings() const { return m_Timings; }
+
+    private:
+        std::vector<Task> m_Tasks;
+        std::vector<PhaseTiming> m_Timings;
+    };
+
+}
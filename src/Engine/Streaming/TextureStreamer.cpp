@@ -0,0 +1,388 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+module VKING.Streaming.Textures;
+
+import VKING.Log;
+
+namespace VKING::Streaming {
+
+    using TextureStreamingLogger = Log::Named<"TextureStreaming">;
+
+    TextureStreamer::TextureStreamer(MipLoader& loader, const Config& config)
+        : m_Loader(loader), m_Config(config) {
+        m_Stats.memoryBudgetBytes = config.memoryBudgetBytes;
+        TextureStreamingLogger::record().debug("Texture streamer created with a {} MiB budget and {} MiB per frame.",
+                                               config.memoryBudgetBytes / (1024 * 1024),
+                                               config.maxBytesPerFrame / (1024 * 1024));
+    }
+
+    TextureStreamer::~TextureStreamer() {
+        for (TextureHandle handle = 0; handle < m_Textures.size(); handle++) {
+            if (m_Textures[handle].alive) unregisterTexture(handle);
+        }
+    }
+
+    uint64_t TextureStreamer::computeMipSize(const StreamableTextureCreateInfo& createInfo, const uint32_t mip) {
+        const uint32_t width = std::max(createInfo.width >> mip, 1u);
+        const uint32_t height = std::max(createInfo.height >> mip, 1u);
+        const uint32_t blockDimension = std::max(createInfo.blockDimension, 1u);
+        const uint64_t blocksWide = (width + blockDimension - 1) / blockDimension;
+        const uint64_t blocksHigh = (height + blockDimension - 1) / blockDimension;
+        return blocksWide * blocksHigh * createInfo.bytesPerBlock;
+    }
+
+    uint32_t TextureStreamer::computeRequiredMip(const uint32_t textureWidth, const uint32_t textureHeight,
+                                                 const uint32_t mipCount, const float screenWidthPixels,
+                                                 const float screenHeightPixels, const float mipBias) {
+        if (mipCount == 0) return 0;
+        if (screenWidthPixels <= 0.0f || screenHeightPixels <= 0.0f) return mipCount - 1;
+
+        // the ratio of texels to pixels along the most demanding axis picks the mip, exactly like the
+        // hardware LOD selection would for a surface facing the camera
+        const float texelsPerPixel = std::min(static_cast<float>(textureWidth) / screenWidthPixels,
+                                              static_cast<float>(textureHeight) / screenHeightPixels);
+        const float lod = std::log2(std::max(texelsPerPixel, 1.0f)) + mipBias;
+        const auto mip = static_cast<uint32_t>(std::max(std::floor(lod), 0.0f));
+        return std::min(mip, mipCount - 1);
+    }
+
+    TextureHandle TextureStreamer::registerTexture(const StreamableTextureCreateInfo& createInfo) {
+        if (createInfo.width == 0 || createInfo.height == 0 || createInfo.mipCount == 0 || createInfo.bytesPerBlock == 0) {
+            TextureStreamingLogger::record().error("Refusing to register texture '{}': it has no extent, mips or bytes per block.", createInfo.name);
+            return INVALID_TEXTURE_HANDLE;
+        }
+
+        TextureRecord record;
+        record.createInfo = createInfo;
+        record.mipSizes.reserve(createInfo.mipCount);
+        for (uint32_t mip = 0; mip < createInfo.mipCount; mip++) {
+            record.mipSizes.push_back(computeMipSize(createInfo, mip));
+        }
+
+        // the tail starts at the first mip that fits entirely inside tailMaxDimension
+        record.tailMip = createInfo.mipCount - 1;
+        for (uint32_t mip = 0; mip < createInfo.mipCount; mip++) {
+            if (std::max(createInfo.width >> mip, createInfo.height >> mip) <= m_Config.tailMaxDimension) {
+                record.tailMip = mip;
+                break;
+            }
+        }
+
+        record.residentMip = createInfo.mipCount;
+        record.loadingMip = createInfo.mipCount;
+        record.frameRequestedMip = record.tailMip;
+        record.requestedMip = record.tailMip;
+        record.lastSeenFrame = m_Stats.frameIndex;
+        record.alive = true;
+
+        TextureHandle handle;
+        if (!m_FreeHandles.empty()) {
+            handle = m_FreeHandles.back();
+            m_FreeHandles.pop_back();
+            m_Textures[handle] = std::move(record);
+        } else {
+            handle = static_cast<TextureHandle>(m_Textures.size());
+            m_Textures.push_back(std::move(record));
+        }
+        m_Stats.registeredTextures++;
+
+        // the tail is requested right away so there is always something to sample
+        TextureRecord& stored = m_Textures[handle];
+        if (!issueLoad(handle, stored, stored.tailMip)) {
+            TextureStreamingLogger::record().debug("Mip tail of '{}' deferred, loader is saturated.", stored.createInfo.name);
+        }
+
+        TextureStreamingLogger::record().trace("Registered texture '{}' ({}x{}, {} mips, tail starts at mip {}) as handle {}.",
+                                               stored.createInfo.name, createInfo.width, createInfo.height,
+                                               createInfo.mipCount, stored.tailMip, handle);
+        return handle;
+    }
+
+    void TextureStreamer::unregisterTexture(const TextureHandle texture) {
+        TextureRecord* record = lookup(texture);
+        if (!record) return;
+
+        const uint32_t mipCount = record->createInfo.mipCount;
+        for (uint32_t mip = record->residentMip; mip < mipCount; mip = (mip == record->tailMip) ? mipCount : mip + 1) {
+            m_Loader.releaseMip(texture, mip);
+        }
+        m_Stats.residentBytes -= residentBytesOf(*record);
+        record->residentMip = mipCount;
+        record->alive = false;
+        m_Stats.registeredTextures--;
+
+        // a load that is still in flight keeps the handle reserved, it is recycled once the loader reports back
+        if (record->loadingMip == mipCount) {
+            m_FreeHandles.push_back(texture);
+        }
+    }
+
+    void TextureStreamer::reportScreenSize(const TextureHandle texture, const float screenWidthPixels, const float screenHeightPixels) {
+        TextureRecord* record = lookup(texture);
+        if (!record) return;
+
+        const uint32_t mip = computeRequiredMip(record->createInfo.width, record->createInfo.height, record->createInfo.mipCount,
+                                                screenWidthPixels, screenHeightPixels, m_Config.mipBias);
+        record->frameRequestedMip = std::min(record->frameRequestedMip, mip);
+        record->lastSeenFrame = m_Stats.frameIndex;
+    }
+
+    void TextureStreamer::reportFeedbackMip(const TextureHandle texture, const uint32_t sampledMip) {
+        TextureRecord* record = lookup(texture);
+        if (!record) return;
+
+        record->frameRequestedMip = std::min(record->frameRequestedMip, std::min(sampledMip, record->createInfo.mipCount - 1));
+        record->lastSeenFrame = m_Stats.frameIndex;
+    }
+
+    void TextureStreamer::notifyMipLoaded(const TextureHandle texture, const uint32_t mip) {
+        std::lock_guard lock(m_CompletedMutex);
+        m_Completed.push_back({texture, mip});
+    }
+
+    void TextureStreamer::update(const float deltaSeconds) {
+        m_Stats.bytesRequestedThisFrame = 0;
+        m_Stats.bytesLoadedThisFrame = 0;
+        m_Stats.bytesEvictedThisFrame = 0;
+
+        retireCompletedLoads();
+        resolveDemand();
+        issueLoads();
+
+        // bandwidth is smoothed so a single large mip does not make the statistic useless
+        if (deltaSeconds > 0.0f) {
+            constexpr double SMOOTHING = 0.1;
+            const double instantaneous = static_cast<double>(m_Stats.bytesLoadedThisFrame) / static_cast<double>(deltaSeconds);
+            m_Stats.streamingBandwidthBytesPerSecond += (instantaneous - m_Stats.streamingBandwidthBytesPerSecond) * SMOOTHING;
+        }
+
+        m_Stats.frameIndex++;
+    }
+
+    uint32_t TextureStreamer::getResidentMip(const TextureHandle texture) const {
+        const TextureRecord* record = lookup(texture);
+        return record ? record->residentMip : 0;
+    }
+
+    uint32_t TextureStreamer::getRequestedMip(const TextureHandle texture) const {
+        const TextureRecord* record = lookup(texture);
+        return record ? record->requestedMip : 0;
+    }
+
+    void TextureStreamer::logStats() const {
+        TextureStreamingLogger::record().debug(
+            "Frame {}: {} textures, {:.1f}/{:.1f} MiB resident, {:.1f} MiB in flight, {:.2f} MiB/s streamed, "
+            "{} at requested mip, {} pending, {:.1f} MiB evicted this frame.",
+            m_Stats.frameIndex, m_Stats.registeredTextures,
+            static_cast<double>(m_Stats.residentBytes) / (1024.0 * 1024.0),
+            static_cast<double>(m_Stats.memoryBudgetBytes) / (1024.0 * 1024.0),
+            static_cast<double>(m_Stats.inFlightBytes) / (1024.0 * 1024.0),
+            m_Stats.streamingBandwidthBytesPerSecond / (1024.0 * 1024.0),
+            m_Stats.texturesAtRequestedMip, m_Stats.pendingTextures,
+            static_cast<double>(m_Stats.bytesEvictedThisFrame) / (1024.0 * 1024.0));
+    }
+
+    TextureStreamer::TextureRecord* TextureStreamer::lookup(const TextureHandle texture) {
+        if (texture >= m_Textures.size() || !m_Textures[texture].alive) return nullptr;
+        return &m_Textures[texture];
+    }
+
+    const TextureStreamer::TextureRecord* TextureStreamer::lookup(const TextureHandle texture) const {
+        if (texture >= m_Textures.size() || !m_Textures[texture].alive) return nullptr;
+        return &m_Textures[texture];
+    }
+
+    uint64_t TextureStreamer::residentBytesOf(const TextureRecord& record) const {
+        uint64_t bytes = 0;
+        for (uint32_t mip = record.residentMip; mip < record.createInfo.mipCount; mip++) {
+            bytes += record.mipSizes[mip];
+        }
+        return bytes;
+    }
+
+    uint64_t TextureStreamer::requestBytesOf(const TextureRecord& record, const uint32_t mip) {
+        if (mip != record.tailMip) return record.mipSizes[mip];
+
+        // the tail request covers every mip from tailMip to the end of the chain
+        uint64_t bytes = 0;
+        for (uint32_t tail = mip; tail < record.createInfo.mipCount; tail++) bytes += record.mipSizes[tail];
+        return bytes;
+    }
+
+    void TextureStreamer::retireCompletedLoads() {
+        {
+            std::lock_guard lock(m_CompletedMutex);
+            m_CompletedScratch.swap(m_Completed);
+        }
+
+        for (const auto& [texture, mip] : m_CompletedScratch) {
+            if (texture >= m_Textures.size()) continue;
+            TextureRecord& record = m_Textures[texture];
+            const uint32_t mipCount = record.createInfo.mipCount;
+            if (record.loadingMip != mip) {
+                TextureStreamingLogger::record().warn("Loader reported mip {} of handle {} which was not requested. Ignoring.", mip, texture);
+                continue;
+            }
+
+            const uint64_t loadedBytes = requestBytesOf(record, mip);
+            m_Stats.inFlightBytes -= loadedBytes;
+            record.loadingMip = mipCount;
+
+            if (!record.alive) {
+                // unregistered while loading, drop it and finally recycle the handle
+                m_Loader.releaseMip(texture, mip);
+                m_FreeHandles.push_back(texture);
+                continue;
+            }
+
+            record.residentMip = mip;
+            m_Stats.residentBytes += loadedBytes;
+            m_Stats.bytesLoadedThisFrame += loadedBytes;
+            m_Stats.bytesLoadedTotal += loadedBytes;
+        }
+        m_CompletedScratch.clear();
+    }
+
+    void TextureStreamer::resolveDemand() {
+        const uint64_t frame = m_Stats.frameIndex;
+        for (auto& record : m_Textures) {
+            if (!record.alive) continue;
+
+            if (record.lastSeenFrame == frame) {
+                record.requestedMip = record.frameRequestedMip;
+            } else if (frame - record.lastSeenFrame > m_Config.unseenFramesBeforeDecay) {
+                // not visible for a while, it only needs its tail. The memory is reclaimed lazily by eviction
+                record.requestedMip = record.tailMip;
+            }
+            record.frameRequestedMip = record.tailMip;
+        }
+    }
+
+    void TextureStreamer::evictToBudget(const uint64_t bytesNeeded, const TextureHandle protectedTexture) {
+        // victims are ranked by how useless their finest mip is: first anything finer than what was
+        // requested, then the textures that have gone unseen the longest. Textures seen this frame keep
+        // what they asked for, otherwise two textures could evict each other every frame. The texture the
+        // space is made for is never a victim, its next mip is only contiguous with what is resident now.
+        while (m_Stats.residentBytes + m_Stats.inFlightBytes + bytesNeeded > m_Config.memoryBudgetBytes) {
+            TextureHandle victim = INVALID_TEXTURE_HANDLE;
+            int64_t victimSurplus = 0;
+            uint64_t victimLastSeen = 0;
+
+            for (TextureHandle handle = 0; handle < m_Textures.size(); handle++) {
+                const TextureRecord& record = m_Textures[handle];
+                if (handle == protectedTexture || !record.alive || record.residentMip >= record.tailMip) continue;
+                if (record.loadingMip != record.createInfo.mipCount) continue;
+
+                const int64_t surplus = static_cast<int64_t>(record.requestedMip) - static_cast<int64_t>(record.residentMip);
+                if (surplus <= 0 && record.lastSeenFrame == m_Stats.frameIndex) continue;
+
+                const bool better = victim == INVALID_TEXTURE_HANDLE ||
+                                    surplus > victimSurplus ||
+                                    (surplus == victimSurplus && record.lastSeenFrame < victimLastSeen);
+                if (better) {
+                    victim = handle;
+                    victimSurplus = surplus;
+                    victimLastSeen = record.lastSeenFrame;
+                }
+            }
+
+            if (victim == INVALID_TEXTURE_HANDLE) return;
+
+            TextureRecord& record = m_Textures[victim];
+            const uint64_t freed = record.mipSizes[record.residentMip];
+            m_Loader.releaseMip(victim, record.residentMip);
+            record.residentMip++;
+            m_Stats.residentBytes -= freed;
+            m_Stats.bytesEvictedThisFrame += freed;
+            m_Stats.bytesEvictedTotal += freed;
+        }
+    }
+
+    void TextureStreamer::issueLoads() {
+        struct Candidate {
+            TextureHandle texture;
+            uint32_t mip;
+            uint32_t deficit;
+            uint64_t size;
+        };
+
+        std::vector<Candidate> candidates;
+        m_Stats.texturesAtRequestedMip = 0;
+
+        for (TextureHandle handle = 0; handle < m_Textures.size(); handle++) {
+            const TextureRecord& record = m_Textures[handle];
+            if (!record.alive) continue;
+            const uint32_t mipCount = record.createInfo.mipCount;
+
+            if (record.residentMip <= record.requestedMip) {
+                m_Stats.texturesAtRequestedMip++;
+                continue;
+            }
+            if (record.loadingMip != mipCount) continue;
+
+            // a texture without its tail gets the tail first, otherwise the next finer mip
+            const uint32_t mip = record.residentMip == mipCount ? record.tailMip : record.residentMip - 1;
+            const uint32_t deficit = record.residentMip == mipCount ? UINT32_MAX : record.residentMip - record.requestedMip;
+            candidates.push_back({handle, mip, deficit, requestBytesOf(record, mip)});
+        }
+
+        // most missing detail first, cheapest first on ties so more textures improve per frame
+        std::ranges::sort(candidates, [](const Candidate& a, const Candidate& b) {
+            if (a.deficit != b.deficit) return a.deficit > b.deficit;
+            return a.size < b.size;
+        });
+
+        uint32_t issued = 0;
+        for (const auto& candidate : candidates) {
+            if (m_Stats.bytesRequestedThisFrame + candidate.size > m_Config.maxBytesPerFrame && m_Stats.bytesRequestedThisFrame != 0) break;
+            if (m_Stats.inFlightBytes + candidate.size > m_Config.maxBytesInFlight && m_Stats.inFlightBytes != 0) break;
+
+            evictToBudget(candidate.size, candidate.texture);
+            if (m_Stats.residentBytes + m_Stats.inFlightBytes + candidate.size > m_Config.memoryBudgetBytes) {
+                // nothing left that is less useful than this request, stop instead of thrashing
+                break;
+            }
+
+            if (issueLoad(candidate.texture, m_Textures[candidate.texture], candidate.mip)) issued++;
+        }
+
+        m_Stats.pendingTextures = static_cast<uint32_t>(candidates.size()) - issued;
+    }
+
+    bool TextureStreamer::issueLoad(const TextureHandle texture, TextureRecord& record, const uint32_t mip) {
+        const uint64_t bytes = requestBytesOf(record, mip);
+        if (!m_Loader.requestMip(texture, mip, bytes)) return false;
+
+        record.loadingMip = mip;
+        m_Stats.inFlightBytes += bytes;
+        m_Stats.bytesRequestedThisFrame += bytes;
+        return true;
+    }
+
+}
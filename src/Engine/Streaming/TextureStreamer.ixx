@@ -0,0 +1,254 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+export module VKING.Streaming.Textures;
+
+export namespace VKING::Streaming {
+
+    /**
+     * @brief Opaque handle to a texture registered with the TextureStreamer.
+     */
+    using TextureHandle = uint32_t;
+
+    /// Returned by registerTexture() when the texture could not be registered
+    constexpr TextureHandle INVALID_TEXTURE_HANDLE = UINT32_MAX;
+
+    /**
+     * @brief Describes the shape of a streamable texture so mip sizes can be derived.
+     *
+     * Uncompressed formats use a block dimension of 1 (bytesPerBlock is then bytes per pixel),
+     * block compressed formats (BC1-7) use a block dimension of 4.
+     */
+    struct StreamableTextureCreateInfo {
+        std::string name;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t mipCount = 1;
+        uint32_t blockDimension = 1;
+        uint32_t bytesPerBlock = 4;
+    };
+
+    /**
+     * @brief Backend hook that actually moves mip data between storage and VRAM.
+     *
+     * The streamer only decides *what* should be resident. The loader is expected to kick off the
+     * I/O and upload asynchronously and call TextureStreamer::notifyMipLoaded() from any thread once
+     * the mip is usable by the GPU.
+     */
+    class MipLoader {
+    public:
+        virtual ~MipLoader() = default;
+
+        /**
+         * @brief Begins streaming in a single mip level.
+         *
+         * @note A request for the texture's tail mip covers the whole packed tail (that mip and every coarser one),
+         *       sizeBytes already accounts for it. The tail is released the same way.
+         *
+         * @return false if the request could not be queued right now. The streamer will retry next frame.
+         */
+        virtual bool requestMip(TextureHandle texture, uint32_t mip, uint64_t sizeBytes) = 0;
+
+        /**
+         * @brief Releases the memory held by a single resident mip level.
+         */
+        virtual void releaseMip(TextureHandle texture, uint32_t mip) = 0;
+    };
+
+    /**
+     * @brief Streams texture mips in and out of a fixed memory budget based on per-frame demand.
+     *
+     * Only the mip tail (every mip whose largest dimension is at or below Config::tailMaxDimension) is
+     * requested when a texture is registered. Each frame, callers report how large each texture appears
+     * on screen (or report the mip sampled by the GPU directly via feedback) and update() then:
+     *  - retires completed loads,
+     *  - ranks every texture that is blurrier than it should be by how much detail it is missing,
+     *  - streams the next finer mip of the best candidates within the per-frame bandwidth budget,
+     *  - evicts the least useful mips (finer than needed, then least recently seen) if over budget.
+     *
+     * Residency is kept contiguous: a texture with mip N resident also has every coarser mip resident,
+     * so a single index per texture is enough to describe what the sampler may use (the min LOD clamp).
+     *
+     * All member functions other than notifyMipLoaded() are expected to be called from the thread that
+     * owns the frame loop.
+     */
+    class TextureStreamer {
+    public:
+        struct Config {
+            /// Total bytes the streamer may keep resident, mip tails included
+            uint64_t memoryBudgetBytes = 512ull * 1024 * 1024;
+            /// Maximum bytes requested from the loader per update() (bandwidth cap)
+            uint64_t maxBytesPerFrame = 16ull * 1024 * 1024;
+            /// Maximum bytes that may be outstanding at the loader at any time
+            uint64_t maxBytesInFlight = 64ull * 1024 * 1024;
+            /// Mips whose largest dimension is at or below this are the always-resident tail
+            uint32_t tailMaxDimension = 64;
+            /// Frames a texture may go unseen before its demand decays to the tail
+            uint32_t unseenFramesBeforeDecay = 60;
+            /// Added to every computed mip. Positive values trade sharpness for memory
+            float mipBias = 0.0f;
+        };
+
+        struct Stats {
+            uint64_t residentBytes = 0;
+            uint64_t memoryBudgetBytes = 0;
+            uint64_t inFlightBytes = 0;
+            uint64_t bytesRequestedThisFrame = 0;
+            uint64_t bytesLoadedThisFrame = 0;
+            uint64_t bytesEvictedThisFrame = 0;
+            uint64_t bytesLoadedTotal = 0;
+            uint64_t bytesEvictedTotal = 0;
+            /// Exponential moving average of completed loads, in bytes per second
+            double streamingBandwidthBytesPerSecond = 0.0;
+            uint32_t registeredTextures = 0;
+            /// Textures whose resident mip is at least as detailed as what was requested
+            uint32_t texturesAtRequestedMip = 0;
+            /// Textures that are waiting for more detail but did not fit this frame
+            uint32_t pendingTextures = 0;
+            uint64_t frameIndex = 0;
+        };
+
+        TextureStreamer(MipLoader& loader, const Config& config);
+        ~TextureStreamer();
+
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+        /**
+         * @brief Registers a texture and immediately requests its mip tail.
+         *
+         * @return A handle for future calls, or INVALID_TEXTURE_HANDLE if the create info is malformed
+         */
+        TextureHandle registerTexture(const StreamableTextureCreateInfo& createInfo);
+
+        /**
+         * @brief Releases every resident mip of a texture and forgets about it.
+         */
+        void unregisterTexture(TextureHandle texture);
+
+        /**
+         * @brief Reports how many pixels the texture covers on screen this frame.
+         *
+         * The required mip is the one whose texel density best matches the screen-space footprint.
+         * Multiple reports per frame keep the most detailed requirement.
+         */
+        void reportScreenSize(TextureHandle texture, float screenWidthPixels, float screenHeightPixels);
+
+        /**
+         * @brief Reports the finest mip the GPU actually sampled (sampler feedback or a feedback buffer).
+         */
+        void reportFeedbackMip(TextureHandle texture, uint32_t sampledMip);
+
+        /**
+         * @brief Called by the MipLoader, from any thread, once a requested mip is resident.
+         */
+        void notifyMipLoaded(TextureHandle texture, uint32_t mip);
+
+        /**
+         * @brief Runs one streaming step. Call once per frame after reporting demand.
+         *
+         * @param deltaSeconds Time since the previous update, used for the bandwidth statistic.
+         */
+        void update(float deltaSeconds);
+
+        /**
+         * @brief Finest mip the sampler may use for this texture (use as the min LOD clamp).
+         */
+        [[nodiscard]] uint32_t getResidentMip(TextureHandle texture) const;
+
+        /**
+         * @brief Finest mip requested for this texture during the last completed frame.
+         */
+        [[nodiscard]] uint32_t getRequestedMip(TextureHandle texture) const;
+
+        [[nodiscard]] const Stats& getStats() const { return m_Stats; }
+
+        /**
+         * @brief Writes the current statistics to the streaming logger at debug level.
+         */
+        void logStats() const;
+
+        /**
+         * @brief Computes the mip whose resolution matches a screen-space footprint.
+         *
+         * @return The mip index, clamped to [0, mipCount - 1]
+         */
+        static uint32_t computeRequiredMip(uint32_t textureWidth, uint32_t textureHeight, uint32_t mipCount,
+                                           float screenWidthPixels, float screenHeightPixels, float mipBias = 0.0f);
+
+        /**
+         * @brief Computes the size of a single mip level in bytes.
+         */
+        static uint64_t computeMipSize(const StreamableTextureCreateInfo& createInfo, uint32_t mip);
+
+    private:
+        struct TextureRecord {
+            StreamableTextureCreateInfo createInfo;
+            std::vector<uint64_t> mipSizes;
+            /// Finest mip of the always-resident tail
+            uint32_t tailMip = 0;
+            /// Finest resident mip, mipCount when nothing is resident yet
+            uint32_t residentMip = 0;
+            /// Mip currently at the loader, mipCount if none
+            uint32_t loadingMip = 0;
+            /// Finest mip requested during the frame in progress
+            uint32_t frameRequestedMip = 0;
+            /// Finest mip requested during the last completed frame
+            uint32_t requestedMip = 0;
+            uint64_t lastSeenFrame = 0;
+            bool alive = false;
+        };
+
+        struct CompletedLoad {
+            TextureHandle texture;
+            uint32_t mip;
+        };
+
+        [[nodiscard]] TextureRecord* lookup(TextureHandle texture);
+        [[nodiscard]] const TextureRecord* lookup(TextureHandle texture) const;
+        [[nodiscard]] uint64_t residentBytesOf(const TextureRecord& record) const;
+        [[nodiscard]] static uint64_t requestBytesOf(const TextureRecord& record, uint32_t mip);
+
+        void retireCompletedLoads();
+        void resolveDemand();
+        void evictToBudget(uint64_t bytesNeeded, TextureHandle protectedTexture);
+        void issueLoads();
+        bool issueLoad(TextureHandle texture, TextureRecord& record, uint32_t mip);
+
+        MipLoader& m_Loader;
+        Config m_Config;
+        Stats m_Stats{};
+
+        std::vector<TextureRecord> m_Textures;
+        std::vector<TextureHandle> m_FreeHandles;
+
+        std::mutex m_CompletedMutex;
+        std::vector<CompletedLoad> m_Completed;
+        std::vector<CompletedLoad> m_CompletedScratch;
+    };
+
+}
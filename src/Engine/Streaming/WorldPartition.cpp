@@ -0,0 +1,378 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+module VKING.Streaming.World;
+
+import VKING.Log;
+
+namespace VKING::Streaming {
+
+    using WorldStreamingLogger = Log::Named<"WorldStreaming">;
+
+    namespace {
+
+        /// Frames before the first retry of a cell that failed to load, doubled after every further failure
+        constexpr uint64_t RETRY_BASE_FRAMES = 30;
+        /// Upper bound of the backoff, a file that appears later is still picked up within a few seconds
+        constexpr uint64_t RETRY_MAX_FRAMES = 600;
+
+    }
+
+    WorldPartition::WorldPartition(const Scene::ComponentRegistry& registry, CellIntegrator& integrator, const Config& config, JobSystem& jobSystem)
+        : m_Registry(registry), m_Integrator(integrator), m_Config(config), m_JobSystem(jobSystem),
+          m_LoadResults(std::make_shared<LoadResults>()) {
+        if (m_Config.unloadRadius < m_Config.loadRadius) {
+            WorldStreamingLogger::record().warn("Unload radius {} is smaller than the load radius {}, clamping it (no hysteresis).",
+                                                m_Config.unloadRadius, m_Config.loadRadius);
+            m_Config.unloadRadius = m_Config.loadRadius;
+        }
+        m_Config.cellSize = std::max(m_Config.cellSize, 1.0f);
+        m_Config.maxConcurrentLoads = std::max(m_Config.maxConcurrentLoads, 1u);
+
+        WorldStreamingLogger::record().debug("World partition created: {} unit cells, load radius {}, unload radius {}, {} ms integration budget.",
+                                             m_Config.cellSize, m_Config.loadRadius, m_Config.unloadRadius, m_Config.integrationBudgetMilliseconds);
+    }
+
+    WorldPartition::~WorldPartition() {
+        for (auto& [key, cell] : m_Cells) unloadCell(cell);
+
+        // load jobs reference the registry, which is only guaranteed to live as long as we do
+        while (m_LoadResults->inFlight.load(std::memory_order_acquire) > 0) {
+            if (!m_JobSystem.tryRunOne()) std::this_thread::yield();
+        }
+    }
+
+    uint64_t WorldPartition::makeKey(const CellCoord cell) {
+        return static_cast<uint64_t>(static_cast<uint32_t>(cell.x)) << 32 | static_cast<uint32_t>(cell.z);
+    }
+
+    std::string WorldPartition::getCellFileName(const CellCoord cell) {
+        return "Cell_" + std::to_string(cell.x) + "_" + std::to_string(cell.z) + ".vkscene";
+    }
+
+    void WorldPartition::registerCell(const CellCoord cell, const std::filesystem::path& path) {
+        auto [iterator, inserted] = m_Cells.try_emplace(makeKey(cell));
+        if (!inserted) {
+            WorldStreamingLogger::record().warn("Cell ({}, {}) registered twice, keeping '{}'.", cell.x, cell.z, iterator->second.path.string());
+            return;
+        }
+        iterator->second.coord = cell;
+        iterator->second.path = path;
+        m_Stats.registeredCells++;
+    }
+
+    uint32_t WorldPartition::registerCellsInDirectory(const std::filesystem::path& directory) {
+        std::error_code error;
+        uint32_t registered = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+            if (!entry.is_regular_file()) continue;
+
+            CellCoord cell;
+            int consumed = 0;
+            const std::string fileName = entry.path().filename().string();
+            if (std::sscanf(fileName.c_str(), "Cell_%d_%d.vkscene%n", &cell.x, &cell.z, &consumed) == 2
+                && static_cast<size_t>(consumed) == fileName.size()) {
+                registerCell(cell, entry.path());
+                registered++;
+            }
+        }
+
+        if (error) WorldStreamingLogger::record().error("Could not list cells in '{}': {}", directory.string(), error.message());
+        else WorldStreamingLogger::record().info("Registered {} cells from '{}'.", registered, directory.string());
+        return registered;
+    }
+
+    StreamingSourceHandle WorldPartition::addSource(const float priorityScale) {
+        Source source;
+        source.priorityScale = std::max(priorityScale, 0.001f);
+        source.alive = true;
+
+        for (StreamingSourceHandle handle = 0; handle < m_Sources.size(); handle++) {
+            if (!m_Sources[handle].alive) {
+                m_Sources[handle] = source;
+                return handle;
+            }
+        }
+        m_Sources.push_back(source);
+        return static_cast<StreamingSourceHandle>(m_Sources.size() - 1);
+    }
+
+    void WorldPartition::removeSource(const StreamingSourceHandle source) {
+        if (source < m_Sources.size()) m_Sources[source].alive = false;
+    }
+
+    void WorldPartition::updateSource(const StreamingSourceHandle source, const float x, const float z, const float velocityX, const float velocityZ) {
+        if (source >= m_Sources.size() || !m_Sources[source].alive) {
+            WorldStreamingLogger::record().warn("Ignoring update of unknown streaming source {}.", source);
+            return;
+        }
+        Source& target = m_Sources[source];
+        target.x = x;
+        target.z = z;
+        target.velocityX = velocityX;
+        target.velocityZ = velocityZ;
+    }
+
+    CellCoord WorldPartition::getCellAt(const float x, const float z) const {
+        return {static_cast<int32_t>(std::floor(x / m_Config.cellSize)), static_cast<int32_t>(std::floor(z / m_Config.cellSize))};
+    }
+
+    bool WorldPartition::isCellActive(const CellCoord cell) const {
+        const auto found = m_Cells.find(makeKey(cell));
+        return found != m_Cells.end() && found->second.state == CellState::ACTIVE;
+    }
+
+    WorldPartition::CellDistance WorldPartition::computeDistance(const CellCoord cell) const {
+        const float minX = static_cast<float>(cell.x) * m_Config.cellSize;
+        const float minZ = static_cast<float>(cell.z) * m_Config.cellSize;
+
+        // distance from a point to the cell's square, 0 inside
+        auto distanceTo = [&](const float x, const float z) {
+            const float dx = std::max({minX - x, 0.0f, x - (minX + m_Config.cellSize)});
+            const float dz = std::max({minZ - z, 0.0f, z - (minZ + m_Config.cellSize)});
+            return std::sqrt(dx * dx + dz * dz);
+        };
+
+        CellDistance result{std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+        for (const Source& source : m_Sources) {
+            if (!source.alive) continue;
+            const float current = distanceTo(source.x, source.z);
+            const float predicted = distanceTo(source.x + source.velocityX * m_Config.velocityLookaheadSeconds,
+                                               source.z + source.velocityZ * m_Config.velocityLookaheadSeconds);
+            const float nearest = std::min(current, predicted);
+            result.nearest = std::min(result.nearest, nearest);
+            result.priority = std::min(result.priority, nearest / source.priorityScale);
+        }
+        return result;
+    }
+
+    void WorldPartition::update() {
+        m_Stats.frameIndex++;
+        m_Stats.chunksIntegratedThisFrame = 0;
+        m_Stats.cellsUnloadedThisFrame = 0;
+        m_Stats.integrationMillisecondsThisFrame = 0.0;
+
+        retireLoads();
+        updatePriorities();
+        startLoads();
+        integrate();
+
+        m_Stats.queuedCells = m_Stats.loadingCells = m_Stats.pendingIntegrationCells = m_Stats.activeCells = 0;
+        for (const auto& [key, cell] : m_Cells) {
+            switch (cell.state) {
+                case CellState::QUEUED:      m_Stats.queuedCells++; break;
+                case CellState::LOADING:     m_Stats.loadingCells++; break;
+                case CellState::INTEGRATING: m_Stats.pendingIntegrationCells++; break;
+                case CellState::ACTIVE:      m_Stats.activeCells++; break;
+                default: break;
+            }
+        }
+    }
+
+    void WorldPartition::retireLoads() {
+        std::vector<LoadResults::Result> completed;
+        {
+            std::lock_guard lock(m_LoadResults->mutex);
+            completed.swap(m_LoadResults->completed);
+        }
+
+        for (LoadResults::Result& result : completed) {
+            const auto found = m_Cells.find(result.key);
+            // results of abandoned loads are simply dropped, which unmaps the file
+            if (found == m_Cells.end() || found->second.generation != result.generation || found->second.state != CellState::LOADING) continue;
+
+            Cell& cell = found->second;
+            if (!result.scene) {
+                const uint64_t backoff = std::min(RETRY_BASE_FRAMES << std::min(cell.failedLoads, 5u), RETRY_MAX_FRAMES);
+                cell.failedLoads++;
+                cell.retryFrame = m_Stats.frameIndex + backoff;
+                cell.state = CellState::UNLOADED;
+                WorldStreamingLogger::record().error("Cell ({}, {}) failed to load from '{}' ({} attempts), retrying in {} frames.",
+                                                     cell.coord.x, cell.coord.z, cell.path.string(), cell.failedLoads, backoff);
+                continue;
+            }
+
+            m_Stats.bytesLoadedTotal += result.scene->getStats().fileBytes;
+            cell.failedLoads = 0;
+            cell.scene = std::move(result.scene);
+            cell.state = CellState::INTEGRATING;
+            cell.archetypeCursor = 0;
+            cell.chunkCursor = 0;
+        }
+    }
+
+    void WorldPartition::updatePriorities() {
+        // resident cells: refresh their rank and drop the ones beyond the unload radius
+        for (auto& [key, cell] : m_Cells) {
+            if (cell.state == CellState::UNLOADED) continue;
+            const CellDistance distance = computeDistance(cell.coord);
+            cell.priority = distance.priority;
+            if (distance.nearest > m_Config.unloadRadius) {
+                if (cell.state != CellState::QUEUED) m_Stats.cellsUnloadedThisFrame++;
+                unloadCell(cell);
+            }
+        }
+
+        // only cells around sources can newly enter the load radius, no need to visit the whole world. The radius is
+        // measured from the predicted position too, so the cells around it are visited as well
+        const auto reach = static_cast<int32_t>(std::ceil(m_Config.loadRadius / m_Config.cellSize));
+        for (const Source& source : m_Sources) {
+            if (!source.alive) continue;
+            const CellCoord centers[] = {
+                getCellAt(source.x, source.z),
+                getCellAt(source.x + source.velocityX * m_Config.velocityLookaheadSeconds,
+                          source.z + source.velocityZ * m_Config.velocityLookaheadSeconds),
+            };
+            for (const CellCoord& center : centers) {
+                for (int32_t z = center.z - reach; z <= center.z + reach; z++) {
+                    for (int32_t x = center.x - reach; x <= center.x + reach; x++) {
+                        // cells already queued by the other center are no longer UNLOADED and are skipped
+                        const auto found = m_Cells.find(makeKey({x, z}));
+                        if (found == m_Cells.end() || found->second.state != CellState::UNLOADED || m_Stats.frameIndex < found->second.retryFrame) continue;
+
+                        const CellDistance distance = computeDistance(found->second.coord);
+                        if (distance.nearest <= m_Config.loadRadius) {
+                            found->second.state = CellState::QUEUED;
+                            found->second.priority = distance.priority;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void WorldPartition::startLoads() {
+        const uint32_t inFlight = m_LoadResults->inFlight.load(std::memory_order_acquire);
+        if (inFlight >= m_Config.maxConcurrentLoads) return;
+
+        std::vector<Cell*> queued;
+        for (auto& [key, cell] : m_Cells) {
+            if (cell.state == CellState::QUEUED) queued.push_back(&cell);
+        }
+
+        const size_t slots = std::min<size_t>(m_Config.maxConcurrentLoads - inFlight, queued.size());
+        std::partial_sort(queued.begin(), queued.begin() + static_cast<std::ptrdiff_t>(slots), queued.end(),
+                          [](const Cell* a, const Cell* b) { return a->priority < b->priority; });
+
+        for (size_t i = 0; i < slots; i++) {
+            Cell& cell = *queued[i];
+            cell.state = CellState::LOADING;
+            cell.generation++;
+            m_LoadResults->inFlight.fetch_add(1, std::memory_order_acq_rel);
+
+            WorldStreamingLogger::record().trace("Loading cell ({}, {}) from '{}'.", cell.coord.x, cell.coord.z, cell.path.string());
+            m_JobSystem.submit([results = m_LoadResults, &registry = m_Registry, key = makeKey(cell.coord), generation = cell.generation, path = cell.path] {
+                // prefault so the main thread never takes page faults while integrating
+                auto scene = Scene::SceneFile::load(path, registry, {.prefault = true});
+                {
+                    std::lock_guard lock(results->mutex);
+                    results->completed.push_back({key, generation, std::move(scene)});
+                }
+                results->inFlight.fetch_sub(1, std::memory_order_acq_rel);
+            });
+        }
+    }
+
+    void WorldPartition::integrate() {
+        std::vector<Cell*> pending;
+        for (auto& [key, cell] : m_Cells) {
+            if (cell.state == CellState::INTEGRATING) pending.push_back(&cell);
+        }
+        if (pending.empty()) return;
+        std::ranges::sort(pending, [](const Cell* a, const Cell* b) { return a->priority < b->priority; });
+
+        using clock = std::chrono::steady_clock;
+        const auto start = clock::now();
+        const auto deadline = start + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double, std::milli>(m_Config.integrationBudgetMilliseconds));
+
+        // at least one chunk per frame, otherwise a tiny budget would stall streaming forever
+        bool budgetExhausted = false;
+        for (Cell* cell : pending) {
+            const auto archetypes = cell->scene->getArchetypes();
+            while (cell->archetypeCursor < archetypes.size()) {
+                const Scene::SceneArchetype& archetype = archetypes[cell->archetypeCursor];
+                if (cell->chunkCursor >= archetype.chunks.size()) {
+                    cell->archetypeCursor++;
+                    cell->chunkCursor = 0;
+                    continue;
+                }
+
+                if (m_Stats.chunksIntegratedThisFrame > 0 && clock::now() >= deadline) {
+                    budgetExhausted = true;
+                    break;
+                }
+
+                m_Integrator.integrateChunk(cell->coord, *cell->scene, archetype, archetype.chunks[cell->chunkCursor]);
+                cell->integratedAnything = true;
+                cell->chunkCursor++;
+                m_Stats.chunksIntegratedThisFrame++;
+            }
+
+            if (budgetExhausted) break;
+
+            cell->state = CellState::ACTIVE;
+            m_Integrator.cellActivated(cell->coord);
+            WorldStreamingLogger::record().trace("Cell ({}, {}) active.", cell->coord.x, cell->coord.z);
+        }
+
+        m_Stats.integrationMillisecondsThisFrame = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+        if (m_Stats.integrationMillisecondsThisFrame > m_Config.integrationBudgetMilliseconds) m_Stats.budgetOverruns++;
+    }
+
+    void WorldPartition::unloadCell(Cell& cell) {
+        if (cell.integratedAnything) m_Integrator.releaseCell(cell.coord);
+
+        // a load still in flight finishes in the background and is discarded by retireLoads()
+        if (cell.state == CellState::LOADING) cell.generation++;
+
+        cell.scene.reset();
+        cell.state = CellState::UNLOADED;
+        cell.archetypeCursor = 0;
+        cell.chunkCursor = 0;
+        cell.integratedAnything = false;
+    }
+
+    void WorldPartition::logStats() const {
+        WorldStreamingLogger::record().info("Frame {}: {} active, {} integrating, {} loading, {} queued of {} cells. "
+                                            "{} chunks integrated in {:.3f} ms, {} unloaded, {} budget overruns, {} MiB streamed in total.",
+                                            m_Stats.frameIndex, m_Stats.activeCells, m_Stats.pendingIntegrationCells, m_Stats.loadingCells,
+                                            m_Stats.queuedCells, m_Stats.registeredCells, m_Stats.chunksIntegratedThisFrame,
+                                            m_Stats.integrationMillisecondsThisFrame, m_Stats.cellsUnloadedThisFrame, m_Stats.budgetOverruns,
+                                            m_Stats.bytesLoadedTotal / (1024 * 1024));
+    }
+
+}
@@ -0,0 +1,247 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+export module VKING.Streaming.World;
+
+import VKING.JobSystem;
+import VKING.Scene.Serialization;
+
+export namespace VKING::Streaming {
+
+    /**
+     * @brief Integer coordinate of a cell on the world's XZ grid.
+     */
+    struct CellCoord {
+        int32_t x = 0;
+        int32_t z = 0;
+
+        bool operator==(const CellCoord&) const = default;
+    };
+
+    /// Opaque handle to a streaming source registered with the WorldPartition
+    using StreamingSourceHandle = uint32_t;
+
+    /// Returned by addSource() when no more sources can be registered
+    constexpr StreamingSourceHandle INVALID_STREAMING_SOURCE = UINT32_MAX;
+
+    /**
+     * @brief Receives the contents of streamed cells.
+     *
+     * The partition hands loaded cells over one chunk at a time from update(), never more than the integration
+     * budget allows per frame, so a large cell is spread over several frames instead of causing a hitch.
+     * The chunks stay valid until releaseCell() is called for the cell.
+     */
+    class CellIntegrator {
+    public:
+        virtual ~CellIntegrator() = default;
+
+        /**
+         * @brief Adds one chunk of a streamed cell to the world.
+         */
+        virtual void integrateChunk(CellCoord cell, const Scene::SceneFile& scene, const Scene::SceneArchetype& archetype, const Scene::ChunkView& chunk) = 0;
+
+        /**
+         * @brief Called once every chunk of a cell has been integrated.
+         */
+        virtual void cellActivated([[maybe_unused]] CellCoord cell) {}
+
+        /**
+         * @brief Removes everything previously integrated from this cell. Its chunks become invalid afterwards.
+         */
+        virtual void releaseCell(CellCoord cell) = 0;
+    };
+
+    /**
+     * @brief Streams a grid of scene cells in and out around a set of streaming sources.
+     *
+     * Every frame, update():
+     *  - ranks registered cells by their distance to the nearest source, using positions extrapolated
+     *    along each source's velocity so cells ahead of a moving camera win over those behind it,
+     *  - queues cells inside the load radius and starts the closest ones on the JobSystem, where the scene
+     *    file is mapped and prefaulted off the main thread. Cells that fail to load are retried with backoff,
+     *  - unloads cells only once they are further than the unload radius. The gap between both radii
+     *    is the hysteresis that keeps a source on a cell border from loading and unloading it every frame,
+     *  - integrates finished cells, nearest first, chunk by chunk until the frame's time budget is spent.
+     *
+     * All member functions must be called from the thread that owns the frame loop.
+     */
+    class WorldPartition {
+    public:
+        struct Config {
+            /// Edge length of a cell in world units
+            float cellSize = 128.0f;
+            /// Cells closer than this to any source are loaded
+            float loadRadius = 384.0f;
+            /// Loaded cells further than this from every source are unloaded. Must be at least loadRadius
+            float unloadRadius = 448.0f;
+            /// Seconds of source velocity added to its position when ranking cells
+            float velocityLookaheadSeconds = 1.0f;
+            /// Cells being read in the background at the same time
+            uint32_t maxConcurrentLoads = 4;
+            /// Main thread time spent handing chunks to the integrator per update()
+            double integrationBudgetMilliseconds = 1.0;
+        };
+
+        struct Stats {
+            uint32_t registeredCells = 0;
+            uint32_t queuedCells = 0;
+            uint32_t loadingCells = 0;
+            /// Loaded in the background, waiting for (or part way through) integration
+            uint32_t pendingIntegrationCells = 0;
+            uint32_t activeCells = 0;
+            uint32_t chunksIntegratedThisFrame = 0;
+            uint32_t cellsUnloadedThisFrame = 0;
+            double integrationMillisecondsThisFrame = 0.0;
+            /// Frames in which the single chunk that is always integrated did not fit the budget
+            uint64_t budgetOverruns = 0;
+            uint64_t bytesLoadedTotal = 0;
+            uint64_t frameIndex = 0;
+        };
+
+        WorldPartition(const Scene::ComponentRegistry& registry, CellIntegrator& integrator, const Config& config, JobSystem& jobSystem = JobSystem::getDefault());
+        ~WorldPartition();
+
+        WorldPartition(const WorldPartition&) = delete;
+        WorldPartition& operator=(const WorldPartition&) = delete;
+
+        /**
+         * @brief Makes a cell known to the partition. Cells that were never registered are treated as empty.
+         */
+        void registerCell(CellCoord cell, const std::filesystem::path& path);
+
+        /**
+         * @brief Registers every file named like getCellFileName() in a directory.
+         *
+         * @return The number of cells registered
+         */
+        uint32_t registerCellsInDirectory(const std::filesystem::path& directory);
+
+        /**
+         * @return The conventional file name of a cell, "Cell_<x>_<z>.vkscene"
+         */
+        static std::string getCellFileName(CellCoord cell);
+
+        /**
+         * @param priorityScale Larger values make this source's cells win over other sources' at the same distance
+         */
+        StreamingSourceHandle addSource(float priorityScale = 1.0f);
+        void removeSource(StreamingSourceHandle source);
+        void updateSource(StreamingSourceHandle source, float x, float z, float velocityX = 0.0f, float velocityZ = 0.0f);
+
+        /**
+         * @brief Runs one streaming step. Call once per frame.
+         */
+        void update();
+
+        /**
+         * @return The cell containing a world position
+         */
+        [[nodiscard]] CellCoord getCellAt(float x, float z) const;
+
+        [[nodiscard]] bool isCellActive(CellCoord cell) const;
+        [[nodiscard]] const Stats& getStats() const { return m_Stats; }
+        void logStats() const;
+
+    private:
+        enum class CellState {
+            UNLOADED,
+            QUEUED,
+            LOADING,
+            INTEGRATING,
+            ACTIVE
+        };
+
+        struct Cell {
+            CellCoord coord;
+            std::filesystem::path path;
+            CellState state = CellState::UNLOADED;
+            /// Distance to the nearest source divided by its priority scale. Lower loads first
+            float priority = 0.0f;
+            /// Bumped whenever a load is started or abandoned so stale results can be recognised
+            uint32_t generation = 0;
+            std::unique_ptr<Scene::SceneFile> scene;
+            uint32_t archetypeCursor = 0;
+            uint32_t chunkCursor = 0;
+            bool integratedAnything = false;
+            /// Consecutive failed loads, each one doubles the wait before the next attempt
+            uint32_t failedLoads = 0;
+            /// Frame before which a cell that failed to load is not queued again
+            uint64_t retryFrame = 0;
+        };
+
+        struct Source {
+            float x = 0.0f;
+            float z = 0.0f;
+            float velocityX = 0.0f;
+            float velocityZ = 0.0f;
+            float priorityScale = 1.0f;
+            bool alive = false;
+        };
+
+        /// Shared with load jobs, which may finish after the partition stopped caring about their cell
+        struct LoadResults {
+            struct Result {
+                uint64_t key;
+                uint32_t generation;
+                std::unique_ptr<Scene::SceneFile> scene;
+            };
+            std::mutex mutex;
+            std::vector<Result> completed;
+            std::atomic<uint32_t> inFlight = 0;
+        };
+
+        struct CellDistance {
+            /// Distance from the cell to the closest source, current or extrapolated position
+            float nearest;
+            /// nearest, divided by the priority scale of the source it belongs to
+            float priority;
+        };
+
+        static uint64_t makeKey(CellCoord cell);
+        [[nodiscard]] CellDistance computeDistance(CellCoord cell) const;
+        void updatePriorities();
+        void retireLoads();
+        void startLoads();
+        void integrate();
+        void unloadCell(Cell& cell);
+
+        const Scene::ComponentRegistry& m_Registry;
+        CellIntegrator& m_Integrator;
+        Config m_Config;
+        JobSystem& m_JobSystem;
+
+        std::unordered_map<uint64_t, Cell> m_Cells;
+        std::vector<Source> m_Sources;
+        std::shared_ptr<LoadResults> m_LoadResults;
+        Stats m_Stats;
+    };
+
+}
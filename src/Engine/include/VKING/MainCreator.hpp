@@ -24,7 +24,7 @@
 
 #include <VKING/Prerequisites.hpp>
 
-extern int VKING_Main([[maybe_unused]] int argc, [[maybe_unused]] const char ** _argv);
+extern int VKING_Main(int argc, const char ** _argv);
 
 #ifdef VKING_INCLUDE_WIN_MAIN
 #   ifdef WIN32
@@ -43,4 +43,48 @@ extern "C" {
         if (const auto callbackFN = userWindow->getWindowCloseRequestCallbackEventFN()) callbackFN(userWindow);
     }
 
+    // Input callbacks only translate and queue, they run on the thread pumping events
+
+    export void VKING_Platform_GLFW_KeyCallback(GLFWwindow* window, const int key, const int scancode, const int action, const int mods) {
+        using VKING::Types::InputEvent;
+        static_cast<VKING::Types::Window*>(glfwGetWindowUserPointer(window))->getInputQueue().push({
+            .type = InputEvent::Type::KEY, .action = static_cast<InputEvent::Action>(action), .code = key, .scancode = scancode, .modifiers = mods
+        });
+    }
+
+    export void VKING_Platform_GLFW_CharCallback(GLFWwindow* window, const unsigned int codepoint) {
+        using VKING::Types::InputEvent;
+        static_cast<VKING::Types::Window*>(glfwGetWindowUserPointer(window))->getInputQueue().push({
+            .type = InputEvent::Type::CHARACTER, .code = static_cast<int32_t>(codepoint)
+        });
+    }
+
+    export void VKING_Platform_GLFW_MouseButtonCallback(GLFWwindow* window, const int button, const int action, const int mods) {
+        using VKING::Types::InputEvent;
+        static_cast<VKING::Types::Window*>(glfwGetWindowUserPointer(window))->getInputQueue().push({
+            .type = InputEvent::Type::MOUSE_BUTTON, .action = static_cast<InputEvent::Action>(action), .code = button, .modifiers = mods
+        });
+    }
+
+    export void VKING_Platform_GLFW_CursorPositionCallback(GLFWwindow* window, const double x, const double y) {
+        using VKING::Types::InputEvent;
+        static_cast<VKING::Types::Window*>(glfwGetWindowUserPointer(window))->getInputQueue().push({
+            .type = InputEvent::Type::CURSOR_POSITION, .x = x, .y = y
+        });
+    }
+
+    export void VKING_Platform_GLFW_ScrollCallback(GLFWwindow* window, const double xOffset, const double yOffset) {
+        using VKING::Types::InputEvent;
+        static_cast<VKING::Types::Window*>(glfwGetWindowUserPointer(window))->getInputQueue().push({
+            .type = InputEvent::Type::SCROLL, .x = xOffset, .y = yOffset
+        });
+    }
+
+    export void VKING_Platform_GLFW_WindowFocusCallback(GLFWwindow* window, const int focused) {
+        using VKING::Types::InputEvent;
+        static_cast<VKING::Types::Window*>(glfwGetWindowUserPointer(window))->getInputQueue().push({
+            .type = InputEvent::Type::FOCUS, .action = focused ? InputEvent::Action::PRESS : InputEvent::Action::RELEASE
+        });
+    }
+
 }
@@ -22,6 +22,8 @@
 module;
 #include <GLFW/glfw3.h>
 
+#include <VKING/Profiler.hpp>
+
 module VKING.Platform.GLFW:WindowImpl;
 import :Window;
 import :Logger;
@@ -32,6 +34,7 @@ namespace VKING::Platform::GLFW {
     static std::atomic_int s_WindowCount = 0;
 
     Window::Window(const WindowCreateInfo& createInfo){
+        VKING_PROFILE_SCOPE("GLFW::Window::Window");
         m_Title = createInfo.title;
         m_Width = static_cast<int>(createInfo.width);
         m_Height = static_cast<int>(createInfo.height);
@@ -43,6 +46,7 @@ namespace VKING::Platform::GLFW {
         glfwSetErrorCallback(VKING_Platform_GLFW_ErrorCallback);
         if (s_WindowCount.fetch_add(1, std::memory_order_acq_rel) == 0) {
             ModuleLogger::record().trace("GLFW initializing. First time creating a window.");
+            VKING_PROFILE_SCOPE("GLFW::glfwInit");
             glfwInit();
             ModuleLogger::record().debug("GLFW initialized.");
         }
@@ -51,7 +55,10 @@ namespace VKING::Platform::GLFW {
         if (createInfo.pfn_ApplyWindowCreationHints) createInfo.pfn_ApplyWindowCreationHints(createInfo);
 
         ModuleLogger::record().debug("Creating GLFW window.");
-        m_GLFWwindow = glfwCreateWindow(m_Width, m_Height, m_Title.c_str(), nullptr, nullptr);
+        {
+            VKING_PROFILE_SCOPE("GLFW::glfwCreateWindow");
+            m_GLFWwindow = glfwCreateWindow(m_Width, m_Height, m_Title.c_str(), nullptr, nullptr);
+        }
         if (!m_GLFWwindow) {
             ModuleLogger::record().critical("GLFW window creation failed.");
         }
@@ -65,9 +72,18 @@ namespace VKING::Platform::GLFW {
         // The VKING_Platform_GLFW_WindowCloseCallback will handle if the callback is null
         glfwSetWindowCloseCallback(m_GLFWwindow, VKING_Platform_GLFW_WindowCloseCallback);
 
+        // Input goes straight into the window's input queue, stamped as GLFW delivers it
+        glfwSetKeyCallback(m_GLFWwindow, VKING_Platform_GLFW_KeyCallback);
+        glfwSetCharCallback(m_GLFWwindow, VKING_Platform_GLFW_CharCallback);
+        glfwSetMouseButtonCallback(m_GLFWwindow, VKING_Platform_GLFW_MouseButtonCallback);
+        glfwSetCursorPosCallback(m_GLFWwindow, VKING_Platform_GLFW_CursorPositionCallback);
+        glfwSetScrollCallback(m_GLFWwindow, VKING_Platform_GLFW_ScrollCallback);
+        glfwSetWindowFocusCallback(m_GLFWwindow, VKING_Platform_GLFW_WindowFocusCallback);
+
     }
 
     Window::~Window() {
+        VKING_PROFILE_SCOPE("GLFW::Window::~Window");
         glfwDestroyWindow(m_GLFWwindow);
         if (s_WindowCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
             glfwTerminate();
@@ -79,6 +95,28 @@ namespace VKING::Platform::GLFW {
     }
 
     void Window::pollEvents() {
+        VKING_PROFILE_SCOPE("GLFW::pollEvents");
         glfwPollEvents();
     }
+
+    void Window::waitEvents(const double timeoutSeconds) {
+        VKING_PROFILE_SCOPE("GLFW::waitEvents");
+        if (timeoutSeconds > 0.0) {
+            glfwWaitEventsTimeout(timeoutSeconds);
+        } else {
+            glfwPollEvents();
+        }
+    }
+
+    Window::FramebufferSize Window::getFramebufferSize() const {
+        int width = 0, height = 0;
+        glfwGetFramebufferSize(m_GLFWwindow, &width, &height);
+        return {static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
+    }
+
+    double Window::getContentScale() const {
+        float xScale = 1.0f, yScale = 1.0f;
+        glfwGetWindowContentScale(m_GLFWwindow, &xScale, &yScale);
+        return xScale;
+    }
 }
@@ -56,7 +56,11 @@ namespace VKING::Platform::GLFW {
 
         void* getNativeWindowHandle() override { return m_GLFWwindow; }
 
+        [[nodiscard]] FramebufferSize getFramebufferSize() const override;
+        [[nodiscard]] double getContentScale() const override;
+
         void pollEvents() override;
+        void waitEvents(double timeoutSeconds) override;
 
     private:
         GLFWwindow* m_GLFWwindow = nullptr;
@@ -20,6 +20,10 @@
 // Created by Matthew Krueger on 1/6/26.
 //
 module;
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
 #include <GLFW/glfw3native.h>
@@ -30,6 +34,7 @@ module VKING.Platform.Glue.GLFWVulkan;
 import VKING.Types.Platform;
 import VKING.Types.Window;
 import VKING.Platform.GLFW;
+import VKING.Platform.Vulkan;
 
 namespace VKING::Platform::Glue {
 
@@ -56,9 +61,72 @@ namespace VKING::Platform::Glue {
     std::unique_ptr<Types::Platform::RHI> GLFWVulkan::createRHI() {
 
         PlatformGLFWVulkanLogger::record().info("Creating Vulkan RHI.");
-        return nullptr;
+
+        // Independent of GLFW, so it runs while the window is created
+        Vulkan::RHI::CreateInfo createInfo;
+#if !defined(NDEBUG)
+        createInfo.validation = true;
+#endif
+        return Vulkan::RHI::create(createInfo);
 
     }
 
+    std::unique_ptr<Types::Platform::Swapchain> GLFWVulkan::createSwapchain(Types::Platform::RHI& rhi, Types::Window& window) {
+
+        // Both were created by this platform manager
+        auto& vulkanRHI = static_cast<Vulkan::RHI&>(rhi);
+        auto* glfwWindow = static_cast<GLFWwindow*>(window.getNativeWindowHandle());
+
+        VkSurfaceKHR surface = VK_NULL_HANDLE;
+        if (const VkResult result = glfwCreateWindowSurface(vulkanRHI.getInstance(), glfwWindow, VKING_Platform_Vulkan_CreateAllocationCallbacks(), &surface);
+            result != VK_SUCCESS) {
+            PlatformGLFWVulkanLogger::record().error("glfwCreateWindowSurface failed with VkResult {}.", static_cast<int32_t>(result));
+            return nullptr;
+        }
+
+        return Vulkan::Swapchain::create(vulkanRHI, surface, window);
+
+    }
+
+
+}
+
+extern "C" bool VKING_Platform_Glue_GLFWVulkan_Probe(std::string* reason) {
+#if defined(__linux__)
+    // Checked before GLFW, which would otherwise fail in glfwInit
+    if (!std::getenv("DISPLAY") && !std::getenv("WAYLAND_DISPLAY")) {
+        if (reason) *reason = "neither DISPLAY nor WAYLAND_DISPLAY is set";
+        return false;
+    }
+#endif
+    return VKING::Platform::Vulkan::probe(reason);
+}
 
+#if defined(VKING_PLATFORM_PLUGIN)
+// Read by EngineConfig when this glue is built as a platform plugin
+extern "C" const VKING::Types::Platform::PlatformPluginInfo* VKING_Platform_RegisterPlugin() {
+    using namespace VKING::Types::Platform;
+    static const VKING::ScoredType<PlatformManager::PlatformSpecification> s_Entries[] = {
+        {
+            .value = {
+                .platformCreateInfo = PlatformManager::PlatformSpecification::PlatformCreateInfo{
+                    .pfn_PlatformManagerCreate = VKING_Platform_Glue_GLFWVulkan_Create,
+                    .pfn_PlatformManagerDestroy = VKING_Platform_Glue_GLFWVulkan_Destroy,
+                    .pfn_PlatformProbe = VKING_Platform_Glue_GLFWVulkan_Probe
+                },
+                .platformType = PlatformType::GLFW,
+                .backendType = BackendType::VULKAN
+            },
+            // GLFW (2) times Vulkan (2), the score EngineConfig gives the linked in glue
+            .score = 4
+        }
+    };
+    static const PlatformPluginInfo s_Info{
+        .abiVersion = PLATFORM_PLUGIN_ABI_VERSION,
+        .name = "GLFW + Vulkan",
+        .entries = s_Entries,
+        .entryCount = 1
+    };
+    return &s_Info;
 }
+#endif
@@ -45,12 +45,22 @@ namespace VKING::Platform::Glue {
 
         std::unique_ptr<Types::Platform::RHI> createRHI() override;
 
+        /**
+         * @brief Creates the window's surface through GLFW and a Vulkan swapchain for it on the shared device.
+         */
+        std::unique_ptr<Types::Platform::Swapchain> createSwapchain(Types::Platform::RHI& rhi, Types::Window& window) override;
+
     private:
 
     };
 
 }
 
+/**
+ * @brief A display to connect to and a Vulkan driver with a device, see PlatformCreateInfo::pfn_PlatformProbe.
+ */
+export extern "C" bool VKING_Platform_Glue_GLFWVulkan_Probe(std::string* reason);
+
 export extern "C" void VKING_Platform_Glue_GLFWVulkan_Destroy(
     VKING::Types::Platform::PlatformManager* p
 ) {
@@ -60,6 +70,6 @@ export extern "C" void VKING_Platform_Glue_GLFWVulkan_Destroy(
 // now, we create a c linkage specifically to create this object
 export extern "C" VKING::Types::Platform::PlatformManager* VKING_Platform_Glue_GLFWVulkan_Create(){
     PlatformGLFWVulkanLogger::record().debug("Invoked the GLFWVulkan GLUE LIBRARY Create Function");
-    return new VKING::Platform::Glue::GLFWVulkan({VKING_Platform_Glue_GLFWVulkan_Create, VKING_Platform_Glue_GLFWVulkan_Destroy});
+    return new VKING::Platform::Glue::GLFWVulkan({VKING_Platform_Glue_GLFWVulkan_Create, VKING_Platform_Glue_GLFWVulkan_Destroy, VKING_Platform_Glue_GLFWVulkan_Probe});
 }
 
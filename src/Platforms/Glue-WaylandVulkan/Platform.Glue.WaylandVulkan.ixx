@@ -0,0 +1,66 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+export module VKING.Platform.Glue.WaylandVulkan;
+
+import VKING.Types.Platform;
+import VKING.Log;
+import VKING.Types.Window;
+
+using PlatformWaylandVulkanLogger = VKING::Log::Named<"PlatformCreator">;
+
+namespace VKING::Platform::Glue {
+
+    /**
+     * @brief Vulkan presenting straight to native Wayland surfaces, with no GLFW in between.
+     */
+    export class WaylandVulkan final : public Types::Platform::PlatformManager {
+    public:
+        explicit WaylandVulkan(const Types::Platform::PlatformManager::PlatformSpecification::PlatformCreateInfo createInfo) : PlatformManager(Types::Platform::BackendType::VULKAN, Types::Platform::PlatformType::WAYLAND, createInfo){};
+
+        std::unique_ptr<Types::Window> createWindow(const Types::Window::WindowCreateInfo &windowCreateInfo) override;
+
+        std::unique_ptr<Types::Platform::RHI> createRHI() override;
+
+        /**
+         * @brief Creates a VkSurfaceKHR on the window's wl_surface and a Vulkan swapchain for it on the shared device.
+         */
+        std::unique_ptr<Types::Platform::Swapchain> createSwapchain(Types::Platform::RHI& rhi, Types::Window& window) override;
+    };
+
+}
+
+/**
+ * @brief A Wayland compositor to connect to and a Vulkan driver with a device, see PlatformCreateInfo::pfn_PlatformProbe.
+ */
+export extern "C" bool VKING_Platform_Glue_WaylandVulkan_Probe(std::string* reason);
+
+export extern "C" void VKING_Platform_Glue_WaylandVulkan_Destroy(
+    VKING::Types::Platform::PlatformManager* p
+) {
+    delete p;
+}
+
+export extern "C" VKING::Types::Platform::PlatformManager* VKING_Platform_Glue_WaylandVulkan_Create() {
+    PlatformWaylandVulkanLogger::record().debug("Invoked the WaylandVulkan GLUE LIBRARY Create Function");
+    return new VKING::Platform::Glue::WaylandVulkan({VKING_Platform_Glue_WaylandVulkan_Create, VKING_Platform_Glue_WaylandVulkan_Destroy, VKING_Platform_Glue_WaylandVulkan_Probe});
+}
@@ -0,0 +1,144 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include <wayland-client.h>
+
+#define VK_USE_PLATFORM_WAYLAND_KHR
+#include <vulkan/vulkan.h>
+
+module VKING.Platform.Glue.WaylandVulkan;
+
+import VKING.Types.Platform;
+import VKING.Types.Window;
+import VKING.Platform.Wayland;
+import VKING.Platform.Vulkan;
+
+namespace VKING::Platform::Glue {
+
+    std::unique_ptr<Types::Window> WaylandVulkan::createWindow(const Types::Window::WindowCreateInfo &createInfo) {
+
+        PlatformWaylandVulkanLogger::record().debug("Creating Wayland window.");
+
+        Wayland::Window::WindowCreateInfo windowCreateInfo;
+        windowCreateInfo.title = createInfo.title;
+        windowCreateInfo.width = createInfo.width;
+        windowCreateInfo.height = createInfo.height;
+
+        auto window = std::make_unique<Wayland::Window>(windowCreateInfo);
+        if (!window->getSurface()) return nullptr;
+        return window;
+
+    }
+
+    std::unique_ptr<Types::Platform::RHI> WaylandVulkan::createRHI() {
+
+        PlatformWaylandVulkanLogger::record().info("Creating Vulkan RHI.");
+
+        // Independent of Wayland, so it runs while the window is created
+        Vulkan::RHI::CreateInfo createInfo;
+#if !defined(NDEBUG)
+        createInfo.validation = true;
+#endif
+        return Vulkan::RHI::create(createInfo);
+
+    }
+
+    std::unique_ptr<Types::Platform::Swapchain> WaylandVulkan::createSwapchain(Types::Platform::RHI& rhi, Types::Window& window) {
+
+        // Both were created by this platform manager
+        auto& vulkanRHI = static_cast<Vulkan::RHI&>(rhi);
+        auto& waylandWindow = static_cast<Wayland::Window&>(window);
+
+        // Looked up rather than linked, so a loader without VK_KHR_wayland_surface fails here instead of at load time
+        const auto pfn_CreateWaylandSurface = reinterpret_cast<PFN_vkCreateWaylandSurfaceKHR>(
+            vkGetInstanceProcAddr(vulkanRHI.getInstance(), "vkCreateWaylandSurfaceKHR"));
+        if (!pfn_CreateWaylandSurface) {
+            PlatformWaylandVulkanLogger::record().error("The Vulkan instance has no VK_KHR_wayland_surface.");
+            return nullptr;
+        }
+
+        VkWaylandSurfaceCreateInfoKHR surfaceInfo{};
+        surfaceInfo.sType = VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR;
+        surfaceInfo.display = waylandWindow.getDisplay();
+        surfaceInfo.surface = waylandWindow.getSurface();
+
+        VkSurfaceKHR surface = VK_NULL_HANDLE;
+        if (const VkResult result = pfn_CreateWaylandSurface(vulkanRHI.getInstance(), &surfaceInfo, VKING_Platform_Vulkan_CreateAllocationCallbacks(), &surface);
+            result != VK_SUCCESS) {
+            PlatformWaylandVulkanLogger::record().error("vkCreateWaylandSurfaceKHR failed with VkResult {}.", static_cast<int32_t>(result));
+            return nullptr;
+        }
+
+        // Wayland surfaces take their size from the swapchain, which builds at the window's scaled framebuffer size
+        return Vulkan::Swapchain::create(vulkanRHI, surface, window);
+
+    }
+
+}
+
+extern "C" bool VKING_Platform_Glue_WaylandVulkan_Probe(std::string* reason) {
+    if (!std::getenv("WAYLAND_DISPLAY") && !std::getenv("WAYLAND_SOCKET")) {
+        if (reason) *reason = "WAYLAND_DISPLAY is not set";
+        return false;
+    }
+    // A stale WAYLAND_DISPLAY (compositor gone) would otherwise only fail at window creation
+    wl_display* display = wl_display_connect(nullptr);
+    if (!display) {
+        if (reason) *reason = "cannot connect to the Wayland compositor";
+        return false;
+    }
+    wl_display_disconnect(display);
+    return VKING::Platform::Vulkan::probe(reason);
+}
+
+#if defined(VKING_PLATFORM_PLUGIN)
+// Read by EngineConfig when this glue is built as a platform plugin
+extern "C" const VKING::Types::Platform::PlatformPluginInfo* VKING_Platform_RegisterPlugin() {
+    using namespace VKING::Types::Platform;
+    static const VKING::ScoredType<PlatformManager::PlatformSpecification> s_Entries[] = {
+        {
+            .value = {
+                .platformCreateInfo = PlatformManager::PlatformSpecification::PlatformCreateInfo{
+                    .pfn_PlatformManagerCreate = VKING_Platform_Glue_WaylandVulkan_Create,
+                    .pfn_PlatformManagerDestroy = VKING_Platform_Glue_WaylandVulkan_Destroy,
+                    .pfn_PlatformProbe = VKING_Platform_Glue_WaylandVulkan_Probe
+                },
+                .platformType = PlatformType::WAYLAND,
+                .backendType = BackendType::VULKAN
+            },
+            // Wayland (1) times Vulkan (2), the score EngineConfig gives the linked in glue
+            .score = 2
+        }
+    };
+    static const PlatformPluginInfo s_Info{
+        .abiVersion = PLATFORM_PLUGIN_ABI_VERSION,
+        .name = "Wayland + Vulkan",
+        .entries = s_Entries,
+        .entryCount = 1
+    };
+    return &s_Info;
+}
+#endif
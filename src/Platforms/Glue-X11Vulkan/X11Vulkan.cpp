@@ -0,0 +1,145 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include <xcb/xcb.h>
+
+#define VK_USE_PLATFORM_XCB_KHR
+#include <vulkan/vulkan.h>
+
+module VKING.Platform.Glue.X11Vulkan;
+
+import VKING.Types.Platform;
+import VKING.Types.Window;
+import VKING.Platform.X11;
+import VKING.Platform.Vulkan;
+
+namespace VKING::Platform::Glue {
+
+    std::unique_ptr<Types::Window> X11Vulkan::createWindow(const Types::Window::WindowCreateInfo &createInfo) {
+
+        PlatformX11VulkanLogger::record().debug("Creating X11 window.");
+
+        X11::Window::WindowCreateInfo windowCreateInfo;
+        windowCreateInfo.title = createInfo.title;
+        windowCreateInfo.width = createInfo.width;
+        windowCreateInfo.height = createInfo.height;
+
+        auto window = std::make_unique<X11::Window>(windowCreateInfo);
+        if (!window->getConnection()) return nullptr;
+        return window;
+
+    }
+
+    std::unique_ptr<Types::Platform::RHI> X11Vulkan::createRHI() {
+
+        PlatformX11VulkanLogger::record().info("Creating Vulkan RHI.");
+
+        // Independent of X11, so it runs while the window is created
+        Vulkan::RHI::CreateInfo createInfo;
+#if !defined(NDEBUG)
+        createInfo.validation = true;
+#endif
+        return Vulkan::RHI::create(createInfo);
+
+    }
+
+    std::unique_ptr<Types::Platform::Swapchain> X11Vulkan::createSwapchain(Types::Platform::RHI& rhi, Types::Window& window) {
+
+        // Both were created by this platform manager
+        auto& vulkanRHI = static_cast<Vulkan::RHI&>(rhi);
+        auto& x11Window = static_cast<X11::Window&>(window);
+
+        // Looked up rather than linked, so a loader without VK_KHR_xcb_surface fails here instead of at load time
+        const auto pfn_CreateXcbSurface = reinterpret_cast<PFN_vkCreateXcbSurfaceKHR>(
+            vkGetInstanceProcAddr(vulkanRHI.getInstance(), "vkCreateXcbSurfaceKHR"));
+        if (!pfn_CreateXcbSurface) {
+            PlatformX11VulkanLogger::record().error("The Vulkan instance has no VK_KHR_xcb_surface.");
+            return nullptr;
+        }
+
+        VkXcbSurfaceCreateInfoKHR surfaceInfo{};
+        surfaceInfo.sType = VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR;
+        surfaceInfo.connection = x11Window.getConnection();
+        surfaceInfo.window = x11Window.getWindow();
+
+        VkSurfaceKHR surface = VK_NULL_HANDLE;
+        if (const VkResult result = pfn_CreateXcbSurface(vulkanRHI.getInstance(), &surfaceInfo, VKING_Platform_Vulkan_CreateAllocationCallbacks(), &surface);
+            result != VK_SUCCESS) {
+            PlatformX11VulkanLogger::record().error("vkCreateXcbSurfaceKHR failed with VkResult {}.", static_cast<int32_t>(result));
+            return nullptr;
+        }
+
+        // The driver presents through the Present extension, whose completions the window listens to for its timing
+        return Vulkan::Swapchain::create(vulkanRHI, surface, window);
+
+    }
+
+}
+
+extern "C" bool VKING_Platform_Glue_X11Vulkan_Probe(std::string* reason) {
+    if (!std::getenv("DISPLAY")) {
+        if (reason) *reason = "DISPLAY is not set";
+        return false;
+    }
+    // A stale DISPLAY (server gone) would otherwise only fail at window creation
+    xcb_connection_t* connection = xcb_connect(nullptr, nullptr);
+    const bool connected = xcb_connection_has_error(connection) == 0;
+    xcb_disconnect(connection);
+    if (!connected) {
+        if (reason) *reason = "cannot connect to the X server";
+        return false;
+    }
+    return VKING::Platform::Vulkan::probe(reason);
+}
+
+#if defined(VKING_PLATFORM_PLUGIN)
+// Read by EngineConfig when this glue is built as a platform plugin
+extern "C" const VKING::Types::Platform::PlatformPluginInfo* VKING_Platform_RegisterPlugin() {
+    using namespace VKING::Types::Platform;
+    static const VKING::ScoredType<PlatformManager::PlatformSpecification> s_Entries[] = {
+        {
+            .value = {
+                .platformCreateInfo = PlatformManager::PlatformSpecification::PlatformCreateInfo{
+                    .pfn_PlatformManagerCreate = VKING_Platform_Glue_X11Vulkan_Create,
+                    .pfn_PlatformManagerDestroy = VKING_Platform_Glue_X11Vulkan_Destroy,
+                    .pfn_PlatformProbe = VKING_Platform_Glue_X11Vulkan_Probe
+                },
+                .platformType = PlatformType::X11,
+                .backendType = BackendType::VULKAN
+            },
+            // X11 (1) times Vulkan (2), the score EngineConfig gives the linked in glue
+            .score = 2
+        }
+    };
+    static const PlatformPluginInfo s_Info{
+        .abiVersion = PLATFORM_PLUGIN_ABI_VERSION,
+        .name = "X11 + Vulkan",
+        .entries = s_Entries,
+        .entryCount = 1
+    };
+    return &s_Info;
+}
+#endif
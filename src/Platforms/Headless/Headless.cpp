@@ -0,0 +1,46 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <memory>
+
+module VKING.Platform.Headless;
+
+import VKING.Types.Platform;
+import VKING.Types.Window;
+
+namespace VKING::Platform::Headless {
+
+    Window::Window(const WindowCreateInfo& createInfo)
+        : m_Title(createInfo.title), m_Width(createInfo.width), m_Height(createInfo.height) {
+        PlatformHeadlessLogger::record().debug("Created headless window '{}' ({}x{}).", m_Title, m_Width, m_Height);
+    }
+
+    std::unique_ptr<Types::Window> PlatformManager::createWindow(const Types::Window::WindowCreateInfo& windowCreateInfo) {
+        return std::make_unique<Window>(windowCreateInfo);
+    }
+
+    std::unique_ptr<Types::Platform::RHI> PlatformManager::createRHI() {
+        PlatformHeadlessLogger::record().info("Headless platform has no RHI.");
+        return nullptr;
+    }
+
+}
@@ -0,0 +1,101 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+export module VKING.Platform.Headless;
+
+import VKING.Types.Platform;
+import VKING.Types.Window;
+import VKING.Log;
+
+using PlatformHeadlessLogger = VKING::Log::Named<"PlatformHeadless">;
+
+namespace VKING::Platform::Headless {
+
+    /**
+     * @brief A window that exists only as an object: nothing is shown and no events ever arrive.
+     *
+     * Keeps the window lifecycle of the application identical on machines without a display server.
+     */
+    export class Window final : public Types::Window {
+    public:
+        explicit Window(const WindowCreateInfo& createInfo);
+
+        void pollEvents() override {}
+
+        /// Nothing can arrive, so this only waits out the timeout
+        void waitEvents(const double timeoutSeconds) override {
+            if (timeoutSeconds > 0.0) std::this_thread::sleep_for(std::chrono::duration<double>(timeoutSeconds));
+        }
+
+        /**
+         * @return nullptr, there is no native window
+         */
+        void* getNativeWindowHandle() override { return nullptr; }
+
+        [[nodiscard]] FramebufferSize getFramebufferSize() const override { return {m_Width, m_Height}; }
+
+        [[nodiscard]] const std::string& getTitle() const { return m_Title; }
+        [[nodiscard]] uint32_t getWidth() const { return m_Width; }
+        [[nodiscard]] uint32_t getHeight() const { return m_Height; }
+
+    private:
+        std::string m_Title;
+        uint32_t m_Width;
+        uint32_t m_Height;
+    };
+
+    /**
+     * @brief Platform manager without a windowing system or GPU, for servers, CI and performance harness runs.
+     *
+     * Never chosen over a real platform unless it is requested explicitly.
+     */
+    export class PlatformManager final : public Types::Platform::PlatformManager {
+    public:
+        explicit PlatformManager(const PlatformSpecification::PlatformCreateInfo createInfo)
+            : Types::Platform::PlatformManager(Types::Platform::BackendType::HEADLESS, Types::Platform::PlatformType::HEADLESS, createInfo) {}
+
+        std::unique_ptr<Types::Window> createWindow(const Types::Window::WindowCreateInfo& windowCreateInfo) override;
+
+        /**
+         * @return nullptr, a headless platform has no renderer
+         */
+        std::unique_ptr<Types::Platform::RHI> createRHI() override;
+    };
+
+}
+
+export extern "C" void VKING_Platform_Headless_Destroy(
+    VKING::Types::Platform::PlatformManager* p
+) {
+    delete p;
+}
+
+export extern "C" VKING::Types::Platform::PlatformManager* VKING_Platform_Headless_Create() {
+    PlatformHeadlessLogger::record().debug("Invoked the Headless platform Create Function");
+    return new VKING::Platform::Headless::PlatformManager({VKING_Platform_Headless_Create, VKING_Platform_Headless_Destroy});
+}
@@ -23,44 +23,68 @@
 module;
 #include <vulkan/vulkan.h>
 
+#include <VKING/AllocationProfiler.hpp>
+
 export module VKING.Platform.Vulkan:Callbacks;
 
 namespace VKING::Platform::Vulkan {
     // Helper functions – put these in a namespace or as static inline functions
 
-    constexpr size_t HEADER_SIZE = sizeof(size_t);
-    constexpr size_t HEADER_ALIGN = alignof(size_t);
+    // Stored right before every user pointer. The low bit of offset marks allocations the allocation
+    // profiler sampled, so only those pay for a lookup when freed
+    struct AllocationHeader {
+        size_t size;
+        size_t offset;
+    };
+
+    constexpr size_t SAMPLED_FLAG = 1;
 
-    // Returns the pointer to the actual allocated block (header + payload)
-    inline void* GetInternalBlock(void* userPtr) {
-        return userPtr ? static_cast<char*>(userPtr) - HEADER_SIZE : nullptr;
+    inline AllocationHeader* GetHeader(void* userPtr) {
+        return reinterpret_cast<AllocationHeader*>(static_cast<char*>(userPtr) - sizeof(AllocationHeader));
     }
 
     // Returns the original requested size that was passed to vkAllocationFunction
     inline size_t GetStoredSize(void* userPtr) {
-        void* block = GetInternalBlock(userPtr);
-        return block ? *static_cast<size_t*>(block) : 0;
+        return userPtr ? GetHeader(userPtr)->size : 0;
+    }
+
+    // Tags allocations in the allocation profiler by the scope Vulkan gave them
+    inline const char* GetScopeTag(const VkSystemAllocationScope allocationScope) {
+        switch (allocationScope) {
+            case VK_SYSTEM_ALLOCATION_SCOPE_COMMAND: return "Vulkan/Command";
+            case VK_SYSTEM_ALLOCATION_SCOPE_OBJECT: return "Vulkan/Object";
+            case VK_SYSTEM_ALLOCATION_SCOPE_CACHE: return "Vulkan/Cache";
+            case VK_SYSTEM_ALLOCATION_SCOPE_DEVICE: return "Vulkan/Device";
+            case VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE: return "Vulkan/Instance";
+            default: return "Vulkan";
+        }
     }
 
     // Allocates a new block with header, stores the requested size, returns user pointer
-    inline void* AllocateWithHeader(const size_t requestedSize, const size_t alignment) {
+    inline void* AllocateWithHeader(const size_t requestedSize, const size_t alignment, const VkSystemAllocationScope allocationScope) {
         if (requestedSize == 0) return nullptr;
 
-        const size_t effectiveAlignment = std::max(alignment, HEADER_ALIGN);
-        const size_t totalSize = HEADER_SIZE + requestedSize;
-        const size_t roundedTotal = (totalSize + effectiveAlignment - 1) & ~(effectiveAlignment - 1);
+        // The header is padded to a multiple of the alignment, so the user pointer keeps it
+        const size_t effectiveAlignment = std::max(alignment, alignof(AllocationHeader));
+        const size_t offset = (sizeof(AllocationHeader) + effectiveAlignment - 1) & ~(effectiveAlignment - 1);
+        const size_t roundedTotal = (offset + requestedSize + effectiveAlignment - 1) & ~(effectiveAlignment - 1);
 
         void* block = std::aligned_alloc(effectiveAlignment, roundedTotal);
         if (!block) return nullptr;
 
-        *static_cast<size_t*>(block) = requestedSize;
-        return static_cast<char*>(block) + HEADER_SIZE;
+        void* userPtr = static_cast<char*>(block) + offset;
+        const bool sampled = Profiler::Allocations::shouldSample(requestedSize);
+        *GetHeader(userPtr) = {requestedSize, offset | (sampled ? SAMPLED_FLAG : 0)};
+        if (sampled) Profiler::Allocations::recordAllocation(userPtr, requestedSize, GetScopeTag(allocationScope));
+        return userPtr;
     }
 
     // Frees the block correctly
     inline void FreeWithHeader(void* userPtr) {
         if (userPtr) {
-            std::free(GetInternalBlock(userPtr));
+            const size_t offset = GetHeader(userPtr)->offset;
+            if (offset & SAMPLED_FLAG) Profiler::Allocations::recordFree(userPtr);
+            std::free(static_cast<char*>(userPtr) - (offset & ~SAMPLED_FLAG));
         }
     }
 }
@@ -70,9 +94,9 @@ extern "C" {
 void *VKING_Platform_Vulkan_vkAllocationFunction([[maybe_unused]] void *pUserData,
                                                  const size_t size,
                                                  const size_t alignment,
-                                                 [[maybe_unused]] VkSystemAllocationScope allocationScope) {
+                                                 const VkSystemAllocationScope allocationScope) {
 
-    return VKING::Platform::Vulkan::AllocateWithHeader(size, alignment);
+    return VKING::Platform::Vulkan::AllocateWithHeader(size, alignment, allocationScope);
 
 }
 
@@ -85,10 +109,10 @@ void *VKING_Platform_Vulkan_vkReallocationFunction([[maybe_unused]] void *pUserD
                                                    void *pOriginal,
                                                    const size_t size,
                                                    const size_t alignment,
-                                                   [[maybe_unused]] VkSystemAllocationScope allocationScope) {
+                                                   const VkSystemAllocationScope allocationScope) {
     // Case 1: equivalent to allocation
     if (pOriginal == nullptr) {
-        return VKING::Platform::Vulkan::AllocateWithHeader(size, alignment);
+        return VKING::Platform::Vulkan::AllocateWithHeader(size, alignment, allocationScope);
     }
 
     // Case 2: free request
@@ -100,7 +124,7 @@ void *VKING_Platform_Vulkan_vkReallocationFunction([[maybe_unused]] void *pUserD
     size_t oldSize = VKING::Platform::Vulkan::GetStoredSize(pOriginal);
 
     // Allocate new block
-    void* newUserPtr = VKING::Platform::Vulkan::AllocateWithHeader(size, alignment);
+    void* newUserPtr = VKING::Platform::Vulkan::AllocateWithHeader(size, alignment, allocationScope);
     if (!newUserPtr) return nullptr;
 
     // Copy as much as possible (min of old and new size)
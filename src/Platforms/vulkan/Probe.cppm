@@ -0,0 +1,155 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include <VKING/Profiler.hpp>
+
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#else
+#   include <dlfcn.h>
+#endif
+
+module VKING.Platform.Vulkan:ProbeImpl;
+import :Probe;
+
+namespace VKING::Platform::Vulkan {
+
+    namespace {
+
+#if defined(_WIN32)
+        constexpr const char* LOADER_NAMES[] = {"vulkan-1.dll"};
+#elif defined(__APPLE__)
+        constexpr const char* LOADER_NAMES[] = {"libvulkan.1.dylib", "libvulkan.dylib", "libMoltenVK.dylib"};
+#else
+        constexpr const char* LOADER_NAMES[] = {"libvulkan.so.1", "libvulkan.so"};
+#endif
+
+        /// The loader, opened for the duration of one probe
+        class Loader {
+        public:
+            Loader() {
+                for (const char* name : LOADER_NAMES) {
+#if defined(_WIN32)
+                    m_Handle = LoadLibraryA(name);
+#else
+                    m_Handle = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+#endif
+                    if (m_Handle) break;
+                }
+            }
+
+            ~Loader() {
+                if (!m_Handle) return;
+#if defined(_WIN32)
+                FreeLibrary(static_cast<HMODULE>(m_Handle));
+#else
+                dlclose(m_Handle);
+#endif
+            }
+
+            Loader(const Loader&) = delete;
+            Loader& operator=(const Loader&) = delete;
+
+            [[nodiscard]] PFN_vkGetInstanceProcAddr getInstanceProcAddr() const {
+                if (!m_Handle) return nullptr;
+#if defined(_WIN32)
+                return reinterpret_cast<PFN_vkGetInstanceProcAddr>(GetProcAddress(static_cast<HMODULE>(m_Handle), "vkGetInstanceProcAddr"));
+#else
+                return reinterpret_cast<PFN_vkGetInstanceProcAddr>(dlsym(m_Handle, "vkGetInstanceProcAddr"));
+#endif
+            }
+
+        private:
+            void* m_Handle = nullptr;
+        };
+
+        bool fail(std::string* reason, std::string message) {
+            if (reason) *reason = std::move(message);
+            return false;
+        }
+
+    }
+
+    bool probe(std::string* reason) {
+        VKING_PROFILE_SCOPE("Vulkan::probe");
+
+        const Loader loader;
+        const PFN_vkGetInstanceProcAddr getInstanceProcAddr = loader.getInstanceProcAddr();
+        if (!getInstanceProcAddr) return fail(reason, "no Vulkan loader is installed");
+
+        const auto enumerateExtensions = reinterpret_cast<PFN_vkEnumerateInstanceExtensionProperties>(
+            getInstanceProcAddr(VK_NULL_HANDLE, "vkEnumerateInstanceExtensionProperties"));
+        const auto createInstance = reinterpret_cast<PFN_vkCreateInstance>(getInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance"));
+        if (!enumerateExtensions || !createInstance) return fail(reason, "the Vulkan loader is incomplete");
+
+        uint32_t count = 0;
+        if (enumerateExtensions(nullptr, &count, nullptr) != VK_SUCCESS) return fail(reason, "the Vulkan loader cannot list instance extensions");
+        std::vector<VkExtensionProperties> extensions(count);
+        enumerateExtensions(nullptr, &count, extensions.data());
+        bool hasSurface = false;
+        bool hasPortabilityEnumeration = false;
+        for (const VkExtensionProperties& extension : extensions) {
+            hasSurface |= std::strcmp(extension.extensionName, "VK_KHR_surface") == 0;
+            hasPortabilityEnumeration |= std::strcmp(extension.extensionName, "VK_KHR_portability_enumeration") == 0;
+        }
+        if (!hasSurface) return fail(reason, "no installed Vulkan driver supports VK_KHR_surface");
+
+        // Only an instance lists the devices the drivers expose
+        const char* portabilityEnumeration = "VK_KHR_portability_enumeration";
+        VkApplicationInfo applicationInfo{};
+        applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        applicationInfo.pEngineName = "VKING";
+        applicationInfo.apiVersion = VK_API_VERSION_1_2;
+        VkInstanceCreateInfo instanceInfo{};
+        instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instanceInfo.pApplicationInfo = &applicationInfo;
+        if (hasPortabilityEnumeration) {
+            instanceInfo.flags = VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR;
+            instanceInfo.enabledExtensionCount = 1;
+            instanceInfo.ppEnabledExtensionNames = &portabilityEnumeration;
+        }
+
+        VkInstance instance = VK_NULL_HANDLE;
+        if (const VkResult result = createInstance(&instanceInfo, nullptr, &instance); result != VK_SUCCESS) {
+            return fail(reason, "vkCreateInstance failed with VkResult " + std::to_string(static_cast<int32_t>(result)));
+        }
+        const auto enumerateDevices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(getInstanceProcAddr(instance, "vkEnumeratePhysicalDevices"));
+        const auto destroyInstance = reinterpret_cast<PFN_vkDestroyInstance>(getInstanceProcAddr(instance, "vkDestroyInstance"));
+        uint32_t deviceCount = 0;
+        if (enumerateDevices) enumerateDevices(instance, &deviceCount, nullptr);
+        if (destroyInstance) destroyInstance(instance, nullptr);
+
+        if (deviceCount == 0) return fail(reason, "no Vulkan driver exposes a device");
+        return true;
+    }
+
+}
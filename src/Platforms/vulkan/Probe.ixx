@@ -0,0 +1,40 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <string>
+
+export module VKING.Platform.Vulkan:Probe;
+
+export namespace VKING::Platform::Vulkan {
+
+    /**
+     * @brief Checks that Vulkan can work here before anything links against it: a loader is installed, it offers
+     *        VK_KHR_surface, and at least one driver exposes a device.
+     *
+     * Loads the loader itself and creates a throwaway instance, so it costs the few milliseconds the drivers take
+     * to load. Nothing outlives the call.
+     *
+     * @param reason Receives why not, when returning false
+     */
+    bool probe(std::string* reason);
+
+}
@@ -0,0 +1,424 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include <VKING/Profiler.hpp>
+
+module VKING.Platform.Vulkan:RHIImpl;
+import :RHI;
+import :Swapchain;
+import :Callbacks;
+import VKING.Log;
+
+namespace VKING::Platform::Vulkan {
+
+    namespace {
+
+        using VulkanLogger = Log::Named<"Vulkan">;
+
+        /// Enabled on the instance whenever the loader has them, so any window system can get a surface later
+        constexpr const char* SURFACE_EXTENSIONS[] = {
+            "VK_KHR_surface",
+            "VK_KHR_xcb_surface",
+            "VK_KHR_xlib_surface",
+            "VK_KHR_wayland_surface",
+            "VK_KHR_win32_surface",
+            "VK_EXT_metal_surface",
+        };
+        constexpr const char* PORTABILITY_ENUMERATION_EXTENSION = "VK_KHR_portability_enumeration";
+        constexpr const char* PORTABILITY_SUBSET_EXTENSION = "VK_KHR_portability_subset";
+        constexpr const char* SWAPCHAIN_EXTENSION = "VK_KHR_swapchain";
+        constexpr const char* VALIDATION_LAYER = "VK_LAYER_KHRONOS_validation";
+
+        bool contains(const std::vector<VkExtensionProperties>& available, const char* name) {
+            return std::ranges::any_of(available, [name](const VkExtensionProperties& extension) {
+                return std::strcmp(extension.extensionName, name) == 0;
+            });
+        }
+
+        std::optional<uint32_t> findGraphicsQueueFamily(const VkPhysicalDevice device) {
+            uint32_t count = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties(device, &count, nullptr);
+            std::vector<VkQueueFamilyProperties> families(count);
+            vkGetPhysicalDeviceQueueFamilyProperties(device, &count, families.data());
+            for (uint32_t i = 0; i < count; i++) {
+                if (families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) return i;
+            }
+            return std::nullopt;
+        }
+
+        uint32_t scoreDeviceType(const VkPhysicalDeviceType type) {
+            switch (type) {
+                case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU: return 4;
+                case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU: return 3;
+                case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU: return 2;
+                case VK_PHYSICAL_DEVICE_TYPE_CPU: return 1;
+                default: return 0;
+            }
+        }
+
+    }
+
+    std::unique_ptr<RHI> RHI::create(const CreateInfo& createInfo) {
+        VKING_PROFILE_SCOPE("Vulkan::RHI::create");
+        const VkAllocationCallbacks* allocator = VKING_Platform_Vulkan_CreateAllocationCallbacks();
+        std::unique_ptr<RHI> rhi(new RHI());
+
+        // === Instance ===
+        {
+            VKING_PROFILE_SCOPE("Vulkan::createInstance");
+            uint32_t count = 0;
+            if (vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr) != VK_SUCCESS) {
+                VulkanLogger::record().error("No Vulkan loader, or it cannot list instance extensions.");
+                return nullptr;
+            }
+            std::vector<VkExtensionProperties> available(count);
+            vkEnumerateInstanceExtensionProperties(nullptr, &count, available.data());
+
+            std::vector<const char*> extensions;
+            for (const char* extension : SURFACE_EXTENSIONS) {
+                if (contains(available, extension)) extensions.push_back(extension);
+            }
+            VkInstanceCreateFlags flags = 0;
+            if (contains(available, PORTABILITY_ENUMERATION_EXTENSION)) {
+                // Lists MoltenVK and other portability drivers too
+                extensions.push_back(PORTABILITY_ENUMERATION_EXTENSION);
+                flags |= VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR;
+            }
+
+            std::vector<const char*> layers;
+            if (createInfo.validation) {
+                uint32_t layerCount = 0;
+                vkEnumerateInstanceLayerProperties(&layerCount, nullptr);
+                std::vector<VkLayerProperties> availableLayers(layerCount);
+                vkEnumerateInstanceLayerProperties(&layerCount, availableLayers.data());
+                if (std::ranges::any_of(availableLayers, [](const VkLayerProperties& layer) { return std::strcmp(layer.layerName, VALIDATION_LAYER) == 0; })) {
+                    layers.push_back(VALIDATION_LAYER);
+                } else {
+                    VulkanLogger::record().warn("Validation was requested, but {} is not installed.", VALIDATION_LAYER);
+                }
+            }
+
+            VkApplicationInfo applicationInfo{};
+            applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+            applicationInfo.pApplicationName = createInfo.applicationName.c_str();
+            applicationInfo.applicationVersion = VK_MAKE_API_VERSION(0, 1, 0, 0);
+            applicationInfo.pEngineName = "VKING";
+            applicationInfo.engineVersion = VK_MAKE_API_VERSION(0, 1, 0, 0);
+            applicationInfo.apiVersion = VK_API_VERSION_1_2;
+
+            VkInstanceCreateInfo instanceInfo{};
+            instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+            instanceInfo.flags = flags;
+            instanceInfo.pApplicationInfo = &applicationInfo;
+            instanceInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+            instanceInfo.ppEnabledExtensionNames = extensions.data();
+            instanceInfo.enabledLayerCount = static_cast<uint32_t>(layers.size());
+            instanceInfo.ppEnabledLayerNames = layers.data();
+
+            if (const VkResult result = vkCreateInstance(&instanceInfo, allocator, &rhi->m_Instance); result != VK_SUCCESS) {
+                VulkanLogger::record().error("vkCreateInstance failed with VkResult {}.", static_cast<int32_t>(result));
+                rhi->m_Instance = VK_NULL_HANDLE;
+                return nullptr;
+            }
+            VulkanLogger::record().debug("Vulkan instance created with {} extensions and {} layers.", extensions.size(), layers.size());
+        }
+
+        // === Physical device ===
+        {
+            VKING_PROFILE_SCOPE("Vulkan::selectPhysicalDevice");
+            uint32_t count = 0;
+            vkEnumeratePhysicalDevices(rhi->m_Instance, &count, nullptr);
+            std::vector<VkPhysicalDevice> devices(count);
+            vkEnumeratePhysicalDevices(rhi->m_Instance, &count, devices.data());
+
+            uint32_t bestScore = 0;
+            for (const VkPhysicalDevice device : devices) {
+                const std::optional<uint32_t> family = findGraphicsQueueFamily(device);
+                if (!family) continue;
+                VkPhysicalDeviceProperties properties{};
+                vkGetPhysicalDeviceProperties(device, &properties);
+                const uint32_t score = scoreDeviceType(properties.deviceType) + 1;
+                VulkanLogger::record().debug("Found {} (type {}).", properties.deviceName, static_cast<int32_t>(properties.deviceType));
+                if (score > bestScore) {
+                    bestScore = score;
+                    rhi->m_PhysicalDevice = device;
+                    rhi->m_GraphicsQueueFamily = *family;
+                    rhi->m_DeviceName = properties.deviceName;
+                }
+            }
+            if (rhi->m_PhysicalDevice == VK_NULL_HANDLE) {
+                VulkanLogger::record().error("None of the {} Vulkan devices has a graphics queue.", count);
+                return nullptr;
+            }
+        }
+
+        // === Logical device ===
+        {
+            VKING_PROFILE_SCOPE("Vulkan::createDevice");
+            uint32_t count = 0;
+            vkEnumerateDeviceExtensionProperties(rhi->m_PhysicalDevice, nullptr, &count, nullptr);
+            std::vector<VkExtensionProperties> available(count);
+            vkEnumerateDeviceExtensionProperties(rhi->m_PhysicalDevice, nullptr, &count, available.data());
+
+            std::vector<const char*> extensions;
+            rhi->m_SwapchainSupported = contains(available, SWAPCHAIN_EXTENSION);
+            if (rhi->m_SwapchainSupported) extensions.push_back(SWAPCHAIN_EXTENSION);
+            // Required whenever a portability driver offers it
+            if (contains(available, PORTABILITY_SUBSET_EXTENSION)) extensions.push_back(PORTABILITY_SUBSET_EXTENSION);
+
+            const float priority = 1.0f;
+            VkDeviceQueueCreateInfo queueInfo{};
+            queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            queueInfo.queueFamilyIndex = rhi->m_GraphicsQueueFamily;
+            queueInfo.queueCount = 1;
+            queueInfo.pQueuePriorities = &priority;
+
+            VkDeviceCreateInfo deviceInfo{};
+            deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+            deviceInfo.queueCreateInfoCount = 1;
+            deviceInfo.pQueueCreateInfos = &queueInfo;
+            deviceInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+            deviceInfo.ppEnabledExtensionNames = extensions.data();
+
+            if (const VkResult result = vkCreateDevice(rhi->m_PhysicalDevice, &deviceInfo, allocator, &rhi->m_Device); result != VK_SUCCESS) {
+                VulkanLogger::record().error("vkCreateDevice failed on {} with VkResult {}.", rhi->m_DeviceName, static_cast<int32_t>(result));
+                rhi->m_Device = VK_NULL_HANDLE;
+                return nullptr;
+            }
+            vkGetDeviceQueue(rhi->m_Device, rhi->m_GraphicsQueueFamily, 0, &rhi->m_GraphicsQueue);
+        }
+
+        // === Presentation ===
+        {
+            VKING_PROFILE_SCOPE("Vulkan::createFrameResources");
+            VkCommandPoolCreateInfo poolInfo{};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+            poolInfo.queueFamilyIndex = rhi->m_GraphicsQueueFamily;
+            if (vkCreateCommandPool(rhi->m_Device, &poolInfo, allocator, &rhi->m_CommandPool) != VK_SUCCESS) {
+                VulkanLogger::record().error("vkCreateCommandPool failed on {}.", rhi->m_DeviceName);
+                rhi->m_CommandPool = VK_NULL_HANDLE;
+                return nullptr;
+            }
+
+            VkCommandBufferAllocateInfo bufferInfo{};
+            bufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            bufferInfo.commandPool = rhi->m_CommandPool;
+            bufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            bufferInfo.commandBufferCount = FRAMES_IN_FLIGHT;
+            if (vkAllocateCommandBuffers(rhi->m_Device, &bufferInfo, rhi->m_CommandBuffers.data()) != VK_SUCCESS) {
+                VulkanLogger::record().error("vkAllocateCommandBuffers failed on {}.", rhi->m_DeviceName);
+                return nullptr;
+            }
+
+            VkFenceCreateInfo fenceInfo{};
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+            for (VkFence& fence : rhi->m_FrameFences) {
+                if (vkCreateFence(rhi->m_Device, &fenceInfo, allocator, &fence) != VK_SUCCESS) {
+                    VulkanLogger::record().error("vkCreateFence failed on {}.", rhi->m_DeviceName);
+                    fence = VK_NULL_HANDLE;
+                    return nullptr;
+                }
+            }
+        }
+
+        VulkanLogger::record().info("Vulkan device {} created, graphics queue family {}.", rhi->m_DeviceName, rhi->m_GraphicsQueueFamily);
+        return rhi;
+    }
+
+    RHI::~RHI() {
+        VKING_PROFILE_SCOPE("Vulkan::RHI::~RHI");
+        const VkAllocationCallbacks* allocator = VKING_Platform_Vulkan_CreateAllocationCallbacks();
+        if (m_Device != VK_NULL_HANDLE) {
+            vkDeviceWaitIdle(m_Device);
+            for (const VkFence fence : m_FrameFences) {
+                if (fence != VK_NULL_HANDLE) vkDestroyFence(m_Device, fence, allocator);
+            }
+            // Frees the command buffers with it
+            if (m_CommandPool != VK_NULL_HANDLE) vkDestroyCommandPool(m_Device, m_CommandPool, allocator);
+            vkDestroyDevice(m_Device, allocator);
+        }
+        if (m_Instance != VK_NULL_HANDLE) vkDestroyInstance(m_Instance, allocator);
+    }
+
+    uint32_t RHI::present(const std::span<Types::Platform::Swapchain* const> swapchains) {
+        VKING_PROFILE_SCOPE("Vulkan::RHI::present");
+        if (swapchains.empty()) return 0;
+
+        // The slot's previous batch must be finished before its command buffer and acquire semaphores are reused
+        const uint32_t slot = m_FrameSlot;
+        {
+            VKING_PROFILE_SCOPE("Vulkan::waitForFrameFence");
+            vkWaitForFences(m_Device, 1, &m_FrameFences[slot], VK_TRUE, UINT64_MAX);
+        }
+
+        // === Acquire ===
+        struct Frame {
+            Swapchain* swapchain;
+            uint32_t imageIndex;
+        };
+        std::vector<Frame> frames;
+        frames.reserve(swapchains.size());
+        for (Types::Platform::Swapchain* base : swapchains) {
+            // Only this RHI's platform manager creates the swapchains it is given
+            auto* swapchain = static_cast<Swapchain*>(base);
+            swapchain->checkFramebufferSize();
+            if (swapchain->isOutOfDate() && !swapchain->recreate()) continue;
+            // Left without one when replacing it after a failed submit did not work out
+            if (swapchain->getAcquireSemaphore(slot) == VK_NULL_HANDLE && !swapchain->resetAcquireSemaphore(slot)) continue;
+
+            // Never block here: a window without a free image sits this batch out
+            uint32_t imageIndex = 0;
+            const VkResult result = vkAcquireNextImageKHR(m_Device, swapchain->getHandle(), 0, swapchain->getAcquireSemaphore(slot),
+                                                          VK_NULL_HANDLE, &imageIndex);
+            if (result == VK_SUBOPTIMAL_KHR || result == VK_ERROR_OUT_OF_DATE_KHR) swapchain->markOutOfDate();
+            if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) continue;
+            frames.push_back({swapchain, imageIndex});
+        }
+        if (frames.empty()) return 0;
+
+        // === Record ===
+        // Until there is a renderer a frame is a clear, with the layout transitions of every window in one barrier each
+        const VkCommandBuffer commandBuffer = m_CommandBuffers[slot];
+        vkResetCommandBuffer(commandBuffer, 0);
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+        VkImageSubresourceRange range{};
+        range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        range.levelCount = 1;
+        range.layerCount = 1;
+
+        std::vector<VkImageMemoryBarrier> toTransfer(frames.size());
+        std::vector<VkImageMemoryBarrier> toPresent(frames.size());
+        for (size_t i = 0; i < frames.size(); i++) {
+            VkImageMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = frames[i].swapchain->getImage(frames[i].imageIndex);
+            barrier.subresourceRange = range;
+
+            toTransfer[i] = barrier;
+            toTransfer[i].srcAccessMask = 0;
+            toTransfer[i].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            toTransfer[i].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            toTransfer[i].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+
+            toPresent[i] = barrier;
+            toPresent[i].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            toPresent[i].dstAccessMask = 0;
+            toPresent[i].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            toPresent[i].newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        }
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr,
+                             static_cast<uint32_t>(toTransfer.size()), toTransfer.data());
+        for (const Frame& frame : frames) {
+            const Types::Platform::Swapchain::ClearColor& color = frame.swapchain->getClearColor();
+            const VkClearColorValue clearValue{{color.red, color.green, color.blue, color.alpha}};
+            vkCmdClearColorImage(commandBuffer, frame.swapchain->getImage(frame.imageIndex), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                 &clearValue, 1, &range);
+        }
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr,
+                             static_cast<uint32_t>(toPresent.size()), toPresent.data());
+        vkEndCommandBuffer(commandBuffer);
+
+        // === Submit ===
+        std::vector<VkSemaphore> waitSemaphores;
+        std::vector<VkPipelineStageFlags> waitStages;
+        std::vector<VkSemaphore> signalSemaphores;
+        std::vector<VkSwapchainKHR> handles;
+        std::vector<uint32_t> imageIndices;
+        for (const Frame& frame : frames) {
+            waitSemaphores.push_back(frame.swapchain->getAcquireSemaphore(slot));
+            waitStages.push_back(VK_PIPELINE_STAGE_TRANSFER_BIT);
+            signalSemaphores.push_back(frame.swapchain->getPresentSemaphore(frame.imageIndex));
+            handles.push_back(frame.swapchain->getHandle());
+            imageIndices.push_back(frame.imageIndex);
+        }
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
+        submitInfo.pWaitSemaphores = waitSemaphores.data();
+        submitInfo.pWaitDstStageMask = waitStages.data();
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+        submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
+        submitInfo.pSignalSemaphores = signalSemaphores.data();
+
+        vkResetFences(m_Device, 1, &m_FrameFences[slot]);
+        if (const VkResult result = vkQueueSubmit(m_GraphicsQueue, 1, &submitInfo, m_FrameFences[slot]); result != VK_SUCCESS) {
+            VulkanLogger::record().error("vkQueueSubmit of {} window frames failed with VkResult {}.", frames.size(), static_cast<int32_t>(result));
+            // Nothing waited on the acquire semaphores, so they stay signaled and the slot's next acquire could not
+            // use them. They are replaced once the device is idle, and each swapchain is rebuilt on its next
+            // present to get back the image it acquired but will never present
+            vkDeviceWaitIdle(m_Device);
+            for (const Frame& frame : frames) {
+                frame.swapchain->resetAcquireSemaphore(slot);
+                frame.swapchain->markOutOfDate();
+            }
+            // Signal the fence anyway, so the next wait on this slot does not hang
+            vkQueueSubmit(m_GraphicsQueue, 0, nullptr, m_FrameFences[slot]);
+            return 0;
+        }
+
+        // === Present ===
+        std::vector<VkResult> results(frames.size(), VK_SUCCESS);
+        VkPresentInfoKHR presentInfo{};
+        presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        presentInfo.waitSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
+        presentInfo.pWaitSemaphores = signalSemaphores.data();
+        presentInfo.swapchainCount = static_cast<uint32_t>(handles.size());
+        presentInfo.pSwapchains = handles.data();
+        presentInfo.pImageIndices = imageIndices.data();
+        presentInfo.pResults = results.data();
+        {
+            VKING_PROFILE_SCOPE("Vulkan::vkQueuePresentKHR");
+            vkQueuePresentKHR(m_GraphicsQueue, &presentInfo);
+        }
+        m_FrameSlot = (slot + 1) % FRAMES_IN_FLIGHT;
+
+        uint32_t presented = 0;
+        for (size_t i = 0; i < frames.size(); i++) {
+            if (results[i] == VK_SUBOPTIMAL_KHR || results[i] == VK_ERROR_OUT_OF_DATE_KHR) frames[i].swapchain->markOutOfDate();
+            if (results[i] == VK_SUCCESS || results[i] == VK_SUBOPTIMAL_KHR) presented++;
+        }
+        return presented;
+    }
+
+}
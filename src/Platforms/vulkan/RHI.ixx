@@ -0,0 +1,112 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+#include <vulkan/vulkan.h>
+
+export module VKING.Platform.Vulkan:RHI;
+
+import VKING.Types.Platform;
+
+namespace VKING::Platform::Vulkan {
+
+    /**
+     * @brief Vulkan instance, the chosen physical device, its logical device and graphics queue.
+     *
+     * Needs no window: every surface extension the loader offers is enabled on the instance, so a surface for
+     * whichever window system the platform picks can be created later. Presentation support of the queue is
+     * checked when that surface exists.
+     *
+     * Every window's Swapchain shares this device. present() records all of their frames into one command buffer
+     * and hands them to one vkQueueSubmit and one vkQueuePresentKHR, with a fence per frame in flight for the whole
+     * batch instead of one per window.
+     */
+    export class RHI final : public Types::Platform::RHI {
+    public:
+        /// Batches recorded while the GPU may still be working on earlier ones
+        static constexpr uint32_t FRAMES_IN_FLIGHT = 2;
+
+        struct CreateInfo {
+            std::string applicationName = "VKING";
+            /// Enables VK_LAYER_KHRONOS_validation when it is installed
+            bool validation = false;
+        };
+
+        /**
+         * @return The RHI, or nullptr (logged) if there is no Vulkan loader or no device with a graphics queue
+         */
+        static std::unique_ptr<RHI> create(const CreateInfo& createInfo);
+
+        ~RHI() override;
+
+        RHI(const RHI&) = delete;
+        RHI& operator=(const RHI&) = delete;
+
+        [[nodiscard]] std::string getDeviceName() const override { return m_DeviceName; }
+
+        /**
+         * @brief Acquires an image from each swapchain without waiting, clears it to the swapchain's clear colour and
+         *        presents all of them at once. See Types::Platform::RHI::present().
+         */
+        uint32_t present(std::span<Types::Platform::Swapchain* const> swapchains) override;
+
+        /**
+         * @return Whether the device has VK_KHR_swapchain, without it no window can be presented to
+         */
+        [[nodiscard]] bool supportsSwapchains() const { return m_SwapchainSupported; }
+
+        /**
+         * @return Index of the batch present() records next, below FRAMES_IN_FLIGHT
+         */
+        [[nodiscard]] uint32_t getFrameSlot() const { return m_FrameSlot; }
+
+        [[nodiscard]] VkInstance getInstance() const { return m_Instance; }
+        [[nodiscard]] VkPhysicalDevice getPhysicalDevice() const { return m_PhysicalDevice; }
+        [[nodiscard]] VkDevice getDevice() const { return m_Device; }
+        [[nodiscard]] VkQueue getGraphicsQueue() const { return m_GraphicsQueue; }
+        [[nodiscard]] uint32_t getGraphicsQueueFamily() const { return m_GraphicsQueueFamily; }
+
+    private:
+        RHI() = default;
+
+        VkInstance m_Instance = VK_NULL_HANDLE;
+        VkPhysicalDevice m_PhysicalDevice = VK_NULL_HANDLE;
+        VkDevice m_Device = VK_NULL_HANDLE;
+        VkQueue m_GraphicsQueue = VK_NULL_HANDLE;
+        uint32_t m_GraphicsQueueFamily = 0;
+        std::string m_DeviceName;
+        bool m_SwapchainSupported = false;
+
+        // === Presentation ===
+        VkCommandPool m_CommandPool = VK_NULL_HANDLE;
+        std::array<VkCommandBuffer, FRAMES_IN_FLIGHT> m_CommandBuffers{};
+        /// Signalled when the batch of that slot is done on the GPU, created signalled
+        std::array<VkFence, FRAMES_IN_FLIGHT> m_FrameFences{};
+        uint32_t m_FrameSlot = 0;
+    };
+
+}
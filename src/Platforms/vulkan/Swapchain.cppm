@@ -0,0 +1,225 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include <VKING/Profiler.hpp>
+
+module VKING.Platform.Vulkan:SwapchainImpl;
+import :Swapchain;
+import :RHI;
+import :Callbacks;
+import VKING.Log;
+import VKING.Types.Window;
+
+namespace VKING::Platform::Vulkan {
+
+    namespace {
+
+        using VulkanLogger = Log::Named<"Vulkan">;
+
+        VkSurfaceFormatKHR chooseSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& formats) {
+            for (const VkSurfaceFormatKHR& format : formats) {
+                if ((format.format == VK_FORMAT_B8G8R8A8_SRGB || format.format == VK_FORMAT_R8G8B8A8_SRGB) &&
+                    format.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
+                    return format;
+                }
+            }
+            return formats.front();
+        }
+
+        VkCompositeAlphaFlagBitsKHR chooseCompositeAlpha(const VkCompositeAlphaFlagsKHR supported) {
+            for (const VkCompositeAlphaFlagBitsKHR alpha : {VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR, VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR,
+                                                            VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR, VK_COMPOSITE_ALPHA_POST_MULTIPLIED_BIT_KHR}) {
+                if (supported & alpha) return alpha;
+            }
+            return VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+        }
+
+    }
+
+    std::unique_ptr<Swapchain> Swapchain::create(RHI& rhi, const VkSurfaceKHR surface, const Types::Window& window) {
+        VKING_PROFILE_SCOPE("Vulkan::Swapchain::create");
+        // Owns the surface from here on, so every failure below cleans it up
+        std::unique_ptr<Swapchain> swapchain(new Swapchain(rhi, surface, window));
+
+        if (!rhi.supportsSwapchains()) {
+            VulkanLogger::record().error("{} does not support VK_KHR_swapchain, windows cannot be presented to.", rhi.getDeviceName());
+            return nullptr;
+        }
+        VkBool32 presentSupported = VK_FALSE;
+        vkGetPhysicalDeviceSurfaceSupportKHR(rhi.getPhysicalDevice(), rhi.getGraphicsQueueFamily(), surface, &presentSupported);
+        if (!presentSupported) {
+            VulkanLogger::record().error("The graphics queue of {} cannot present to this window's surface.", rhi.getDeviceName());
+            return nullptr;
+        }
+
+        const VkAllocationCallbacks* allocator = VKING_Platform_Vulkan_CreateAllocationCallbacks();
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        for (VkSemaphore& semaphore : swapchain->m_AcquireSemaphores) {
+            if (vkCreateSemaphore(rhi.getDevice(), &semaphoreInfo, allocator, &semaphore) != VK_SUCCESS) {
+                semaphore = VK_NULL_HANDLE;
+                VulkanLogger::record().error("vkCreateSemaphore failed for a swapchain.");
+                return nullptr;
+            }
+        }
+
+        // A minimized window has no extent yet, it is built on its first present once it has one
+        if (!swapchain->build()) swapchain->markOutOfDate();
+        return swapchain;
+    }
+
+    Swapchain::~Swapchain() {
+        VKING_PROFILE_SCOPE("Vulkan::Swapchain::~Swapchain");
+        const VkAllocationCallbacks* allocator = VKING_Platform_Vulkan_CreateAllocationCallbacks();
+        const VkDevice device = m_RHI.getDevice();
+
+        // The batch presenting to it may still be in flight
+        vkQueueWaitIdle(m_RHI.getGraphicsQueue());
+        for (const VkSemaphore semaphore : m_PresentSemaphores) vkDestroySemaphore(device, semaphore, allocator);
+        for (const VkSemaphore semaphore : m_AcquireSemaphores) {
+            if (semaphore != VK_NULL_HANDLE) vkDestroySemaphore(device, semaphore, allocator);
+        }
+        if (m_Swapchain != VK_NULL_HANDLE) vkDestroySwapchainKHR(device, m_Swapchain, allocator);
+        if (m_Surface != VK_NULL_HANDLE) vkDestroySurfaceKHR(m_RHI.getInstance(), m_Surface, allocator);
+    }
+
+    bool Swapchain::recreate() {
+        VKING_PROFILE_SCOPE("Vulkan::Swapchain::recreate");
+        // Old images and semaphores are retired below, nothing may still be using them
+        vkQueueWaitIdle(m_RHI.getGraphicsQueue());
+        if (!build()) return false;
+        m_OutOfDate = false;
+        return true;
+    }
+
+    bool Swapchain::resetAcquireSemaphore(const uint32_t frameSlot) {
+        const VkAllocationCallbacks* allocator = VKING_Platform_Vulkan_CreateAllocationCallbacks();
+        const VkDevice device = m_RHI.getDevice();
+
+        VkSemaphore& semaphore = m_AcquireSemaphores[frameSlot];
+        if (semaphore != VK_NULL_HANDLE) vkDestroySemaphore(device, semaphore, allocator);
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        if (vkCreateSemaphore(device, &semaphoreInfo, allocator, &semaphore) != VK_SUCCESS) {
+            semaphore = VK_NULL_HANDLE;
+            VulkanLogger::record().error("vkCreateSemaphore failed while replacing an acquire semaphore.");
+            return false;
+        }
+        return true;
+    }
+
+    bool Swapchain::build() {
+        const VkAllocationCallbacks* allocator = VKING_Platform_Vulkan_CreateAllocationCallbacks();
+        const VkDevice device = m_RHI.getDevice();
+        const VkPhysicalDevice physicalDevice = m_RHI.getPhysicalDevice();
+
+        VkSurfaceCapabilitiesKHR capabilities{};
+        vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, m_Surface, &capabilities);
+
+        // What checkFramebufferSize() compares against to notice resizes the surface does not report
+        m_BuiltFramebufferSize = m_Window.getFramebufferSize();
+        const auto [width, height] = m_BuiltFramebufferSize;
+
+        VkExtent2D extent = capabilities.currentExtent;
+        if (extent.width == UINT32_MAX) {
+            // The surface takes the swapchain's size, which follows the window
+            extent.width = std::clamp(width, capabilities.minImageExtent.width, capabilities.maxImageExtent.width);
+            extent.height = std::clamp(height, capabilities.minImageExtent.height, capabilities.maxImageExtent.height);
+        }
+        if (extent.width == 0 || extent.height == 0) return false;
+
+        if (!(capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT)) {
+            VulkanLogger::record().error("Swapchain images of this surface cannot be cleared, VK_IMAGE_USAGE_TRANSFER_DST_BIT is unsupported.");
+            return false;
+        }
+
+        uint32_t formatCount = 0;
+        vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, m_Surface, &formatCount, nullptr);
+        std::vector<VkSurfaceFormatKHR> formats(formatCount);
+        vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, m_Surface, &formatCount, formats.data());
+        if (formats.empty()) {
+            VulkanLogger::record().error("The surface reports no formats.");
+            return false;
+        }
+        const VkSurfaceFormatKHR format = chooseSurfaceFormat(formats);
+
+        // One more than the minimum so acquiring rarely finds every image in use
+        uint32_t imageCount = capabilities.minImageCount + 1;
+        if (capabilities.maxImageCount != 0) imageCount = std::min(imageCount, capabilities.maxImageCount);
+
+        VkSwapchainCreateInfoKHR createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+        createInfo.surface = m_Surface;
+        createInfo.minImageCount = imageCount;
+        createInfo.imageFormat = format.format;
+        createInfo.imageColorSpace = format.colorSpace;
+        createInfo.imageExtent = extent;
+        createInfo.imageArrayLayers = 1;
+        createInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        createInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.preTransform = capabilities.currentTransform;
+        createInfo.compositeAlpha = chooseCompositeAlpha(capabilities.supportedCompositeAlpha);
+        // Always available, and paces each window to its display without blocking the others
+        createInfo.presentMode = VK_PRESENT_MODE_FIFO_KHR;
+        createInfo.clipped = VK_TRUE;
+        createInfo.oldSwapchain = m_Swapchain;
+
+        VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+        if (const VkResult result = vkCreateSwapchainKHR(device, &createInfo, allocator, &swapchain); result != VK_SUCCESS) {
+            VulkanLogger::record().error("vkCreateSwapchainKHR failed with VkResult {}.", static_cast<int32_t>(result));
+            return false;
+        }
+        if (m_Swapchain != VK_NULL_HANDLE) vkDestroySwapchainKHR(device, m_Swapchain, allocator);
+        m_Swapchain = swapchain;
+        m_Format = format.format;
+        m_Extent = extent;
+
+        uint32_t count = 0;
+        vkGetSwapchainImagesKHR(device, m_Swapchain, &count, nullptr);
+        m_Images.resize(count);
+        vkGetSwapchainImagesKHR(device, m_Swapchain, &count, m_Images.data());
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        for (const VkSemaphore semaphore : m_PresentSemaphores) vkDestroySemaphore(device, semaphore, allocator);
+        m_PresentSemaphores.assign(count, VK_NULL_HANDLE);
+        for (VkSemaphore& semaphore : m_PresentSemaphores) {
+            if (vkCreateSemaphore(device, &semaphoreInfo, allocator, &semaphore) != VK_SUCCESS) {
+                VulkanLogger::record().error("vkCreateSemaphore failed for a swapchain image.");
+                semaphore = VK_NULL_HANDLE;
+                return false;
+            }
+        }
+
+        VulkanLogger::record().debug("Swapchain built: {}x{}, {} images, format {}.", extent.width, extent.height, count, static_cast<int32_t>(format.format));
+        return true;
+    }
+
+}
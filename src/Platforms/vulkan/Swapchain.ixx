@@ -0,0 +1,113 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+export module VKING.Platform.Vulkan:Swapchain;
+
+import VKING.Types.Platform;
+import VKING.Types.Window;
+import :RHI;
+
+namespace VKING::Platform::Vulkan {
+
+    /**
+     * @brief A window's VkSurfaceKHR and the VkSwapchainKHR presenting to it, on the device of the RHI that created it.
+     *
+     * Only what is per window lives here: the images, a semaphore per frame in flight to acquire them and one per
+     * image to present them. Recording, submission and presentation are batched across windows by RHI::present().
+     */
+    export class Swapchain final : public Types::Platform::Swapchain {
+    public:
+        /**
+         * @param surface Owned by the swapchain from here on, also when creation fails
+         * @param window The window the surface belongs to, which must outlive the swapchain. Its framebuffer size is
+         *               used when the surface does not dictate one
+         * @return The swapchain, or nullptr (logged) if the graphics queue cannot present to the surface
+         */
+        static std::unique_ptr<Swapchain> create(RHI& rhi, VkSurfaceKHR surface, const Types::Window& window);
+
+        ~Swapchain() override;
+
+        Swapchain(const Swapchain&) = delete;
+        Swapchain& operator=(const Swapchain&) = delete;
+
+        /**
+         * @brief Marks the swapchain out of date if the window's framebuffer size changed since it was built.
+         *
+         * Surfaces that take their size from the swapchain (Wayland) never report themselves out of date on a resize.
+         */
+        void checkFramebufferSize() {
+            if (m_Window.getFramebufferSize() != m_BuiltFramebufferSize) m_OutOfDate = true;
+        }
+
+        /**
+         * @brief Rebuilds the swapchain for the surface's current size, waiting for the queue to go idle first.
+         *
+         * @return false while the window has no area (minimized) or the rebuild failed, the swapchain stays out of date
+         */
+        bool recreate();
+
+        /**
+         * @brief Replaces the acquire semaphore of a frame slot, for when its signal was never waited on.
+         *
+         * The device must be idle. On failure the slot is left without a semaphore and the next present retries.
+         *
+         * @return false (logged) if no new semaphore could be created
+         */
+        bool resetAcquireSemaphore(uint32_t frameSlot);
+
+        void markOutOfDate() { m_OutOfDate = true; }
+        [[nodiscard]] bool isOutOfDate() const { return m_OutOfDate; }
+
+        [[nodiscard]] VkSwapchainKHR getHandle() const { return m_Swapchain; }
+        [[nodiscard]] VkExtent2D getExtent() const { return m_Extent; }
+        [[nodiscard]] VkFormat getFormat() const { return m_Format; }
+        [[nodiscard]] VkImage getImage(const uint32_t imageIndex) const { return m_Images[imageIndex]; }
+        [[nodiscard]] VkSemaphore getAcquireSemaphore(const uint32_t frameSlot) const { return m_AcquireSemaphores[frameSlot]; }
+        [[nodiscard]] VkSemaphore getPresentSemaphore(const uint32_t imageIndex) const { return m_PresentSemaphores[imageIndex]; }
+
+    private:
+        Swapchain(RHI& rhi, VkSurfaceKHR surface, const Types::Window& window) : m_RHI(rhi), m_Window(window), m_Surface(surface) {}
+
+        /// (Re)creates the VkSwapchainKHR at the window's framebuffer size, retiring the previous one, and the per image semaphores
+        bool build();
+
+        RHI& m_RHI;
+        const Types::Window& m_Window;
+        Types::Window::FramebufferSize m_BuiltFramebufferSize;
+        VkSurfaceKHR m_Surface = VK_NULL_HANDLE;
+        VkSwapchainKHR m_Swapchain = VK_NULL_HANDLE;
+        VkFormat m_Format = VK_FORMAT_UNDEFINED;
+        VkExtent2D m_Extent{};
+        std::vector<VkImage> m_Images;
+        std::array<VkSemaphore, RHI::FRAMES_IN_FLIGHT> m_AcquireSemaphores{};
+        std::vector<VkSemaphore> m_PresentSemaphores;
+        bool m_OutOfDate = false;
+    };
+
+}
@@ -22,4 +22,7 @@
 
 export module VKING.Platform.Vulkan;
 
-export import :Callbacks;
\ No newline at end of file
+export import :Callbacks;
+export import :RHI;
+export import :Swapchain;
+export import :Probe;
\ No newline at end of file
@@ -0,0 +1,382 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <unordered_map>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include <wayland-client.h>
+#include "xdg-shell-client-protocol.h"
+#include "presentation-time-client-protocol.h"
+#include "viewporter-client-protocol.h"
+#include "fractional-scale-v1-client-protocol.h"
+
+#include <VKING/Profiler.hpp>
+
+module VKING.Platform.Wayland:DisplayImpl;
+import :Display;
+import :Logger;
+import VKING.Types.Window;
+
+namespace VKING::Platform::Wayland {
+
+    /**
+     * @brief The listeners of the globals and the seat, friends of Display so they can fill it in.
+     */
+    struct DisplayListeners {
+
+        // === Registry ===
+
+        static void global(void* data, wl_registry* registry, const uint32_t name, const char* interface, const uint32_t version) {
+            auto* display = static_cast<Display*>(data);
+            // Bound at the highest version whose events are all handled here, never above what the compositor has
+            if (std::strcmp(interface, wl_compositor_interface.name) == 0) {
+                display->m_Compositor = static_cast<wl_compositor*>(wl_registry_bind(registry, name, &wl_compositor_interface, std::min(version, 4u)));
+            } else if (std::strcmp(interface, xdg_wm_base_interface.name) == 0) {
+                display->m_WindowManager = static_cast<xdg_wm_base*>(wl_registry_bind(registry, name, &xdg_wm_base_interface, std::min(version, 2u)));
+                xdg_wm_base_add_listener(display->m_WindowManager, &WINDOW_MANAGER, display);
+            } else if (std::strcmp(interface, wp_presentation_interface.name) == 0) {
+                display->m_Presentation = static_cast<wp_presentation*>(wl_registry_bind(registry, name, &wp_presentation_interface, 1));
+                wp_presentation_add_listener(display->m_Presentation, &PRESENTATION, display);
+            } else if (std::strcmp(interface, wp_viewporter_interface.name) == 0) {
+                display->m_Viewporter = static_cast<wp_viewporter*>(wl_registry_bind(registry, name, &wp_viewporter_interface, 1));
+            } else if (std::strcmp(interface, wp_fractional_scale_manager_v1_interface.name) == 0) {
+                display->m_FractionalScaleManager = static_cast<wp_fractional_scale_manager_v1*>(
+                    wl_registry_bind(registry, name, &wp_fractional_scale_manager_v1_interface, 1));
+            } else if (std::strcmp(interface, wl_seat_interface.name) == 0 && !display->m_Seat) {
+                // Only the first seat, a game has one set of keyboard and mouse
+                display->m_SeatVersion = std::min(version, 5u);
+                display->m_Seat = static_cast<wl_seat*>(wl_registry_bind(registry, name, &wl_seat_interface, display->m_SeatVersion));
+                wl_seat_add_listener(display->m_Seat, &SEAT, display);
+            }
+        }
+
+        static void globalRemove(void*, wl_registry*, uint32_t) {}
+
+        static constexpr wl_registry_listener REGISTRY{.global = global, .global_remove = globalRemove};
+
+        // === Globals ===
+
+        static void ping(void*, xdg_wm_base* windowManager, const uint32_t serial) {
+            xdg_wm_base_pong(windowManager, serial);
+        }
+
+        static constexpr xdg_wm_base_listener WINDOW_MANAGER{.ping = ping};
+
+        static void presentationClock(void* data, wp_presentation*, const uint32_t clock) {
+            static_cast<Display*>(data)->m_PresentationClock = static_cast<clockid_t>(clock);
+        }
+
+        static constexpr wp_presentation_listener PRESENTATION{.clock_id = presentationClock};
+
+        // === Seat ===
+
+        static void capabilities(void* data, wl_seat* seat, const uint32_t capabilities) {
+            auto* display = static_cast<Display*>(data);
+            const bool pointer = capabilities & WL_SEAT_CAPABILITY_POINTER;
+            const bool keyboard = capabilities & WL_SEAT_CAPABILITY_KEYBOARD;
+
+            if (pointer && !display->m_Pointer) {
+                display->m_Pointer = wl_seat_get_pointer(seat);
+                wl_pointer_add_listener(display->m_Pointer, &POINTER, display);
+            } else if (!pointer && display->m_Pointer) {
+                display->releasePointer();
+            }
+            if (keyboard && !display->m_Keyboard) {
+                display->m_Keyboard = wl_seat_get_keyboard(seat);
+                wl_keyboard_add_listener(display->m_Keyboard, &KEYBOARD, display);
+            } else if (!keyboard && display->m_Keyboard) {
+                display->releaseKeyboard();
+            }
+        }
+
+        static void seatName(void*, wl_seat*, const char*) {}
+
+        static constexpr wl_seat_listener SEAT{.capabilities = capabilities, .name = seatName};
+
+        // === Pointer ===
+
+        static void pointerEnter(void* data, wl_pointer*, uint32_t, wl_surface* surface, const wl_fixed_t x, const wl_fixed_t y) {
+            auto* display = static_cast<Display*>(data);
+            display->m_PointerFocus = display->findWindow(surface);
+            if (display->m_PointerFocus) {
+                display->m_PointerFocus->getInputQueue().push({
+                    .type = Types::InputEvent::Type::CURSOR_POSITION, .x = wl_fixed_to_double(x), .y = wl_fixed_to_double(y)
+                });
+            }
+        }
+
+        static void pointerLeave(void* data, wl_pointer*, uint32_t, wl_surface*) {
+            static_cast<Display*>(data)->m_PointerFocus = nullptr;
+        }
+
+        static void pointerMotion(void* data, wl_pointer*, uint32_t, const wl_fixed_t x, const wl_fixed_t y) {
+            if (Types::Window* window = static_cast<Display*>(data)->m_PointerFocus) {
+                window->getInputQueue().push({
+                    .type = Types::InputEvent::Type::CURSOR_POSITION, .x = wl_fixed_to_double(x), .y = wl_fixed_to_double(y)
+                });
+            }
+        }
+
+        static void pointerButton(void* data, wl_pointer*, uint32_t, uint32_t, const uint32_t button, const uint32_t state) {
+            const auto* display = static_cast<Display*>(data);
+            if (Types::Window* window = display->m_PointerFocus) {
+                using Types::InputEvent;
+                window->getInputQueue().push({
+                    .type = InputEvent::Type::MOUSE_BUTTON,
+                    .action = state == WL_POINTER_BUTTON_STATE_PRESSED ? InputEvent::Action::PRESS : InputEvent::Action::RELEASE,
+                    .code = static_cast<int32_t>(button), .modifiers = static_cast<int32_t>(display->m_Modifiers)
+                });
+            }
+        }
+
+        static void pointerAxis(void* data, wl_pointer*, uint32_t, const uint32_t axis, const wl_fixed_t value) {
+            if (Types::Window* window = static_cast<Display*>(data)->m_PointerFocus) {
+                // Compositors send about 10 per wheel notch, positive down. Scaled to notches, positive up, like GLFW
+                const double notches = -wl_fixed_to_double(value) / 10.0;
+                const bool vertical = axis == WL_POINTER_AXIS_VERTICAL_SCROLL;
+                window->getInputQueue().push({
+                    .type = Types::InputEvent::Type::SCROLL, .x = vertical ? 0.0 : notches, .y = vertical ? notches : 0.0
+                });
+            }
+        }
+
+        static void pointerFrame(void*, wl_pointer*) {}
+        static void pointerAxisSource(void*, wl_pointer*, uint32_t) {}
+        static void pointerAxisStop(void*, wl_pointer*, uint32_t, uint32_t) {}
+        static void pointerAxisDiscrete(void*, wl_pointer*, uint32_t, int32_t) {}
+
+        // Filled in member by member, newer protocol headers add events for versions above the one bound
+        static constexpr wl_pointer_listener POINTER = [] {
+            wl_pointer_listener listener{};
+            listener.enter = pointerEnter;
+            listener.leave = pointerLeave;
+            listener.motion = pointerMotion;
+            listener.button = pointerButton;
+            listener.axis = pointerAxis;
+            listener.frame = pointerFrame;
+            listener.axis_source = pointerAxisSource;
+            listener.axis_stop = pointerAxisStop;
+            listener.axis_discrete = pointerAxisDiscrete;
+            return listener;
+        }();
+
+        // === Keyboard ===
+
+        static void keymap(void*, wl_keyboard*, uint32_t, const int32_t fd, uint32_t) {
+            // Codes are passed on untranslated, the keymap is not needed
+            close(fd);
+        }
+
+        static void keyboardEnter(void* data, wl_keyboard*, uint32_t, wl_surface* surface, wl_array*) {
+            auto* display = static_cast<Display*>(data);
+            display->m_KeyboardFocus = display->findWindow(surface);
+            if (display->m_KeyboardFocus) {
+                display->m_KeyboardFocus->getInputQueue().push({.type = Types::InputEvent::Type::FOCUS, .action = Types::InputEvent::Action::PRESS});
+            }
+        }
+
+        static void keyboardLeave(void* data, wl_keyboard*, uint32_t, wl_surface*) {
+            auto* display = static_cast<Display*>(data);
+            if (display->m_KeyboardFocus) {
+                display->m_KeyboardFocus->getInputQueue().push({.type = Types::InputEvent::Type::FOCUS, .action = Types::InputEvent::Action::RELEASE});
+            }
+            display->m_KeyboardFocus = nullptr;
+        }
+
+        static void key(void* data, wl_keyboard*, uint32_t, uint32_t, const uint32_t key, const uint32_t state) {
+            const auto* display = static_cast<Display*>(data);
+            if (Types::Window* window = display->m_KeyboardFocus) {
+                // Released and pressed line up with InputEvent::Action. Repeats are the client's job on Wayland
+                // and are not generated
+                window->getInputQueue().push({
+                    .type = Types::InputEvent::Type::KEY, .action = static_cast<Types::InputEvent::Action>(state),
+                    .code = static_cast<int32_t>(key), .scancode = static_cast<int32_t>(key), .modifiers = static_cast<int32_t>(display->m_Modifiers)
+                });
+            }
+        }
+
+        static void modifiers(void* data, wl_keyboard*, uint32_t, const uint32_t depressed, const uint32_t latched, const uint32_t locked, uint32_t) {
+            static_cast<Display*>(data)->m_Modifiers = depressed | latched | locked;
+        }
+
+        static void repeatInfo(void*, wl_keyboard*, int32_t, int32_t) {}
+
+        static constexpr wl_keyboard_listener KEYBOARD{
+            .keymap = keymap,
+            .enter = keyboardEnter,
+            .leave = keyboardLeave,
+            .key = key,
+            .modifiers = modifiers,
+            .repeat_info = repeatInfo
+        };
+
+    };
+
+    std::shared_ptr<Display> Display::acquire() {
+        // Windows are created on the main thread only, so this needs no lock
+        static std::weak_ptr<Display> s_Display;
+        if (std::shared_ptr<Display> display = s_Display.lock()) return display;
+
+        VKING_PROFILE_SCOPE("Wayland::Display::acquire");
+        std::shared_ptr<Display> display(new Display());
+        if (!display->connect()) return nullptr;
+        s_Display = display;
+        return display;
+    }
+
+    bool Display::connect() {
+        m_Display = wl_display_connect(nullptr);
+        if (!m_Display) {
+            ModuleLogger::record().critical("Could not connect to a Wayland compositor, is WAYLAND_DISPLAY set?");
+            return false;
+        }
+
+        m_Registry = wl_display_get_registry(m_Display);
+        wl_registry_add_listener(m_Registry, &DisplayListeners::REGISTRY, this);
+        // The first roundtrip announces the globals, the second the events they send right after binding
+        // (seat capabilities, presentation clock)
+        if (!roundtrip() || !roundtrip()) return false;
+
+        if (!m_Compositor || !m_WindowManager) {
+            ModuleLogger::record().critical("The Wayland compositor lacks wl_compositor or xdg_wm_base, it cannot show windows.");
+            return false;
+        }
+        ModuleLogger::record().info("Connected to the Wayland compositor: presentation feedback {}, fractional scaling {}.",
+                                    m_Presentation ? "available" : "unavailable",
+                                    m_Viewporter && m_FractionalScaleManager ? "available" : "unavailable");
+        return true;
+    }
+
+    Display::~Display() {
+        VKING_PROFILE_SCOPE("Wayland::Display::~Display");
+        if (!m_Display) return;
+
+        releasePointer();
+        releaseKeyboard();
+        if (m_Seat) {
+            if (m_SeatVersion >= WL_SEAT_RELEASE_SINCE_VERSION) wl_seat_release(m_Seat);
+            else wl_seat_destroy(m_Seat);
+        }
+        if (m_FractionalScaleManager) wp_fractional_scale_manager_v1_destroy(m_FractionalScaleManager);
+        if (m_Viewporter) wp_viewporter_destroy(m_Viewporter);
+        if (m_Presentation) wp_presentation_destroy(m_Presentation);
+        if (m_WindowManager) xdg_wm_base_destroy(m_WindowManager);
+        if (m_Compositor) wl_compositor_destroy(m_Compositor);
+        if (m_Registry) wl_registry_destroy(m_Registry);
+        wl_display_disconnect(m_Display);
+        ModuleLogger::record().debug("Disconnected from the Wayland compositor.");
+    }
+
+    void Display::releasePointer() {
+        if (!m_Pointer) return;
+        if (m_SeatVersion >= WL_POINTER_RELEASE_SINCE_VERSION) wl_pointer_release(m_Pointer);
+        else wl_pointer_destroy(m_Pointer);
+        m_Pointer = nullptr;
+        m_PointerFocus = nullptr;
+    }
+
+    void Display::releaseKeyboard() {
+        if (!m_Keyboard) return;
+        if (m_SeatVersion >= WL_KEYBOARD_RELEASE_SINCE_VERSION) wl_keyboard_release(m_Keyboard);
+        else wl_keyboard_destroy(m_Keyboard);
+        m_Keyboard = nullptr;
+        m_KeyboardFocus = nullptr;
+    }
+
+    void Display::dispatch() {
+        VKING_PROFILE_SCOPE("Wayland::dispatch");
+        pump(0);
+    }
+
+    void Display::wait(const double timeoutSeconds) {
+        VKING_PROFILE_SCOPE("Wayland::wait");
+        pump(timeoutSeconds > 0.0 ? static_cast<int>(std::ceil(timeoutSeconds * 1000.0)) : 0);
+    }
+
+    bool Display::roundtrip() {
+        if (wl_display_roundtrip(m_Display) < 0) {
+            handleConnectionError();
+            return false;
+        }
+        return true;
+    }
+
+    void Display::pump(const int timeoutMilliseconds) {
+        if (m_ConnectionLost) return;
+
+        // The thread safe read: whatever is already queued is dispatched first, so poll() only waits for new data
+        while (wl_display_prepare_read(m_Display) != 0) {
+            if (wl_display_dispatch_pending(m_Display) < 0) {
+                handleConnectionError();
+                return;
+            }
+        }
+        // Requests made since the last pump (acks, pongs, feedback) go out before waiting on the answers
+        wl_display_flush(m_Display);
+
+        pollfd descriptor{wl_display_get_fd(m_Display), POLLIN, 0};
+        if (poll(&descriptor, 1, timeoutMilliseconds) > 0 && (descriptor.revents & POLLIN)) {
+            if (wl_display_read_events(m_Display) < 0) {
+                handleConnectionError();
+                return;
+            }
+        } else {
+            wl_display_cancel_read(m_Display);
+        }
+        if (wl_display_dispatch_pending(m_Display) < 0) handleConnectionError();
+    }
+
+    void Display::handleConnectionError() {
+        if (m_ConnectionLost) return;
+        m_ConnectionLost = true;
+        ModuleLogger::record().critical("Lost the connection to the Wayland compositor (error {}).", wl_display_get_error(m_Display));
+        for (const auto& [surface, window] : m_Windows) {
+            if (const auto callbackFN = window->getWindowCloseRequestCallbackEventFN()) callbackFN(window);
+        }
+    }
+
+    void Display::addWindow(wl_surface* surface, Types::Window* window) {
+        m_Windows[surface] = window;
+    }
+
+    void Display::removeWindow(wl_surface* surface) {
+        const auto entry = m_Windows.find(surface);
+        if (entry == m_Windows.end()) return;
+        if (m_PointerFocus == entry->second) m_PointerFocus = nullptr;
+        if (m_KeyboardFocus == entry->second) m_KeyboardFocus = nullptr;
+        m_Windows.erase(entry);
+    }
+
+    Types::Window* Display::findWindow(wl_surface* surface) const {
+        const auto entry = m_Windows.find(surface);
+        return entry == m_Windows.end() ? nullptr : entry->second;
+    }
+
+}
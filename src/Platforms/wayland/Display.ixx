@@ -0,0 +1,141 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <unordered_map>
+
+#include <wayland-client.h>
+
+// Defined by the generated protocol headers, which only the implementation includes
+struct xdg_wm_base;
+struct wp_presentation;
+struct wp_viewporter;
+struct wp_fractional_scale_manager_v1;
+
+export module VKING.Platform.Wayland:Display;
+
+import VKING.Types.Window;
+
+namespace VKING::Platform::Wayland {
+
+    struct DisplayListeners;
+
+    /**
+     * @brief The connection to the compositor and the globals every window needs, shared by all windows.
+     *
+     * Owns the seat, so it routes pointer and keyboard events to whichever window has focus. Key codes are Linux
+     * evdev codes and modifiers the compositor's xkb modifier mask; without xkbcommon there are no CHARACTER events.
+     * Main thread only, like every other window system.
+     */
+    export class Display {
+    public:
+        /**
+         * @return The process wide connection, opened by the first window and closed with the last, or nullptr
+         *         (logged) if there is no compositor or it lacks xdg-shell
+         */
+        static std::shared_ptr<Display> acquire();
+
+        ~Display();
+
+        Display(const Display&) = delete;
+        Display& operator=(const Display&) = delete;
+
+        [[nodiscard]] wl_display* getHandle() const { return m_Display; }
+        [[nodiscard]] wl_compositor* getCompositor() const { return m_Compositor; }
+        [[nodiscard]] xdg_wm_base* getWindowManager() const { return m_WindowManager; }
+
+        /// nullptr if the compositor does not report presentation times
+        [[nodiscard]] wp_presentation* getPresentation() const { return m_Presentation; }
+        /// The clock presentation times are on, announced by the compositor
+        [[nodiscard]] clockid_t getPresentationClock() const { return m_PresentationClock; }
+        /// nullptr if the compositor cannot scale surfaces, fractional scaling needs it as well
+        [[nodiscard]] wp_viewporter* getViewporter() const { return m_Viewporter; }
+        /// nullptr if the compositor only knows integer scales
+        [[nodiscard]] wp_fractional_scale_manager_v1* getFractionalScaleManager() const { return m_FractionalScaleManager; }
+
+        /**
+         * @brief Reads whatever the compositor already sent and dispatches it, without blocking.
+         */
+        void dispatch();
+
+        /**
+         * @brief Waits up to timeoutSeconds for the compositor to send something, then dispatches it.
+         */
+        void wait(double timeoutSeconds);
+
+        /**
+         * @brief Blocks until the compositor has handled every request sent so far, dispatching events meanwhile.
+         *
+         * @return false if the connection is lost
+         */
+        bool roundtrip();
+
+        /**
+         * @brief Routes input that targets surface to window, until removeWindow(surface).
+         */
+        void addWindow(wl_surface* surface, Types::Window* window);
+        void removeWindow(wl_surface* surface);
+
+    private:
+        Display() = default;
+
+        /// Connects and binds the globals, false (logged) if a required one is missing
+        bool connect();
+
+        /// Dispatches what is queued, then reads the socket for up to timeoutMilliseconds and dispatches that too
+        void pump(int timeoutMilliseconds);
+
+        /// Gives up the seat's devices when the seat loses them or the display closes
+        void releasePointer();
+        void releaseKeyboard();
+
+        /// Logs a lost connection once and asks every window to close, as the compositor will not show them again
+        void handleConnectionError();
+
+        [[nodiscard]] Types::Window* findWindow(wl_surface* surface) const;
+
+        friend struct DisplayListeners;
+
+        wl_display* m_Display = nullptr;
+        wl_registry* m_Registry = nullptr;
+        wl_compositor* m_Compositor = nullptr;
+        xdg_wm_base* m_WindowManager = nullptr;
+        wp_presentation* m_Presentation = nullptr;
+        clockid_t m_PresentationClock = CLOCK_MONOTONIC;
+        wp_viewporter* m_Viewporter = nullptr;
+        wp_fractional_scale_manager_v1* m_FractionalScaleManager = nullptr;
+
+        wl_seat* m_Seat = nullptr;
+        uint32_t m_SeatVersion = 0;
+        wl_pointer* m_Pointer = nullptr;
+        wl_keyboard* m_Keyboard = nullptr;
+        uint32_t m_Modifiers = 0;
+
+        std::unordered_map<wl_surface*, Types::Window*> m_Windows;
+        Types::Window* m_PointerFocus = nullptr;
+        Types::Window* m_KeyboardFocus = nullptr;
+        bool m_ConnectionLost = false;
+    };
+
+}
@@ -0,0 +1,215 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <wayland-client.h>
+#include "xdg-shell-client-protocol.h"
+#include "presentation-time-client-protocol.h"
+#include "viewporter-client-protocol.h"
+#include "fractional-scale-v1-client-protocol.h"
+
+#include <VKING/Profiler.hpp>
+
+module VKING.Platform.Wayland:WindowImpl;
+import :Window;
+import :Display;
+import :Logger;
+
+namespace VKING::Platform::Wayland {
+
+    /**
+     * @brief The listeners of a window's surface roles and frame feedback, friends of Window so they can update it.
+     */
+    struct WindowListeners {
+
+        static void surfaceConfigure(void* data, xdg_surface* surface, const uint32_t serial) {
+            xdg_surface_ack_configure(surface, serial);
+            static_cast<Window*>(data)->m_Configured = true;
+        }
+
+        static constexpr xdg_surface_listener SURFACE{.configure = surfaceConfigure};
+
+        static void toplevelConfigure(void* data, xdg_toplevel*, const int32_t width, const int32_t height, wl_array*) {
+            // Zero leaves the size to the client
+            if (width <= 0 || height <= 0) return;
+            auto* window = static_cast<Window*>(data);
+            window->m_Width = static_cast<uint32_t>(width);
+            window->m_Height = static_cast<uint32_t>(height);
+            window->updateViewport();
+        }
+
+        static void toplevelClose(void* data, xdg_toplevel*) {
+            ModuleLogger::record().debug("The compositor asked a window to close.");
+            auto* window = static_cast<Window*>(data);
+            if (const auto callbackFN = window->getWindowCloseRequestCallbackEventFN()) callbackFN(window);
+        }
+
+        // Newer xdg-shell headers add events for versions above the one bound
+        static constexpr xdg_toplevel_listener TOPLEVEL = [] {
+            xdg_toplevel_listener listener{};
+            listener.configure = toplevelConfigure;
+            listener.close = toplevelClose;
+            return listener;
+        }();
+
+        static void preferredScale(void* data, wp_fractional_scale_v1*, const uint32_t scale) {
+            auto* window = static_cast<Window*>(data);
+            if (window->m_PreferredScale == scale) return;
+            ModuleLogger::record().debug("Window scale is now {:.3f}.", scale / 120.0);
+            // The swapchain notices the new framebuffer size and is rebuilt at it before the next present
+            window->m_PreferredScale = scale;
+            window->updateViewport();
+        }
+
+        static constexpr wp_fractional_scale_v1_listener FRACTIONAL_SCALE{.preferred_scale = preferredScale};
+
+        static void feedbackSyncOutput(void*, struct wp_presentation_feedback*, wl_output*) {}
+
+        static void feedbackPresented(void* data, struct wp_presentation_feedback* feedback, const uint32_t secondsHigh, const uint32_t secondsLow,
+                                      const uint32_t nanoseconds, const uint32_t refreshNanoseconds, const uint32_t sequenceHigh,
+                                      const uint32_t sequenceLow, uint32_t) {
+            auto* window = static_cast<Window*>(data);
+            finish(window, feedback);
+            // Only a CLOCK_MONOTONIC timestamp is on the steady_clock the engine paces with
+            if (window->m_Display->getPresentationClock() != CLOCK_MONOTONIC) return;
+
+            const uint64_t seconds = (uint64_t{secondsHigh} << 32) | secondsLow;
+            window->m_PresentationTiming = Types::Window::PresentationTiming{
+                .lastPresentNanoseconds = seconds * 1'000'000'000ull + nanoseconds,
+                .refreshNanoseconds = refreshNanoseconds,
+                .refreshSequence = (uint64_t{sequenceHigh} << 32) | sequenceLow
+            };
+        }
+
+        static void feedbackDiscarded(void* data, struct wp_presentation_feedback* feedback) {
+            finish(static_cast<Window*>(data), feedback);
+        }
+
+        static constexpr wp_presentation_feedback_listener FEEDBACK{
+            .sync_output = feedbackSyncOutput,
+            .presented = feedbackPresented,
+            .discarded = feedbackDiscarded
+        };
+
+        static void finish(Window* window, struct wp_presentation_feedback* feedback) {
+            std::erase(window->m_PendingFeedback, feedback);
+            wp_presentation_feedback_destroy(feedback);
+        }
+
+    };
+
+    Window::Window(const WindowCreateInfo& createInfo)
+        : m_Width(createInfo.width), m_Height(createInfo.height) {
+        VKING_PROFILE_SCOPE("Wayland::Window::Window");
+
+        m_Display = Display::acquire();
+        if (!m_Display) {
+            ModuleLogger::record().critical("Wayland window creation failed, there is no compositor connection.");
+            return;
+        }
+
+        m_Surface = wl_compositor_create_surface(m_Display->getCompositor());
+        m_Display->addWindow(m_Surface, this);
+
+        if (wp_viewporter* viewporter = m_Display->getViewporter()) {
+            m_Viewport = wp_viewporter_get_viewport(viewporter, m_Surface);
+            // Fractional scales are only usable through a viewport
+            if (wp_fractional_scale_manager_v1* manager = m_Display->getFractionalScaleManager()) {
+                m_FractionalScale = wp_fractional_scale_manager_v1_get_fractional_scale(manager, m_Surface);
+                wp_fractional_scale_v1_add_listener(m_FractionalScale, &WindowListeners::FRACTIONAL_SCALE, this);
+            }
+        }
+
+        m_XdgSurface = xdg_wm_base_get_xdg_surface(m_Display->getWindowManager(), m_Surface);
+        xdg_surface_add_listener(m_XdgSurface, &WindowListeners::SURFACE, this);
+        m_Toplevel = xdg_surface_get_toplevel(m_XdgSurface);
+        xdg_toplevel_add_listener(m_Toplevel, &WindowListeners::TOPLEVEL, this);
+        xdg_toplevel_set_title(m_Toplevel, createInfo.title.c_str());
+        xdg_toplevel_set_app_id(m_Toplevel, createInfo.appId.c_str());
+        updateViewport();
+
+        // A surface without a buffer is mapped by the first commit after its first configure, which the backend's
+        // first present makes. Until that configure arrives nothing may be attached
+        wl_surface_commit(m_Surface);
+        {
+            VKING_PROFILE_SCOPE("Wayland::Window::awaitConfigure");
+            while (!m_Configured && m_Display->roundtrip()) {}
+        }
+        ModuleLogger::record().debug("Wayland window created: {}x{} at scale {:.3f}.", m_Width, m_Height, getContentScale());
+    }
+
+    Window::~Window() {
+        VKING_PROFILE_SCOPE("Wayland::Window::~Window");
+        if (!m_Display) return;
+
+        for (struct wp_presentation_feedback* feedback : m_PendingFeedback) wp_presentation_feedback_destroy(feedback);
+        if (m_FractionalScale) wp_fractional_scale_v1_destroy(m_FractionalScale);
+        if (m_Viewport) wp_viewport_destroy(m_Viewport);
+        if (m_Toplevel) xdg_toplevel_destroy(m_Toplevel);
+        if (m_XdgSurface) xdg_surface_destroy(m_XdgSurface);
+        if (m_Surface) {
+            m_Display->removeWindow(m_Surface);
+            wl_surface_destroy(m_Surface);
+        }
+        wl_display_flush(m_Display->getHandle());
+        ModuleLogger::record().debug("Wayland window destroyed.");
+    }
+
+    void Window::pollEvents() {
+        if (m_Display) m_Display->dispatch();
+    }
+
+    void Window::waitEvents(const double timeoutSeconds) {
+        if (m_Display) m_Display->wait(timeoutSeconds);
+    }
+
+    Window::FramebufferSize Window::getFramebufferSize() const {
+        // Without a viewport the compositor takes buffers at scale 1, whatever the output's scale is
+        if (!m_Viewport) return {m_Width, m_Height};
+        // Rounded as fractional-scale-v1 specifies, so the buffer maps 1:1 onto the output's pixels
+        return {(m_Width * m_PreferredScale + 60) / 120, (m_Height * m_PreferredScale + 60) / 120};
+    }
+
+    void Window::onBeforePresent() {
+        wp_presentation* presentation = m_Display ? m_Display->getPresentation() : nullptr;
+        if (!presentation || !m_Surface) return;
+
+        // Attaches to the surface's next commit, which is the one vkQueuePresentKHR makes
+        // The request shares its name with the interface, hence the elaborated type specifiers in this file
+        struct wp_presentation_feedback* feedback = wp_presentation_feedback(presentation, m_Surface);
+        wp_presentation_feedback_add_listener(feedback, &WindowListeners::FEEDBACK, this);
+        m_PendingFeedback.push_back(feedback);
+    }
+
+    void Window::updateViewport() {
+        if (m_Viewport && m_Width > 0 && m_Height > 0) {
+            wp_viewport_set_destination(m_Viewport, static_cast<int32_t>(m_Width), static_cast<int32_t>(m_Height));
+        }
+    }
+
+}
@@ -0,0 +1,110 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <wayland-client.h>
+
+// Defined by the generated protocol headers, which only the implementation includes
+struct xdg_surface;
+struct xdg_toplevel;
+struct wp_viewport;
+struct wp_fractional_scale_v1;
+struct wp_presentation_feedback;
+
+export module VKING.Platform.Wayland:Window;
+
+import VKING.Types.Window;
+import :Display;
+
+namespace VKING::Platform::Wayland {
+
+    struct WindowListeners;
+
+    /**
+     * @brief An xdg-shell toplevel on a plain wl_surface, which a backend presents to directly.
+     *
+     * On outputs with a fractional scale the framebuffer is the window's size times that scale and the viewport maps
+     * it back onto the window, so the compositor shows the rendered pixels as they are instead of scaling a buffer
+     * rendered at the next integer scale down again. Presented frames are reported back through presentation-time,
+     * which getPresentationTiming() exposes for frame pacing.
+     */
+    export class Window final : public Types::Window {
+    public:
+        struct WindowCreateInfo {
+            std::string title;
+            /// Size in window units, the compositor may configure another one
+            uint32_t width, height;
+            /// Groups the window with its desktop entry
+            std::string appId = "vking";
+        };
+
+        explicit Window(const WindowCreateInfo& createInfo);
+        ~Window() override;
+
+        /**
+         * @return The wl_surface, nullptr if the window could not be created
+         */
+        void* getNativeWindowHandle() override { return m_Surface; }
+
+        [[nodiscard]] wl_display* getDisplay() const { return m_Display ? m_Display->getHandle() : nullptr; }
+        [[nodiscard]] wl_surface* getSurface() const { return m_Surface; }
+
+        void pollEvents() override;
+        void waitEvents(double timeoutSeconds) override;
+
+        [[nodiscard]] FramebufferSize getFramebufferSize() const override;
+        [[nodiscard]] double getContentScale() const override { return m_PreferredScale / 120.0; }
+        [[nodiscard]] std::optional<PresentationTiming> getPresentationTiming() const override { return m_PresentationTiming; }
+
+        /**
+         * @brief Asks for feedback on the frame about to be presented, whose commit comes from the backend's present.
+         */
+        void onBeforePresent() override;
+
+    private:
+        /// Points the viewport at the window's size, so a framebuffer at any scale covers exactly the window
+        void updateViewport();
+
+        friend struct WindowListeners;
+
+        std::shared_ptr<Display> m_Display;
+        wl_surface* m_Surface = nullptr;
+        xdg_surface* m_XdgSurface = nullptr;
+        xdg_toplevel* m_Toplevel = nullptr;
+        wp_viewport* m_Viewport = nullptr;
+        wp_fractional_scale_v1* m_FractionalScale = nullptr;
+        /// Requested but not yet answered, destroyed with the window
+        std::vector<wp_presentation_feedback*> m_PendingFeedback;
+
+        uint32_t m_Width = 0, m_Height = 0;
+        /// Scale in 120ths, as wp_fractional_scale_v1 sends it
+        uint32_t m_PreferredScale = 120;
+        std::optional<PresentationTiming> m_PresentationTiming;
+        bool m_Configured = false;
+    };
+
+}
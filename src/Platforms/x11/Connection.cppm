@@ -0,0 +1,321 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+
+#include <poll.h>
+
+#include <xcb/xcb.h>
+#include <xcb/xinput.h>
+#include <xcb/present.h>
+
+#include <VKING/Profiler.hpp>
+
+module VKING.Platform.X11:ConnectionImpl;
+import :Connection;
+import :Window;
+import :Logger;
+import VKING.Types.Window;
+
+namespace VKING::Platform::X11 {
+
+    namespace {
+
+        /// The core event type, without the bit marking events sent by other clients
+        uint8_t getEventType(const xcb_generic_event_t* event) {
+            return event->response_type & 0x7f;
+        }
+
+        xcb_atom_t getAtomReply(xcb_connection_t* connection, const xcb_intern_atom_cookie_t cookie) {
+            xcb_intern_atom_reply_t* reply = xcb_intern_atom_reply(connection, cookie, nullptr);
+            const xcb_atom_t atom = reply ? reply->atom : static_cast<xcb_atom_t>(XCB_ATOM_NONE);
+            std::free(reply);
+            return atom;
+        }
+
+        double toDouble(const xcb_input_fp3232_t value) {
+            return static_cast<double>(value.integral) + static_cast<double>(value.frac) / 4294967296.0;
+        }
+
+    }
+
+    std::shared_ptr<Connection> Connection::acquire() {
+        // Windows are created on the main thread only, so this needs no lock
+        static std::weak_ptr<Connection> s_Connection;
+        if (std::shared_ptr<Connection> connection = s_Connection.lock()) return connection;
+
+        VKING_PROFILE_SCOPE("X11::Connection::acquire");
+        std::shared_ptr<Connection> connection(new Connection());
+        if (!connection->connect()) return nullptr;
+        s_Connection = connection;
+        return connection;
+    }
+
+    bool Connection::connect() {
+        int screenNumber = 0;
+        m_Connection = xcb_connect(nullptr, &screenNumber);
+        if (xcb_connection_has_error(m_Connection)) {
+            ModuleLogger::record().critical("Could not connect to the X server, is DISPLAY set?");
+            return false;
+        }
+
+        xcb_screen_iterator_t screens = xcb_setup_roots_iterator(xcb_get_setup(m_Connection));
+        for (int i = 0; i < screenNumber && screens.rem > 0; i++) xcb_screen_next(&screens);
+        m_Screen = screens.data;
+        if (!m_Screen) {
+            ModuleLogger::record().critical("The X server has no screen {}.", screenNumber);
+            return false;
+        }
+
+        // Every request goes out before the first reply is waited on, so setup costs one roundtrip
+        xcb_prefetch_extension_data(m_Connection, &xcb_input_id);
+        xcb_prefetch_extension_data(m_Connection, &xcb_present_id);
+        const xcb_intern_atom_cookie_t protocols = xcb_intern_atom(m_Connection, 0, std::strlen("WM_PROTOCOLS"), "WM_PROTOCOLS");
+        const xcb_intern_atom_cookie_t deleteWindow = xcb_intern_atom(m_Connection, 0, std::strlen("WM_DELETE_WINDOW"), "WM_DELETE_WINDOW");
+
+        const xcb_query_extension_reply_t* input = xcb_get_extension_data(m_Connection, &xcb_input_id);
+        const xcb_query_extension_reply_t* present = xcb_get_extension_data(m_Connection, &xcb_present_id);
+        const bool hasInput = input && input->present;
+        const bool hasPresent = present && present->present;
+        const xcb_input_xi_query_version_cookie_t inputVersion = hasInput ? xcb_input_xi_query_version(m_Connection, 2, 0) : xcb_input_xi_query_version_cookie_t{};
+        const xcb_present_query_version_cookie_t presentVersion = hasPresent ? xcb_present_query_version(m_Connection, 1, 0) : xcb_present_query_version_cookie_t{};
+
+        m_ProtocolsAtom = getAtomReply(m_Connection, protocols);
+        m_DeleteWindowAtom = getAtomReply(m_Connection, deleteWindow);
+
+        if (hasInput) {
+            xcb_input_xi_query_version_reply_t* version = xcb_input_xi_query_version_reply(m_Connection, inputVersion, nullptr);
+            if (version && version->major_version >= 2) {
+                m_InputOpcode = input->major_opcode;
+                // Raw events are only delivered to the root window; they are routed to the focused window below
+                struct {
+                    xcb_input_event_mask_t header;
+                    uint32_t mask;
+                } selection{{XCB_INPUT_DEVICE_ALL_MASTER, 1}, XCB_INPUT_XI_EVENT_MASK_RAW_MOTION};
+                xcb_input_xi_select_events(m_Connection, m_Screen->root, 1, &selection.header);
+            }
+            std::free(version);
+        }
+        if (hasPresent) {
+            xcb_present_query_version_reply_t* version = xcb_present_query_version_reply(m_Connection, presentVersion, nullptr);
+            if (version) m_PresentOpcode = present->major_opcode;
+            std::free(version);
+        }
+        xcb_flush(m_Connection);
+
+        ModuleLogger::record().info("Connected to the X server: XInput2 raw motion {}, Present {}.",
+                                    m_InputOpcode ? "available" : "unavailable", m_PresentOpcode ? "available" : "unavailable");
+        return true;
+    }
+
+    Connection::~Connection() {
+        VKING_PROFILE_SCOPE("X11::Connection::~Connection");
+        // Also required after a failed xcb_connect, which still returns a connection object
+        if (m_Connection) xcb_disconnect(m_Connection);
+        ModuleLogger::record().debug("Disconnected from the X server.");
+    }
+
+    void Connection::dispatch() {
+        VKING_PROFILE_SCOPE("X11::dispatch");
+        pump(0);
+    }
+
+    void Connection::wait(const double timeoutSeconds) {
+        VKING_PROFILE_SCOPE("X11::wait");
+        pump(timeoutSeconds > 0.0 ? static_cast<int>(timeoutSeconds * 1000.0 + 0.999) : 0);
+    }
+
+    void Connection::pump(const int timeoutMilliseconds) {
+        if (m_ConnectionLost) return;
+
+        // The only read of the socket this pump, everything after it comes from what it queued
+        xcb_generic_event_t* event = xcb_poll_for_event(m_Connection);
+        if (!event && timeoutMilliseconds > 0) {
+            pollfd descriptor{xcb_get_file_descriptor(m_Connection), POLLIN, 0};
+            if (poll(&descriptor, 1, timeoutMilliseconds) > 0) event = xcb_poll_for_event(m_Connection);
+        }
+        while (event) {
+            xcb_generic_event_t* next = xcb_poll_for_queued_event(m_Connection);
+            if (handleEvent(event, next)) {
+                std::free(next);
+                next = xcb_poll_for_queued_event(m_Connection);
+            }
+            std::free(event);
+            event = next;
+        }
+
+        if (xcb_connection_has_error(m_Connection)) handleConnectionError();
+    }
+
+    bool Connection::handleEvent(const xcb_generic_event_t* event, const xcb_generic_event_t* next) {
+        using Types::InputEvent;
+
+        switch (const uint8_t type = getEventType(event)) {
+            case 0: {
+                const auto* error = reinterpret_cast<const xcb_generic_error_t*>(event);
+                ModuleLogger::record().warn("X request {}.{} failed with error {}.", error->major_code, error->minor_code, error->error_code);
+                return false;
+            }
+            case XCB_KEY_PRESS:
+            case XCB_KEY_RELEASE: {
+                const auto* key = reinterpret_cast<const xcb_key_press_event_t*>(event);
+                Window* window = findWindow(key->event);
+                if (!window) return false;
+
+                // A held key arrives as release and press pairs sharing a timestamp. When both came in the same read
+                // they are reported as one repeat
+                bool repeat = false;
+                if (type == XCB_KEY_RELEASE && next && getEventType(next) == XCB_KEY_PRESS) {
+                    const auto* press = reinterpret_cast<const xcb_key_press_event_t*>(next);
+                    repeat = press->detail == key->detail && press->time == key->time;
+                }
+                window->getInputQueue().push({
+                    .type = InputEvent::Type::KEY,
+                    .action = repeat ? InputEvent::Action::REPEAT : type == XCB_KEY_PRESS ? InputEvent::Action::PRESS : InputEvent::Action::RELEASE,
+                    .code = key->detail - 8, .scancode = key->detail, .modifiers = key->state
+                });
+                return repeat;
+            }
+            case XCB_BUTTON_PRESS:
+            case XCB_BUTTON_RELEASE: {
+                const auto* button = reinterpret_cast<const xcb_button_press_event_t*>(event);
+                Window* window = findWindow(button->event);
+                if (!window) return false;
+
+                // Buttons 4 to 7 are the wheel, a press per notch, signed like GLFW's scroll offsets
+                if (button->detail >= 4 && button->detail <= 7) {
+                    if (type == XCB_BUTTON_PRESS) {
+                        constexpr double OFFSETS[4][2] = {{0.0, 1.0}, {0.0, -1.0}, {1.0, 0.0}, {-1.0, 0.0}};
+                        const double* offset = OFFSETS[button->detail - 4];
+                        window->getInputQueue().push({.type = InputEvent::Type::SCROLL, .x = offset[0], .y = offset[1]});
+                    }
+                    return false;
+                }
+                window->getInputQueue().push({
+                    .type = InputEvent::Type::MOUSE_BUTTON,
+                    .action = type == XCB_BUTTON_PRESS ? InputEvent::Action::PRESS : InputEvent::Action::RELEASE,
+                    .code = button->detail, .modifiers = button->state
+                });
+                return false;
+            }
+            case XCB_MOTION_NOTIFY: {
+                const auto* motion = reinterpret_cast<const xcb_motion_notify_event_t*>(event);
+                if (Window* window = findWindow(motion->event)) {
+                    window->getInputQueue().push({.type = InputEvent::Type::CURSOR_POSITION, .x = static_cast<double>(motion->event_x), .y = static_cast<double>(motion->event_y)});
+                }
+                return false;
+            }
+            case XCB_FOCUS_IN:
+            case XCB_FOCUS_OUT: {
+                const auto* focus = reinterpret_cast<const xcb_focus_in_event_t*>(event);
+                // Keyboard grabs (a window manager's switcher) move the focus away only for their duration
+                if (focus->mode == XCB_NOTIFY_MODE_GRAB || focus->mode == XCB_NOTIFY_MODE_UNGRAB) return false;
+                Window* window = findWindow(focus->event);
+                if (!window) return false;
+
+                const bool gained = type == XCB_FOCUS_IN;
+                if (gained) m_Focus = window;
+                else if (m_Focus == window) m_Focus = nullptr;
+                window->getInputQueue().push({.type = InputEvent::Type::FOCUS, .action = gained ? InputEvent::Action::PRESS : InputEvent::Action::RELEASE});
+                return false;
+            }
+            case XCB_CONFIGURE_NOTIFY: {
+                const auto* configure = reinterpret_cast<const xcb_configure_notify_event_t*>(event);
+                if (Window* window = findWindow(configure->window)) window->handleResize(configure->width, configure->height);
+                return false;
+            }
+            case XCB_CLIENT_MESSAGE: {
+                const auto* message = reinterpret_cast<const xcb_client_message_event_t*>(event);
+                if (message->type != m_ProtocolsAtom || message->data.data32[0] != m_DeleteWindowAtom) return false;
+                ModuleLogger::record().debug("The window manager asked a window to close.");
+                if (Window* window = findWindow(message->window)) {
+                    if (const auto callbackFN = window->getWindowCloseRequestCallbackEventFN()) callbackFN(window);
+                }
+                return false;
+            }
+            case XCB_GE_GENERIC:
+                handleGenericEvent(event);
+                return false;
+            default:
+                return false;
+        }
+    }
+
+    void Connection::handleGenericEvent(const xcb_generic_event_t* event) {
+        const auto* generic = reinterpret_cast<const xcb_ge_generic_event_t*>(event);
+
+        if (m_InputOpcode != 0 && generic->extension == m_InputOpcode && generic->event_type == XCB_INPUT_RAW_MOTION) {
+            if (!m_Focus) return;
+            const auto* raw = reinterpret_cast<const xcb_input_raw_motion_event_t*>(event);
+            const uint32_t* mask = xcb_input_raw_button_press_valuator_mask(raw);
+            const int maskLength = xcb_input_raw_button_press_valuator_mask_length(raw);
+            const xcb_input_fp3232_t* values = xcb_input_raw_button_press_axisvalues_raw(raw);
+
+            // Only the valuators that changed are sent, in order. The first two are x and y on every pointer
+            double motion[2] = {0.0, 0.0};
+            int valueIndex = 0;
+            for (int valuator = 0; valuator < maskLength * 32 && valuator < 2; valuator++) {
+                if (!(mask[valuator / 32] & (1u << (valuator % 32)))) continue;
+                motion[valuator] = toDouble(values[valueIndex++]);
+            }
+            if (valueIndex > 0) m_Focus->getInputQueue().push({.type = Types::InputEvent::Type::RAW_MOTION, .x = motion[0], .y = motion[1]});
+            return;
+        }
+
+        if (m_PresentOpcode != 0 && generic->extension == m_PresentOpcode && generic->event_type == XCB_PRESENT_EVENT_COMPLETE_NOTIFY) {
+            const auto* complete = reinterpret_cast<const xcb_present_complete_notify_event_t*>(event);
+            // Skipped frames never reached the screen, and MSC notifications are not frames at all
+            if (complete->kind != XCB_PRESENT_COMPLETE_KIND_PIXMAP || complete->mode == XCB_PRESENT_COMPLETE_MODE_SKIP) return;
+            if (Window* window = findWindow(complete->window)) window->handlePresentComplete(complete->ust, complete->msc);
+        }
+    }
+
+    void Connection::handleConnectionError() {
+        if (m_ConnectionLost) return;
+        m_ConnectionLost = true;
+        ModuleLogger::record().critical("Lost the connection to the X server (error {}).", xcb_connection_has_error(m_Connection));
+        for (const auto& [handle, window] : m_Windows) {
+            if (const auto callbackFN = window->getWindowCloseRequestCallbackEventFN()) callbackFN(window);
+        }
+    }
+
+    void Connection::addWindow(const xcb_window_t handle, Window* window) {
+        m_Windows[handle] = window;
+    }
+
+    void Connection::removeWindow(const xcb_window_t handle) {
+        const auto entry = m_Windows.find(handle);
+        if (entry == m_Windows.end()) return;
+        if (m_Focus == entry->second) m_Focus = nullptr;
+        m_Windows.erase(entry);
+    }
+
+    Window* Connection::findWindow(const xcb_window_t handle) const {
+        const auto entry = m_Windows.find(handle);
+        return entry == m_Windows.end() ? nullptr : entry->second;
+    }
+
+}
@@ -0,0 +1,116 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include <xcb/xcb.h>
+
+export module VKING.Platform.X11:Connection;
+
+namespace VKING::Platform::X11 {
+
+    export class Window;
+
+    /**
+     * @brief The connection to the X server, shared by all windows, and the event loop routing its events to them.
+     *
+     * Events are read from the socket once per pump and then drained from XCB's queue, so a burst of motion costs a
+     * single read. Key codes are Linux evdev codes, the X keycode minus 8 like the Wayland platform, and modifiers
+     * the core protocol's state mask. With XInput2, unaccelerated pointer motion arrives as RAW_MOTION on the
+     * focused window. Main thread only.
+     */
+    export class Connection {
+    public:
+        /**
+         * @return The process wide connection, opened by the first window and closed with the last, or nullptr
+         *         (logged) if the X server cannot be reached
+         */
+        static std::shared_ptr<Connection> acquire();
+
+        ~Connection();
+
+        Connection(const Connection&) = delete;
+        Connection& operator=(const Connection&) = delete;
+
+        [[nodiscard]] xcb_connection_t* getHandle() const { return m_Connection; }
+        [[nodiscard]] xcb_screen_t* getScreen() const { return m_Screen; }
+        [[nodiscard]] xcb_atom_t getProtocolsAtom() const { return m_ProtocolsAtom; }
+        [[nodiscard]] xcb_atom_t getDeleteWindowAtom() const { return m_DeleteWindowAtom; }
+
+        /// Whether the server has the Present extension, which reports when frames reach the screen
+        [[nodiscard]] bool hasPresent() const { return m_PresentOpcode != 0; }
+
+        /**
+         * @brief Reads whatever the server already sent and dispatches it, without blocking.
+         */
+        void dispatch();
+
+        /**
+         * @brief Waits up to timeoutSeconds for the server to send something, then dispatches it.
+         */
+        void wait(double timeoutSeconds);
+
+        /**
+         * @brief Routes the events of window's xcb window to it, until removeWindow().
+         */
+        void addWindow(xcb_window_t handle, Window* window);
+        void removeWindow(xcb_window_t handle);
+
+    private:
+        Connection() = default;
+
+        /// Connects, interns the atoms and sets up XInput2 and Present where available
+        bool connect();
+
+        /// Reads the socket once, waiting up to timeoutMilliseconds if nothing is queued, then drains the queue
+        void pump(int timeoutMilliseconds);
+
+        /**
+         * @param next The event queued after this one, or nullptr
+         * @return Whether next was consumed as well (a key release and press pair that is really a repeat)
+         */
+        bool handleEvent(const xcb_generic_event_t* event, const xcb_generic_event_t* next);
+
+        /// Events of the extensions (XInput2, Present), which all arrive as generic events
+        void handleGenericEvent(const xcb_generic_event_t* event);
+
+        /// Logs a lost connection once and asks every window to close, as the server will not show them again
+        void handleConnectionError();
+
+        [[nodiscard]] Window* findWindow(xcb_window_t handle) const;
+
+        xcb_connection_t* m_Connection = nullptr;
+        xcb_screen_t* m_Screen = nullptr;
+        xcb_atom_t m_ProtocolsAtom = XCB_ATOM_NONE;
+        xcb_atom_t m_DeleteWindowAtom = XCB_ATOM_NONE;
+        /// Major opcodes identifying the extensions' generic events, 0 if the server lacks the extension
+        uint8_t m_InputOpcode = 0;
+        uint8_t m_PresentOpcode = 0;
+
+        std::unordered_map<xcb_window_t, Window*> m_Windows;
+        Window* m_Focus = nullptr;
+        bool m_ConnectionLost = false;
+    };
+
+}
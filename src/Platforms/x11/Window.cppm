@@ -0,0 +1,115 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include <xcb/xcb.h>
+#include <xcb/present.h>
+
+#include <VKING/Profiler.hpp>
+
+module VKING.Platform.X11:WindowImpl;
+import :Window;
+import :Connection;
+import :Logger;
+
+namespace VKING::Platform::X11 {
+
+    Window::Window(const WindowCreateInfo& createInfo)
+        : m_Width(createInfo.width), m_Height(createInfo.height) {
+        VKING_PROFILE_SCOPE("X11::Window::Window");
+
+        m_Connection = Connection::acquire();
+        if (!m_Connection) {
+            ModuleLogger::record().critical("X11 window creation failed, there is no X server connection.");
+            return;
+        }
+        xcb_connection_t* connection = m_Connection->getHandle();
+        const xcb_screen_t* screen = m_Connection->getScreen();
+
+        // No background, the swapchain covers the whole window and the server would only clear it before each frame
+        m_Window = xcb_generate_id(connection);
+        constexpr uint32_t EVENT_MASK = XCB_EVENT_MASK_KEY_PRESS | XCB_EVENT_MASK_KEY_RELEASE | XCB_EVENT_MASK_BUTTON_PRESS |
+                                        XCB_EVENT_MASK_BUTTON_RELEASE | XCB_EVENT_MASK_POINTER_MOTION | XCB_EVENT_MASK_STRUCTURE_NOTIFY |
+                                        XCB_EVENT_MASK_FOCUS_CHANGE;
+        xcb_create_window(connection, XCB_COPY_FROM_PARENT, m_Window, screen->root, 0, 0, static_cast<uint16_t>(m_Width),
+                          static_cast<uint16_t>(m_Height), 0, XCB_WINDOW_CLASS_INPUT_OUTPUT, screen->root_visual, XCB_CW_EVENT_MASK, &EVENT_MASK);
+
+        xcb_change_property(connection, XCB_PROP_MODE_REPLACE, m_Window, XCB_ATOM_WM_NAME, XCB_ATOM_STRING, 8,
+                            static_cast<uint32_t>(createInfo.title.size()), createInfo.title.data());
+        // Lets the window manager ask for a close instead of killing the connection
+        const xcb_atom_t deleteWindow = m_Connection->getDeleteWindowAtom();
+        xcb_change_property(connection, XCB_PROP_MODE_REPLACE, m_Window, m_Connection->getProtocolsAtom(), XCB_ATOM_ATOM, 32, 1, &deleteWindow);
+
+        // Completion events of every presentation to the window, also those the Vulkan driver makes
+        if (m_Connection->hasPresent()) {
+            xcb_present_select_input(connection, xcb_generate_id(connection), m_Window, XCB_PRESENT_EVENT_MASK_COMPLETE_NOTIFY);
+        }
+
+        m_Connection->addWindow(m_Window, this);
+        xcb_map_window(connection, m_Window);
+        xcb_flush(connection);
+        ModuleLogger::record().debug("X11 window created: {}x{}.", m_Width, m_Height);
+    }
+
+    Window::~Window() {
+        VKING_PROFILE_SCOPE("X11::Window::~Window");
+        if (!m_Connection) return;
+
+        m_Connection->removeWindow(m_Window);
+        xcb_destroy_window(m_Connection->getHandle(), m_Window);
+        xcb_flush(m_Connection->getHandle());
+        ModuleLogger::record().debug("X11 window destroyed.");
+    }
+
+    void Window::pollEvents() {
+        if (m_Connection) m_Connection->dispatch();
+    }
+
+    void Window::waitEvents(const double timeoutSeconds) {
+        if (m_Connection) m_Connection->wait(timeoutSeconds);
+    }
+
+    void Window::handleResize(const uint32_t width, const uint32_t height) {
+        m_Width = width;
+        m_Height = height;
+    }
+
+    void Window::handlePresentComplete(const uint64_t microseconds, const uint64_t sequence) {
+        const uint64_t nanoseconds = microseconds * 1000;
+
+        // Present reports no refresh rate; it follows from how far the clock and the refresh counter moved since the
+        // previous frame. Kept from before when the counter did not move
+        uint64_t refreshNanoseconds = m_PresentationTiming ? m_PresentationTiming->refreshNanoseconds : 0;
+        if (m_PresentationTiming && sequence > m_PresentationTiming->refreshSequence && nanoseconds > m_PresentationTiming->lastPresentNanoseconds) {
+            refreshNanoseconds = (nanoseconds - m_PresentationTiming->lastPresentNanoseconds) / (sequence - m_PresentationTiming->refreshSequence);
+        }
+        m_PresentationTiming = PresentationTiming{
+            .lastPresentNanoseconds = nanoseconds,
+            .refreshNanoseconds = refreshNanoseconds,
+            .refreshSequence = sequence
+        };
+    }
+
+}
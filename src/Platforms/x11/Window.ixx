@@ -0,0 +1,85 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <xcb/xcb.h>
+
+export module VKING.Platform.X11:Window;
+
+import VKING.Types.Window;
+import :Connection;
+
+namespace VKING::Platform::X11 {
+
+    /**
+     * @brief A top level XCB window, which a backend presents to directly.
+     *
+     * When the server has the Present extension the window listens for the completion of every presentation made to
+     * it, including those the Vulkan driver makes, and exposes their timing through getPresentationTiming().
+     */
+    export class Window final : public Types::Window {
+    public:
+        struct WindowCreateInfo {
+            std::string title;
+            uint32_t width, height;
+        };
+
+        explicit Window(const WindowCreateInfo& createInfo);
+        ~Window() override;
+
+        /**
+         * @return The xcb_window_t cast to a pointer, nullptr if the window could not be created
+         */
+        void* getNativeWindowHandle() override { return reinterpret_cast<void*>(static_cast<uintptr_t>(m_Window)); }
+
+        [[nodiscard]] xcb_connection_t* getConnection() const { return m_Connection ? m_Connection->getHandle() : nullptr; }
+        [[nodiscard]] xcb_window_t getWindow() const { return m_Window; }
+
+        void pollEvents() override;
+        void waitEvents(double timeoutSeconds) override;
+
+        /// X11 windows are sized in pixels
+        [[nodiscard]] FramebufferSize getFramebufferSize() const override { return {m_Width, m_Height}; }
+        [[nodiscard]] std::optional<PresentationTiming> getPresentationTiming() const override { return m_PresentationTiming; }
+
+    private:
+        friend class Connection;
+
+        void handleResize(uint32_t width, uint32_t height);
+
+        /**
+         * @param microseconds When the frame reached the screen, on CLOCK_MONOTONIC
+         * @param sequence The screen's refresh counter (MSC) at that time
+         */
+        void handlePresentComplete(uint64_t microseconds, uint64_t sequence);
+
+        std::shared_ptr<Connection> m_Connection;
+        xcb_window_t m_Window = XCB_WINDOW_NONE;
+        uint32_t m_Width = 0, m_Height = 0;
+        std::optional<PresentationTiming> m_PresentationTiming;
+    };
+
+}
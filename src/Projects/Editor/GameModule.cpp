@@ -0,0 +1,42 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// The game module VKING_Editor loads with --game-module when built with VKING_HOT_RELOAD, see GameModule.
+//
+#include <memory>
+
+import VKING.Editor.Application;
+import VKING.GameModule;
+import VKING.Log;
+
+using EditorGameLogger = VKING::Log::Named<"EditorGame">;
+
+extern "C" const VKING::GameModuleInfo* VKING_Game_RegisterModule() {
+    static const VKING::GameModuleInfo s_Info{
+        .abiVersion = VKING::GAME_MODULE_ABI_VERSION,
+        .name = "VKING Editor",
+        .createApplication = []() -> std::unique_ptr<VKING::Application> {
+            EditorGameLogger::record().info("Creating application.");
+            return std::make_unique<VKING::Editor::EditorApplication>();
+        },
+    };
+    return &s_Info;
+}
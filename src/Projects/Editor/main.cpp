@@ -27,7 +27,9 @@ module;
 #define VKING_INCLUDE_WIN_MAIN
 #include <VKING/MainCreator.hpp>
 
+#if !defined(VKING_EDITOR_GAME_MODULE)
 import VKING.Editor.Application;
+#endif
 import VKING.Log;
 
 module VKING.EntryPointCallbacks;
@@ -40,7 +42,13 @@ void VKING::registerLogger() {
 
 
 std::unique_ptr<VKING::Application> VKING::createApplication() {
+#if defined(VKING_EDITOR_GAME_MODULE)
+    // Built with VKING_HOT_RELOAD, the gameplay code only exists in the VKING_Editor_Game module
+    EditorMainLogger::record().critical("This Editor loads its gameplay code from a game module, run it with --game-module=<path>.");
+    return nullptr;
+#else
     EditorMainLogger::record().info("Creating application.");
     return std::make_unique<Editor::EditorApplication>();
+#endif
 }
 
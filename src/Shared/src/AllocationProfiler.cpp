@@ -0,0 +1,282 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#include "AllocationProfiler.hpp"
+#include "Symbolizer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__linux__) || defined(__APPLE__)
+#   include <execinfo.h>
+#endif
+
+namespace VKING::Profiler::Allocations {
+
+    namespace {
+
+        /// Sites printed per stack in the text report
+        constexpr uint32_t REPORT_STACK_DEPTH = 8;
+
+        struct SiteKey {
+            const char* tag;
+            std::vector<uintptr_t> stack;
+
+            bool operator==(const SiteKey&) const = default;
+        };
+
+        struct SiteKeyHash {
+            size_t operator()(const SiteKey& key) const {
+                uint64_t hash = 14695981039346656037ull ^ reinterpret_cast<uintptr_t>(key.tag);
+                for (const uintptr_t address : key.stack) hash = (hash ^ address) * 1099511628211ull;
+                return static_cast<size_t>(hash);
+            }
+        };
+
+        struct LiveAllocation {
+            uint32_t siteIndex;
+            double estimatedBytes;
+            uint64_t allocatedAt;
+        };
+
+        struct Recorder {
+            std::atomic<uint64_t> sampleInterval{DEFAULT_SAMPLE_INTERVAL};
+            std::atomic<uint64_t> shortLivedNanoseconds{DEFAULT_SHORT_LIVED_NANOSECONDS};
+
+            /// Guards everything below. Only sampled allocations and their frees take it
+            std::mutex mutex;
+            std::vector<Site> sites;
+            std::unordered_map<SiteKey, uint32_t, SiteKeyHash> siteIndices;
+            std::unordered_map<const void*, LiveAllocation> live;
+            uint64_t sampledAllocations = 0;
+            double estimatedBytes = 0.0;
+        };
+
+        Recorder& getRecorder() {
+            // Intentionally leaked: allocators may still free during static destruction
+            static Recorder* s_Recorder = new Recorder();
+            return *s_Recorder;
+        }
+
+        constinit thread_local uint64_t t_RandomState = 0;
+        /// false until the thread drew its first distance, so its first allocation is not always sampled
+        constinit thread_local bool t_Armed = false;
+
+        uint64_t getNanoseconds() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        /// xorshift64*, seeded per thread
+        uint64_t nextRandom() {
+            if (t_RandomState == 0) t_RandomState = (getNanoseconds() ^ reinterpret_cast<uintptr_t>(&t_RandomState)) | 1;
+            t_RandomState ^= t_RandomState >> 12;
+            t_RandomState ^= t_RandomState << 25;
+            t_RandomState ^= t_RandomState >> 27;
+            return t_RandomState * 2685821657736338717ull;
+        }
+
+        /// Exponentially distributed, so samples form a Poisson process over allocated bytes
+        int64_t drawDistance(const uint64_t meanBytes) {
+            const double uniform = (static_cast<double>(nextRandom() >> 11) + 1.0) * 0x1.0p-53;
+            return std::max<int64_t>(1, static_cast<int64_t>(-std::log(uniform) * static_cast<double>(meanBytes)));
+        }
+
+        std::vector<uintptr_t> captureStack() {
+#if defined(__linux__) || defined(__APPLE__)
+            // One extra frame for recordAllocation itself
+            void* frames[MAX_STACK_DEPTH + 1];
+            const int depth = backtrace(frames, MAX_STACK_DEPTH + 1);
+            std::vector<uintptr_t> stack;
+            stack.reserve(depth > 1 ? static_cast<size_t>(depth - 1) : 0);
+            for (int i = 1; i < depth; i++) stack.push_back(reinterpret_cast<uintptr_t>(frames[i]) - 1);
+            return stack;
+#else
+            return {};
+#endif
+        }
+
+        void printBytes(std::FILE* file, const double bytes) {
+            if (bytes >= 1024.0 * 1024.0) std::fprintf(file, "%.2f MiB", bytes / (1024.0 * 1024.0));
+            else if (bytes >= 1024.0) std::fprintf(file, "%.2f KiB", bytes / 1024.0);
+            else std::fprintf(file, "%.0f B", bytes);
+        }
+
+        void printStack(std::FILE* file, const Site& site, const std::unordered_map<uintptr_t, std::string>& symbols) {
+            const size_t depth = std::min<size_t>(site.stack.size(), REPORT_STACK_DEPTH);
+            for (size_t i = 0; i < depth; i++) std::fprintf(file, "       %s %s\n", i == 0 ? "at" : "  ", symbols.at(site.stack[i]).c_str());
+            if (site.stack.size() > depth) std::fprintf(file, "          ... %zu more frames\n", site.stack.size() - depth);
+        }
+
+    }
+
+    bool detail::rearm() {
+        const bool sampled = t_Armed;
+        t_Armed = true;
+        t_BytesUntilSample = drawDistance(getRecorder().sampleInterval.load(std::memory_order_relaxed));
+        return sampled;
+    }
+
+    void setEnabled(const bool enabled, const uint64_t sampleIntervalBytes) {
+        getRecorder().sampleInterval.store(std::max<uint64_t>(sampleIntervalBytes, 1), std::memory_order_relaxed);
+        detail::s_Enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool isEnabled() {
+        return detail::s_Enabled.load(std::memory_order_relaxed);
+    }
+
+    void setShortLivedThreshold(const uint64_t nanoseconds) {
+        getRecorder().shortLivedNanoseconds.store(nanoseconds, std::memory_order_relaxed);
+    }
+
+    void recordAllocation(const void* pointer, const size_t size, const char* tag) {
+        SiteKey key{tag, captureStack()};
+        const uint64_t now = getNanoseconds();
+        Recorder& recorder = getRecorder();
+
+        // An allocation of size bytes is sampled with probability 1 - e^(-size / interval), so each sample
+        // stands for 1 / probability allocations like it
+        const double interval = static_cast<double>(recorder.sampleInterval.load(std::memory_order_relaxed));
+        const double probability = 1.0 - std::exp(-static_cast<double>(size) / interval);
+        const double weight = probability > 0.0 ? 1.0 / probability : 1.0;
+
+        std::lock_guard lock(recorder.mutex);
+        auto [found, inserted] = recorder.siteIndices.try_emplace(std::move(key), static_cast<uint32_t>(recorder.sites.size()));
+        if (inserted) {
+            Site site;
+            site.tag = tag;
+            site.stack = found->first.stack;
+            recorder.sites.push_back(std::move(site));
+        }
+
+        Site& site = recorder.sites[found->second];
+        const double estimatedBytes = static_cast<double>(size) * weight;
+        site.sampledAllocations++;
+        site.estimatedAllocations += weight;
+        site.estimatedBytes += estimatedBytes;
+        site.liveAllocations++;
+        site.liveEstimatedBytes += estimatedBytes;
+        recorder.sampledAllocations++;
+        recorder.estimatedBytes += estimatedBytes;
+        recorder.live[pointer] = {found->second, estimatedBytes, now};
+    }
+
+    void recordFree(const void* pointer) {
+        const uint64_t now = getNanoseconds();
+        Recorder& recorder = getRecorder();
+        const uint64_t shortLived = recorder.shortLivedNanoseconds.load(std::memory_order_relaxed);
+
+        std::lock_guard lock(recorder.mutex);
+        const auto found = recorder.live.find(pointer);
+        if (found == recorder.live.end()) return;
+
+        const LiveAllocation allocation = found->second;
+        recorder.live.erase(found);
+        Site& site = recorder.sites[allocation.siteIndex];
+        const uint64_t lifetime = now - allocation.allocatedAt;
+        site.sampledFrees++;
+        site.totalLifetimeNanoseconds += lifetime;
+        if (lifetime < shortLived) site.shortLivedFrees++;
+        site.liveAllocations--;
+        site.liveEstimatedBytes -= allocation.estimatedBytes;
+    }
+
+    Report buildReport() {
+        Recorder& recorder = getRecorder();
+        Report report;
+        report.sampleIntervalBytes = recorder.sampleInterval.load(std::memory_order_relaxed);
+        report.shortLivedNanoseconds = recorder.shortLivedNanoseconds.load(std::memory_order_relaxed);
+
+        std::lock_guard lock(recorder.mutex);
+        report.sampledAllocations = recorder.sampledAllocations;
+        report.estimatedBytes = recorder.estimatedBytes;
+        report.sites = recorder.sites;
+        return report;
+    }
+
+    bool writeReport(const std::filesystem::path& path, const uint32_t topSites) {
+        Report report = buildReport();
+
+        std::vector<uintptr_t> addresses;
+        for (const Site& site : report.sites) addresses.insert(addresses.end(), site.stack.begin(), site.stack.end());
+        std::ranges::sort(addresses);
+        addresses.erase(std::ranges::unique(addresses).begin(), addresses.end());
+        const auto symbols = Profiler::detail::symbolize(addresses);
+
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        if (!file) return false;
+
+        std::fprintf(file, "VKING allocation profile\n");
+        std::fprintf(file, "Sample interval %llu bytes, short-lived below %.3f ms\n", static_cast<unsigned long long>(report.sampleIntervalBytes),
+                     static_cast<double>(report.shortLivedNanoseconds) / 1'000'000.0);
+        std::fprintf(file, "%llu sampled allocations, ", static_cast<unsigned long long>(report.sampledAllocations));
+        printBytes(file, report.estimatedBytes);
+        std::fprintf(file, " allocated (estimated)\n");
+
+        // === Top allocating sites ===
+        std::vector<const Site*> sites;
+        for (const Site& site : report.sites) sites.push_back(&site);
+        std::ranges::sort(sites, std::ranges::greater{}, &Site::estimatedBytes);
+        std::fprintf(file, "\n== Top allocating sites ==\n");
+        for (size_t i = 0; i < std::min<size_t>(sites.size(), topSites); i++) {
+            const Site& site = *sites[i];
+            std::fprintf(file, "%3zu. ", i + 1);
+            printBytes(file, site.estimatedBytes);
+            std::fprintf(file, " in ~%.0f allocations [%s]\n", site.estimatedAllocations, site.tag);
+            printStack(file, site, symbols);
+        }
+
+        // === Churn ===
+        std::erase_if(sites, [](const Site* site) { return site->shortLivedFrees == 0; });
+        std::ranges::sort(sites, std::ranges::greater{}, [](const Site* site) { return static_cast<double>(site->shortLivedFrees) * (site->estimatedAllocations / static_cast<double>(site->sampledAllocations)); });
+        std::fprintf(file, "\n== Top churn sites (freed within %.3f ms) ==\n", static_cast<double>(report.shortLivedNanoseconds) / 1'000'000.0);
+        for (size_t i = 0; i < std::min<size_t>(sites.size(), topSites); i++) {
+            const Site& site = *sites[i];
+            std::fprintf(file, "%3zu. %llu of %llu sampled frees short-lived, mean lifetime %.3f ms [%s]\n", i + 1,
+                         static_cast<unsigned long long>(site.shortLivedFrees), static_cast<unsigned long long>(site.sampledFrees),
+                         static_cast<double>(site.totalLifetimeNanoseconds) / static_cast<double>(site.sampledFrees) / 1'000'000.0, site.tag);
+            printStack(file, site, symbols);
+        }
+
+        // === Live, which at shutdown means leaked ===
+        std::fprintf(file, "\n== Live allocations ==\n");
+        bool anyLive = false;
+        for (const Site& site : report.sites) {
+            if (site.liveAllocations == 0) continue;
+            anyLive = true;
+            std::fprintf(file, "     ");
+            printBytes(file, site.liveEstimatedBytes);
+            std::fprintf(file, " in %llu sampled allocations [%s]\n", static_cast<unsigned long long>(site.liveAllocations), site.tag);
+            printStack(file, site, symbols);
+        }
+        if (!anyLive) std::fprintf(file, "     none\n");
+
+        const bool success = std::ferror(file) == 0;
+        return std::fclose(file) == 0 && success;
+    }
+
+}
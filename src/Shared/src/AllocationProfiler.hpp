@@ -0,0 +1,133 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace VKING::Profiler::Allocations {
+
+    /// Mean bytes allocated between two samples
+    constexpr uint64_t DEFAULT_SAMPLE_INTERVAL = 256 * 1024;
+
+    /// Sampled allocations freed sooner than this count as churn
+    constexpr uint64_t DEFAULT_SHORT_LIVED_NANOSECONDS = 16'000'000;
+
+    /// Return addresses kept per sampled allocation
+    constexpr uint32_t MAX_STACK_DEPTH = 24;
+
+    namespace detail {
+        inline constinit std::atomic_bool s_Enabled{false};
+        /// Bytes this thread may still allocate before its next sample
+        inline constinit thread_local int64_t t_BytesUntilSample = 0;
+
+        /**
+         * @brief Draws the calling thread's next sampling distance. Slow path, once per sample.
+         *
+         * @return Whether the allocation that crossed the last distance is sampled (false on a thread's first call)
+         */
+        bool rearm();
+    }
+
+    /**
+     * @brief Turns allocation sampling on or off. Off by default.
+     *
+     * Samples are Poisson distributed over allocated bytes: on average one every sampleIntervalBytes, so large
+     * allocations are almost always caught and small frequent ones in proportion to their volume. Reports scale
+     * samples back up to estimated totals. Disabling keeps what was recorded, allocations still live are kept
+     * until they are freed.
+     */
+    void setEnabled(bool enabled, uint64_t sampleIntervalBytes = DEFAULT_SAMPLE_INTERVAL);
+    bool isEnabled();
+
+    /**
+     * @brief Sets how young a freed allocation must be to count as churn.
+     */
+    void setShortLivedThreshold(uint64_t nanoseconds);
+
+    /**
+     * @brief The hook's fast path: decides whether an allocation of size bytes is sampled.
+     *
+     * Costs one relaxed load when disabled, and a thread local subtraction when enabled.
+     * Allocators call recordAllocation() only when this returns true, and must remember that they did.
+     */
+    inline bool shouldSample(const size_t size) {
+        if (!detail::s_Enabled.load(std::memory_order_relaxed)) return false;
+        detail::t_BytesUntilSample -= static_cast<int64_t>(size);
+        if (detail::t_BytesUntilSample > 0) return false;
+        return detail::rearm();
+    }
+
+    /**
+     * @brief Records a sampled allocation with the caller's stack.
+     *
+     * @param tag Static string naming the allocator or category, e.g. "Vulkan/Object"
+     */
+    void recordAllocation(const void* pointer, size_t size, const char* tag);
+
+    /**
+     * @brief Records that an allocation recordAllocation() saw was freed. Only call it for those.
+     */
+    void recordFree(const void* pointer);
+
+    /// Everything sampled at one call stack under one tag
+    struct Site {
+        const char* tag = nullptr;
+        /// Innermost first, return addresses already moved into the call instruction
+        std::vector<uintptr_t> stack;
+        uint64_t sampledAllocations = 0;
+        /// Sampled allocations scaled up to estimate the real volume
+        double estimatedAllocations = 0.0;
+        double estimatedBytes = 0.0;
+        uint64_t sampledFrees = 0;
+        uint64_t shortLivedFrees = 0;
+        uint64_t totalLifetimeNanoseconds = 0;
+        /// Sampled allocations not freed yet, and their estimated bytes
+        uint64_t liveAllocations = 0;
+        double liveEstimatedBytes = 0.0;
+    };
+
+    struct Report {
+        uint64_t sampleIntervalBytes = 0;
+        uint64_t shortLivedNanoseconds = 0;
+        uint64_t sampledAllocations = 0;
+        double estimatedBytes = 0.0;
+        std::vector<Site> sites;
+    };
+
+    Report buildReport();
+
+    /**
+     * @brief Writes a text report: the top allocating sites by estimated bytes, the top churn sites by
+     *        short-lived allocations, and every site with live allocations (at shutdown: leaks).
+     *
+     * @param topSites Sites listed in each of the first two sections
+     * @return false if the file could not be written
+     */
+    bool writeReport(const std::filesystem::path& path, uint32_t topSites = 20);
+
+}
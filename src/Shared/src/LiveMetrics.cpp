@@ -0,0 +1,234 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#include "LiveMetrics.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/resource.h>
+#   include <unistd.h>
+#endif
+
+namespace VKING::LiveMetrics {
+
+    namespace {
+
+        using clock = std::chrono::steady_clock;
+
+        /// Weight of the newest frame in the moving average, about a 20 frame window
+        constexpr double AVERAGE_WEIGHT = 0.05;
+        constexpr auto WINDOW = std::chrono::seconds(1);
+
+        struct Publisher {
+            Block* block = nullptr;
+            std::string sharedMemoryName;
+
+            /// Registered queues. Names never change once queueCount covers them
+            std::mutex registryMutex;
+            char queueNames[MAX_QUEUES][sizeof(QueueDepth::name)] = {};
+            std::atomic<uint32_t> queueCount{0};
+            std::atomic<uint32_t> queueDepths[MAX_QUEUES] = {};
+
+            // Only touched by the thread publishing frames
+            Snapshot snapshot{};
+            clock::time_point start;
+            clock::time_point windowStart;
+            uint32_t windowFrames = 0;
+            double windowWorstMilliseconds = 0.0;
+        };
+
+        Publisher& getPublisher() {
+            // Intentionally leaked: queues may still report depths while static destructors run
+            static Publisher* s_Publisher = new Publisher();
+            return *s_Publisher;
+        }
+
+        void copyName(char* destination, const size_t capacity, const std::string_view name) {
+            const size_t length = std::min(name.size(), capacity - 1);
+            std::memcpy(destination, name.data(), length);
+            destination[length] = '\0';
+        }
+
+#if defined(__unix__) || defined(__APPLE__)
+
+        void readMemory(Snapshot& snapshot) {
+#if defined(__linux__)
+            // statm holds sizes in pages: total, then resident
+            if (std::FILE* statm = std::fopen("/proc/self/statm", "r")) {
+                unsigned long long totalPages = 0;
+                unsigned long long residentPages = 0;
+                if (std::fscanf(statm, "%llu %llu", &totalPages, &residentPages) == 2) {
+                    snapshot.residentBytes = residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+                }
+                std::fclose(statm);
+            }
+#endif
+            rusage usage{};
+            if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+                snapshot.peakResidentBytes = static_cast<uint64_t>(usage.ru_maxrss);
+#else
+                snapshot.peakResidentBytes = static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+            }
+        }
+
+        void write(Publisher& publisher) {
+            Block& block = *publisher.block;
+            const uint64_t sequence = block.sequence.load(std::memory_order_relaxed);
+            block.sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            std::memcpy(&block.snapshot, &publisher.snapshot, sizeof(Snapshot));
+            block.sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+#endif
+
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    bool open(const std::string_view application) {
+        Publisher& publisher = getPublisher();
+        if (publisher.block) return true;
+
+        const std::string name = getSharedMemoryName(static_cast<int>(getpid()));
+        const int file = shm_open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+        if (file < 0) return false;
+        if (ftruncate(file, sizeof(Block)) != 0) {
+            ::close(file);
+            shm_unlink(name.c_str());
+            return false;
+        }
+        void* memory = mmap(nullptr, sizeof(Block), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        ::close(file);
+        if (memory == MAP_FAILED) {
+            shm_unlink(name.c_str());
+            return false;
+        }
+
+        Block* block = new (memory) Block{};
+        block->header.version = LAYOUT_VERSION;
+        block->header.blockSize = sizeof(Block);
+        block->header.processId = static_cast<int32_t>(getpid());
+        copyName(block->header.application, sizeof(block->header.application), application);
+        block->header.startUnixSeconds = static_cast<int64_t>(std::time(nullptr));
+
+        publisher.block = block;
+        publisher.sharedMemoryName = name;
+        publisher.start = clock::now();
+        publisher.windowStart = publisher.start;
+        publisher.snapshot = {};
+        publisher.snapshot.state = State::RUNNING;
+        readMemory(publisher.snapshot);
+        write(publisher);
+
+        // Readers check the magic first, so it goes in last
+        std::atomic_thread_fence(std::memory_order_release);
+        block->header.magic = MAGIC;
+        return true;
+    }
+
+    void close() {
+        Publisher& publisher = getPublisher();
+        if (!publisher.block) return;
+
+        publisher.snapshot.state = State::EXITED;
+        write(publisher);
+        munmap(publisher.block, sizeof(Block));
+        shm_unlink(publisher.sharedMemoryName.c_str());
+        publisher.block = nullptr;
+    }
+
+    void publishFrame(const double frameMilliseconds) {
+        Publisher& publisher = getPublisher();
+        if (!publisher.block) return;
+
+        Snapshot& snapshot = publisher.snapshot;
+        const auto now = clock::now();
+        snapshot.frameIndex++;
+        snapshot.uptimeMilliseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now - publisher.start).count());
+        snapshot.frameMilliseconds = frameMilliseconds;
+        snapshot.averageFrameMilliseconds = snapshot.frameIndex == 1 ? frameMilliseconds
+            : snapshot.averageFrameMilliseconds + AVERAGE_WEIGHT * (frameMilliseconds - snapshot.averageFrameMilliseconds);
+
+        publisher.windowFrames++;
+        publisher.windowWorstMilliseconds = std::max(publisher.windowWorstMilliseconds, frameMilliseconds);
+        if (now - publisher.windowStart >= WINDOW) {
+            snapshot.framesPerSecond = publisher.windowFrames / std::chrono::duration<double>(now - publisher.windowStart).count();
+            snapshot.worstFrameMilliseconds = publisher.windowWorstMilliseconds;
+            publisher.windowStart = now;
+            publisher.windowFrames = 0;
+            publisher.windowWorstMilliseconds = 0.0;
+            readMemory(snapshot);
+        }
+
+        const uint32_t queueCount = publisher.queueCount.load(std::memory_order_acquire);
+        for (uint32_t i = snapshot.queueCount; i < queueCount; i++) {
+            std::memcpy(snapshot.queues[i].name, publisher.queueNames[i], sizeof(QueueDepth::name));
+        }
+        snapshot.queueCount = queueCount;
+        for (uint32_t i = 0; i < queueCount; i++) snapshot.queues[i].depth = publisher.queueDepths[i].load(std::memory_order_relaxed);
+
+        write(publisher);
+    }
+
+#else
+
+    bool open(std::string_view) {
+        return false;
+    }
+
+    void close() {}
+
+    void publishFrame(double) {}
+
+#endif
+
+    bool isOpen() {
+        return getPublisher().block != nullptr;
+    }
+
+    uint32_t registerQueue(const std::string_view name) {
+        Publisher& publisher = getPublisher();
+        std::lock_guard lock(publisher.registryMutex);
+        const uint32_t queue = publisher.queueCount.load(std::memory_order_relaxed);
+        if (queue >= MAX_QUEUES) return INVALID_QUEUE;
+        copyName(publisher.queueNames[queue], sizeof(publisher.queueNames[queue]), name);
+        publisher.queueCount.store(queue + 1, std::memory_order_release);
+        return queue;
+    }
+
+    void setQueueDepth(const uint32_t queue, const uint32_t depth) {
+        if (queue >= MAX_QUEUES) return;
+        getPublisher().queueDepths[queue].store(depth, std::memory_order_relaxed);
+    }
+
+}
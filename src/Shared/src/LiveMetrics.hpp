@@ -0,0 +1,144 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+/**
+ * Live metrics other processes can read while the engine runs.
+ *
+ * The engine maps one Block into POSIX shared memory under getSharedMemoryName(pid) and rewrites its snapshot
+ * once per frame under a seqlock: the sequence is odd while a write is in progress, and a reader retries
+ * whenever it changed during its copy. Readers never block the engine. VKING_Top is the reference reader.
+ */
+namespace VKING::LiveMetrics {
+
+    constexpr uint32_t MAGIC = 0x4D4C4B56; // "VKLM"
+    /// Bumped whenever the layout below changes, readers refuse other versions
+    constexpr uint32_t LAYOUT_VERSION = 1;
+    constexpr uint32_t MAX_QUEUES = 8;
+    constexpr uint32_t INVALID_QUEUE = UINT32_MAX;
+
+    enum class State : uint32_t {
+        RUNNING,
+        EXITED
+    };
+
+    struct QueueDepth {
+        char name[28];
+        uint32_t depth;
+    };
+
+    /// Everything a reader copies out at once
+    struct Snapshot {
+        State state;
+        uint32_t queueCount;
+        uint64_t frameIndex;
+        uint64_t uptimeMilliseconds;
+        double frameMilliseconds;
+        /// Exponential moving average over roughly the last 20 frames
+        double averageFrameMilliseconds;
+        /// Worst frame and frame rate of the last complete second
+        double worstFrameMilliseconds;
+        double framesPerSecond;
+        uint64_t residentBytes;
+        uint64_t peakResidentBytes;
+        QueueDepth queues[MAX_QUEUES];
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t blockSize;
+        int32_t processId;
+        char application[64];
+        int64_t startUnixSeconds;
+    };
+
+    struct Block {
+        Header header;
+        alignas(64) std::atomic<uint64_t> sequence;
+        Snapshot snapshot;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "The seqlock must work across processes");
+
+    inline std::string getSharedMemoryName(const int processId) {
+        return "/VKING." + std::to_string(processId);
+    }
+
+    /**
+     * @brief Copies a consistent snapshot out of a mapped block.
+     *
+     * @return false if the writer kept changing it (it is paused mid-write, or crashed there)
+     */
+    inline bool readSnapshot(const Block& block, Snapshot& snapshot) {
+        for (uint32_t attempt = 0; attempt < 1000; attempt++) {
+            const uint64_t before = block.sequence.load(std::memory_order_acquire);
+            if (before & 1) continue;
+            std::memcpy(&snapshot, &block.snapshot, sizeof(Snapshot));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (block.sequence.load(std::memory_order_relaxed) == before) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Creates and maps this process's block. POSIX only.
+     *
+     * @param application Shown by readers, truncated to 63 characters
+     * @return false if shared memory is unavailable, the engine then runs without publishing
+     */
+    bool open(std::string_view application);
+
+    /**
+     * @brief Marks the block as exited, unmaps and removes it.
+     */
+    void close();
+
+    bool isOpen();
+
+    /**
+     * @brief Adds a queue whose depth is published with every frame.
+     *
+     * @return The slot to pass to setQueueDepth(), or INVALID_QUEUE once MAX_QUEUES are registered
+     */
+    uint32_t registerQueue(std::string_view name);
+
+    /**
+     * @brief Notes a queue's current depth. One relaxed store, the value goes out with the next frame.
+     */
+    void setQueueDepth(uint32_t queue, uint32_t depth);
+
+    /**
+     * @brief Publishes the frame that just ended. Called once per frame by the application loop.
+     *
+     * Resident memory is sampled once a second, everything else is a handful of stores.
+     */
+    void publishFrame(double frameMilliseconds);
+
+}
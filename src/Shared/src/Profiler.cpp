@@ -0,0 +1,582 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
+
+namespace VKING::Profiler::detail {
+
+    struct ThreadCounters {
+#if defined(__linux__)
+        int fds[COUNTER_COUNT] = {-1, -1, -1, -1};
+        /// Mapped control page of each counter, for reading it with rdpmc. nullptr falls back to read()
+        const volatile perf_event_mmap_page* pages[COUNTER_COUNT] = {};
+        size_t pageSize = 0;
+
+        ~ThreadCounters() {
+            for (uint32_t i = 0; i < COUNTER_COUNT; i++) {
+                if (pages[i]) munmap(const_cast<perf_event_mmap_page*>(pages[i]), pageSize);
+                if (fds[i] >= 0) close(fds[i]);
+            }
+        }
+#endif
+    };
+
+}
+
+namespace VKING::Profiler {
+
+    namespace {
+
+        /// Cap on the history whatever the frame count, for frames with unusually many zones
+        constexpr size_t MAX_RETAINED_EVENTS = size_t{1} << 20;
+
+        /// Thread id used for the frame track in exported traces
+        constexpr uint32_t FRAME_TRACK_ID = 0;
+
+        struct ThreadRecord {
+            std::unique_ptr<ThreadBuffer> buffer;
+            std::string name;
+            std::unique_ptr<detail::ThreadCounters> counters;
+            std::unique_ptr<CounterSample[]> counterSamples;
+            /// Set when the thread exits. The record is freed by the next markFrame(), once its last events were drained
+            bool exited = false;
+        };
+
+        struct CollectedEvent {
+            const ZoneInfo* zone;
+            uint64_t begin;
+            uint64_t end;
+            uint32_t threadId;
+            CounterSample counters;
+        };
+
+        /// Set on a thread once opening its counters failed, so it never retries
+        constinit thread_local bool t_CountersUnavailable = false;
+
+#if defined(__linux__)
+        int openCounter(const uint32_t type, const uint64_t config, const int groupFd) {
+            perf_event_attr attributes{};
+            attributes.size = sizeof(attributes);
+            attributes.type = type;
+            attributes.config = config;
+            attributes.disabled = groupFd == -1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+        }
+
+        uint64_t readCounter(const int fd, const volatile perf_event_mmap_page* page) {
+#   if defined(__x86_64__) || defined(__i386__)
+            // Self-monitoring without a system call, following the protocol in linux/perf_event.h
+            if (page) {
+                uint32_t sequence;
+                uint64_t count;
+                bool readable;
+                do {
+                    sequence = page->lock;
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                    const uint32_t index = page->index;
+                    count = static_cast<uint64_t>(page->offset);
+                    readable = page->cap_user_rdpmc && index != 0;
+                    if (readable) {
+                        const uint32_t width = page->pmc_width;
+                        int64_t pmc = static_cast<int64_t>(__rdpmc(static_cast<int>(index - 1)));
+                        pmc = (pmc << (64 - width)) >> (64 - width);
+                        count += static_cast<uint64_t>(pmc);
+                    }
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                } while (page->lock != sequence);
+                if (readable) return count;
+            }
+#   endif
+            uint64_t value = 0;
+            if (::read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) return 0;
+            return value;
+        }
+#endif
+
+        std::unique_ptr<detail::ThreadCounters> createThreadCounters() {
+#if defined(__linux__)
+            auto counters = std::make_unique<detail::ThreadCounters>();
+            constexpr uint64_t LLC_READ_MISS = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+            int& leader = counters->fds[static_cast<uint32_t>(Counter::CYCLES)];
+            leader = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+            if (leader < 0) return nullptr;
+            counters->fds[static_cast<uint32_t>(Counter::INSTRUCTIONS)] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, leader);
+            int& llcMisses = counters->fds[static_cast<uint32_t>(Counter::LLC_MISSES)];
+            llcMisses = openCounter(PERF_TYPE_HW_CACHE, LLC_READ_MISS, leader);
+            // Some PMUs have no last level cache event, the generic cache miss event usually means the same
+            if (llcMisses < 0) llcMisses = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, leader);
+            counters->fds[static_cast<uint32_t>(Counter::BRANCH_MISSES)] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, leader);
+            for (const int fd : counters->fds) {
+                if (fd < 0) return nullptr;
+            }
+
+            counters->pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            for (uint32_t i = 0; i < COUNTER_COUNT; i++) {
+                void* page = mmap(nullptr, counters->pageSize, PROT_READ, MAP_SHARED, counters->fds[i], 0);
+                if (page != MAP_FAILED) counters->pages[i] = static_cast<const volatile perf_event_mmap_page*>(page);
+            }
+
+            ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            if (ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0) return nullptr;
+            return counters;
+#else
+            return nullptr;
+#endif
+        }
+
+        struct Collector {
+            // Guards threads and the two below. Taken once per thread on registration and exit and by the collector, never by ScopedZone
+            std::mutex registryMutex;
+            std::vector<ThreadRecord> threads;
+            /// Thread ids are never reused, so events of an exited thread are not attributed to a later one
+            uint32_t nextThreadId = 1;
+            /// Drops of threads whose records are already gone
+            uint64_t retiredDroppedEvents = 0;
+
+            // Guards everything below
+            std::mutex historyMutex;
+            std::deque<CollectedEvent> events;
+            /// Timestamp of every retained markFrame() call. Frame i spans frameBoundaries[i] to frameBoundaries[i + 1]
+            std::deque<uint64_t> frameBoundaries;
+            uint32_t retainedFrames = DEFAULT_RETAINED_FRAMES;
+            uint64_t frameCount = 0;
+            uint64_t droppedEvents = 0;
+            /// Events ever drained, and that count when the last frame closed. Their difference is what ended during the frame
+            uint64_t drainedEvents = 0;
+            uint64_t drainedEventsAtFrame = 0;
+            std::atomic<FrameListener> frameListener{nullptr};
+            std::vector<FrameZone> frameZones;
+
+            const uint64_t calibrationTicks = readTimestamp();
+            const std::chrono::steady_clock::time_point calibrationTime = std::chrono::steady_clock::now();
+            double ticksPerNanosecond = 1.0;
+        };
+
+        Collector& getCollector() {
+            // Intentionally leaked: threads may still record zones while static destructors run
+            static Collector* s_Collector = new Collector();
+            return *s_Collector;
+        }
+
+        /// Refines the tick rate from the time elapsed since the collector was created. Requires historyMutex
+        void calibrate(Collector& collector) {
+            const uint64_t ticks = readTimestamp() - collector.calibrationTicks;
+            const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - collector.calibrationTime).count();
+            // Below a millisecond the steady_clock resolution dominates the estimate
+            if (nanoseconds > 1'000'000 && ticks > 0) collector.ticksPerNanosecond = static_cast<double>(ticks) / static_cast<double>(nanoseconds);
+        }
+
+        /// Requires registryMutex
+        ThreadRecord* findThread(Collector& collector, const uint32_t threadId) {
+            const auto found = std::ranges::find(collector.threads, threadId, [](const ThreadRecord& thread) { return thread.buffer->threadId; });
+            return found == collector.threads.end() ? nullptr : &*found;
+        }
+
+        /// Drains every thread buffer into the history. Requires historyMutex
+        void drainThreads(Collector& collector) {
+            std::lock_guard registryLock(collector.registryMutex);
+
+            uint64_t dropped = collector.retiredDroppedEvents;
+            for (const ThreadRecord& thread : collector.threads) {
+                ThreadBuffer& buffer = *thread.buffer;
+                const uint64_t write = buffer.writeIndex.load(std::memory_order_acquire);
+                const CounterSample* counterSamples = buffer.counterSamples.load(std::memory_order_acquire);
+                uint64_t read = buffer.readIndex.load(std::memory_order_relaxed);
+                for (; read < write; read++) {
+                    const uint64_t slot = read & (THREAD_BUFFER_CAPACITY - 1);
+                    const Event& event = buffer.events[slot];
+                    collector.events.push_back({event.zone, event.begin, event.end, buffer.threadId, CounterSample{}});
+                    if (counterSamples) collector.events.back().counters = counterSamples[slot];
+                    collector.drainedEvents++;
+                }
+                buffer.readIndex.store(read, std::memory_order_release);
+                dropped += buffer.droppedEvents.load(std::memory_order_relaxed);
+            }
+            collector.droppedEvents = dropped;
+
+            if (collector.events.size() > MAX_RETAINED_EVENTS) {
+                collector.events.erase(collector.events.begin(), collector.events.begin() + static_cast<std::ptrdiff_t>(collector.events.size() - MAX_RETAINED_EVENTS));
+            }
+        }
+
+        /// Frees the records of exited threads. Requires historyMutex, right after a drain, so nothing they recorded is lost
+        void releaseExitedThreads(Collector& collector) {
+            std::lock_guard registryLock(collector.registryMutex);
+            std::erase_if(collector.threads, [&collector](const ThreadRecord& thread) {
+                if (!thread.exited) return false;
+                collector.retiredDroppedEvents += thread.buffer->droppedEvents.load(std::memory_order_relaxed);
+                return true;
+            });
+        }
+
+        /// Drops the events that ended before the oldest retained frame. Requires historyMutex
+        void discardExpiredEvents(Collector& collector) {
+            const uint64_t oldest = collector.frameBoundaries.front();
+            // Events are in drain order and every drain happens at a frame boundary, so the expired ones come first
+            while (!collector.events.empty() && collector.events.front().end < oldest) collector.events.pop_front();
+        }
+
+        /// Gives the frame that just closed to the listener. Requires historyMutex, after the frame's events were drained
+        void notifyFrameListener(Collector& collector, const FrameListener listener) {
+            const size_t boundaries = collector.frameBoundaries.size();
+            const uint64_t newEvents = collector.drainedEvents - collector.drainedEventsAtFrame;
+            collector.drainedEventsAtFrame = collector.drainedEvents;
+            if (boundaries < 2) return;
+
+            calibrate(collector);
+            const uint64_t frameBegin = collector.frameBoundaries[boundaries - 2];
+            const uint64_t frameEnd = collector.frameBoundaries[boundaries - 1];
+            auto toNanoseconds = [&](const int64_t ticks) {
+                return static_cast<int64_t>(static_cast<double>(ticks) / collector.ticksPerNanosecond);
+            };
+
+            collector.frameZones.clear();
+            const size_t count = static_cast<size_t>(std::min<uint64_t>(newEvents, collector.events.size()));
+            for (size_t i = collector.events.size() - count; i < collector.events.size(); i++) {
+                const CollectedEvent& event = collector.events[i];
+                collector.frameZones.push_back({event.zone, event.threadId, toNanoseconds(static_cast<int64_t>(event.begin - frameBegin)),
+                                                static_cast<uint64_t>(toNanoseconds(static_cast<int64_t>(event.end - event.begin))), event.counters});
+            }
+
+            const auto calibrationNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(collector.calibrationTime.time_since_epoch()).count();
+            const FrameRecord frame{
+                collector.frameCount - 2,
+                static_cast<uint64_t>(calibrationNanoseconds + toNanoseconds(static_cast<int64_t>(frameBegin - collector.calibrationTicks))),
+                static_cast<uint64_t>(toNanoseconds(static_cast<int64_t>(frameEnd - frameBegin))),
+                collector.frameZones.data(),
+                collector.frameZones.size()
+            };
+            listener(frame);
+        }
+
+        void writeEscaped(std::FILE* file, const char* text) {
+            for (; *text; text++) {
+                const char c = *text;
+                if (c == '"' || c == '\\') {
+                    std::fputc('\\', file);
+                    std::fputc(c, file);
+                } else if (static_cast<unsigned char>(c) < 0x20) {
+                    std::fprintf(file, "\\u%04x", static_cast<unsigned>(c));
+                } else {
+                    std::fputc(c, file);
+                }
+            }
+        }
+
+        /// Retires a thread's record when it exits, so short-lived threads do not each keep a buffer for the rest of the process
+        struct ThreadExitGuard {
+            bool registered = false;
+
+            ~ThreadExitGuard() {
+                if (!registered) return;
+                Collector& collector = getCollector();
+                std::lock_guard lock(collector.registryMutex);
+                if (ThreadRecord* record = findThread(collector, detail::t_ThreadBuffer->threadId)) {
+                    record->exited = true;
+                    // Counters count this thread only, they are of no use once it is gone
+                    record->counters.reset();
+                }
+                detail::t_ThreadBuffer = nullptr;
+                detail::t_ThreadCounters = nullptr;
+            }
+        };
+
+        thread_local ThreadExitGuard t_ExitGuard;
+
+    }
+
+    ThreadBuffer* detail::registerCurrentThread() {
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.registryMutex);
+
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->threadId = collector.nextThreadId++;
+        t_ThreadBuffer = buffer.get();
+        collector.threads.push_back({std::move(buffer), "Thread " + std::to_string(t_ThreadBuffer->threadId), nullptr, nullptr});
+        t_ExitGuard.registered = true;
+        return t_ThreadBuffer;
+    }
+
+    detail::ThreadCounters* detail::openThreadCounters() {
+        if (t_CountersUnavailable) return nullptr;
+        ThreadBuffer* buffer = t_ThreadBuffer ? t_ThreadBuffer : registerCurrentThread();
+
+        std::unique_ptr<ThreadCounters> counters = createThreadCounters();
+        if (!counters) {
+            t_CountersUnavailable = true;
+            return nullptr;
+        }
+
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.registryMutex);
+        ThreadRecord& record = *findThread(collector, buffer->threadId);
+        // Value initialized: slots written before this point read as not counted
+        record.counterSamples = std::make_unique<CounterSample[]>(THREAD_BUFFER_CAPACITY);
+        buffer->counterSamples.store(record.counterSamples.get(), std::memory_order_release);
+        record.counters = std::move(counters);
+        t_ThreadCounters = record.counters.get();
+        return t_ThreadCounters;
+    }
+
+    void detail::readCounters([[maybe_unused]] const ThreadCounters* counters, CounterSample& sample) {
+#if defined(__linux__)
+        for (uint32_t i = 0; i < COUNTER_COUNT; i++) sample.values[i] = readCounter(counters->fds[i], counters->pages[i]);
+#else
+        for (uint64_t& value : sample.values) value = 0;
+#endif
+    }
+
+    bool setHardwareCountersEnabled(const bool enabled) {
+        detail::s_CountersEnabled.store(enabled, std::memory_order_relaxed);
+        if (!enabled) return true;
+        return detail::t_ThreadCounters || detail::openThreadCounters();
+    }
+
+    bool areHardwareCountersEnabled() {
+        return detail::s_CountersEnabled.load(std::memory_order_relaxed);
+    }
+
+    const char* getCounterName(const Counter counter) {
+        switch (counter) {
+            case Counter::CYCLES: return "cycles";
+            case Counter::INSTRUCTIONS: return "instructions";
+            case Counter::LLC_MISSES: return "llcMisses";
+            case Counter::BRANCH_MISSES: return "branchMisses";
+        }
+        return "unknown";
+    }
+
+    void markFrame() {
+        const uint64_t now = readTimestamp();
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.historyMutex);
+
+        collector.frameBoundaries.push_back(now);
+        collector.frameCount++;
+        while (collector.frameBoundaries.size() > size_t{collector.retainedFrames} + 1) collector.frameBoundaries.pop_front();
+        drainThreads(collector);
+        // Until the first frame is discarded the history still starts at startup, which a whole-run trace wants
+        if (collector.frameCount > uint64_t{collector.retainedFrames} + 1) discardExpiredEvents(collector);
+        if (const FrameListener listener = collector.frameListener.load(std::memory_order_acquire)) notifyFrameListener(collector, listener);
+        // After the listener, which may still ask for the names of threads that just exited
+        releaseExitedThreads(collector);
+    }
+
+    void setThreadName(const std::string_view name) {
+        ThreadBuffer* buffer = detail::t_ThreadBuffer ? detail::t_ThreadBuffer : detail::registerCurrentThread();
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.registryMutex);
+        findThread(collector, buffer->threadId)->name = name;
+    }
+
+    std::string getThreadName(const uint32_t threadId) {
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.registryMutex);
+        const ThreadRecord* record = findThread(collector, threadId);
+        return record ? record->name : std::string();
+    }
+
+    void setFrameListener(const FrameListener listener) {
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.historyMutex);
+        // Events drained before the listener existed belong to no frame it will see
+        collector.drainedEventsAtFrame = collector.drainedEvents;
+        collector.frameListener.store(listener, std::memory_order_release);
+    }
+
+    void setRetainedFrames(const uint32_t frames) {
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.historyMutex);
+        collector.retainedFrames = std::clamp(frames, 1u, MAX_RETAINED_FRAMES);
+    }
+
+    uint32_t getRetainedFrames() {
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.historyMutex);
+        return collector.retainedFrames;
+    }
+
+    void setCapturing(const bool capturing) {
+        detail::s_Capturing.store(capturing, std::memory_order_relaxed);
+    }
+
+    bool isCapturing() {
+        return detail::s_Capturing.load(std::memory_order_relaxed);
+    }
+
+    void collect() {
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.historyMutex);
+        drainThreads(collector);
+    }
+
+    bool exportChromeTrace(const std::filesystem::path& path, const uint32_t lastFrames) {
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.historyMutex);
+        drainThreads(collector);
+        calibrate(collector);
+
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        if (!file) return false;
+
+        // Export window in ticks
+        uint64_t windowBegin = 0;
+        uint64_t windowEnd = UINT64_MAX;
+        size_t firstBoundary = 0;
+        if (lastFrames > 0 && collector.frameBoundaries.size() > 1) {
+            firstBoundary = collector.frameBoundaries.size() - 1 - std::min<size_t>(lastFrames, collector.frameBoundaries.size() - 1);
+            windowBegin = collector.frameBoundaries[firstBoundary];
+            windowEnd = collector.frameBoundaries.back();
+        }
+
+        const double ticksPerMicrosecond = collector.ticksPerNanosecond * 1000.0;
+        auto toMicroseconds = [&](const uint64_t ticks) {
+            return static_cast<double>(static_cast<int64_t>(ticks - collector.calibrationTicks)) / ticksPerMicrosecond;
+        };
+
+        std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+        std::fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"VKING\"}},\n");
+        std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Frames\"}}", FRAME_TRACK_ID);
+        {
+            std::lock_guard registryLock(collector.registryMutex);
+            for (const ThreadRecord& thread : collector.threads) {
+                std::fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", thread.buffer->threadId);
+                writeEscaped(file, thread.name.c_str());
+                std::fprintf(file, "\"}}");
+            }
+        }
+
+        // Frame n spans the n-th and (n + 1)-th markFrame() calls, counting from 0
+        const uint64_t firstMarkIndex = collector.frameCount - collector.frameBoundaries.size();
+        for (size_t i = firstBoundary; i + 1 < collector.frameBoundaries.size(); i++) {
+            const uint64_t begin = collector.frameBoundaries[i];
+            const uint64_t end = collector.frameBoundaries[i + 1];
+            std::fprintf(file, ",\n{\"name\":\"Frame %llu\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                         static_cast<unsigned long long>(firstMarkIndex + i), FRAME_TRACK_ID, toMicroseconds(begin),
+                         static_cast<double>(end - begin) / ticksPerMicrosecond);
+        }
+
+        for (const CollectedEvent& event : collector.events) {
+            if (event.end < windowBegin || event.begin > windowEnd) continue;
+            std::fprintf(file, ",\n{\"name\":\"");
+            writeEscaped(file, event.zone->name);
+            std::fprintf(file, "\",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"file\":\"",
+                         event.threadId, toMicroseconds(event.begin), static_cast<double>(event.end - event.begin) / ticksPerMicrosecond);
+            writeEscaped(file, event.zone->file);
+            std::fprintf(file, "\",\"line\":%u", event.zone->line);
+            if (event.counters.counted) {
+                for (uint32_t i = 0; i < COUNTER_COUNT; i++) {
+                    std::fprintf(file, ",\"%s\":%llu", getCounterName(static_cast<Counter>(i)), static_cast<unsigned long long>(event.counters.values[i]));
+                }
+                const uint64_t cycles = event.counters.values[static_cast<uint32_t>(Counter::CYCLES)];
+                const uint64_t instructions = event.counters.values[static_cast<uint32_t>(Counter::INSTRUCTIONS)];
+                std::fprintf(file, ",\"ipc\":%.3f", cycles ? static_cast<double>(instructions) / static_cast<double>(cycles) : 0.0);
+            }
+            std::fprintf(file, "}}");
+        }
+
+        std::fprintf(file, "\n]}\n");
+        const bool success = std::ferror(file) == 0;
+        return std::fclose(file) == 0 && success;
+    }
+
+    Stats getStats() {
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.historyMutex);
+        calibrate(collector);
+
+        Stats stats;
+        {
+            std::lock_guard registryLock(collector.registryMutex);
+            for (const ThreadRecord& thread : collector.threads) {
+                if (thread.exited) continue;
+                stats.threadCount++;
+                if (thread.counters) stats.countedThreadCount++;
+            }
+        }
+        stats.frameCount = collector.frameCount;
+        stats.retainedEvents = collector.events.size();
+        stats.droppedEvents = collector.droppedEvents;
+        stats.ticksPerNanosecond = collector.ticksPerNanosecond;
+        return stats;
+    }
+
+    FrameSummary summarizeFrames(const uint32_t lastFrames) {
+        Collector& collector = getCollector();
+        std::lock_guard lock(collector.historyMutex);
+        drainThreads(collector);
+        calibrate(collector);
+
+        FrameSummary summary;
+        const std::deque<uint64_t>& boundaries = collector.frameBoundaries;
+        if (boundaries.size() < 2) return summary;
+
+        const size_t availableFrames = boundaries.size() - 1;
+        const size_t frameCount = lastFrames > 0 ? std::min<size_t>(lastFrames, availableFrames) : availableFrames;
+        const auto first = boundaries.end() - static_cast<std::ptrdiff_t>(frameCount + 1);
+
+        summary.frameNanoseconds.reserve(frameCount);
+        for (auto boundary = first; boundary + 1 != boundaries.end(); ++boundary) {
+            summary.frameNanoseconds.push_back(static_cast<double>(*(boundary + 1) - *boundary) / collector.ticksPerNanosecond);
+        }
+
+        // Call sites with the same name are merged
+        std::unordered_map<std::string_view, size_t> zoneIndices;
+        for (const CollectedEvent& event : collector.events) {
+            const auto next = std::upper_bound(first, boundaries.end(), event.begin);
+            if (next == first || next == boundaries.end()) continue;
+            const size_t frame = static_cast<size_t>(next - first) - 1;
+
+            const auto [found, inserted] = zoneIndices.try_emplace(event.zone->name, summary.zones.size());
+            if (inserted) summary.zones.push_back({event.zone->name, 0, std::vector<double>(frameCount, 0.0)});
+            ZoneSummary& zone = summary.zones[found->second];
+            zone.calls++;
+            zone.frameNanoseconds[frame] += static_cast<double>(event.end - event.begin) / collector.ticksPerNanosecond;
+            if (event.counters.counted) {
+                zone.countedCalls++;
+                for (uint32_t i = 0; i < COUNTER_COUNT; i++) zone.counters[i] += event.counters.values[i];
+            }
+        }
+        return summary;
+    }
+
+}
@@ -0,0 +1,381 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#   include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#   include <x86intrin.h>
+#endif
+
+/**
+ * VKING_PROFILER_ENABLED is set by the VKING_ENABLE_PROFILER CMake option. When it is 0 every
+ * VKING_PROFILE_* macro expands to nothing, so instrumentation can stay in shipping code.
+ */
+#ifndef VKING_PROFILER_ENABLED
+#   define VKING_PROFILER_ENABLED 0
+#endif
+
+namespace VKING::Profiler {
+
+    /**
+     * @brief Static description of one instrumented scope. One instance exists per call site.
+     *
+     * @note name must outlive the profiler, in practice it is always a string literal.
+     */
+    struct ZoneInfo {
+        const char* name;
+        const char* file;
+        uint32_t line;
+    };
+
+    /// One completed zone, in raw timestamp ticks
+    struct Event {
+        const ZoneInfo* zone;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    /// Events each thread can hold between two collections. Power of two
+    constexpr uint32_t THREAD_BUFFER_CAPACITY = 1u << 14;
+
+    /// Hardware counters sampled at zone boundaries, see setHardwareCountersEnabled()
+    enum class Counter : uint32_t {
+        CYCLES,
+        INSTRUCTIONS,
+        LLC_MISSES,
+        BRANCH_MISSES
+    };
+    constexpr uint32_t COUNTER_COUNT = 4;
+
+    /// Counter deltas of one zone, indexed by Counter
+    struct CounterSample {
+        uint64_t values[COUNTER_COUNT];
+        /// false if the zone ran without counters
+        bool counted;
+    };
+
+    /**
+     * @brief Single producer, single consumer ring of events owned by one thread.
+     *
+     * Only the owning thread pushes and only the collector pops, so neither side ever takes a lock.
+     * A full ring drops new events instead of blocking, the drop count is reported by getStats().
+     */
+    struct ThreadBuffer {
+        Event events[THREAD_BUFFER_CAPACITY];
+        /// Parallel to events once this thread opened hardware counters, nullptr before
+        std::atomic<CounterSample*> counterSamples{nullptr};
+        alignas(64) std::atomic<uint64_t> writeIndex{0};
+        std::atomic<uint64_t> droppedEvents{0};
+        alignas(64) std::atomic<uint64_t> readIndex{0};
+        uint32_t threadId = 0;
+
+        void push(const Event& event, const CounterSample* counters = nullptr) {
+            const uint64_t write = writeIndex.load(std::memory_order_relaxed);
+            if (write - readIndex.load(std::memory_order_acquire) >= THREAD_BUFFER_CAPACITY) {
+                droppedEvents.store(droppedEvents.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return;
+            }
+            const uint64_t slot = write & (THREAD_BUFFER_CAPACITY - 1);
+            events[slot] = event;
+            if (CounterSample* samples = counterSamples.load(std::memory_order_relaxed)) {
+                if (counters) samples[slot] = *counters;
+                else samples[slot].counted = false;
+            }
+            writeIndex.store(write + 1, std::memory_order_release);
+        }
+    };
+
+    namespace detail {
+        /// Open counter group of one thread, platform specific
+        struct ThreadCounters;
+
+        inline constinit thread_local ThreadBuffer* t_ThreadBuffer = nullptr;
+        inline constinit thread_local ThreadCounters* t_ThreadCounters = nullptr;
+        inline constinit std::atomic_bool s_Capturing{true};
+        inline constinit std::atomic_bool s_CountersEnabled{false};
+
+        /**
+         * @brief Allocates and registers the calling thread's buffer. Slow path, once per thread.
+         */
+        ThreadBuffer* registerCurrentThread();
+
+        /**
+         * @brief Opens the calling thread's counters. Slow path, once per thread.
+         *
+         * @return nullptr if counters are unavailable on this thread, later calls then fail fast
+         */
+        ThreadCounters* openThreadCounters();
+
+        void readCounters(const ThreadCounters* counters, CounterSample& sample);
+    }
+
+    /**
+     * @brief Reads the cheapest monotonic tick counter available (TSC on x86, the virtual counter on ARM64).
+     *
+     * Ticks are converted to nanoseconds by the collector, which calibrates them against steady_clock.
+     */
+    inline uint64_t readTimestamp() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief Records the lifetime of a scope. Use VKING_PROFILE_SCOPE instead of constructing this directly.
+     */
+    class ScopedZone {
+    public:
+        explicit ScopedZone(const ZoneInfo* zone)
+            : m_Zone(detail::s_Capturing.load(std::memory_order_relaxed) ? zone : nullptr) {
+            if (!m_Zone) return;
+            if (detail::s_CountersEnabled.load(std::memory_order_relaxed)) {
+                m_Counters = detail::t_ThreadCounters ? detail::t_ThreadCounters : detail::openThreadCounters();
+                if (m_Counters) detail::readCounters(m_Counters, m_CounterBegin);
+            }
+            m_Begin = readTimestamp();
+        }
+
+        ~ScopedZone() {
+            if (!m_Zone) return;
+            const uint64_t end = readTimestamp();
+            ThreadBuffer* buffer = detail::t_ThreadBuffer;
+            if (!buffer) buffer = detail::registerCurrentThread();
+            if (!m_Counters) {
+                buffer->push({m_Zone, m_Begin, end});
+                return;
+            }
+
+            CounterSample counters;
+            detail::readCounters(m_Counters, counters);
+            for (uint32_t i = 0; i < COUNTER_COUNT; i++) counters.values[i] -= m_CounterBegin.values[i];
+            counters.counted = true;
+            buffer->push({m_Zone, m_Begin, end}, &counters);
+        }
+
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+
+    private:
+        const ZoneInfo* m_Zone;
+        uint64_t m_Begin = 0;
+        const detail::ThreadCounters* m_Counters = nullptr;
+        CounterSample m_CounterBegin;
+    };
+
+    struct Stats {
+        /// Threads that recorded zones and are still running. Exited threads are released by the next markFrame()
+        uint32_t threadCount = 0;
+        uint64_t frameCount = 0;
+        /// Events currently held by the collector
+        uint64_t retainedEvents = 0;
+        /// Events lost because a thread's ring filled up between two collections
+        uint64_t droppedEvents = 0;
+        /// Timestamp ticks per nanosecond, as last calibrated
+        double ticksPerNanosecond = 1.0;
+        /// Threads whose zones carry hardware counters
+        uint32_t countedThreadCount = 0;
+    };
+
+    /**
+     * @brief Marks the end of a frame and the start of the next one, then collects every thread's events.
+     *
+     * Called once per frame from the main loop through VKING_PROFILE_FRAME.
+     */
+    void markFrame();
+
+    /**
+     * @brief Names the calling thread in exported traces.
+     */
+    void setThreadName(std::string_view name);
+
+    /**
+     * @return The name setThreadName() gave a thread, as used in exported traces. Empty once the thread exited and
+     *         the frame after that was marked
+     */
+    std::string getThreadName(uint32_t threadId);
+
+    /**
+     * @brief Pauses or resumes recording. Zones opened while paused are not recorded, zones already open still are.
+     */
+    void setCapturing(bool capturing);
+    bool isCapturing();
+
+    /**
+     * @brief Samples cycles, instructions, last level cache misses and branch misses at every zone boundary.
+     *
+     * Each thread opens its own counters (perf_event_open on Linux, user space rdpmc where the kernel allows it)
+     * the first time it enters a zone afterwards. Costs a few hundred nanoseconds per zone, so it stays off
+     * unless a run asks for it. Not available on other platforms, or when perf_event_paranoid forbids it.
+     *
+     * @return Whether the calling thread could open its counters. Always true when disabling
+     */
+    bool setHardwareCountersEnabled(bool enabled);
+    bool areHardwareCountersEnabled();
+
+    /**
+     * @return "cycles", "instructions", "llcMisses" or "branchMisses"
+     */
+    const char* getCounterName(Counter counter);
+
+    /**
+     * @brief Moves every thread's pending events into the collector.
+     *
+     * The collector keeps a bounded history (the most recent frames and their events), older data is discarded,
+     * see setRetainedFrames().
+     */
+    void collect();
+
+    /// Frames the collector keeps unless a consumer asks for more, enough for the watchdog's hang diagnostics
+    constexpr uint32_t DEFAULT_RETAINED_FRAMES = 8;
+    /// Most frames the collector keeps, whatever is asked for
+    constexpr uint32_t MAX_RETAINED_FRAMES = 4096;
+
+    /**
+     * @brief Sets how many of the most recent frames the collector keeps, with the events that ended in them.
+     *
+     * Only the last DEFAULT_RETAINED_FRAMES are kept unless a consumer of the history asks for more, such as a
+     * whole-run trace (VKING_PROFILE_TRACE) or the frame harness, so a long run does not grow the history. Clamped
+     * to 1..MAX_RETAINED_FRAMES. Older frames are discarded at the next markFrame().
+     */
+    void setRetainedFrames(uint32_t frames);
+    uint32_t getRetainedFrames();
+
+    /**
+     * @brief Writes the collected history as Chrome trace event JSON, which chrome://tracing and Perfetto both open.
+     *
+     * Frames appear as their own track, every thread that recorded a zone as another.
+     *
+     * @param path The file to write
+     * @param lastFrames Only export the most recent lastFrames frames. 0 exports the whole history
+     * @return false if the file could not be written
+     */
+    bool exportChromeTrace(const std::filesystem::path& path, uint32_t lastFrames = 0);
+
+    Stats getStats();
+
+    /// Time one zone name accumulated in each summarized frame
+    struct ZoneSummary {
+        const char* name = nullptr;
+        uint64_t calls = 0;
+        /// Inclusive nanoseconds spent in the zone during each frame, summed over every thread
+        std::vector<double> frameNanoseconds;
+        /// Calls that carried hardware counters, and the sum of their deltas indexed by Counter
+        uint64_t countedCalls = 0;
+        uint64_t counters[COUNTER_COUNT] = {};
+    };
+
+    struct FrameSummary {
+        /// Duration of each frame in nanoseconds, oldest first
+        std::vector<double> frameNanoseconds;
+        /// One entry per zone name, in order of first appearance
+        std::vector<ZoneSummary> zones;
+    };
+
+    /**
+     * @brief Aggregates the collected history per frame and zone name. Zones count toward the frame they began in.
+     *
+     * @param lastFrames Only the most recent lastFrames complete frames. 0 summarizes the whole history
+     */
+    FrameSummary summarizeFrames(uint32_t lastFrames = 0);
+
+    /// One zone of a completed frame, see setFrameListener()
+    struct FrameZone {
+        const ZoneInfo* zone;
+        uint32_t threadId;
+        /// Relative to the frame's start, negative for zones that opened during an earlier frame
+        int64_t beginNanoseconds;
+        uint64_t durationNanoseconds;
+        CounterSample counters;
+    };
+
+    struct FrameRecord {
+        uint64_t frameIndex;
+        /// steady_clock time, in nanoseconds since its epoch
+        uint64_t beginNanoseconds;
+        uint64_t durationNanoseconds;
+        /// Every zone that ended since the previous frame closed
+        const FrameZone* zones;
+        size_t zoneCount;
+    };
+
+    using FrameListener = void (*)(const FrameRecord& frame);
+
+    /**
+     * @brief Hands every frame to listener as markFrame() closes it, for live consumers such as Profiler::Stream.
+     *
+     * The listener runs on the frame thread with the collector locked, so it must be quick and must not call
+     * back into the profiler's collection functions. nullptr removes it.
+     */
+    void setFrameListener(FrameListener listener);
+
+}
+
+#define VKING_PROFILE_CONCAT_INNER(a, b) a##b
+#define VKING_PROFILE_CONCAT(a, b) VKING_PROFILE_CONCAT_INNER(a, b)
+
+#if VKING_PROFILER_ENABLED
+
+/**
+ * @brief Times the enclosing scope under the given name (a string literal).
+ *
+ * @code
+ * void Renderer::drawFrame() {
+ *     VKING_PROFILE_SCOPE("Renderer::drawFrame");
+ *     ...
+ * }
+ * @endcode
+ */
+#define VKING_PROFILE_SCOPE(name)                                                                                   \
+    static constexpr ::VKING::Profiler::ZoneInfo VKING_PROFILE_CONCAT(vkingProfileZone, __LINE__){name, __FILE__, __LINE__}; \
+    const ::VKING::Profiler::ScopedZone VKING_PROFILE_CONCAT(vkingProfileScope, __LINE__)(&VKING_PROFILE_CONCAT(vkingProfileZone, __LINE__))
+
+/// Marks a frame boundary, see VKING::Profiler::markFrame()
+#define VKING_PROFILE_FRAME() ::VKING::Profiler::markFrame()
+
+/// Names the calling thread in exported traces
+#define VKING_PROFILE_THREAD(name) ::VKING::Profiler::setThreadName(name)
+
+#else
+
+#define VKING_PROFILE_SCOPE(name) static_cast<void>(0)
+#define VKING_PROFILE_FRAME() static_cast<void>(0)
+#define VKING_PROFILE_THREAD(name) static_cast<void>(sizeof(name))
+
+#endif
@@ -0,0 +1,404 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#include "ProfilerStream.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#   include <poll.h>
+#   include <sys/socket.h>
+#   include <sys/stat.h>
+#   include <sys/un.h>
+#   include <unistd.h>
+#endif
+
+namespace VKING::Profiler::Stream {
+
+    std::string getDefaultSocketPath(const int processId) {
+        const char* runtimeDirectory = std::getenv("XDG_RUNTIME_DIR");
+        const std::string directory = runtimeDirectory && *runtimeDirectory ? runtimeDirectory : "/tmp";
+        return directory + "/VKING." + std::to_string(processId) + ".profiler";
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    namespace {
+
+        /// Bytes the sender moves out of the buffer per send()
+        constexpr size_t SEND_CHUNK = 64 * 1024;
+        constexpr auto POLL_INTERVAL = std::chrono::milliseconds(100);
+        constexpr uint32_t INVALID_ID = UINT32_MAX;
+
+#if defined(MSG_NOSIGNAL)
+        constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+        constexpr int SEND_FLAGS = 0;
+#endif
+
+        struct Streamer {
+            /// Guards the buffer and the interning state. Producers hold it only while encoding one message
+            std::mutex mutex;
+            std::condition_variable dataAvailable;
+            std::vector<char> buffer = std::vector<char>(BUFFER_CAPACITY);
+            size_t readPosition = 0;
+            size_t queuedBytes = 0;
+            /// Interned per connection, every viewer starts with an empty table
+            std::unordered_map<std::string, uint32_t> stringIds;
+            std::unordered_map<const char*, uint32_t> zoneNameIds;
+            std::unordered_set<uint32_t> knownThreads;
+            uint32_t nextStringId = 0;
+            uint64_t unreportedDrops = 0;
+            uint64_t droppedMessages = 0;
+            std::string payload;
+            std::string scratch;
+
+            std::atomic_bool viewerConnected{false};
+            std::atomic<uint64_t> sentBytes{0};
+
+            // Owned by start(), stop() and the sender thread
+            std::atomic_bool running{false};
+            int listenSocket = -1;
+            int viewerSocket = -1;
+            std::string socketPath;
+            std::thread sender;
+        };
+
+        Streamer& getStreamer() {
+            // Intentionally leaked: log messages may still arrive while static destructors run
+            static Streamer* s_Streamer = new Streamer();
+            return *s_Streamer;
+        }
+
+        void appendVarint(std::string& out, uint64_t value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<char>(value));
+        }
+
+        uint64_t zigzag(const int64_t value) {
+            return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        }
+
+        uint64_t getNanoseconds() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        void writeRing(Streamer& streamer, const char* data, const size_t size) {
+            size_t writePosition = (streamer.readPosition + streamer.queuedBytes) % BUFFER_CAPACITY;
+            const size_t first = std::min(size, BUFFER_CAPACITY - writePosition);
+            std::memcpy(streamer.buffer.data() + writePosition, data, first);
+            std::memcpy(streamer.buffer.data(), data + first, size - first);
+            streamer.queuedBytes += size;
+        }
+
+        /// Frames and queues one message, or counts it as dropped when the buffer is full. Requires the mutex
+        bool emitFramed(Streamer& streamer, const MessageType type, const std::string& payload) {
+            std::string& header = streamer.scratch;
+            header.clear();
+            header.push_back(static_cast<char>(type));
+            appendVarint(header, payload.size());
+            if (streamer.queuedBytes + header.size() + payload.size() > BUFFER_CAPACITY) {
+                streamer.unreportedDrops++;
+                streamer.droppedMessages++;
+                return false;
+            }
+            writeRing(streamer, header.data(), header.size());
+            writeRing(streamer, payload.data(), payload.size());
+            return true;
+        }
+
+        bool emit(Streamer& streamer, const MessageType type, const std::string& payload) {
+            if (streamer.unreportedDrops > 0) {
+                std::string drops;
+                appendVarint(drops, streamer.unreportedDrops);
+                const uint64_t unreported = streamer.unreportedDrops;
+                if (emitFramed(streamer, MessageType::DROPPED, drops)) streamer.unreportedDrops -= unreported;
+            }
+            return emitFramed(streamer, type, payload);
+        }
+
+        /// Id of a string the viewer knows, sending it first if needed. INVALID_ID if that was dropped
+        uint32_t internString(Streamer& streamer, const std::string_view text) {
+            if (const auto found = streamer.stringIds.find(std::string(text)); found != streamer.stringIds.end()) return found->second;
+
+            std::string message;
+            appendVarint(message, streamer.nextStringId);
+            message.append(text);
+            if (!emit(streamer, MessageType::STRING, message)) return INVALID_ID;
+            streamer.stringIds.emplace(text, streamer.nextStringId);
+            return streamer.nextStringId++;
+        }
+
+        uint32_t internZoneName(Streamer& streamer, const char* name) {
+            if (const auto found = streamer.zoneNameIds.find(name); found != streamer.zoneNameIds.end()) return found->second;
+            const uint32_t id = internString(streamer, name);
+            if (id != INVALID_ID) streamer.zoneNameIds.emplace(name, id);
+            return id;
+        }
+
+        bool announceThread(Streamer& streamer, const uint32_t threadId) {
+            if (streamer.knownThreads.contains(threadId)) return true;
+            const uint32_t nameId = internString(streamer, getThreadName(threadId));
+            if (nameId == INVALID_ID) return false;
+
+            std::string message;
+            appendVarint(message, threadId);
+            appendVarint(message, nameId);
+            if (!emit(streamer, MessageType::THREAD, message)) return false;
+            streamer.knownThreads.insert(threadId);
+            return true;
+        }
+
+        void onFrame(const FrameRecord& frame) {
+            Streamer& streamer = getStreamer();
+            if (!streamer.viewerConnected.load(std::memory_order_acquire)) return;
+            std::lock_guard lock(streamer.mutex);
+
+            std::string& payload = streamer.payload;
+            payload.clear();
+            appendVarint(payload, frame.frameIndex);
+            appendVarint(payload, frame.beginNanoseconds);
+            appendVarint(payload, frame.durationNanoseconds);
+            appendVarint(payload, frame.zoneCount);
+            for (size_t i = 0; i < frame.zoneCount; i++) {
+                const FrameZone& zone = frame.zones[i];
+                const uint32_t nameId = internZoneName(streamer, zone.zone->name);
+                // A name or thread the viewer cannot resolve would corrupt the frame, drop it whole instead
+                if (nameId == INVALID_ID || !announceThread(streamer, zone.threadId)) {
+                    streamer.unreportedDrops++;
+                    streamer.droppedMessages++;
+                    return;
+                }
+                appendVarint(payload, nameId);
+                appendVarint(payload, zone.threadId);
+                appendVarint(payload, zigzag(zone.beginNanoseconds));
+                appendVarint(payload, zone.durationNanoseconds);
+                payload.push_back(zone.counters.counted ? 1 : 0);
+                if (zone.counters.counted) {
+                    for (const uint64_t value : zone.counters.values) appendVarint(payload, value);
+                }
+            }
+            if (emit(streamer, MessageType::FRAME, payload)) streamer.dataAvailable.notify_one();
+        }
+
+        bool sendAll(const int socket, const char* data, size_t size) {
+            while (size > 0) {
+                const ssize_t sent = send(socket, data, size, SEND_FLAGS);
+                if (sent <= 0) return false;
+                data += sent;
+                size -= static_cast<size_t>(sent);
+            }
+            return true;
+        }
+
+        void disconnectViewer(Streamer& streamer) {
+            streamer.viewerConnected.store(false, std::memory_order_release);
+            close(streamer.viewerSocket);
+            streamer.viewerSocket = -1;
+        }
+
+        void acceptViewer(Streamer& streamer) {
+            pollfd listening{streamer.listenSocket, POLLIN, 0};
+            if (poll(&listening, 1, static_cast<int>(POLL_INTERVAL.count())) <= 0) return;
+            const int viewer = accept(streamer.listenSocket, nullptr, nullptr);
+            if (viewer < 0) return;
+#if !defined(MSG_NOSIGNAL) && defined(SO_NOSIGPIPE)
+            const int noSignal = 1;
+            setsockopt(viewer, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+#endif
+
+            std::lock_guard lock(streamer.mutex);
+            streamer.readPosition = 0;
+            streamer.queuedBytes = 0;
+            streamer.stringIds.clear();
+            streamer.zoneNameIds.clear();
+            streamer.knownThreads.clear();
+            streamer.nextStringId = 0;
+            streamer.unreportedDrops = 0;
+
+            std::string hello;
+            for (uint32_t i = 0; i < 4; i++) hello.push_back(static_cast<char>((PROTOCOL_MAGIC >> (8 * i)) & 0xFF));
+            appendVarint(hello, PROTOCOL_VERSION);
+            appendVarint(hello, static_cast<uint64_t>(getpid()));
+            emit(streamer, MessageType::HELLO, hello);
+
+            streamer.viewerSocket = viewer;
+            streamer.viewerConnected.store(true, std::memory_order_release);
+        }
+
+        void senderLoop() {
+            Streamer& streamer = getStreamer();
+            std::vector<char> chunk(SEND_CHUNK);
+
+            while (streamer.running.load(std::memory_order_acquire)) {
+                if (streamer.viewerSocket < 0) {
+                    acceptViewer(streamer);
+                    continue;
+                }
+
+                size_t length = 0;
+                {
+                    std::unique_lock lock(streamer.mutex);
+                    streamer.dataAvailable.wait_for(lock, POLL_INTERVAL, [&streamer] {
+                        return streamer.queuedBytes > 0 || !streamer.running.load(std::memory_order_relaxed);
+                    });
+                    length = std::min(streamer.queuedBytes, chunk.size());
+                    const size_t first = std::min(length, BUFFER_CAPACITY - streamer.readPosition);
+                    std::memcpy(chunk.data(), streamer.buffer.data() + streamer.readPosition, first);
+                    std::memcpy(chunk.data() + first, streamer.buffer.data(), length - first);
+                    streamer.readPosition = (streamer.readPosition + length) % BUFFER_CAPACITY;
+                    streamer.queuedBytes -= length;
+                }
+
+                if (length == 0) {
+                    // Nothing to send, notice a viewer that went away anyway
+                    char byte;
+                    if (recv(streamer.viewerSocket, &byte, 1, MSG_PEEK | MSG_DONTWAIT) == 0) disconnectViewer(streamer);
+                    continue;
+                }
+                if (!sendAll(streamer.viewerSocket, chunk.data(), length)) {
+                    disconnectViewer(streamer);
+                    continue;
+                }
+                streamer.sentBytes.fetch_add(length, std::memory_order_relaxed);
+            }
+
+            if (streamer.viewerSocket >= 0) disconnectViewer(streamer);
+        }
+
+    }
+
+    bool start(const std::filesystem::path& socketPath) {
+        Streamer& streamer = getStreamer();
+        if (streamer.running.load(std::memory_order_acquire)) return false;
+
+        const std::string path = socketPath.empty() ? getDefaultSocketPath(getpid()) : socketPath.string();
+        sockaddr_un address{};
+        if (path.size() >= sizeof(address.sun_path)) return false;
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+        // A stale socket from a crashed run with the same pid would make bind() fail. Anything else at the path is
+        // not ours to delete, a mistyped --profiler-stream path must not cost the user a file
+        struct stat existing{};
+        if (lstat(path.c_str(), &existing) == 0) {
+            if (!S_ISSOCK(existing.st_mode)) return false;
+            unlink(path.c_str());
+        }
+
+        const int listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenSocket < 0) return false;
+        if (bind(listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(listenSocket, 1) != 0) {
+            close(listenSocket);
+            return false;
+        }
+
+        streamer.listenSocket = listenSocket;
+        streamer.socketPath = path;
+        streamer.running.store(true, std::memory_order_release);
+        setFrameListener(onFrame);
+        streamer.sender = std::thread(senderLoop);
+        return true;
+    }
+
+    void stop() {
+        Streamer& streamer = getStreamer();
+        if (!streamer.running.exchange(false, std::memory_order_acq_rel)) return;
+
+        setFrameListener(nullptr);
+        streamer.dataAvailable.notify_all();
+        streamer.sender.join();
+        close(streamer.listenSocket);
+        streamer.listenSocket = -1;
+        unlink(streamer.socketPath.c_str());
+    }
+
+    bool isViewerConnected() {
+        return getStreamer().viewerConnected.load(std::memory_order_acquire);
+    }
+
+    void publishLog(const uint32_t level, const std::string_view logger, const std::string_view message) {
+        Streamer& streamer = getStreamer();
+        if (!streamer.viewerConnected.load(std::memory_order_acquire)) return;
+        const uint64_t timestamp = getNanoseconds();
+        std::lock_guard lock(streamer.mutex);
+
+        const uint32_t loggerId = internString(streamer, logger);
+        if (loggerId == INVALID_ID) {
+            streamer.unreportedDrops++;
+            streamer.droppedMessages++;
+            return;
+        }
+        std::string& payload = streamer.payload;
+        payload.clear();
+        appendVarint(payload, timestamp);
+        payload.push_back(static_cast<char>(level));
+        appendVarint(payload, loggerId);
+        payload.append(message);
+        if (emit(streamer, MessageType::LOG, payload)) streamer.dataAvailable.notify_one();
+    }
+
+    Stats getStats() {
+        Streamer& streamer = getStreamer();
+        Stats stats;
+        stats.viewerConnected = streamer.viewerConnected.load(std::memory_order_acquire);
+        stats.sentBytes = streamer.sentBytes.load(std::memory_order_relaxed);
+        std::lock_guard lock(streamer.mutex);
+        stats.droppedMessages = streamer.droppedMessages;
+        return stats;
+    }
+
+#else
+
+    bool start(const std::filesystem::path&) {
+        return false;
+    }
+
+    void stop() {}
+
+    bool isViewerConnected() {
+        return false;
+    }
+
+    void publishLog(uint32_t, std::string_view, std::string_view) {}
+
+    Stats getStats() {
+        return {};
+    }
+
+#endif
+
+}
@@ -0,0 +1,103 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+/**
+ * Live profiler stream: frames, zones with their hardware counters, and log messages, sent over a local Unix
+ * domain socket to one viewer at a time (VKING_ProfilerViewer).
+ *
+ * Producers encode into a bounded buffer and never wait for the socket. When the viewer falls behind, whole
+ * messages are dropped and counted, and the viewer is told how many it missed. With no viewer connected,
+ * nothing is encoded at all.
+ *
+ * Wire format: messages of [type: u8][payload length: varint][payload], unsigned LEB128 varints throughout and
+ * zigzag for signed values. Strings are sent once as STRING messages and referenced by id afterwards, and zone
+ * times are varint nanoseconds relative to their frame, so a typical zone costs 5 to 8 bytes.
+ */
+namespace VKING::Profiler::Stream {
+
+    constexpr uint32_t PROTOCOL_MAGIC = 0x53504B56; // "VKPS"
+    constexpr uint32_t PROTOCOL_VERSION = 1;
+
+    /// Bytes buffered for the viewer before messages are dropped
+    constexpr size_t BUFFER_CAPACITY = size_t{4} << 20;
+
+    enum class MessageType : uint8_t {
+        /// magic: u32, version, processId
+        HELLO = 1,
+        /// id, then the UTF-8 bytes for the rest of the payload
+        STRING,
+        /// threadId, name string id
+        THREAD,
+        /// frameIndex, begin (steady_clock ns), duration ns, zone count, then per zone: name string id, threadId,
+        /// zigzag begin relative to the frame, duration, counted: u8 and, if set, one value per Profiler::Counter
+        FRAME,
+        /// timestamp (steady_clock ns), level: u8, logger string id, then the message for the rest of the payload
+        LOG,
+        /// Messages dropped since the previous DROPPED
+        DROPPED
+    };
+
+    struct Stats {
+        bool viewerConnected = false;
+        uint64_t sentBytes = 0;
+        uint64_t droppedMessages = 0;
+    };
+
+    /**
+     * @return Where a process streams by default: $XDG_RUNTIME_DIR (or /tmp) / VKING.<pid>.profiler
+     */
+    std::string getDefaultSocketPath(int processId);
+
+    /**
+     * @brief Listens on socketPath and streams every profiled frame and log message to whichever viewer connects.
+     *
+     * @param socketPath Empty listens on getDefaultSocketPath() for this process
+     * @return false if the socket could not be created, something other than a socket already exists at the path,
+     *         or on platforms without Unix domain sockets
+     */
+    bool start(const std::filesystem::path& socketPath);
+
+    /**
+     * @brief Disconnects the viewer and removes the socket.
+     */
+    void stop();
+
+    bool isViewerConnected();
+
+    /**
+     * @brief Queues a log message for the viewer. Called by the log sink, does nothing without a viewer.
+     *
+     * @param level spdlog level
+     */
+    void publishLog(uint32_t level, std::string_view logger, std::string_view message);
+
+    Stats getStats();
+
+}
@@ -0,0 +1,427 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#include "SamplingProfiler.hpp"
+#include "Symbolizer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#   include <cerrno>
+#   include <csignal>
+#   include <ctime>
+#   include <pthread.h>
+#   include <sys/syscall.h>
+#   include <ucontext.h>
+#   include <unistd.h>
+#endif
+
+#if defined(__linux__) && !defined(sigev_notify_thread_id)
+#   define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+namespace VKING::Profiler::Sampling {
+
+#if defined(__linux__)
+
+    namespace {
+
+        /// Samples each thread can hold between two drains. Power of two
+        constexpr uint32_t RING_CAPACITY = 512;
+        constexpr auto DRAIN_INTERVAL = std::chrono::milliseconds(20);
+        constexpr uint32_t MAX_FREQUENCY = 20'000;
+
+        struct Sample {
+            uint32_t depth;
+            /// Innermost first: the interrupted program counter, then one return address per frame
+            uintptr_t frames[MAX_STACK_DEPTH];
+        };
+
+        /**
+         * Single producer (the owning thread's signal handler), single consumer (the drain thread) ring.
+         * A full ring drops the new sample, the handler never waits.
+         */
+        struct SampleRing {
+            Sample samples[RING_CAPACITY];
+            alignas(64) std::atomic<uint64_t> writeIndex{0};
+            std::atomic<uint64_t> droppedSamples{0};
+            alignas(64) std::atomic<uint64_t> readIndex{0};
+            uintptr_t stackLow = 0;
+            uintptr_t stackHigh = 0;
+        };
+
+        struct ThreadRecord {
+            std::unique_ptr<SampleRing> ring;
+            uint32_t nameIndex = 0;
+            pid_t tid = 0;
+            clockid_t clock{};
+            timer_t timer{};
+            bool armed = false;
+            /// The thread is gone, the record is removed once its ring is drained
+            bool exited = false;
+        };
+
+        struct StackHash {
+            size_t operator()(const std::vector<uintptr_t>& stack) const {
+                uint64_t hash = 14695981039346656037ull;
+                for (const uintptr_t address : stack) hash = (hash ^ address) * 1099511628211ull;
+                return static_cast<size_t>(hash);
+            }
+        };
+
+        struct Sampler {
+            /// Guards everything below. Never taken by the signal handler
+            std::mutex mutex;
+            std::vector<std::unique_ptr<ThreadRecord>> threads;
+            std::vector<std::string> names;
+            bool handlerInstalled = false;
+            bool running = false;
+            uint32_t frequency = DEFAULT_FREQUENCY;
+            std::thread drainThread;
+            std::condition_variable drainCondition;
+
+            /// Thread name index followed by the frames innermost first, and how often it was sampled
+            std::unordered_map<std::vector<uintptr_t>, uint64_t, StackHash> stacks;
+            uint64_t samples = 0;
+            uint64_t truncatedSamples = 0;
+            /// Drops of threads whose records are already gone
+            uint64_t retiredDroppedSamples = 0;
+        };
+
+        Sampler& getSampler() {
+            // Intentionally leaked: threads may still exit and unregister while static destructors run
+            static Sampler* s_Sampler = new Sampler();
+            return *s_Sampler;
+        }
+
+        // Initial-exec TLS in the engine's static libraries, so reading these in the handler does not allocate
+        constinit thread_local SampleRing* t_Ring = nullptr;
+        constinit thread_local ThreadRecord* t_Record = nullptr;
+
+        void walkStack(const ucontext_t* context, const uintptr_t stackLow, const uintptr_t stackHigh, Sample& sample) {
+#if defined(__x86_64__)
+            const auto pc = static_cast<uintptr_t>(context->uc_mcontext.gregs[REG_RIP]);
+            auto fp = static_cast<uintptr_t>(context->uc_mcontext.gregs[REG_RBP]);
+#elif defined(__aarch64__)
+            const auto pc = static_cast<uintptr_t>(context->uc_mcontext.pc);
+            auto fp = static_cast<uintptr_t>(context->uc_mcontext.regs[29]);
+#else
+            const uintptr_t pc = 0;
+            uintptr_t fp = 0;
+            static_cast<void>(context);
+#endif
+            uint32_t depth = 0;
+            sample.frames[depth++] = pc;
+
+            // Each frame begins with the caller's frame pointer followed by the return address. Only pointers that
+            // stay on this thread's stack and move toward its base are followed, so a register that does not hold
+            // a frame pointer ends the walk instead of faulting
+            while (depth < MAX_STACK_DEPTH && fp >= stackLow && fp + 2 * sizeof(uintptr_t) <= stackHigh && fp % alignof(uintptr_t) == 0) {
+                const auto* frame = reinterpret_cast<const uintptr_t*>(fp);
+                const uintptr_t returnAddress = frame[1];
+                if (returnAddress == 0) break;
+                sample.frames[depth++] = returnAddress;
+                if (frame[0] <= fp) break;
+                fp = frame[0];
+            }
+            sample.depth = depth;
+        }
+
+        void handleSignal(int, siginfo_t*, void* context) {
+            SampleRing* ring = t_Ring;
+            if (!ring) return;
+            const int savedErrno = errno;
+
+            const uint64_t write = ring->writeIndex.load(std::memory_order_relaxed);
+            if (write - ring->readIndex.load(std::memory_order_acquire) >= RING_CAPACITY) {
+                ring->droppedSamples.store(ring->droppedSamples.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            } else {
+                walkStack(static_cast<const ucontext_t*>(context), ring->stackLow, ring->stackHigh, ring->samples[write & (RING_CAPACITY - 1)]);
+                ring->writeIndex.store(write + 1, std::memory_order_release);
+            }
+
+            errno = savedErrno;
+        }
+
+        bool arm(ThreadRecord& record, const uint32_t frequency) {
+            sigevent event{};
+            event.sigev_notify = SIGEV_THREAD_ID;
+            event.sigev_signo = SIGPROF;
+            event.sigev_notify_thread_id = record.tid;
+            if (timer_create(record.clock, &event, &record.timer) != 0) return false;
+
+            const long interval = 1'000'000'000L / static_cast<long>(frequency);
+            itimerspec spec{};
+            spec.it_interval.tv_sec = interval / 1'000'000'000L;
+            spec.it_interval.tv_nsec = interval % 1'000'000'000L;
+            spec.it_value = spec.it_interval;
+            if (timer_settime(record.timer, 0, &spec, nullptr) != 0) {
+                timer_delete(record.timer);
+                return false;
+            }
+            record.armed = true;
+            return true;
+        }
+
+        void disarm(ThreadRecord& record) {
+            if (!record.armed) return;
+            timer_delete(record.timer);
+            record.armed = false;
+        }
+
+        uint32_t internName(Sampler& sampler, const std::string_view name) {
+            const auto found = std::ranges::find(sampler.names, name);
+            if (found != sampler.names.end()) return static_cast<uint32_t>(found - sampler.names.begin());
+            sampler.names.emplace_back(name);
+            return static_cast<uint32_t>(sampler.names.size() - 1);
+        }
+
+        void drainRings(Sampler& sampler) {
+            std::vector<uintptr_t> key;
+            for (const auto& record : sampler.threads) {
+                SampleRing& ring = *record->ring;
+                uint64_t read = ring.readIndex.load(std::memory_order_relaxed);
+                const uint64_t write = ring.writeIndex.load(std::memory_order_acquire);
+                for (; read != write; read++) {
+                    const Sample& sample = ring.samples[read & (RING_CAPACITY - 1)];
+                    key.assign(1, record->nameIndex);
+                    key.insert(key.end(), sample.frames, sample.frames + sample.depth);
+                    sampler.stacks[key]++;
+                    sampler.samples++;
+                    if (sample.depth == MAX_STACK_DEPTH) sampler.truncatedSamples++;
+                }
+                ring.readIndex.store(read, std::memory_order_release);
+            }
+
+            std::erase_if(sampler.threads, [&sampler](const std::unique_ptr<ThreadRecord>& record) {
+                if (!record->exited) return false;
+                sampler.retiredDroppedSamples += record->ring->droppedSamples.load(std::memory_order_relaxed);
+                return true;
+            });
+        }
+
+        void drainLoop() {
+            Sampler& sampler = getSampler();
+            std::unique_lock lock(sampler.mutex);
+            while (sampler.running) {
+                sampler.drainCondition.wait_for(lock, DRAIN_INTERVAL);
+                drainRings(sampler);
+            }
+        }
+
+        /// Unregisters a thread when it exits, so no timer outlives it
+        struct ThreadExitGuard {
+            bool registered = false;
+
+            ~ThreadExitGuard() {
+                if (!registered) return;
+                Sampler& sampler = getSampler();
+                std::lock_guard lock(sampler.mutex);
+                disarm(*t_Record);
+                t_Record->exited = true;
+                t_Record = nullptr;
+                t_Ring = nullptr;
+            }
+        };
+
+        thread_local ThreadExitGuard t_ExitGuard;
+
+    }
+
+    void registerCurrentThread(const std::string_view name) {
+        Sampler& sampler = getSampler();
+        std::lock_guard lock(sampler.mutex);
+        if (t_Record) {
+            t_Record->nameIndex = internName(sampler, name);
+            return;
+        }
+
+        auto record = std::make_unique<ThreadRecord>();
+        record->ring = std::make_unique<SampleRing>();
+        record->nameIndex = internName(sampler, name);
+        record->tid = static_cast<pid_t>(syscall(SYS_gettid));
+        if (pthread_getcpuclockid(pthread_self(), &record->clock) != 0) return;
+
+        pthread_attr_t attributes;
+        if (pthread_getattr_np(pthread_self(), &attributes) == 0) {
+            void* stackAddress = nullptr;
+            size_t stackSize = 0;
+            if (pthread_attr_getstack(&attributes, &stackAddress, &stackSize) == 0) {
+                record->ring->stackLow = reinterpret_cast<uintptr_t>(stackAddress);
+                record->ring->stackHigh = record->ring->stackLow + stackSize;
+            }
+            pthread_attr_destroy(&attributes);
+        }
+
+        t_Record = record.get();
+        t_Ring = record->ring.get();
+        t_ExitGuard.registered = true;
+        if (sampler.running) arm(*record, sampler.frequency);
+        sampler.threads.push_back(std::move(record));
+    }
+
+    bool start(const uint32_t frequencyHz) {
+        Sampler& sampler = getSampler();
+        std::lock_guard lock(sampler.mutex);
+        if (sampler.running || frequencyHz == 0) return false;
+
+        // Installed once and never removed: a SIGPROF still in flight after stop() would otherwise kill the process
+        if (!sampler.handlerInstalled) {
+            struct sigaction action{};
+            action.sa_sigaction = handleSignal;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&action.sa_mask);
+            if (sigaction(SIGPROF, &action, nullptr) != 0) return false;
+            sampler.handlerInstalled = true;
+        }
+
+        sampler.frequency = std::min(frequencyHz, MAX_FREQUENCY);
+        for (const auto& record : sampler.threads) {
+            if (!record->exited) arm(*record, sampler.frequency);
+        }
+        sampler.running = true;
+        sampler.drainThread = std::thread(drainLoop);
+        return true;
+    }
+
+    void stop() {
+        Sampler& sampler = getSampler();
+        {
+            std::lock_guard lock(sampler.mutex);
+            if (!sampler.running) return;
+            sampler.running = false;
+            for (const auto& record : sampler.threads) disarm(*record);
+        }
+        sampler.drainCondition.notify_all();
+        sampler.drainThread.join();
+
+        std::lock_guard lock(sampler.mutex);
+        drainRings(sampler);
+    }
+
+    bool isRunning() {
+        Sampler& sampler = getSampler();
+        std::lock_guard lock(sampler.mutex);
+        return sampler.running;
+    }
+
+    void clear() {
+        Sampler& sampler = getSampler();
+        std::lock_guard lock(sampler.mutex);
+        for (const auto& record : sampler.threads) {
+            record->ring->readIndex.store(record->ring->writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+        }
+        sampler.stacks.clear();
+        sampler.samples = 0;
+        sampler.truncatedSamples = 0;
+    }
+
+    Stats getStats() {
+        Sampler& sampler = getSampler();
+        std::lock_guard lock(sampler.mutex);
+        Stats stats;
+        stats.samples = sampler.samples;
+        stats.truncatedSamples = sampler.truncatedSamples;
+        stats.droppedSamples = sampler.retiredDroppedSamples;
+        for (const auto& record : sampler.threads) {
+            if (!record->exited) stats.threadCount++;
+            stats.droppedSamples += record->ring->droppedSamples.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    bool exportFoldedStacks(const std::filesystem::path& path) {
+        std::vector<std::pair<std::vector<uintptr_t>, uint64_t>> stacks;
+        std::vector<std::string> names;
+        {
+            Sampler& sampler = getSampler();
+            std::lock_guard lock(sampler.mutex);
+            if (sampler.running) drainRings(sampler);
+            stacks.assign(sampler.stacks.begin(), sampler.stacks.end());
+            names = sampler.names;
+        }
+
+        // Return addresses point after the call, look up the call itself. The first frame is the interrupted pc
+        std::vector<uintptr_t> addresses;
+        for (auto& [stack, count] : stacks) {
+            for (size_t i = 2; i < stack.size(); i++) stack[i] -= 1;
+            addresses.insert(addresses.end(), stack.begin() + 1, stack.end());
+        }
+        std::ranges::sort(addresses);
+        addresses.erase(std::ranges::unique(addresses).begin(), addresses.end());
+        const auto symbols = detail::symbolize(addresses);
+
+        // Different addresses in the same functions fold into one line
+        std::map<std::string, uint64_t> folded;
+        std::string line;
+        for (const auto& [stack, count] : stacks) {
+            line = names[stack[0]];
+            for (size_t i = stack.size() - 1; i >= 1; i--) {
+                line += ';';
+                line += symbols.at(stack[i]);
+            }
+            folded[line] += count;
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        for (const auto& [stack, count] : folded) file << stack << ' ' << count << '\n';
+        return static_cast<bool>(file);
+    }
+
+#else
+
+    void registerCurrentThread(std::string_view) {}
+
+    bool start(uint32_t) {
+        return false;
+    }
+
+    void stop() {}
+
+    bool isRunning() {
+        return false;
+    }
+
+    void clear() {}
+
+    Stats getStats() {
+        return {};
+    }
+
+    bool exportFoldedStacks(const std::filesystem::path&) {
+        return false;
+    }
+
+#endif
+
+}
@@ -0,0 +1,95 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace VKING::Profiler::Sampling {
+
+    /// Prime default rate, so sampling does not fall into lockstep with millisecond timers
+    constexpr uint32_t DEFAULT_FREQUENCY = 997;
+
+    /// Return addresses kept per sample, deeper stacks are truncated at the root end
+    constexpr uint32_t MAX_STACK_DEPTH = 62;
+
+    struct Stats {
+        uint32_t threadCount = 0;
+        uint64_t samples = 0;
+        /// Samples lost because a thread's ring filled up before the collector drained it
+        uint64_t droppedSamples = 0;
+        /// Samples that filled all MAX_STACK_DEPTH frames, their outermost frames are missing
+        uint64_t truncatedSamples = 0;
+    };
+
+    /**
+     * @brief Makes the calling thread visible to the sampler, under the given name.
+     *
+     * Allocates the thread's sample ring and notes its stack bounds. If sampling is running the thread is
+     * armed right away, otherwise start() arms it. The thread is removed again when it exits.
+     * Calling it again only renames the thread.
+     */
+    void registerCurrentThread(std::string_view name);
+
+    /**
+     * @brief Starts sampling every registered thread.
+     *
+     * Each thread gets a timer on its own CPU time clock that raises SIGPROF at frequencyHz, so only threads
+     * that are running get sampled. The signal handler walks the frame pointer chain into a preallocated ring,
+     * it never allocates or locks. A background thread drains the rings and counts unique stacks.
+     *
+     * CPU time timers expire on scheduler ticks, so the kernel's tick rate (CONFIG_HZ, usually 250 or 1000)
+     * caps the effective rate. Needs frame pointers (VKING_ENABLE_FRAME_POINTERS) for useful stacks, without
+     * them only the sampled function itself is recorded. Linux only.
+     *
+     * @return false if sampling is unsupported here or already running
+     */
+    bool start(uint32_t frequencyHz = DEFAULT_FREQUENCY);
+
+    /**
+     * @brief Disarms every thread and collects the samples still in flight. Collected stacks are kept.
+     */
+    void stop();
+
+    bool isRunning();
+
+    /**
+     * @brief Discards every collected stack.
+     */
+    void clear();
+
+    Stats getStats();
+
+    /**
+     * @brief Writes the collected stacks in folded form ("Thread;outer;...;inner count" per line), the input of
+     *        flamegraph.pl, speedscope and inferno.
+     *
+     * Symbolization happens here, not while sampling: the dynamic symbol table first, then addr2line for
+     * anything it cannot name. Addresses neither can name are written as module+0xoffset.
+     *
+     * @return false if the file could not be written
+     */
+    bool exportFoldedStacks(const std::filesystem::path& path);
+
+}
@@ -21,6 +21,7 @@
 //
 
 #include "Signals.hpp"
+#include "Profiler.hpp"
 
 #include <atomic>
 
@@ -38,10 +39,9 @@ extern "C"{
 #endif
 
 namespace VKING::Shutdown {
-    static constexpr size_t MAX_MESSAGE_LENGTH = 100;
-    static char s_MessageBuf[MAX_MESSAGE_LENGTH]{};
-    static std::atomic<Reason> s_RequestReason = Reason::REASON_NONE;
-    static std::atomic_bool s_ShutdownRequested{false};
+    // Constant initialized, the interrupt handler may run before any dynamic initialization
+    static constinit State s_ProcessState;
+    static constinit thread_local State* t_ThreadState = nullptr;
 }
 
 /**
@@ -53,22 +53,24 @@ extern "C" {
         switch (signal) {
             case SIGINT:
                 // "[SIGINT] Interrupt subscribed and received."
-                request(VKING::Shutdown::Reason::REASON_SIGINT, "[SIGINT] Signal Interrupt received and interrupt handled.");
+                VKING::Shutdown::s_ProcessState.request(VKING::Shutdown::Reason::REASON_SIGINT, "[SIGINT] Signal Interrupt received and interrupt handled.");
                 break;
             case SIGTERM:
                 // "[SIGTERM] Interrupt was subscribed and received."
-                request(VKING::Shutdown::Reason::REASON_SIGTERM, "[SIGTERM] Signal Interrupt received and interrupt handled.");
+                VKING::Shutdown::s_ProcessState.request(VKING::Shutdown::Reason::REASON_SIGTERM, "[SIGTERM] Signal Interrupt received and interrupt handled.");
                 break;
             default:
                 // "[SIG Unknown] Interrupt was subscribed and received, but no handler."
-                request(VKING::Shutdown::Reason::REASON_UNKNOWN, "[UNKNOWN] Signal Interrupt received but no handler was known.");
+                VKING::Shutdown::s_ProcessState.request(VKING::Shutdown::Reason::REASON_UNKNOWN, "[UNKNOWN] Signal Interrupt received but no handler was known.");
                 break;
         }
     }
 }
 
 namespace VKING::Shutdown {
-    void request(Reason reason, const char* message) {
+    // request() runs inside signal handlers, so it must not be profiled: a zone there could interrupt
+    // the same thread halfway through pushing another zone into its buffer.
+    void State::request(Reason reason, const char* message) {
 
         if (message) {
             // safely copy byte for byte our message into the buffer
@@ -76,41 +78,42 @@ namespace VKING::Shutdown {
             // the message may still be corrupted if multiple interrupts happen, but at that point, meh
             for (uint32_t i = 0; i < MAX_MESSAGE_LENGTH - 1; i++) {
                 const char c = message[i];
-                s_MessageBuf[i] = c;
+                m_MessageBuf[i] = c;
                 if (c == '\0') break;
             }
-            s_MessageBuf[MAX_MESSAGE_LENGTH - 1] = '\0';  // ensure null-termination
+            m_MessageBuf[MAX_MESSAGE_LENGTH - 1] = '\0';  // ensure null-termination
         } else {
-            s_MessageBuf[0] = '\0';
+            m_MessageBuf[0] = '\0';
         }
 
         // copy the reason
-        s_RequestReason.store(reason, std::memory_order_release);
+        m_RequestReason.store(reason, std::memory_order_release);
 
         // and raise the flag
         // if multiple requests are raised, the last one in is fine
         // we care about *read* inconsistencies in the atomic
-        s_ShutdownRequested.store(true, std::memory_order_release);
+        m_ShutdownRequested.store(true, std::memory_order_release);
     }
 
-    bool isRequested() {
-        return s_ShutdownRequested.load(std::memory_order_acquire);
+    bool State::isRequested() const {
+        return m_ShutdownRequested.load(std::memory_order_acquire);
     }
 
-    bool restartRequested() {
+    bool State::restartRequested() const {
         if (!isRequested()) return false;
-        const Reason reason = s_RequestReason.load(std::memory_order_acquire);
+        const Reason reason = m_RequestReason.load(std::memory_order_acquire);
         if ( reason == Reason::REASON_USER_RESTART) return true;
         if ( reason == Reason::REASON_INVOLUNTARY_RESTART) return true;
         return false;
     }
 
-    Info getReason() {
+    Info State::getReason() const {
+        VKING_PROFILE_SCOPE("Shutdown::State::getReason");
 
         // construct a string so the lifetime is separate and remains separable in the thread
         // and cap the length to MAX_MESSAGE_LENGTH, just in case the message was not properly terminated
-        auto msg = std::string(s_MessageBuf, std::min(strlen(s_MessageBuf), MAX_MESSAGE_LENGTH));
-        const Reason reason = s_RequestReason.load(std::memory_order_acquire);
+        auto msg = std::string(m_MessageBuf, std::min(strlen(m_MessageBuf), MAX_MESSAGE_LENGTH));
+        const Reason reason = m_RequestReason.load(std::memory_order_acquire);
 
         return {
             reason, std::move(msg)
@@ -118,15 +121,51 @@ namespace VKING::Shutdown {
 
     }
 
+    void State::clear() {
+        VKING_PROFILE_SCOPE("Shutdown::State::clear");
+        m_ShutdownRequested.store(false, std::memory_order_release);
+        m_RequestReason.store(Reason::REASON_NONE, std::memory_order_release);
+        memset(m_MessageBuf, '\0', MAX_MESSAGE_LENGTH);
+    }
+
+    State& getProcessState() {
+        return s_ProcessState;
+    }
+
+    void bindThreadState(State* state) {
+        t_ThreadState = state;
+    }
+
+    State* getThreadState() {
+        return t_ThreadState;
+    }
+
+    void request(const Reason reason, const char* message) {
+        (t_ThreadState ? *t_ThreadState : s_ProcessState).request(reason, message);
+    }
+
+    bool isRequested() {
+        return s_ProcessState.isRequested() || (t_ThreadState && t_ThreadState->isRequested());
+    }
+
+    bool restartRequested() {
+        if (s_ProcessState.isRequested()) return s_ProcessState.restartRequested();
+        return t_ThreadState && t_ThreadState->restartRequested();
+    }
+
+    Info getReason() {
+        if (s_ProcessState.isRequested() || !t_ThreadState) return s_ProcessState.getReason();
+        return t_ThreadState->getReason();
+    }
+
     void clearRequest() {
-        s_ShutdownRequested.store(false, std::memory_order_release);
-        s_RequestReason.store(Reason::REASON_NONE, std::memory_order_release);
-        memset(s_MessageBuf, '\0', MAX_MESSAGE_LENGTH);
+        (t_ThreadState ? *t_ThreadState : s_ProcessState).clear();
     }
 
 
 #ifdef _WIN32
     void registerInterruptHandler() {
+        VKING_PROFILE_SCOPE("Shutdown::registerInterruptHandler");
 #pragma message("VKING::Shutdown: Windows console control handlers are not fully implemented. " \
 "Application might not quit gracefully via all console commands (e.g., closing console window).")
         signal(SIGINT, interruptHandler);
@@ -135,6 +174,7 @@ namespace VKING::Shutdown {
 #else// we are assuming a posix system
 
     void registerInterruptHandler() {
+        VKING_PROFILE_SCOPE("Shutdown::registerInterruptHandler");
         struct sigaction sa{};
         sa.sa_handler = interruptHandler; // Your existing C-linkage handler
         sigemptyset(&sa.sa_mask);         // Clear the mask of signals to block
@@ -22,6 +22,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <string>
+
 namespace VKING::Shutdown {
 
     /**
@@ -57,7 +61,47 @@ namespace VKING::Shutdown {
     };
 
     /**
-     * @brief Requests a shutdown at the next safe shutdown time.
+     * @brief One place a shutdown can be requested. The process has one, and every engine instance hosted next to
+     *        others in the same process has its own, so each can stop and restart on its own.
+     */
+    class State {
+    public:
+        /**
+         * @note This function is async-singal-safe.
+         */
+        void request(Reason reason, const char* message = nullptr);
+        [[nodiscard]] bool isRequested() const;
+        [[nodiscard]] bool restartRequested() const;
+        [[nodiscard]] Info getReason() const;
+        void clear();
+
+    private:
+        static constexpr size_t MAX_MESSAGE_LENGTH = 100;
+        char m_MessageBuf[MAX_MESSAGE_LENGTH]{};
+        std::atomic<Reason> m_RequestReason{Reason::REASON_NONE};
+        std::atomic_bool m_ShutdownRequested{false};
+    };
+
+    /**
+     * @brief The process's state. Signals, and requests from threads bound to no other state, land here.
+     */
+    State& getProcessState();
+
+    /**
+     * @brief Binds the calling thread to an instance's state, nullptr binds it back to the process.
+     *
+     * While bound, request() and clearRequest() act on that state alone. isRequested() sees the process's state as
+     * well, so a signal still stops every instance.
+     */
+    void bindThreadState(State* state);
+
+    /**
+     * @return The state the calling thread is bound to, nullptr for the process's
+     */
+    State* getThreadState();
+
+    /**
+     * @brief Requests a shutdown at the next safe shutdown time, of the calling thread's state.
      *
      * @note This function is async-singal-safe.
      *
@@ -67,19 +111,19 @@ namespace VKING::Shutdown {
     void request(Reason reason, const char* message = nullptr);
 
     /**
-     * @brief Tests if a shutdown is requested
+     * @brief Tests if a shutdown is requested, of the calling thread's state or of the process
      * @return Whether or not a shutdown is requested
      */
     bool isRequested();
 
     /**
-     * @brief Tests if a restart is requested
+     * @brief Tests if a restart is requested. A process shutdown takes precedence over an instance's restart
      * @return Whether or not a restart is requested
      */
     bool restartRequested();
 
     /**
-     * @brief Gets the reason for the shutdown
+     * @brief Gets the reason for the shutdown. The process's, if it requested one, otherwise the calling thread's state's
      *
      * @note Lifetime of all objects are transferred. Please remember to call clearRequest(); it is not cleared automatically
      *
@@ -88,7 +132,7 @@ namespace VKING::Shutdown {
     Info getReason();
 
     /**
-     * @brief Clears the stored request
+     * @brief Clears the stored request of the calling thread's state
      */
     void clearRequest();
 
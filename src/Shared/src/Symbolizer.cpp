@@ -0,0 +1,138 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#include "Symbolizer.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+
+#if defined(__linux__)
+#   include <cxxabi.h>
+#   include <dlfcn.h>
+#   include <link.h>
+#   include <unistd.h>
+#endif
+
+namespace VKING::Profiler::detail {
+
+    namespace {
+
+        std::string toHex(const uintptr_t value) {
+            char buffer[24];
+            std::snprintf(buffer, sizeof(buffer), "0x%llx", static_cast<unsigned long long>(value));
+            return buffer;
+        }
+
+    }
+
+#if defined(__linux__)
+
+    namespace {
+
+        std::string getExecutablePath() {
+            char buffer[4096];
+            const ssize_t length = readlink("/proc/self/exe", buffer, sizeof(buffer) - 1);
+            return length > 0 ? std::string(buffer, static_cast<size_t>(length)) : std::string();
+        }
+
+        std::string demangle(const char* name) {
+            int status = 0;
+            char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+            if (status != 0 || !demangled) return name;
+            std::string result = demangled;
+            std::free(demangled);
+            return result;
+        }
+
+    }
+
+    std::unordered_map<uintptr_t, std::string> symbolize(const std::vector<uintptr_t>& addresses) {
+        struct Unresolved {
+            uintptr_t address;
+            uintptr_t offset;
+        };
+
+        std::unordered_map<uintptr_t, std::string> symbols;
+        std::map<std::string, std::vector<Unresolved>> unresolvedByModule;
+        const std::string executablePath = getExecutablePath();
+
+        for (const uintptr_t address : addresses) {
+            Dl_info info{};
+            link_map* map = nullptr;
+            if (!dladdr1(reinterpret_cast<void*>(address), &info, reinterpret_cast<void**>(&map), RTLD_DL_LINKMAP) || !map) {
+                symbols[address] = toHex(address);
+                continue;
+            }
+
+            // The main program's link map has an empty name
+            std::string module = map->l_name && *map->l_name ? map->l_name : executablePath;
+            const uintptr_t offset = address - static_cast<uintptr_t>(map->l_addr);
+            if (info.dli_sname) {
+                symbols[address] = demangle(info.dli_sname);
+                continue;
+            }
+            const size_t slash = module.rfind('/');
+            symbols[address] = (slash == std::string::npos ? module : module.substr(slash + 1)) + "+" + toHex(offset);
+            unresolvedByModule[std::move(module)].push_back({address, offset});
+        }
+
+        for (const auto& [module, unresolved] : unresolvedByModule) {
+            if (module.empty() || module.find('\'') != std::string::npos) continue;
+
+            char inputPath[] = "/tmp/VKING_SymbolsXXXXXX";
+            const int inputFile = mkstemp(inputPath);
+            if (inputFile < 0) continue;
+            std::string input;
+            for (const Unresolved& entry : unresolved) input += toHex(entry.offset) + "\n";
+            const bool written = ::write(inputFile, input.data(), input.size()) == static_cast<ssize_t>(input.size());
+            close(inputFile);
+
+            const std::string command = "addr2line -C -f -e '" + module + "' < " + inputPath + " 2>/dev/null";
+            if (std::FILE* pipe = written ? popen(command.c_str(), "r") : nullptr) {
+                // Two lines per address: the function, then file:line
+                char function[4096];
+                char location[4096];
+                for (const Unresolved& entry : unresolved) {
+                    if (!std::fgets(function, sizeof(function), pipe) || !std::fgets(location, sizeof(location), pipe)) break;
+                    function[std::strcspn(function, "\n")] = '\0';
+                    if (std::strcmp(function, "??") != 0) symbols[entry.address] = function;
+                }
+                pclose(pipe);
+            }
+            unlink(inputPath);
+        }
+        return symbols;
+    }
+
+#else
+
+    std::unordered_map<uintptr_t, std::string> symbolize(const std::vector<uintptr_t>& addresses) {
+        std::unordered_map<uintptr_t, std::string> symbols;
+        for (const uintptr_t address : addresses) symbols[address] = toHex(address);
+        return symbols;
+    }
+
+#endif
+
+}
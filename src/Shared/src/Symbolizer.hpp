@@ -0,0 +1,42 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace VKING::Profiler::detail {
+
+    /**
+     * @brief Names code addresses for the profilers' reports. Slow, never call it while sampling.
+     *
+     * The dynamic symbol table answers first, then one addr2line run per module for the rest. Addresses neither
+     * can name come back as module+0xoffset (or plain 0xaddress outside any module, and on other platforms).
+     *
+     * @param addresses Addresses inside the instruction to name. Subtract 1 from return addresses first
+     */
+    std::unordered_map<uintptr_t, std::string> symbolize(const std::vector<uintptr_t>& addresses);
+
+}
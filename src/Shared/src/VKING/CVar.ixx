@@ -0,0 +1,759 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+export module VKING.CVar;
+
+import VKING.StringId;
+import VKING.Log;
+import VKING.Json;
+
+export namespace VKING::CVars {
+
+    /**
+     * @brief Where a value came from. A CVar takes the value of the highest source that set a valid one,
+     *        so the console overrides the command line, which overrides the config file, which overrides the default.
+     */
+    enum class Source : uint8_t {
+        DEFAULT,
+        CONFIG_FILE,
+        COMMAND_LINE,
+        CONSOLE
+    };
+
+    constexpr size_t SOURCE_COUNT = 4;
+
+    constexpr std::string_view sourceToString(const Source source) {
+        switch (source) {
+            case Source::DEFAULT: return "default";
+            case Source::CONFIG_FILE: return "config file";
+            case Source::COMMAND_LINE: return "command line";
+            case Source::CONSOLE: return "console";
+        }
+        return "unknown";
+    }
+
+    /// Types a CVar can hold
+    template<typename T>
+    concept CVarType = std::same_as<T, bool> || std::same_as<T, int32_t> || std::same_as<T, uint32_t> ||
+                       std::same_as<T, int64_t> || std::same_as<T, float> || std::same_as<T, double> ||
+                       std::same_as<T, std::string>;
+
+    /// Snapshot of one registered CVar, for listings
+    struct Info {
+        std::string name;
+        std::string description;
+        std::string_view typeName;
+        std::string value;
+        std::string defaultValue;
+        Source source = Source::DEFAULT;
+    };
+
+    /**
+     * @brief Sets the value of a CVar in one source layer.
+     *
+     * Names nobody registered yet are kept and applied when the CVar registers, so config files and the command
+     * line can name CVars of modules that load later.
+     *
+     * @return false if value does not parse as the CVar's type, or source is DEFAULT
+     */
+    bool set(std::string_view name, std::string_view value, Source source = Source::CONSOLE);
+
+    /**
+     * @brief Removes the value a source set, so the next lower source shows through again.
+     */
+    void reset(std::string_view name, Source source = Source::CONSOLE);
+
+    /**
+     * @brief The current value of a CVar as text, or the pending value of one not registered yet.
+     */
+    std::optional<std::string> get(std::string_view name);
+
+    /**
+     * @brief Every registered CVar, sorted by name.
+     */
+    std::vector<Info> list();
+
+    /**
+     * @brief Applies every "+name=value" argument to the COMMAND_LINE layer. Other arguments are left alone.
+     *
+     * @return Number of values applied
+     */
+    size_t parseCommandLine(int argc, const char* const* argv);
+
+    /**
+     * @brief Replaces the CONFIG_FILE layer with the contents of a JSON file and watches it for changes.
+     *
+     * The file is a JSON object of name/value pairs. Nested objects join their keys with '.', so
+     * {"window": {"width": 1920}} sets window.width. A missing file is not an error: the layer is emptied and the
+     * file is picked up by update() once it is created.
+     *
+     * @return false if the file is missing or malformed. A malformed file leaves the previous layer in place.
+     */
+    bool loadConfigFile(const std::filesystem::path& path);
+
+    /**
+     * @brief Reloads the config file if it changed since it was loaded.
+     *
+     * @return true if it was reloaded
+     */
+    bool pollConfigFile();
+
+    /**
+     * @brief Runs one console command and returns the text to show for it.
+     *
+     * Commands: "<name>" shows a CVar, "<name> <value>" or "<name>=<value>" sets it, "reset <name>" removes the
+     * console value, "list" shows every CVar, "reload" reloads the config file, "help" shows this.
+     */
+    std::string execute(std::string_view command);
+
+    /**
+     * @brief Runs the change callbacks of every CVar that changed since the last call, on the calling thread.
+     */
+    void dispatchChanges();
+
+    /**
+     * @brief Per-frame housekeeping for the main loop: polls the config file (at most twice a second) and
+     *        dispatches change callbacks.
+     */
+    void update();
+
+    namespace detail {
+        class Entry;
+    }
+
+    /**
+     * @brief Detaches the CVars declared by code that is retired without running its static destructors, such as an
+     *        earlier generation of a game module, so the code replacing it can declare them again.
+     *
+     * Each one is left as if it had been destroyed: the values set for its name stay, for the next declaration.
+     * isDeclaredThere is called with the address of every registered CVar.
+     *
+     * @return The detached CVars. Entry::attach() takes one back if its code stays in use after all.
+     */
+    std::vector<detail::Entry*> detachDeclarations(const std::function<bool(const void*)>& isDeclaredThere);
+
+    namespace detail {
+
+        enum class PublishResult {
+            INVALID,
+            UNCHANGED,
+            CHANGED
+        };
+
+        template<CVarType T>
+        constexpr std::string_view getTypeName() {
+            if constexpr (std::same_as<T, bool>) return "bool";
+            else if constexpr (std::same_as<T, int32_t>) return "int32";
+            else if constexpr (std::same_as<T, uint32_t>) return "uint32";
+            else if constexpr (std::same_as<T, int64_t>) return "int64";
+            else if constexpr (std::same_as<T, float>) return "float";
+            else if constexpr (std::same_as<T, double>) return "double";
+            else return "string";
+        }
+
+        template<CVarType T>
+        std::optional<T> parseValue(const std::string_view text) {
+            if constexpr (std::same_as<T, std::string>) {
+                return std::string(text);
+            } else if constexpr (std::same_as<T, bool>) {
+                std::string lower(text);
+                std::ranges::transform(lower, lower.begin(), [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+                if (lower == "1" || lower == "true" || lower == "on" || lower == "yes") return true;
+                if (lower == "0" || lower == "false" || lower == "off" || lower == "no") return false;
+                return std::nullopt;
+            } else {
+                T value{};
+                const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+                if (error != std::errc() || end != text.data() + text.size()) return std::nullopt;
+                return value;
+            }
+        }
+
+        template<CVarType T>
+        std::string formatValue(const T& value) {
+            if constexpr (std::same_as<T, std::string>) {
+                return value;
+            } else if constexpr (std::same_as<T, bool>) {
+                return value ? "true" : "false";
+            } else {
+                char buffer[32];
+                const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                return std::string(buffer, result.ptr);
+            }
+        }
+
+        /**
+         * @brief The type-erased half of a CVar the registry works with.
+         *
+         * publish() is only called with the registry locked; notify() only from dispatchChanges().
+         */
+        class Entry {
+        public:
+            Entry(std::string_view name, std::string_view description);
+            virtual ~Entry();
+
+            Entry(const Entry&) = delete;
+            Entry& operator=(const Entry&) = delete;
+
+            [[nodiscard]] StringId getId() const { return m_Id; }
+            [[nodiscard]] const std::string& getName() const { return m_Name; }
+            [[nodiscard]] const std::string& getDescription() const { return m_Description; }
+
+            [[nodiscard]] virtual std::string_view getTypeName() const = 0;
+            [[nodiscard]] virtual std::string format() const = 0;
+            [[nodiscard]] virtual std::string formatDefault() const = 0;
+            [[nodiscard]] virtual bool accepts(std::string_view text) const = 0;
+
+            virtual PublishResult publish(std::string_view text) = 0;
+            virtual void notify() = 0;
+
+            /**
+             * @brief Adds the CVar to the registry and applies any value set for its name before it existed.
+             *        Called by the derived constructor once publish() can run, and for a CVar detachDeclarations()
+             *        detached whose code is kept after all.
+             */
+            void attach();
+
+            /**
+             * @brief Removes the CVar from the registry, as its destructor does. Values set for its name stay.
+             */
+            void detach();
+
+        private:
+            StringId m_Id;
+            std::string m_Name;
+            std::string m_Description;
+            bool m_Attached = false;
+        };
+
+    }
+
+    /**
+     * @brief A named, typed engine setting.
+     *
+     * Declare one per setting, usually as a static next to the code that reads it:
+     * @code
+     * static VKING::CVars::CVar<uint32_t> s_FrameSleep{"app.frameSleepMs", 10, "Idle sleep per frame, in milliseconds"};
+     * std::this_thread::sleep_for(std::chrono::milliseconds(s_FrameSleep.get()));
+     * @endcode
+     *
+     * get() is one acquire load and never locks, so it is fine on hot paths and any thread. Writers publish a new
+     * immutable value and swap the pointer. Replaced values are kept until the CVar is destroyed, so a reference
+     * from get() never dangles; settings change rarely enough that this costs nothing worth reclaiming.
+     *
+     * onChange() callbacks run on the main thread from update(), never on the thread that set the value.
+     */
+    template<CVarType T>
+    class CVar final : public detail::Entry {
+    public:
+        CVar(const std::string_view name, T defaultValue, const std::string_view description)
+            : Entry(name, description), m_Default(std::move(defaultValue)) {
+            m_Current.store(&m_Default, std::memory_order_release);
+            attach();
+        }
+
+        [[nodiscard]] const T& get() const { return *m_Current.load(std::memory_order_acquire); }
+        [[nodiscard]] const T& operator*() const { return get(); }
+        [[nodiscard]] const T& getDefault() const { return m_Default; }
+
+        /**
+         * @brief Sets the value in one source layer. See CVars::set().
+         */
+        bool set(const T& value, const Source source = Source::CONSOLE) {
+            return CVars::set(getName(), detail::formatValue(value), source);
+        }
+
+        /**
+         * @brief Adds a callback run with the new value each time it changes.
+         */
+        void onChange(std::function<void(const T&)> callback) {
+            std::lock_guard lock(m_CallbacksMutex);
+            m_Callbacks.push_back(std::move(callback));
+        }
+
+        [[nodiscard]] std::string_view getTypeName() const override { return detail::getTypeName<T>(); }
+        [[nodiscard]] std::string format() const override { return detail::formatValue(get()); }
+        [[nodiscard]] std::string formatDefault() const override { return detail::formatValue(m_Default); }
+        [[nodiscard]] bool accepts(const std::string_view text) const override { return detail::parseValue<T>(text).has_value(); }
+
+        detail::PublishResult publish(const std::string_view text) override {
+            std::optional<T> parsed = detail::parseValue<T>(text);
+            if (!parsed) return detail::PublishResult::INVALID;
+            if (*parsed == get()) return detail::PublishResult::UNCHANGED;
+
+            if (*parsed == m_Default) {
+                m_Current.store(&m_Default, std::memory_order_release);
+            } else {
+                m_Retired.push_back(std::make_unique<const T>(std::move(*parsed)));
+                m_Current.store(m_Retired.back().get(), std::memory_order_release);
+            }
+            return detail::PublishResult::CHANGED;
+        }
+
+        void notify() override {
+            std::vector<std::function<void(const T&)>> callbacks;
+            {
+                std::lock_guard lock(m_CallbacksMutex);
+                callbacks = m_Callbacks;
+            }
+            for (const auto& callback : callbacks) callback(get());
+        }
+
+    private:
+        T m_Default;
+        std::atomic<const T*> m_Current{nullptr};
+        /// Every value published so far that is not the default. Only touched with the registry locked
+        std::vector<std::unique_ptr<const T>> m_Retired;
+
+        std::mutex m_CallbacksMutex;
+        std::vector<std::function<void(const T&)>> m_Callbacks;
+    };
+
+}
+
+namespace VKING::CVars {
+
+    using CVarLogger = Log::Named<"CVar">;
+
+    /// How often update() looks at the config file's timestamp
+    constexpr auto CONFIG_POLL_INTERVAL = std::chrono::milliseconds(500);
+
+    struct Record {
+        std::string name;
+        /// Value text per Source, indexed by its numeric value
+        std::array<std::optional<std::string>, SOURCE_COUNT> layers;
+        /// The registered CVar, or nullptr while values for it are only pending
+        detail::Entry* entry = nullptr;
+        /// The source the current value came from
+        Source source = Source::DEFAULT;
+    };
+
+    struct ConfigFileState {
+        std::filesystem::path path;
+        bool exists = false;
+        std::filesystem::file_time_type writeTime;
+        uintmax_t size = 0;
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::unordered_map<StringId, Record> records;
+        /// CVars whose value changed since the last dispatchChanges()
+        std::vector<detail::Entry*> changed;
+        ConfigFileState config;
+        std::chrono::steady_clock::time_point nextConfigPoll;
+    };
+
+    Registry& getRegistry() {
+        static Registry* s_Registry = new Registry();
+        return *s_Registry;
+    }
+
+    /// Record for name, created if needed. nullptr if another name already has the same id
+    Record* findOrCreateRecord(Registry& registry, const std::string_view name) {
+        auto [iterator, inserted] = registry.records.try_emplace(StringId(name));
+        Record& record = iterator->second;
+        if (inserted) {
+            record.name = name;
+        } else if (record.name != name) {
+            CVarLogger::record().error("CVar name '{}' has the same id as '{}'. Rename one of them.", name, record.name);
+            return nullptr;
+        }
+        return &record;
+    }
+
+    Record* findRecord(Registry& registry, const std::string_view name) {
+        const auto iterator = registry.records.find(StringId(name));
+        if (iterator == registry.records.end() || iterator->second.name != name) return nullptr;
+        return &iterator->second;
+    }
+
+    /// Publishes the highest valid layer of a registered CVar and queues its callbacks if the value changed
+    void refresh(Registry& registry, Record& record) {
+        if (!record.entry) return;
+        for (size_t layer = SOURCE_COUNT; layer-- > 0;) {
+            const std::optional<std::string>& text = record.layers[layer];
+            if (!text) continue;
+
+            const detail::PublishResult result = record.entry->publish(*text);
+            if (result == detail::PublishResult::INVALID) {
+                CVarLogger::record().warn("{} = '{}' from the {} is not a valid {}, ignored.", record.name, *text,
+                                          sourceToString(static_cast<Source>(layer)), record.entry->getTypeName());
+                continue;
+            }
+            if (result == detail::PublishResult::CHANGED &&
+                std::ranges::find(registry.changed, record.entry) == registry.changed.end()) {
+                registry.changed.push_back(record.entry);
+            }
+            record.source = static_cast<Source>(layer);
+            return;
+        }
+    }
+
+    std::string describe(const Record& record) {
+        if (!record.entry) {
+            for (size_t layer = SOURCE_COUNT; layer-- > 0;) {
+                if (record.layers[layer]) return record.name + " = " + *record.layers[layer] + " (not registered)";
+            }
+            return record.name + " (not registered)";
+        }
+        return record.name + " = " + record.entry->format() + " [" + std::string(record.entry->getTypeName()) + ", " +
+               std::string(sourceToString(record.source)) + ", default " + record.entry->formatDefault() + "] " +
+               record.entry->getDescription();
+    }
+
+    /// Flattens a config object into name/value text pairs, joining nested keys with '.'
+    void flattenConfig(const Json::Value& object, const std::string& prefix, std::vector<std::pair<std::string, std::string>>& values) {
+        for (const auto& [key, value] : object.asObject()) {
+            const std::string name = prefix.empty() ? key : prefix + "." + key;
+            switch (value.getType()) {
+                case Json::Type::OBJECT: flattenConfig(value, name, values); break;
+                case Json::Type::BOOLEAN: values.emplace_back(name, value.asBool() ? "true" : "false"); break;
+                case Json::Type::NUMBER: values.emplace_back(name, value.dump()); break;
+                case Json::Type::STRING: values.emplace_back(name, std::string(value.asString())); break;
+                default:
+                    CVarLogger::record().warn("Config value '{}' is not a boolean, number or string, ignored.", name);
+                    break;
+            }
+        }
+    }
+
+    ConfigFileState statConfigFile(const std::filesystem::path& path) {
+        ConfigFileState state;
+        state.path = path;
+        std::error_code error;
+        state.exists = std::filesystem::is_regular_file(path, error);
+        if (state.exists) {
+            state.writeTime = std::filesystem::last_write_time(path, error);
+            state.size = std::filesystem::file_size(path, error);
+        }
+        return state;
+    }
+
+    std::string_view trim(std::string_view text) {
+        while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) text.remove_prefix(1);
+        while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) text.remove_suffix(1);
+        return text;
+    }
+
+    namespace detail {
+
+        Entry::Entry(const std::string_view name, const std::string_view description)
+            : m_Id(name), m_Name(name), m_Description(description) {}
+
+        Entry::~Entry() {
+            detach();
+        }
+
+        void Entry::attach() {
+            Registry& registry = getRegistry();
+            std::lock_guard lock(registry.mutex);
+            Record* record = findOrCreateRecord(registry, m_Name);
+            if (!record) return;
+            if (record->entry) {
+                CVarLogger::record().error("CVar '{}' is registered twice, the second one keeps its default.", m_Name);
+                return;
+            }
+
+            record->entry = this;
+            record->layers[static_cast<size_t>(Source::DEFAULT)] = formatDefault();
+            m_Attached = true;
+            refresh(registry, *record);
+        }
+
+        void Entry::detach() {
+            if (!m_Attached) return;
+            Registry& registry = getRegistry();
+            std::lock_guard lock(registry.mutex);
+            if (Record* record = findRecord(registry, m_Name); record && record->entry == this) {
+                record->entry = nullptr;
+                record->layers[static_cast<size_t>(Source::DEFAULT)].reset();
+            }
+            std::erase(registry.changed, this);
+            m_Attached = false;
+        }
+
+    }
+
+    std::vector<detail::Entry*> detachDeclarations(const std::function<bool(const void*)>& isDeclaredThere) {
+        std::vector<detail::Entry*> declarations;
+        {
+            Registry& registry = getRegistry();
+            std::lock_guard lock(registry.mutex);
+            for (const Record& record : registry.records | std::views::values) {
+                if (record.entry && isDeclaredThere(record.entry)) declarations.push_back(record.entry);
+            }
+        }
+        for (detail::Entry* entry : declarations) entry->detach();
+        if (!declarations.empty()) CVarLogger::record().debug("Detached {} CVars of retired code.", declarations.size());
+        return declarations;
+    }
+
+    bool set(const std::string_view name, const std::string_view value, const Source source) {
+        if (source == Source::DEFAULT) {
+            CVarLogger::record().warn("The default of '{}' cannot be set, it is part of its declaration.", name);
+            return false;
+        }
+
+        Registry& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+        Record* record = findOrCreateRecord(registry, name);
+        if (!record) return false;
+        if (record->entry && !record->entry->accepts(value)) {
+            CVarLogger::record().warn("'{}' is not a valid {} for {}.", value, record->entry->getTypeName(), name);
+            return false;
+        }
+
+        record->layers[static_cast<size_t>(source)] = std::string(value);
+        if (record->entry) {
+            refresh(registry, *record);
+        } else {
+            CVarLogger::record().debug("{} = '{}' from the {} is kept until the CVar registers.", name, value, sourceToString(source));
+        }
+        return true;
+    }
+
+    void reset(const std::string_view name, const Source source) {
+        if (source == Source::DEFAULT) return;
+
+        Registry& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+        Record* record = findRecord(registry, name);
+        if (!record) return;
+        record->layers[static_cast<size_t>(source)].reset();
+        refresh(registry, *record);
+    }
+
+    std::optional<std::string> get(const std::string_view name) {
+        Registry& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+        const Record* record = findRecord(registry, name);
+        if (!record) return std::nullopt;
+        if (record->entry) return record->entry->format();
+        for (size_t layer = SOURCE_COUNT; layer-- > 0;) {
+            if (record->layers[layer]) return record->layers[layer];
+        }
+        return std::nullopt;
+    }
+
+    std::vector<Info> list() {
+        Registry& registry = getRegistry();
+        std::vector<Info> infos;
+        {
+            std::lock_guard lock(registry.mutex);
+            infos.reserve(registry.records.size());
+            for (const auto& record : registry.records | std::views::values) {
+                if (!record.entry) continue;
+                infos.push_back({record.name, record.entry->getDescription(), record.entry->getTypeName(),
+                                 record.entry->format(), record.entry->formatDefault(), record.source});
+            }
+        }
+        std::ranges::sort(infos, {}, &Info::name);
+        return infos;
+    }
+
+    size_t parseCommandLine(const int argc, const char* const* argv) {
+        size_t applied = 0;
+        for (int i = 1; i < argc; i++) {
+            const std::string_view argument = argv[i];
+            if (!argument.starts_with('+')) continue;
+
+            const size_t equals = argument.find('=');
+            if (equals == std::string_view::npos || equals == 1) {
+                CVarLogger::record().warn("Ignoring '{}', CVars are set with +<name>=<value>.", argument);
+                continue;
+            }
+            if (set(argument.substr(1, equals - 1), argument.substr(equals + 1), Source::COMMAND_LINE)) applied++;
+        }
+        return applied;
+    }
+
+    bool loadConfigFile(const std::filesystem::path& path) {
+        Registry& registry = getRegistry();
+        const ConfigFileState state = statConfigFile(path);
+
+        std::vector<std::pair<std::string, std::string>> values;
+        bool loaded = false;
+        if (state.exists) {
+            std::ifstream file(path, std::ios::binary);
+            std::stringstream contents;
+            contents << file.rdbuf();
+
+            std::string error;
+            const std::optional<Json::Value> document = Json::parse(contents.str(), &error);
+            if (!document || !document->isObject()) {
+                CVarLogger::record().warn("Config file {} is not a JSON object{}{}, keeping the previous values.", path.string(),
+                                          error.empty() ? "" : ": ", error);
+                std::lock_guard lock(registry.mutex);
+                // Remember the broken file so it is not reparsed until it changes again
+                registry.config = state;
+                return false;
+            }
+            flattenConfig(*document, {}, values);
+            loaded = true;
+        } else {
+            CVarLogger::record().debug("No config file at {}, it is loaded if created.", path.string());
+        }
+
+        std::lock_guard lock(registry.mutex);
+        registry.config = state;
+
+        for (Record& record : registry.records | std::views::values) {
+            record.layers[static_cast<size_t>(Source::CONFIG_FILE)].reset();
+        }
+        for (auto& [name, value] : values) {
+            Record* record = findOrCreateRecord(registry, name);
+            if (!record) continue;
+            record->layers[static_cast<size_t>(Source::CONFIG_FILE)] = std::move(value);
+        }
+        for (Record& record : registry.records | std::views::values) {
+            refresh(registry, record);
+        }
+
+        if (loaded) CVarLogger::record().info("Loaded {} values from config file {}.", values.size(), path.string());
+        return loaded;
+    }
+
+    bool pollConfigFile() {
+        Registry& registry = getRegistry();
+        ConfigFileState previous;
+        {
+            std::lock_guard lock(registry.mutex);
+            previous = registry.config;
+        }
+        if (previous.path.empty()) return false;
+
+        const ConfigFileState current = statConfigFile(previous.path);
+        if (current.exists == previous.exists && current.writeTime == previous.writeTime && current.size == previous.size) return false;
+
+        CVarLogger::record().info("Config file {} changed, reloading.", previous.path.string());
+        loadConfigFile(previous.path);
+        return true;
+    }
+
+    std::string execute(const std::string_view command) {
+        const std::string_view line = trim(command);
+        if (line.empty()) return {};
+
+        if (line == "help") {
+            return "<name>            show a CVar\n"
+                   "<name> <value>    set a CVar (also <name>=<value>)\n"
+                   "reset <name>      remove the console value of a CVar\n"
+                   "list              show every CVar\n"
+                   "reload            reload the config file";
+        }
+        if (line == "list") {
+            std::string output;
+            Registry& registry = getRegistry();
+            std::lock_guard lock(registry.mutex);
+            std::vector<const Record*> records;
+            for (const Record& record : registry.records | std::views::values) records.push_back(&record);
+            std::ranges::sort(records, {}, &Record::name);
+            for (const Record* record : records) {
+                if (!output.empty()) output += '\n';
+                output += describe(*record);
+            }
+            return output;
+        }
+        if (line == "reload") {
+            Registry& registry = getRegistry();
+            std::filesystem::path path;
+            {
+                std::lock_guard lock(registry.mutex);
+                path = registry.config.path;
+            }
+            if (path.empty()) return "No config file was loaded.";
+            return loadConfigFile(path) ? "Reloaded " + path.string() : "Could not load " + path.string();
+        }
+
+        std::string_view name = line;
+        std::optional<std::string_view> value;
+        if (line.starts_with("reset ")) {
+            name = trim(line.substr(6));
+            reset(name);
+        } else if (const size_t split = line.find_first_of("= \t"); split != std::string_view::npos) {
+            name = trim(line.substr(0, split));
+            value = trim(line.substr(split + 1));
+        }
+
+        if (value && !set(name, *value, Source::CONSOLE)) return "Could not set " + std::string(name);
+
+        Registry& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+        const Record* record = findRecord(registry, name);
+        if (!record) return "Unknown CVar: " + std::string(name);
+        return describe(*record);
+    }
+
+    void dispatchChanges() {
+        Registry& registry = getRegistry();
+        std::vector<detail::Entry*> changed;
+        {
+            std::lock_guard lock(registry.mutex);
+            if (registry.changed.empty()) return;
+            changed.swap(registry.changed);
+        }
+
+        for (detail::Entry* entry : changed) {
+            CVarLogger::record().debug("{} changed to {}.", entry->getName(), entry->format());
+            entry->notify();
+        }
+    }
+
+    void update() {
+        Registry& registry = getRegistry();
+        const auto now = std::chrono::steady_clock::now();
+        bool poll = false;
+        {
+            std::lock_guard lock(registry.mutex);
+            if (now >= registry.nextConfigPoll) {
+                registry.nextConfigPoll = now + CONFIG_POLL_INTERVAL;
+                poll = true;
+            }
+        }
+        if (poll) pollConfigFile();
+        dispatchChanges();
+    }
+
+}
@@ -0,0 +1,289 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <VKING/Profiler.hpp>
+#include <VKING/SamplingProfiler.hpp>
+#include <VKING/LiveMetrics.hpp>
+
+export module VKING.JobSystem;
+
+import VKING.Log;
+
+export namespace VKING {
+    /**
+     * @brief Fixed-size worker pool shared by every engine system that needs to fan out CPU work.
+     *
+     * Jobs are plain callables pulled from a single FIFO queue. The pool is deliberately simple: the
+     * engine's parallel work today is coarse (whole images, whole meshes, whole init phases), so a
+     * mutex-protected queue is nowhere near the bottleneck.
+     *
+     * Threads that wait on the pool (parallelFor(), wait()) execute queued jobs while they wait,
+     * so nested parallelism from inside a job cannot deadlock the pool.
+     *
+     * Typical usage:
+     * @code
+     * auto& jobs = VKING::JobSystem::getDefault();
+     * jobs.parallelFor(blockCount, 64, [&](uint32_t begin, uint32_t end) {
+     *     for (uint32_t i = begin; i < end; i++) encodeBlock(i);
+     * });
+     *
+     * auto future = jobs.async([] { return loadShaderCache(); });
+     * @endcode
+     */
+    class JobSystem {
+    public:
+        /**
+         * @brief Starts the worker threads.
+         *
+         * @param workerCount Number of worker threads. 0 picks one less than the hardware concurrency,
+         *                    leaving a core for the thread that submits the work.
+         */
+        explicit JobSystem(uint32_t workerCount = 0);
+
+        /**
+         * @brief Drains every queued job and joins the workers.
+         */
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * @brief Queues a fire-and-forget job.
+         */
+        void submit(std::function<void()> job);
+
+        /**
+         * @brief Queues a job and returns a future for its result.
+         *
+         * @note Waiting on the returned future blocks the calling thread without helping the pool.
+         *       Prefer wait() when calling from inside another job.
+         */
+        template<typename Fn>
+        auto async(Fn&& fn) -> std::future<std::invoke_result_t<Fn>> {
+            using Result = std::invoke_result_t<Fn>;
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+            auto future = task->get_future();
+            submit([task] { (*task)(); });
+            return future;
+        }
+
+        /**
+         * @brief Waits for a future produced by async(), running other queued jobs in the meantime.
+         */
+        template<typename Result>
+        Result wait(std::future<Result>& future) {
+            while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                if (!tryRunOne()) std::this_thread::yield();
+            }
+            return future.get();
+        }
+
+        /**
+         * @brief Splits [0, count) into chunks of grainSize and runs body over them in parallel.
+         *
+         * The calling thread participates and the call returns once every chunk has finished.
+         *
+         * @param count Number of items
+         * @param grainSize Items handed out per chunk. Larger grains amortize scheduling, smaller ones balance better
+         * @param body Called as body(begin, end) for each chunk, possibly concurrently
+         */
+        void parallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t begin, uint32_t end)>& body);
+
+        /**
+         * @brief Runs a single queued job on the calling thread, if there is one.
+         *
+         * @return Whether a job was run
+         */
+        bool tryRunOne();
+
+        /**
+         * @return The number of worker threads (not counting threads that help while waiting)
+         */
+        [[nodiscard]] uint32_t getWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+        /**
+         * @brief Process-wide pool, created on first use and shared by every engine system. Its queue depth is
+         *        published as "Jobs" in the live metrics.
+         */
+        static JobSystem& getDefault();
+
+    private:
+        void workerLoop();
+
+        std::vector<std::thread> m_Workers;
+        std::deque<std::function<void()>> m_Queue;
+        std::mutex m_QueueMutex;
+        std::condition_variable m_QueueCondition;
+        bool m_Stopping = false;
+        /// Live metrics slot the queue depth goes to, if any
+        uint32_t m_MetricsQueue = LiveMetrics::INVALID_QUEUE;
+    };
+}
+
+namespace VKING {
+
+    using JobSystemLogger = Log::Named<"JobSystem">;
+
+    JobSystem::JobSystem(uint32_t workerCount) {
+        if (workerCount == 0) {
+            const uint32_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 2u);
+            workerCount = hardwareThreads - 1;
+        }
+
+        m_Workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; i++) {
+            m_Workers.emplace_back([this, i] {
+                VKING_PROFILE_THREAD("Job Worker " + std::to_string(i));
+                Profiler::Sampling::registerCurrentThread("Job Worker " + std::to_string(i));
+                workerLoop();
+            });
+        }
+
+        JobSystemLogger::record().debug("Job system started with {} worker threads.", workerCount);
+    }
+
+    JobSystem::~JobSystem() {
+        {
+            std::lock_guard lock(m_QueueMutex);
+            m_Stopping = true;
+        }
+        m_QueueCondition.notify_all();
+        for (auto& worker : m_Workers) worker.join();
+    }
+
+    void JobSystem::submit(std::function<void()> job) {
+        {
+            std::lock_guard lock(m_QueueMutex);
+            m_Queue.push_back(std::move(job));
+            LiveMetrics::setQueueDepth(m_MetricsQueue, static_cast<uint32_t>(m_Queue.size()));
+        }
+        m_QueueCondition.notify_one();
+    }
+
+    bool JobSystem::tryRunOne() {
+        std::function<void()> job;
+        {
+            std::lock_guard lock(m_QueueMutex);
+            if (m_Queue.empty()) return false;
+            job = std::move(m_Queue.front());
+            m_Queue.pop_front();
+            LiveMetrics::setQueueDepth(m_MetricsQueue, static_cast<uint32_t>(m_Queue.size()));
+        }
+        VKING_PROFILE_SCOPE("JobSystem::job");
+        job();
+        return true;
+    }
+
+    void JobSystem::parallelFor(const uint32_t count, uint32_t grainSize, const std::function<void(uint32_t, uint32_t)>& body) {
+        if (count == 0) return;
+        grainSize = std::max(grainSize, 1u);
+
+        const uint32_t chunkCount = (count + grainSize - 1) / grainSize;
+        if (chunkCount == 1 || m_Workers.empty()) {
+            body(0, count);
+            return;
+        }
+
+        // shared so helper jobs that only start after the loop finished never touch a dead stack frame.
+        // They can only reach body after claiming a chunk, which is impossible once all chunks are claimed.
+        struct LoopState {
+            std::atomic_uint32_t nextChunk{0};
+            std::atomic_uint32_t finishedChunks{0};
+            const std::function<void(uint32_t, uint32_t)>* body = nullptr;
+            uint32_t count = 0;
+            uint32_t grainSize = 0;
+            uint32_t chunkCount = 0;
+
+            void drain() {
+                for (uint32_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+                     chunk < chunkCount;
+                     chunk = nextChunk.fetch_add(1, std::memory_order_relaxed)) {
+                    const uint32_t begin = chunk * grainSize;
+                    (*body)(begin, std::min(begin + grainSize, count));
+                    finishedChunks.fetch_add(1, std::memory_order_release);
+                }
+            }
+        };
+
+        auto state = std::make_shared<LoopState>();
+        state->body = &body;
+        state->count = count;
+        state->grainSize = grainSize;
+        state->chunkCount = chunkCount;
+
+        const uint32_t helpers = std::min(chunkCount - 1, getWorkerCount());
+        for (uint32_t i = 0; i < helpers; i++) {
+            submit([state] { state->drain(); });
+        }
+
+        state->drain();
+
+        while (state->finishedChunks.load(std::memory_order_acquire) != chunkCount) {
+            if (!tryRunOne()) std::this_thread::yield();
+        }
+    }
+
+    JobSystem& JobSystem::getDefault() {
+        static JobSystem s_JobSystem;
+        static const bool s_MetricsRegistered = [] {
+            // Workers already read the slot under the queue lock
+            std::lock_guard lock(s_JobSystem.m_QueueMutex);
+            s_JobSystem.m_MetricsQueue = LiveMetrics::registerQueue("Jobs");
+            return true;
+        }();
+        static_cast<void>(s_MetricsRegistered);
+        return s_JobSystem;
+    }
+
+    void JobSystem::workerLoop() {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock lock(m_QueueMutex);
+                m_QueueCondition.wait(lock, [this] { return m_Stopping || !m_Queue.empty(); });
+                if (m_Queue.empty()) return; // stopping and fully drained
+                job = std::move(m_Queue.front());
+                m_Queue.pop_front();
+                LiveMetrics::setQueueDepth(m_MetricsQueue, static_cast<uint32_t>(m_Queue.size()));
+            }
+            VKING_PROFILE_SCOPE("JobSystem::job");
+            job();
+        }
+    }
+
+}
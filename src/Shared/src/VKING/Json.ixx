@@ -0,0 +1,534 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+export module VKING.Json;
+
+export namespace VKING::Json {
+
+    enum class Type {
+        NUL,
+        BOOLEAN,
+        NUMBER,
+        STRING,
+        ARRAY,
+        OBJECT
+    };
+
+    /**
+     * @brief A parsed JSON document node.
+     *
+     * Objects keep their members in document order and are searched linearly. Engine documents (asset
+     * descriptions, reports, configs) have few keys per object, where this beats hashing and keeps
+     * dumps stable for diffing.
+     *
+     * Accessors never throw: reading a missing key or the wrong type yields a null value or the given fallback.
+     */
+    class Value {
+    public:
+        using Array = std::vector<Value>;
+        using Object = std::vector<std::pair<std::string, Value>>;
+
+        Value() = default;
+        Value(std::nullptr_t) {}
+        Value(const bool value) : m_Data(value) {}
+        Value(const double value) : m_Data(value) {}
+        Value(const int value) : m_Data(static_cast<double>(value)) {}
+        Value(const int64_t value) : m_Data(static_cast<double>(value)) {}
+        Value(const uint32_t value) : m_Data(static_cast<double>(value)) {}
+        Value(const uint64_t value) : m_Data(static_cast<double>(value)) {}
+        Value(std::string value) : m_Data(std::move(value)) {}
+        Value(const std::string_view value) : m_Data(std::string(value)) {}
+        Value(const char* value) : m_Data(std::string(value)) {}
+        Value(Array value) : m_Data(std::move(value)) {}
+        Value(Object value) : m_Data(std::move(value)) {}
+
+        [[nodiscard]] Type getType() const { return static_cast<Type>(m_Data.index()); }
+        [[nodiscard]] bool isNull() const { return getType() == Type::NUL; }
+        [[nodiscard]] bool isBool() const { return getType() == Type::BOOLEAN; }
+        [[nodiscard]] bool isNumber() const { return getType() == Type::NUMBER; }
+        [[nodiscard]] bool isString() const { return getType() == Type::STRING; }
+        [[nodiscard]] bool isArray() const { return getType() == Type::ARRAY; }
+        [[nodiscard]] bool isObject() const { return getType() == Type::OBJECT; }
+
+        [[nodiscard]] bool asBool(const bool fallback = false) const {
+            const bool* value = std::get_if<bool>(&m_Data);
+            return value ? *value : fallback;
+        }
+
+        [[nodiscard]] double asNumber(const double fallback = 0.0) const {
+            const double* value = std::get_if<double>(&m_Data);
+            return value ? *value : fallback;
+        }
+
+        /**
+         * @return The number converted to T. For integral T, fallback unless the number is a whole number T can hold,
+         *         so negative, fractional, huge or non-finite input never reaches the conversion
+         */
+        template<typename T>
+        [[nodiscard]] T asNumber(const T fallback = T{}) const {
+            const double* value = std::get_if<double>(&m_Data);
+            if (!value) return fallback;
+            if constexpr (std::is_integral_v<T>) {
+                // Both bounds are powers of two (or zero), so they are exact as doubles
+                constexpr double LOWEST = static_cast<double>(std::numeric_limits<T>::min());
+                constexpr double BEYOND_MAX = static_cast<double>(std::numeric_limits<T>::max() / 2 + 1) * 2.0;
+                if (!(*value >= LOWEST && *value < BEYOND_MAX) || std::trunc(*value) != *value) return fallback;
+            }
+            return static_cast<T>(*value);
+        }
+
+        [[nodiscard]] std::string_view asString(const std::string_view fallback = {}) const {
+            const std::string* value = std::get_if<std::string>(&m_Data);
+            return value ? std::string_view(*value) : fallback;
+        }
+
+        /**
+         * @return The elements of an array, empty for any other type
+         */
+        [[nodiscard]] const Array& asArray() const {
+            static const Array s_Empty;
+            const Array* value = std::get_if<Array>(&m_Data);
+            return value ? *value : s_Empty;
+        }
+
+        /**
+         * @return The members of an object, empty for any other type
+         */
+        [[nodiscard]] const Object& asObject() const {
+            static const Object s_Empty;
+            const Object* value = std::get_if<Object>(&m_Data);
+            return value ? *value : s_Empty;
+        }
+
+        /**
+         * @return The member, or nullptr if this is not an object or has no such key
+         */
+        [[nodiscard]] const Value* find(const std::string_view key) const {
+            if (const Object* object = std::get_if<Object>(&m_Data)) {
+                for (const auto& [memberKey, member] : *object) {
+                    if (memberKey == key) return &member;
+                }
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] bool contains(const std::string_view key) const { return find(key) != nullptr; }
+
+        /**
+         * @return The member, or a null value if missing
+         */
+        const Value& operator[](const std::string_view key) const {
+            const Value* member = find(key);
+            return member ? *member : getNull();
+        }
+
+        /**
+         * @return The element, or a null value if out of range or not an array
+         */
+        const Value& operator[](const size_t index) const {
+            const Array& array = asArray();
+            return index < array.size() ? array[index] : getNull();
+        }
+
+        /**
+         * @return The number of array elements or object members, 0 for scalars
+         */
+        [[nodiscard]] size_t size() const {
+            if (const Array* array = std::get_if<Array>(&m_Data)) return array->size();
+            if (const Object* object = std::get_if<Object>(&m_Data)) return object->size();
+            return 0;
+        }
+
+        /**
+         * @brief Sets an object member. A value that is not an object is replaced by an empty object first.
+         *
+         * @return The stored member
+         */
+        Value& set(const std::string_view key, Value value) {
+            if (!isObject()) m_Data = Object{};
+            Object& object = std::get<Object>(m_Data);
+            for (auto& [memberKey, member] : object) {
+                if (memberKey == key) return member = std::move(value);
+            }
+            return object.emplace_back(std::string(key), std::move(value)).second;
+        }
+
+        /**
+         * @brief Appends an array element. A value that is not an array is replaced by an empty array first.
+         *
+         * @return The stored element
+         */
+        Value& push(Value value) {
+            if (!isArray()) m_Data = Array{};
+            return std::get<Array>(m_Data).emplace_back(std::move(value));
+        }
+
+        /**
+         * @brief Serializes the value.
+         *
+         * @param indent Spaces per nesting level, or a negative value for a single line
+         */
+        [[nodiscard]] std::string dump(int indent = -1) const;
+
+    private:
+        static const Value& getNull() {
+            static const Value s_Null;
+            return s_Null;
+        }
+
+        void dumpTo(std::string& output, int indent, int depth) const;
+
+        std::variant<std::nullptr_t, bool, double, std::string, Array, Object> m_Data;
+    };
+
+    /**
+     * @brief Parses a complete JSON document (RFC 8259).
+     *
+     * @param error Receives a message with the byte offset of the first problem when parsing fails. May be nullptr
+     * @return The document, or std::nullopt if the text is not valid JSON
+     */
+    std::optional<Value> parse(std::string_view text, std::string* error = nullptr);
+
+}
+
+namespace VKING::Json {
+
+    namespace {
+
+        constexpr uint32_t MAX_DEPTH = 512;
+
+        class Parser {
+        public:
+            explicit Parser(const std::string_view text) : m_Text(text) {}
+
+            std::optional<Value> parseDocument(std::string* error) {
+                skipWhitespace();
+                Value value;
+                if (parseValue(value, 0)) {
+                    skipWhitespace();
+                    if (m_Position == m_Text.size()) return value;
+                    fail("unexpected trailing characters");
+                }
+                if (error) *error = m_Error + " at byte " + std::to_string(m_Position);
+                return std::nullopt;
+            }
+
+        private:
+            bool fail(const char* message) {
+                if (m_Error.empty()) m_Error = message;
+                return false;
+            }
+
+            void skipWhitespace() {
+                while (m_Position < m_Text.size()) {
+                    const char c = m_Text[m_Position];
+                    if (c != ' ' && c != '\t' && c != '\n' && c != '\r') break;
+                    m_Position++;
+                }
+            }
+
+            bool consumeLiteral(const std::string_view literal) {
+                if (m_Text.substr(m_Position, literal.size()) != literal) return fail("invalid literal");
+                m_Position += literal.size();
+                return true;
+            }
+
+            bool parseValue(Value& value, const uint32_t depth) {
+                if (depth > MAX_DEPTH) return fail("nesting too deep");
+                if (m_Position >= m_Text.size()) return fail("unexpected end of input");
+
+                switch (m_Text[m_Position]) {
+                    case '{': return parseObject(value, depth);
+                    case '[': return parseArray(value, depth);
+                    case '"': {
+                        std::string string;
+                        if (!parseString(string)) return false;
+                        value = Value(std::move(string));
+                        return true;
+                    }
+                    case 't': value = Value(true); return consumeLiteral("true");
+                    case 'f': value = Value(false); return consumeLiteral("false");
+                    case 'n': value = Value(); return consumeLiteral("null");
+                    default: return parseNumber(value);
+                }
+            }
+
+            bool parseNumber(Value& value) {
+                // validate the JSON grammar first, from_chars alone accepts forms JSON does not ("inf", "1.")
+                const size_t start = m_Position;
+                auto digits = [this] {
+                    const size_t first = m_Position;
+                    while (m_Position < m_Text.size() && m_Text[m_Position] >= '0' && m_Text[m_Position] <= '9') m_Position++;
+                    return m_Position - first;
+                };
+
+                if (m_Position < m_Text.size() && m_Text[m_Position] == '-') m_Position++;
+                const size_t integerStart = m_Position;
+                const size_t integerDigits = digits();
+                if (integerDigits == 0) return fail("invalid value");
+                if (integerDigits > 1 && m_Text[integerStart] == '0') return fail("leading zero in number");
+                if (m_Position < m_Text.size() && m_Text[m_Position] == '.') {
+                    m_Position++;
+                    if (digits() == 0) return fail("missing digits after decimal point");
+                }
+                if (m_Position < m_Text.size() && (m_Text[m_Position] == 'e' || m_Text[m_Position] == 'E')) {
+                    m_Position++;
+                    if (m_Position < m_Text.size() && (m_Text[m_Position] == '+' || m_Text[m_Position] == '-')) m_Position++;
+                    if (digits() == 0) return fail("missing exponent digits");
+                }
+
+                double number = 0.0;
+                const auto result = std::from_chars(m_Text.data() + start, m_Text.data() + m_Position, number);
+                if (result.ec == std::errc::invalid_argument) return fail("invalid number");
+                // from_chars leaves the value untouched when it does not fit a double, it would silently read as 0
+                if (result.ec == std::errc::result_out_of_range) return fail("number out of range");
+                value = Value(number);
+                return true;
+            }
+
+            static void appendUtf8(std::string& output, const uint32_t codePoint) {
+                if (codePoint < 0x80) {
+                    output += static_cast<char>(codePoint);
+                } else if (codePoint < 0x800) {
+                    output += static_cast<char>(0xC0 | (codePoint >> 6));
+                    output += static_cast<char>(0x80 | (codePoint & 0x3F));
+                } else if (codePoint < 0x10000) {
+                    output += static_cast<char>(0xE0 | (codePoint >> 12));
+                    output += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    output += static_cast<char>(0x80 | (codePoint & 0x3F));
+                } else {
+                    output += static_cast<char>(0xF0 | (codePoint >> 18));
+                    output += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                    output += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    output += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            }
+
+            bool parseHex4(uint32_t& codePoint) {
+                if (m_Text.size() - m_Position < 4) return fail("truncated unicode escape");
+                const auto result = std::from_chars(m_Text.data() + m_Position, m_Text.data() + m_Position + 4, codePoint, 16);
+                if (result.ptr != m_Text.data() + m_Position + 4) return fail("invalid unicode escape");
+                m_Position += 4;
+                return true;
+            }
+
+            bool parseString(std::string& output) {
+                m_Position++; // opening quote
+                while (true) {
+                    // copy runs without escapes in one go
+                    const size_t runStart = m_Position;
+                    while (m_Position < m_Text.size() && m_Text[m_Position] != '"' && m_Text[m_Position] != '\\') {
+                        if (static_cast<unsigned char>(m_Text[m_Position]) < 0x20) return fail("control character in string");
+                        m_Position++;
+                    }
+                    output.append(m_Text.substr(runStart, m_Position - runStart));
+
+                    if (m_Position >= m_Text.size()) return fail("unterminated string");
+                    if (m_Text[m_Position++] == '"') return true;
+                    if (m_Position >= m_Text.size()) return fail("unterminated escape");
+
+                    switch (m_Text[m_Position++]) {
+                        case '"':  output += '"'; break;
+                        case '\\': output += '\\'; break;
+                        case '/':  output += '/'; break;
+                        case 'b':  output += '\b'; break;
+                        case 'f':  output += '\f'; break;
+                        case 'n':  output += '\n'; break;
+                        case 'r':  output += '\r'; break;
+                        case 't':  output += '\t'; break;
+                        case 'u': {
+                            uint32_t codePoint = 0;
+                            if (!parseHex4(codePoint)) return false;
+                            if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+                                uint32_t low = 0;
+                                if (m_Text.substr(m_Position, 2) != "\\u") return fail("unpaired surrogate");
+                                m_Position += 2;
+                                if (!parseHex4(low)) return false;
+                                if (low < 0xDC00 || low > 0xDFFF) return fail("unpaired surrogate");
+                                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                            } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+                                return fail("unpaired surrogate");
+                            }
+                            appendUtf8(output, codePoint);
+                            break;
+                        }
+                        default: return fail("invalid escape");
+                    }
+                }
+            }
+
+            bool parseArray(Value& value, const uint32_t depth) {
+                m_Position++;
+                Value::Array array;
+                skipWhitespace();
+                if (m_Position < m_Text.size() && m_Text[m_Position] == ']') {
+                    m_Position++;
+                    value = Value(std::move(array));
+                    return true;
+                }
+
+                while (true) {
+                    skipWhitespace();
+                    if (!parseValue(array.emplace_back(), depth + 1)) return false;
+                    skipWhitespace();
+                    if (m_Position >= m_Text.size()) return fail("unterminated array");
+                    const char c = m_Text[m_Position++];
+                    if (c == ']') break;
+                    if (c != ',') return fail("expected ',' or ']'");
+                }
+                value = Value(std::move(array));
+                return true;
+            }
+
+            bool parseObject(Value& value, const uint32_t depth) {
+                m_Position++;
+                Value::Object object;
+                skipWhitespace();
+                if (m_Position < m_Text.size() && m_Text[m_Position] == '}') {
+                    m_Position++;
+                    value = Value(std::move(object));
+                    return true;
+                }
+
+                while (true) {
+                    skipWhitespace();
+                    if (m_Position >= m_Text.size() || m_Text[m_Position] != '"') return fail("expected object key");
+                    auto& [key, member] = object.emplace_back();
+                    if (!parseString(key)) return false;
+                    skipWhitespace();
+                    if (m_Position >= m_Text.size() || m_Text[m_Position++] != ':') return fail("expected ':'");
+                    skipWhitespace();
+                    if (!parseValue(member, depth + 1)) return false;
+                    skipWhitespace();
+                    if (m_Position >= m_Text.size()) return fail("unterminated object");
+                    const char c = m_Text[m_Position++];
+                    if (c == '}') break;
+                    if (c != ',') return fail("expected ',' or '}'");
+                }
+                value = Value(std::move(object));
+                return true;
+            }
+
+            std::string_view m_Text;
+            size_t m_Position = 0;
+            std::string m_Error;
+        };
+
+        void dumpString(std::string& output, const std::string_view string) {
+            output += '"';
+            for (const char c : string) {
+                switch (c) {
+                    case '"':  output += "\\\""; break;
+                    case '\\': output += "\\\\"; break;
+                    case '\n': output += "\\n"; break;
+                    case '\r': output += "\\r"; break;
+                    case '\t': output += "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            char escape[8];
+                            std::snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned>(c));
+                            output += escape;
+                        } else {
+                            output += c;
+                        }
+                }
+            }
+            output += '"';
+        }
+
+        void newline(std::string& output, const int indent, const int depth) {
+            if (indent < 0) return;
+            output += '\n';
+            output.append(static_cast<size_t>(indent) * static_cast<size_t>(depth), ' ');
+        }
+
+    }
+
+    std::string Value::dump(const int indent) const {
+        std::string output;
+        dumpTo(output, indent, 0);
+        return output;
+    }
+
+    void Value::dumpTo(std::string& output, const int indent, const int depth) const {
+        switch (getType()) {
+            case Type::NUL: output += "null"; break;
+            case Type::BOOLEAN: output += std::get<bool>(m_Data) ? "true" : "false"; break;
+            case Type::NUMBER: {
+                const double number = std::get<double>(m_Data);
+                if (!std::isfinite(number)) {
+                    output += "null"; // JSON has no representation for inf/nan
+                    break;
+                }
+                char buffer[32];
+                const auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+                output.append(buffer, result.ptr);
+                break;
+            }
+            case Type::STRING: dumpString(output, std::get<std::string>(m_Data)); break;
+            case Type::ARRAY: {
+                const Array& array = std::get<Array>(m_Data);
+                output += '[';
+                for (size_t i = 0; i < array.size(); i++) {
+                    if (i) output += ',';
+                    newline(output, indent, depth + 1);
+                    array[i].dumpTo(output, indent, depth + 1);
+                }
+                if (!array.empty()) newline(output, indent, depth);
+                output += ']';
+                break;
+            }
+            case Type::OBJECT: {
+                const Object& object = std::get<Object>(m_Data);
+                output += '{';
+                for (size_t i = 0; i < object.size(); i++) {
+                    if (i) output += ',';
+                    newline(output, indent, depth + 1);
+                    dumpString(output, object[i].first);
+                    output += indent < 0 ? ":" : ": ";
+                    object[i].second.dumpTo(output, indent, depth + 1);
+                }
+                if (!object.empty()) newline(output, indent, depth);
+                output += '}';
+                break;
+            }
+        }
+    }
+
+    std::optional<Value> parse(const std::string_view text, std::string* error) {
+        return Parser(text).parseDocument(error);
+    }
+
+}
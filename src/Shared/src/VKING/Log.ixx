@@ -22,10 +22,19 @@
 // VKING.Log.ixx (module interface)
 module;
 
+#include <atomic>
+#include <optional>
+#include <string_view>
+
 #include <spdlog/spdlog.h>
+#include <spdlog/details/null_mutex.h>
+#include <spdlog/sinks/base_sink.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <VKING/Profiler.hpp>
+#include <VKING/ProfilerStream.hpp>
+
 export module VKING.Log;
 
 
@@ -95,6 +104,23 @@ export namespace VKING {
          */
         static void setLevel(Level level);
 
+        /**
+         * @brief Parses a level name the way spdlog spells them: trace, debug, info, warning (or warn),
+         *        error (or err), critical or off.
+         *
+         * @return std::nullopt for any other name
+         */
+        static std::optional<Level> parseLevel(std::string_view name);
+
+        /**
+         * @brief Enable or disable the console sink. The log file keeps receiving every message.
+         *
+         * Tools that print machine-readable output on stdout (benchmarks, reports) turn the console off.
+         *
+         * @param enabled Whether messages should also go to the console
+         */
+        static void setConsoleOutput(bool enabled);
+
 
         // New: helper to make inline string literals work as NTTP
         /**
@@ -176,6 +202,7 @@ export namespace VKING {
              */
             template <spdlog::level::level_enum Level, typename... Args>
             static void log(const std::source_location& loc, fmt::format_string<Args...> fmt, Args&&... args) {
+                VKING_PROFILE_SCOPE("Log::log");
                 auto logger = get();  // your Named logger
                 logger->log(spdlog::source_loc{
                         loc.file_name(),
@@ -283,8 +310,21 @@ export namespace VKING {
 
 // Namespace containing global sink pointers shared across all loggers
 namespace VKING::detail {
+    /// Forwards messages to a connected profiler viewer. Profiler::Stream does its own locking, so no mutex here
+    class StreamSink final : public spdlog::sinks::base_sink<spdlog::details::null_mutex> {
+    protected:
+        void sink_it_(const spdlog::details::log_msg& msg) override {
+            Profiler::Stream::publishLog(static_cast<uint32_t>(msg.level),
+                                         std::string_view(msg.logger_name.data(), msg.logger_name.size()),
+                                         std::string_view(msg.payload.data(), msg.payload.size()));
+        }
+        void flush_() override {}
+    };
+
     inline std::shared_ptr<spdlog::sinks::basic_file_sink_mt>   file_sink;     // File sink (thread-safe)
     inline std::shared_ptr<spdlog::sinks::stdout_color_sink_mt> console_sink;  // Colored console sink (thread-safe)
+    inline std::shared_ptr<StreamSink>                           stream_sink;   // Profiler viewer, idle without one
+    inline std::atomic_bool console_enabled{true};                               // Console sink passes messages at all
 }
 
 // Template definition: retrieve or create the named spdlog logger
@@ -296,10 +336,11 @@ std::shared_ptr<spdlog::logger> VKING::Log::Named<Name>::get() {
 
     // Static local ensures thread-safe lazy initialization (Meyers' singleton)
     static std::shared_ptr<spdlog::logger> s_Logger = [] {
+        VKING_PROFILE_SCOPE("Log::createLogger");
         Level globalLevel = spdlog::get_level();
         auto logger = spdlog::get(Name.data);
         if (!logger) {
-            std::vector<spdlog::sink_ptr> sinks{detail::file_sink, detail::console_sink};
+            std::vector<spdlog::sink_ptr> sinks{detail::file_sink, detail::console_sink, detail::stream_sink};
             logger = std::make_shared<spdlog::logger>(Name.data, sinks.begin(), sinks.end());
             logger->set_level(globalLevel);
             spdlog::register_logger(logger);
@@ -318,14 +359,16 @@ std::shared_ptr<spdlog::logger> VKING::Log::Named<Name>::get() {
 
             // Ensure our sinks are present (idempotently)
             auto& existing_sinks = logger->sinks();
-            bool has_file = false, has_console = false;
+            bool has_file = false, has_console = false, has_stream = false;
             for (const auto& sink : existing_sinks) {
                 if (sink == detail::file_sink) has_file = true;
                 if (sink == detail::console_sink) has_console = true;
+                if (sink == detail::stream_sink) has_stream = true;
             }
 
             if (!has_file) existing_sinks.push_back(detail::file_sink);
             if (!has_console) existing_sinks.push_back(detail::console_sink);
+            if (!has_stream) existing_sinks.push_back(detail::stream_sink);
 
             // level to match VKING globals
             //logger->set_pattern(spdlog::get_pattern());
@@ -350,6 +393,7 @@ std::shared_ptr<spdlog::logger> VKING::Log::Named<Name>::get() {
 
 // Initialize global sinks (called once)
 void VKING::Log::Init(const std::string& logFilePath, Level initialLevel) {
+    VKING_PROFILE_SCOPE("Log::Init");
 
     // Ensure initialization happens only once
     static std::atomic_bool s_LogInitialized{false};
@@ -359,6 +403,7 @@ void VKING::Log::Init(const std::string& logFilePath, Level initialLevel) {
 
         detail::file_sink   = std::make_shared<spdlog::sinks::basic_file_sink_mt>(logFilePath);
         detail::console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+        detail::stream_sink = std::make_shared<detail::StreamSink>();
 
         spdlog::set_pattern(VKING::Log::DEFAULT_LOG_PATTERN);
         detail::file_sink->set_pattern(DEFAULT_LOG_PATTERN);
@@ -377,6 +422,7 @@ void VKING::Log::Init(const std::string& logFilePath, Level initialLevel) {
 
 // Apply new pattern to all sinks
 void VKING::Log::setFormat(const std::string& format) {
+    VKING_PROFILE_SCOPE("Log::setFormat");
 
     spdlog::set_pattern(format);
     detail::file_sink->set_pattern(format);
@@ -388,11 +434,12 @@ using testLogger = VKING::Log::Named<"TestLogger">;
 
 // Apply new global log level
 void VKING::Log::setLevel(VKING::Log::Level level) {
+    VKING_PROFILE_SCOPE("Log::setLevel");
 
 
     spdlog::set_level(level);
     detail::file_sink->set_level(level);
-    detail::console_sink->set_level(level);
+    detail::console_sink->set_level(detail::console_enabled ? level : Level::off);
 
     spdlog::apply_all([&](const std::shared_ptr<spdlog::logger>& logger) {
         logger->set_level(level);
@@ -400,4 +447,19 @@ void VKING::Log::setLevel(VKING::Log::Level level) {
 
 }
 
-// Ensure logger exists when Named<>::get() is called
\ No newline at end of file
+// Parse a level name, rejecting the unknown names spdlog would quietly map to off
+std::optional<VKING::Log::Level> VKING::Log::parseLevel(const std::string_view name) {
+    const Level level = spdlog::level::from_str(std::string(name));
+    if (level == Level::off && name != "off") return std::nullopt;
+    return level;
+}
+
+// Toggle the console sink, remembering the choice for later setLevel() calls
+void VKING::Log::setConsoleOutput(const bool enabled) {
+
+    detail::console_enabled = enabled;
+    detail::console_sink->set_level(enabled ? spdlog::get_level() : Level::off);
+
+}
+
+// Ensure logger exists when Named<>::get() is called
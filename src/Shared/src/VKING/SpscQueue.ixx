@@ -0,0 +1,127 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+export module VKING.SpscQueue;
+
+export namespace VKING {
+
+    /**
+     * @brief Bounded lock-free queue between exactly one producer thread and one consumer thread.
+     *
+     * Both sides only touch their own index and a cached copy of the other one, so an uncontended push or pop is a
+     * store and, now and then, one acquire load of the other side's cache line. Nothing allocates after construction.
+     *
+     * @tparam T Element type, default constructible (the slots are constructed up front)
+     * @tparam Capacity Number of slots, a power of two
+     */
+    template<typename T, size_t Capacity>
+    class SpscQueue {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+        static_assert(std::is_default_constructible_v<T>, "SpscQueue elements must be default constructible");
+
+    public:
+        static constexpr size_t CAPACITY = Capacity;
+
+        SpscQueue() = default;
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /**
+         * @brief Producer only.
+         * @return false if the queue is full, value is not added
+         */
+        bool tryPush(T value) {
+            const size_t head = m_Head.load(std::memory_order_relaxed);
+            if (head - m_CachedTail == Capacity) {
+                m_CachedTail = m_Tail.load(std::memory_order_acquire);
+                if (head - m_CachedTail == Capacity) return false;
+            }
+            m_Slots[head & MASK] = std::move(value);
+            m_Head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Consumer only.
+         * @return The oldest element, or nullptr if the queue is empty. Valid until pop()
+         */
+        T* front() {
+            const size_t tail = m_Tail.load(std::memory_order_relaxed);
+            if (tail == m_CachedHead) {
+                m_CachedHead = m_Head.load(std::memory_order_acquire);
+                if (tail == m_CachedHead) return nullptr;
+            }
+            return &m_Slots[tail & MASK];
+        }
+
+        /**
+         * @brief Consumer only. Removes the element front() returned, which must not have been nullptr.
+         */
+        void pop() {
+            m_Tail.store(m_Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Consumer only.
+         * @return false if the queue is empty
+         */
+        bool tryPop(T& value) {
+            T* element = front();
+            if (!element) return false;
+            value = std::move(*element);
+            pop();
+            return true;
+        }
+
+        /**
+         * @brief Number of queued elements, never more than Capacity. Exact only on a side whose counterpart is idle.
+         */
+        [[nodiscard]] size_t sizeApprox() const {
+            // tail first: both only grow, so a head read afterwards is never behind it and the difference cannot
+            // wrap. The stale tail can still make it overshoot while both sides are busy, hence the clamp
+            const size_t tail = m_Tail.load(std::memory_order_acquire);
+            const size_t head = m_Head.load(std::memory_order_acquire);
+            return std::min(head - tail, Capacity);
+        }
+
+    private:
+        static constexpr size_t MASK = Capacity - 1;
+        /// Keeps the producer's and the consumer's indices on separate cache lines
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_Head{0};
+        size_t m_CachedTail = 0;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_Tail{0};
+        size_t m_CachedHead = 0;
+
+        alignas(CACHE_LINE_SIZE) std::array<T, Capacity> m_Slots{};
+    };
+
+}
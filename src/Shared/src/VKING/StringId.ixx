@@ -0,0 +1,84 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+export module VKING.StringId;
+
+export namespace VKING {
+
+    /**
+     * @brief A name reduced to its 64 bit FNV-1a hash, so it can be compared and looked up like an integer.
+     *
+     * Hashes of literals are computed at compile time:
+     * @code
+     * using namespace VKING::StringIdLiterals;
+     * constexpr StringId WINDOW_WIDTH = "window.width"_sid;
+     * static_assert(WINDOW_WIDTH == StringId("window.width"));
+     * @endcode
+     *
+     * The name itself is not kept. Registries that need it back (CVars, for instance) store it next to the id and
+     * check for collisions there.
+     */
+    class StringId {
+    public:
+        static constexpr uint64_t OFFSET_BASIS = 14695981039346656037ull;
+        static constexpr uint64_t PRIME = 1099511628211ull;
+
+        constexpr StringId() = default;
+        constexpr explicit StringId(const std::string_view name) : m_Hash(hash(name)) {}
+
+        [[nodiscard]] static constexpr uint64_t hash(const std::string_view name) {
+            uint64_t value = OFFSET_BASIS;
+            for (const char character : name) {
+                value ^= static_cast<uint8_t>(character);
+                value *= PRIME;
+            }
+            return value;
+        }
+
+        [[nodiscard]] constexpr uint64_t getHash() const { return m_Hash; }
+        [[nodiscard]] constexpr bool isValid() const { return m_Hash != 0; }
+
+        constexpr auto operator<=>(const StringId&) const = default;
+
+    private:
+        /// 0 is the invalid id, no real name is expected to hash to it
+        uint64_t m_Hash = 0;
+    };
+
+    namespace StringIdLiterals {
+        consteval StringId operator""_sid(const char* name, const size_t length) {
+            return StringId(std::string_view(name, length));
+        }
+    }
+
+}
+
+template<>
+struct std::hash<VKING::StringId> {
+    size_t operator()(const VKING::StringId id) const noexcept { return static_cast<size_t>(id.getHash()); }
+};
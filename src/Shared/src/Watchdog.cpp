@@ -0,0 +1,336 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#include "Watchdog.hpp"
+#include "Profiler.hpp"
+#include "Signals.hpp"
+#include "Symbolizer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#   include <cerrno>
+#   include <csignal>
+#   include <execinfo.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
+
+namespace VKING::Watchdog {
+
+#if defined(__linux__)
+
+    namespace {
+
+        constexpr auto POLL_INTERVAL = std::chrono::milliseconds(100);
+        /// A wake-up this late means the whole process was stopped (a debugger, SIGSTOP), not that the loop hung
+        constexpr auto SUSPENDED_THRESHOLD = std::chrono::seconds(2);
+        /// How long a thread gets to answer the stack capture signal
+        constexpr auto CAPTURE_TIMEOUT = std::chrono::milliseconds(200);
+        /// Time the loop gets to notice the fatal shutdown request before the process is ended
+        constexpr auto FATAL_GRACE = std::chrono::seconds(2);
+        constexpr int MAX_STACK_DEPTH = 64;
+
+        /// One stack capture at a time, written by the target thread's signal handler
+        struct StackCapture {
+            std::atomic<pid_t> target{0};
+            std::atomic_bool done{false};
+            int depth = 0;
+            void* frames[MAX_STACK_DEPTH];
+        };
+
+        struct ThreadStack {
+            pid_t tid;
+            std::string name;
+            std::vector<uintptr_t> frames;
+            bool captured;
+        };
+
+        struct State {
+            /// steady_clock nanoseconds of the last heartbeat, 0 while disarmed
+            std::atomic<int64_t> lastHeartbeat{0};
+            std::atomic<uint64_t> heartbeats{0};
+
+            std::mutex mutex;
+            std::condition_variable wake;
+            bool running = false;
+            bool signalInstalled = false;
+            Config config;
+            std::thread thread;
+            pid_t watchdogTid = 0;
+        };
+
+        State& getState() {
+            // Intentionally leaked: heartbeat() may run while static destructors do
+            static State* s_State = new State();
+            return *s_State;
+        }
+
+        StackCapture s_Capture;
+
+        int getCaptureSignal() {
+            return SIGRTMIN;
+        }
+
+        int64_t getNanoseconds() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        pid_t getThreadId() {
+            return static_cast<pid_t>(syscall(SYS_gettid));
+        }
+
+        // backtrace() was warmed up in start(), so it neither loads libgcc nor allocates here
+        void captureHandler(int) {
+            const int savedErrno = errno;
+            if (s_Capture.target.load(std::memory_order_acquire) == getThreadId() && !s_Capture.done.load(std::memory_order_relaxed)) {
+                s_Capture.depth = backtrace(s_Capture.frames, MAX_STACK_DEPTH);
+                s_Capture.done.store(true, std::memory_order_release);
+            }
+            errno = savedErrno;
+        }
+
+        std::string readThreadName(const pid_t tid) {
+            std::ifstream comm("/proc/self/task/" + std::to_string(tid) + "/comm");
+            std::string name;
+            std::getline(comm, name);
+            return name;
+        }
+
+        std::vector<pid_t> listThreads() {
+            std::vector<pid_t> tids;
+            std::error_code error;
+            for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", error)) {
+                tids.push_back(static_cast<pid_t>(std::stol(entry.path().filename().string())));
+            }
+            std::ranges::sort(tids);
+            return tids;
+        }
+
+        /// Every thread's stack except the watchdog's own two
+        std::vector<ThreadStack> captureStacks(const pid_t watchdog, const pid_t self) {
+            std::vector<ThreadStack> stacks;
+            const pid_t process = getpid();
+            for (const pid_t tid : listThreads()) {
+                ThreadStack stack{tid, readThreadName(tid), {}, false};
+                if (tid != watchdog && tid != self) {
+                    s_Capture.done.store(false, std::memory_order_relaxed);
+                    s_Capture.target.store(tid, std::memory_order_release);
+                    if (syscall(SYS_tgkill, process, tid, getCaptureSignal()) == 0) {
+                        const auto deadline = std::chrono::steady_clock::now() + CAPTURE_TIMEOUT;
+                        while (!s_Capture.done.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        }
+                    }
+                    // A thread answering after the deadline finds another target and leaves the capture alone
+                    s_Capture.target.store(0, std::memory_order_release);
+                    if (s_Capture.done.load(std::memory_order_acquire)) {
+                        stack.captured = true;
+                        // Skip the handler and the signal trampoline
+                        for (int i = 2; i < s_Capture.depth; i++) stack.frames.push_back(reinterpret_cast<uintptr_t>(s_Capture.frames[i]));
+                    }
+                }
+                stacks.push_back(std::move(stack));
+            }
+            return stacks;
+        }
+
+        void writeDiagnostics(const Config& config, const pid_t watchdog, const double stalledMilliseconds, const uint64_t frames) {
+            const pid_t self = getThreadId();
+            std::vector<ThreadStack> stacks = captureStacks(watchdog, self);
+
+            std::vector<uintptr_t> addresses;
+            for (const ThreadStack& stack : stacks) {
+                for (size_t i = 0; i < stack.frames.size(); i++) {
+                    // Return addresses point after the call, name the call itself. The innermost is the interrupted pc
+                    addresses.push_back(i == 0 ? stack.frames[i] : stack.frames[i] - 1);
+                }
+            }
+            const auto names = Profiler::detail::symbolize(addresses);
+
+            const std::string stem = "VKING_Hang." + std::to_string(getpid());
+            const std::filesystem::path reportPath = config.outputDirectory / (stem + ".txt");
+            const std::filesystem::path tracePath = config.outputDirectory / (stem + ".json");
+
+            if (std::FILE* file = std::fopen(reportPath.string().c_str(), "wb")) {
+                std::fprintf(file, "Main loop stalled for %.0f ms after %llu frames.\n", stalledMilliseconds, static_cast<unsigned long long>(frames));
+                if (Shutdown::isRequested()) {
+                    std::fprintf(file, "A shutdown was requested and not honoured: %s\n", Shutdown::reasonToString(Shutdown::getReason().reason));
+                }
+                for (const ThreadStack& stack : stacks) {
+                    std::fprintf(file, "\nThread %d (%s)%s\n", stack.tid, stack.name.c_str(),
+                                 stack.tid == watchdog || stack.tid == self ? ": the watchdog" : stack.captured ? "" : ": did not answer, its stack is unknown");
+                    for (size_t i = 0; i < stack.frames.size(); i++) {
+                        const uintptr_t address = i == 0 ? stack.frames[i] : stack.frames[i] - 1;
+                        const auto name = names.find(address);
+                        std::fprintf(file, "  #%-2zu %s\n", i, name != names.end() ? name->second.c_str() : "?");
+                    }
+                }
+                std::fclose(file);
+                std::fprintf(stderr, "VKING::Watchdog: main loop stalled for %.0f ms, thread stacks written to %s\n", stalledMilliseconds,
+                             reportPath.string().c_str());
+            }
+
+#if VKING_PROFILER_ENABLED
+            // Every retained frame: the zones that completed during the stalled frame come after the last frame boundary
+            if (Profiler::exportChromeTrace(tracePath)) {
+                std::fprintf(stderr, "VKING::Watchdog: profiler history written to %s\n", tracePath.string().c_str());
+            }
+#endif
+        }
+
+        void watchdogLoop() {
+            State& state = getState();
+            state.watchdogTid = getThreadId();
+
+            auto previousWake = std::chrono::steady_clock::now();
+            int64_t diagnosedHeartbeat = 0;
+            int64_t fatalHeartbeat = 0;
+
+            std::unique_lock lock(state.mutex);
+            while (state.running) {
+                state.wake.wait_for(lock, POLL_INTERVAL);
+                if (!state.running) break;
+
+                const auto now = std::chrono::steady_clock::now();
+                const bool suspended = now - previousWake > SUSPENDED_THRESHOLD;
+                previousWake = now;
+
+                const int64_t heartbeat = state.lastHeartbeat.load(std::memory_order_relaxed);
+                if (heartbeat == 0) continue;
+                if (suspended) {
+                    // Restart the clock rather than blame the loop for time nobody ran
+                    int64_t expected = heartbeat;
+                    state.lastHeartbeat.compare_exchange_strong(expected, getNanoseconds(), std::memory_order_relaxed);
+                    continue;
+                }
+
+                const double stalledMilliseconds = static_cast<double>(getNanoseconds() - heartbeat) / 1'000'000.0;
+                const Config& config = state.config;
+
+                if (stalledMilliseconds >= config.hangMilliseconds && diagnosedHeartbeat != heartbeat) {
+                    diagnosedHeartbeat = heartbeat;
+                    // On its own thread, so a diagnostic step that blocks (a lock the hung thread holds) cannot delay the fatal exit
+                    std::thread(writeDiagnostics, config, state.watchdogTid, stalledMilliseconds,
+                                state.heartbeats.load(std::memory_order_relaxed)).detach();
+                }
+
+                if (config.fatalMilliseconds > 0 && stalledMilliseconds >= config.fatalMilliseconds && fatalHeartbeat != heartbeat) {
+                    fatalHeartbeat = heartbeat;
+                    Shutdown::request(Shutdown::Reason::REASON_FATAL_ERROR, "Watchdog: the main loop stopped responding.");
+                    std::fprintf(stderr, "VKING::Watchdog: main loop stalled for %.0f ms, requesting a fatal shutdown.\n", stalledMilliseconds);
+
+                    state.wake.wait_for(lock, FATAL_GRACE, [&state, heartbeat] {
+                        return !state.running || state.lastHeartbeat.load(std::memory_order_relaxed) != heartbeat;
+                    });
+                    if (state.running && state.lastHeartbeat.load(std::memory_order_relaxed) == heartbeat) {
+                        std::fprintf(stderr, "VKING::Watchdog: the main loop did not recover, exiting with status %d.\n", FATAL_EXIT_CODE);
+                        std::fflush(nullptr);
+                        _exit(FATAL_EXIT_CODE);
+                    }
+                }
+            }
+        }
+
+    }
+
+    bool start(const Config& config) {
+        State& state = getState();
+        std::lock_guard lock(state.mutex);
+        if (state.running) return false;
+
+        if (!state.signalInstalled) {
+            // Load libgcc's unwinder now, backtrace() would otherwise allocate the first time a handler calls it
+            void* warmup[1];
+            backtrace(warmup, 1);
+
+            struct sigaction action{};
+            action.sa_handler = captureHandler;
+            sigemptyset(&action.sa_mask);
+            action.sa_flags = SA_RESTART;
+            if (sigaction(getCaptureSignal(), &action, nullptr) != 0) return false;
+            state.signalInstalled = true;
+        }
+
+        state.config = config;
+        state.config.fatalMilliseconds = config.fatalMilliseconds == 0 ? 0 : std::max(config.fatalMilliseconds, config.hangMilliseconds);
+        state.lastHeartbeat.store(0, std::memory_order_relaxed);
+        state.running = true;
+        state.thread = std::thread(watchdogLoop);
+        return true;
+    }
+
+    void stop() {
+        State& state = getState();
+        {
+            std::lock_guard lock(state.mutex);
+            if (!state.running) return;
+            state.running = false;
+        }
+        state.wake.notify_all();
+        state.thread.join();
+    }
+
+    bool isRunning() {
+        State& state = getState();
+        std::lock_guard lock(state.mutex);
+        return state.running;
+    }
+
+    void heartbeat() {
+        State& state = getState();
+        state.lastHeartbeat.store(getNanoseconds(), std::memory_order_relaxed);
+        state.heartbeats.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void pause() {
+        getState().lastHeartbeat.store(0, std::memory_order_relaxed);
+    }
+
+#else
+
+    bool start(const Config&) {
+        return false;
+    }
+
+    void stop() {}
+
+    bool isRunning() {
+        return false;
+    }
+
+    void heartbeat() {}
+
+    void pause() {}
+
+#endif
+
+}
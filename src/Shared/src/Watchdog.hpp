@@ -0,0 +1,77 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+/**
+ * Main loop watchdog.
+ *
+ * The loop calls heartbeat() once per frame. When no heartbeat arrives for Config::hangMilliseconds, a watchdog
+ * thread writes hang diagnostics: the stack of every thread in the process and the profiler's history. If the
+ * loop is still stalled after Config::fatalMilliseconds, it requests a REASON_FATAL_ERROR shutdown and, when
+ * the loop does not come back to honour it, exits the process. A hung loop never checks Shutdown::isRequested(),
+ * so without the watchdog SIGTERM cannot end it either.
+ */
+namespace VKING::Watchdog {
+
+    constexpr uint32_t DEFAULT_HANG_MILLISECONDS = 10'000;
+    constexpr uint32_t DEFAULT_FATAL_MILLISECONDS = 30'000;
+    /// Exit status of a process the watchdog ended (EX_SOFTWARE)
+    constexpr int FATAL_EXIT_CODE = 70;
+
+    struct Config {
+        /// Stall after which diagnostics are written
+        uint32_t hangMilliseconds = DEFAULT_HANG_MILLISECONDS;
+        /// Stall after which the process is ended. 0 never ends it
+        uint32_t fatalMilliseconds = DEFAULT_FATAL_MILLISECONDS;
+        /// Where VKING_Hang.<pid>.txt (stacks) and VKING_Hang.<pid>.json (profiler trace) are written
+        std::filesystem::path outputDirectory = ".";
+    };
+
+    /**
+     * @brief Starts the watchdog thread. It stays disarmed until the first heartbeat().
+     *
+     * @return false if it is already running, or on platforms without thread stack capture
+     */
+    bool start(const Config& config);
+
+    /**
+     * @brief Stops and joins the watchdog thread.
+     */
+    void stop();
+
+    bool isRunning();
+
+    /**
+     * @brief Tells the watchdog the main loop completed a frame, and arms it. A relaxed atomic store.
+     */
+    void heartbeat();
+
+    /**
+     * @brief Disarms the watchdog until the next heartbeat(), for work outside the loop such as loading or teardown.
+     */
+    void pause();
+
+}
@@ -0,0 +1,259 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Test_CVar [--filter=<text>]
+//
+// CVar layering: which source wins and what reset brings back, values set before a CVar registers, invalid values
+// falling through to a lower layer, config file flattening and hot reload, and names registered twice.
+// Every test uses CVar names of its own, since the registry lives as long as the process.
+//
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+import VKING.Log;
+import VKING.CVar;
+import VKING.Test.Harness;
+
+namespace {
+
+    using namespace VKING;
+    using CVars::Source;
+
+    /// Writes a config file, moving its timestamp forward so a reload notices even within the clock's resolution
+    void writeConfigFile(const std::filesystem::path& path, const std::string_view contents) {
+        std::error_code error;
+        const auto previous = std::filesystem::last_write_time(path, error);
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << contents;
+        }
+        if (!error) std::filesystem::last_write_time(path, previous + std::chrono::seconds(1), error);
+    }
+
+    size_t countRegistered(const std::string_view name) {
+        size_t count = 0;
+        for (const CVars::Info& info : CVars::list()) count += info.name == name;
+        return count;
+    }
+
+    void testPrecedence(Test::Runner& runner) {
+        runner.run("CVar/precedence", [](Test::Context& test) {
+            CVars::CVar<uint32_t> value{"test.precedence", 1, "Layer precedence"};
+            test.checkEqual(value.get(), 1u, "default");
+
+            test.check(CVars::set("test.precedence", "2", Source::CONFIG_FILE), "set config file");
+            test.checkEqual(value.get(), 2u, "config file over default");
+            test.check(CVars::set("test.precedence", "3", Source::COMMAND_LINE), "set command line");
+            test.checkEqual(value.get(), 3u, "command line over config file");
+            test.check(CVars::set("test.precedence", "4", Source::CONSOLE), "set console");
+            test.checkEqual(value.get(), 4u, "console over command line");
+
+            // A lower layer changing underneath does not show while a higher one is set
+            test.check(CVars::set("test.precedence", "5", Source::CONFIG_FILE), "set config file again");
+            test.checkEqual(value.get(), 4u, "console still wins");
+        });
+
+        runner.run("CVar/reset", [](Test::Context& test) {
+            CVars::CVar<uint32_t> value{"test.reset", 1, "Reset brings back the next layer"};
+            CVars::set("test.reset", "2", Source::CONFIG_FILE);
+            CVars::set("test.reset", "3", Source::COMMAND_LINE);
+            CVars::set("test.reset", "4", Source::CONSOLE);
+
+            CVars::reset("test.reset", Source::CONSOLE);
+            test.checkEqual(value.get(), 3u, "console reset shows the command line");
+            CVars::reset("test.reset", Source::CONFIG_FILE);
+            test.checkEqual(value.get(), 3u, "resetting a lower layer changes nothing");
+            CVars::reset("test.reset", Source::COMMAND_LINE);
+            test.checkEqual(value.get(), 1u, "every layer reset shows the default");
+
+            test.check(!CVars::set("test.reset", "9", Source::DEFAULT), "the default cannot be set");
+            test.checkEqual(value.getDefault(), 1u, "default unchanged");
+        });
+    }
+
+    void testPendingValues(Test::Runner& runner) {
+        runner.run("CVar/set before registration", [](Test::Context& test) {
+            test.check(CVars::set("test.pending", "42", Source::COMMAND_LINE), "set before registration");
+            test.checkEqual(CVars::get("test.pending").value_or(""), std::string("42"), "get shows the pending value");
+            test.checkEqual(countRegistered("test.pending"), size_t{0}, "not listed before registration");
+
+            CVars::CVar<uint32_t> value{"test.pending", 7, "Registers after its value was set"};
+            test.checkEqual(value.get(), 42u, "pending value applied on registration");
+            test.checkEqual(value.getDefault(), 7u, "default kept");
+            test.checkEqual(countRegistered("test.pending"), size_t{1}, "listed once registered");
+        });
+
+        runner.run("CVar/command line", [](Test::Context& test) {
+            const char* arguments[] = {"VKING_Test_CVar", "+test.commandLine=12", "--not-a-cvar", "+test.noValue", "+=3"};
+            test.checkEqual(CVars::parseCommandLine(5, arguments), size_t{1}, "only +name=value arguments applied");
+
+            CVars::CVar<int32_t> value{"test.commandLine", -1, "Set on the command line"};
+            test.checkEqual(value.get(), 12, "command line value");
+        });
+    }
+
+    void testInvalidValues(Test::Runner& runner) {
+        runner.run("CVar/invalid set rejected", [](Test::Context& test) {
+            CVars::CVar<uint32_t> value{"test.invalid", 5, "Rejects what does not parse"};
+            CVars::set("test.invalid", "6", Source::COMMAND_LINE);
+            test.check(!CVars::set("test.invalid", "six", Source::CONSOLE), "non-number rejected");
+            test.check(!CVars::set("test.invalid", "-1", Source::CONSOLE), "negative rejected for uint32");
+            test.checkEqual(value.get(), 6u, "previous layer still shows");
+
+            CVars::CVar<bool> flag{"test.invalidFlag", false, "Boolean spellings"};
+            test.check(CVars::set("test.invalidFlag", "on"), "on accepted");
+            test.checkEqual(flag.get(), true, "on is true");
+            test.check(!CVars::set("test.invalidFlag", "maybe"), "maybe rejected");
+            test.checkEqual(flag.get(), true, "still true");
+        });
+
+        runner.run("CVar/invalid pending value falls through", [](Test::Context& test) {
+            // Nothing can check these while the CVar is unknown, so they are judged when it registers
+            CVars::set("test.fallThrough", "8", Source::CONFIG_FILE);
+            CVars::set("test.fallThrough", "not-a-number", Source::COMMAND_LINE);
+            CVars::set("test.fallThrough", "4294967296", Source::CONSOLE);
+
+            CVars::CVar<uint32_t> value{"test.fallThrough", 1, "Invalid layers are skipped"};
+            test.checkEqual(value.get(), 8u, "highest valid layer wins");
+            bool listed = false;
+            for (const CVars::Info& info : CVars::list()) {
+                if (info.name != "test.fallThrough") continue;
+                listed = true;
+                test.checkEqual(info.source, Source::CONFIG_FILE, "source of the value");
+            }
+            test.check(listed, "listed");
+
+            CVars::reset("test.fallThrough", Source::CONFIG_FILE);
+            test.checkEqual(value.get(), 1u, "default once no valid layer is left");
+        });
+    }
+
+    void testConfigFile(Test::Runner& runner) {
+        runner.run("CVar/config file flattening and reload", [](Test::Context& test) {
+            std::error_code error;
+            const std::filesystem::path path = std::filesystem::temp_directory_path(error) / "VKING_Test_CVar.json";
+            std::filesystem::remove(path, error);
+
+            CVars::CVar<uint32_t> width{"test.config.window.width", 1280, "Nested key"};
+            CVars::CVar<bool> vsync{"test.config.vsync", false, "Boolean from JSON"};
+            CVars::CVar<std::string> title{"test.config.title", "VKING", "String from JSON"};
+
+            writeConfigFile(path, R"({"test": {"config": {"window": {"width": 1920}, "vsync": true, "title": "Loaded"}}})");
+            test.check(CVars::loadConfigFile(path), "loaded");
+            test.checkEqual(width.get(), 1920u, "nested objects join their keys with '.'");
+            test.checkEqual(vsync.get(), true, "JSON true");
+            test.checkEqual(title.get(), std::string("Loaded"), "JSON string");
+            test.checkEqual(CVars::get("test.config.unknown").has_value(), false, "no value for names not in the file");
+
+            test.check(!CVars::pollConfigFile(), "unchanged file is not reloaded");
+
+            writeConfigFile(path, R"({"test.config.window.width": 800})");
+            test.check(CVars::pollConfigFile(), "changed file is reloaded");
+            test.checkEqual(width.get(), 800u, "dotted keys work too");
+            test.checkEqual(vsync.get(), false, "a key removed from the file falls back to the default");
+
+            CVars::set("test.config.window.width", "640", Source::CONSOLE);
+            writeConfigFile(path, R"({"test": {"config": {"window": {"width": 1024}}}})");
+            test.check(CVars::pollConfigFile(), "reloaded again");
+            test.checkEqual(width.get(), 640u, "the console still wins over a reloaded file");
+            CVars::reset("test.config.window.width");
+            test.checkEqual(width.get(), 1024u, "reloaded value under the console one");
+
+            writeConfigFile(path, R"({"test": {"config": )");
+            test.check(CVars::pollConfigFile(), "malformed file is looked at");
+            test.checkEqual(width.get(), 1024u, "malformed file keeps the previous values");
+
+            std::filesystem::remove(path, error);
+            test.check(CVars::pollConfigFile(), "removed file is noticed");
+            test.checkEqual(width.get(), 1280u, "removed file empties the layer");
+        });
+    }
+
+    void testDuplicates(Test::Runner& runner) {
+        runner.run("CVar/registered twice", [](Test::Context& test) {
+            CVars::CVar<uint32_t> first{"test.duplicate", 1, "First declaration"};
+            CVars::set("test.duplicate", "9");
+
+            CVars::CVar<uint32_t> second{"test.duplicate", 2, "Second declaration"};
+            test.checkEqual(second.get(), 2u, "the second declaration keeps its default");
+            test.checkEqual(first.get(), 9u, "the first one stays registered");
+            test.checkEqual(countRegistered("test.duplicate"), size_t{1}, "one entry");
+
+            CVars::set("test.duplicate", "10");
+            test.checkEqual(first.get(), 10u, "values still reach the first");
+            test.checkEqual(second.get(), 2u, "and never the second");
+        });
+
+        runner.run("CVar/detached declarations", [](Test::Context& test) {
+            std::optional<CVars::CVar<uint32_t>> retired;
+            retired.emplace("test.detached", 1, "Declared by code that is retired");
+            CVars::set("test.detached", "5");
+
+            const void* retiredAddress = &*retired;
+            const auto detached = CVars::detachDeclarations([retiredAddress](const void* declaration) { return declaration == retiredAddress; });
+            test.checkEqual(detached.size(), size_t{1}, "one declaration detached");
+            test.checkEqual(countRegistered("test.detached"), size_t{0}, "no longer listed");
+            test.checkEqual(CVars::get("test.detached").value_or(""), std::string("5"), "its value stays pending");
+
+            {
+                CVars::CVar<uint32_t> replacement{"test.detached", 2, "Declared by the code replacing it"};
+                test.checkEqual(replacement.get(), 5u, "the next declaration picks the value up");
+                test.checkEqual(countRegistered("test.detached"), size_t{1}, "one entry");
+            }
+
+            for (CVars::detail::Entry* entry : detached) entry->attach();
+            test.checkEqual(retired->get(), 5u, "attached again");
+            test.checkEqual(countRegistered("test.detached"), size_t{1}, "listed again");
+        });
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    std::string error;
+    const auto options = Test::parseOptions(argc, argv, &error);
+    if (!options) {
+        if (error.empty()) return 0;
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    Log::Init("VKING_Test_CVar.log", Log::Level::info);
+    Log::setConsoleOutput(false);
+
+    Test::Runner runner(*options);
+    testPrecedence(runner);
+    testPendingValues(runner);
+    testInvalidValues(runner);
+    testConfigFile(runner);
+    testDuplicates(runner);
+    return runner.finish();
+}
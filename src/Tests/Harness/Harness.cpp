@@ -0,0 +1,99 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <optional>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+module VKING.Test.Harness;
+
+namespace VKING::Test {
+
+    namespace {
+
+        void printUsage(const char* program) {
+            std::printf("Usage: %s [--filter=<text>]\n"
+                        "  --filter  Only run tests whose name contains the text\n", program);
+        }
+
+    }
+
+    std::optional<Options> parseOptions(const int argc, const char* const* argv, std::string* error) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            const std::string_view argument = argv[i];
+            const size_t equals = argument.find('=');
+            const std::string_view key = argument.substr(0, equals);
+            const std::string value = equals == std::string_view::npos ? std::string() : std::string(argument.substr(equals + 1));
+
+            if (key == "--help" || key == "-h") {
+                printUsage(argv[0]);
+                if (error) error->clear();
+                return std::nullopt;
+            }
+            if (key == "--filter") {
+                options.filter = value;
+            } else {
+                if (error) *error = "Unknown or malformed argument: " + std::string(argument);
+                return std::nullopt;
+            }
+        }
+        return options;
+    }
+
+    bool Context::check(const bool condition, const std::string_view expression, const std::source_location location) {
+        if (!condition) fail(std::string(expression), location);
+        return condition;
+    }
+
+    void Context::fail(const std::string& message, const std::source_location& location) {
+        m_Failures.push_back(std::string(location.file_name()) + ":" + std::to_string(location.line()) + ": " + message);
+    }
+
+    Runner::Runner(Options options)
+        : m_Options(std::move(options)) {}
+
+    void Runner::run(const std::string_view name, const std::function<void(Context&)>& body) {
+        if (!m_Options.filter.empty() && name.find(m_Options.filter) == std::string_view::npos) return;
+
+        Context context;
+        body(context);
+        const bool passed = context.getFailures().empty();
+        std::printf("%-6s %.*s\n", passed ? "PASS" : "FAIL", static_cast<int>(name.size()), name.data());
+        for (const std::string& failure : context.getFailures()) std::printf("       %s\n", failure.c_str());
+        std::fflush(stdout);
+        if (passed) m_Passed++;
+        else m_Failed++;
+    }
+
+    int Runner::finish() const {
+        std::printf("%u passed, %u failed\n", m_Passed, m_Failed);
+        return m_Failed == 0 ? 0 : 1;
+    }
+
+}
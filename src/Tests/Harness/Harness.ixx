@@ -0,0 +1,117 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+export module VKING.Test.Harness;
+
+export namespace VKING::Test {
+
+    struct Options {
+        /// Only tests whose name contains this string run
+        std::string filter;
+    };
+
+    /**
+     * @brief Parses the options every test executable shares.
+     *
+     * Recognized: --filter=<text>, --help.
+     *
+     * @param error Receives a message for unknown or malformed arguments
+     * @return The options, or std::nullopt if the program should exit (error set, or --help printed)
+     */
+    std::optional<Options> parseOptions(int argc, const char* const* argv, std::string* error = nullptr);
+
+    /// Text for a checked value in a failure message
+    template<typename T>
+    std::string describe(const T& value) {
+        if constexpr (std::same_as<T, bool>) {
+            return value ? "true" : "false";
+        } else if constexpr (std::is_enum_v<T>) {
+            return std::to_string(static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            return std::to_string(value);
+        } else if constexpr (std::convertible_to<const T&, std::string_view>) {
+            return "\"" + std::string(std::string_view(value)) + "\"";
+        } else {
+            return "<value>";
+        }
+    }
+
+    /**
+     * @brief What one test checks its expectations with. A failed check is reported and the test goes on, so one
+     *        run shows every expectation that does not hold.
+     */
+    class Context {
+    public:
+        /**
+         * @return condition, so a test can stop early when later checks depend on this one
+         */
+        bool check(bool condition, std::string_view expression, std::source_location location = std::source_location::current());
+
+        template<typename Actual, typename Expected>
+        bool checkEqual(const Actual& actual, const Expected& expected, const std::string_view expression,
+                        const std::source_location location = std::source_location::current()) {
+            if (actual == expected) return true;
+            fail(std::string(expression) + ": got " + describe(actual) + ", expected " + describe(expected), location);
+            return false;
+        }
+
+        /// "file:line: what" for each failed check, in order
+        [[nodiscard]] const std::vector<std::string>& getFailures() const { return m_Failures; }
+
+    private:
+        void fail(const std::string& message, const std::source_location& location);
+
+        std::vector<std::string> m_Failures;
+    };
+
+    /**
+     * @brief Runs tests and reports them. Each test gets a Context of its own; finish() prints the summary and
+     *        gives the process's exit status, 0 only if every test that ran passed.
+     */
+    class Runner {
+    public:
+        explicit Runner(Options options);
+
+        /**
+         * @param name Unique test name, e.g. "CVar/precedence"
+         */
+        void run(std::string_view name, const std::function<void(Context&)>& body);
+
+        [[nodiscard]] int finish() const;
+
+    private:
+        Options m_Options;
+        uint32_t m_Passed = 0;
+        uint32_t m_Failed = 0;
+    };
+
+}
@@ -0,0 +1,233 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Test_Json [--filter=<text>]
+//
+// Json: documents surviving a dump and parse unchanged, numbers and strings at their edges, accessor fallbacks,
+// and malformed input rejected with the right message instead of read as something else.
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+import VKING.Json;
+import VKING.Test.Harness;
+
+namespace {
+
+    using namespace VKING;
+
+    /// The error parse() reports for text, empty if it parses
+    std::string parseError(const std::string_view text) {
+        std::string error;
+        if (Json::parse(text, &error)) return {};
+        return error;
+    }
+
+    Json::Value makeDocument() {
+        Json::Value document;
+        document.set("name", "VKING");
+        document.set("version", 3);
+        document.set("ratio", 0.1);
+        document.set("negative", -2.5e-7);
+        document.set("enabled", true);
+        document.set("missing", nullptr);
+        document.set("text", "quote \" backslash \\ newline \n tab \t bell \x07 e-acute \xC3\xA9");
+        Json::Value& list = document.set("list", Json::Value::Array{});
+        list.push(1);
+        list.push("two");
+        list.push(Json::Value::Array{});
+        list.push(Json::Value::Object{});
+        document.set("nested", Json::Value{}).set("deeper", Json::Value{}).set("value", uint64_t{1} << 53);
+        return document;
+    }
+
+    void testRoundTrips(Test::Runner& runner) {
+        runner.run("Json/round trip", [](Test::Context& test) {
+            const Json::Value document = makeDocument();
+            for (const int indent : {-1, 0, 2, 4}) {
+                const std::string text = document.dump(indent);
+                std::string error;
+                const std::optional<Json::Value> parsed = Json::parse(text, &error);
+                if (!test.check(parsed.has_value(), "dump parses again")) {
+                    test.checkEqual(error, std::string(), "parse error");
+                    continue;
+                }
+                test.checkEqual(parsed->dump(), document.dump(), "same document after a round trip");
+                test.checkEqual(parsed->dump(indent), text, "same text after a round trip");
+            }
+        });
+
+        runner.run("Json/document order", [](Test::Context& test) {
+            Json::Value document;
+            document.set("b", 1);
+            document.set("a", 2);
+            document.set("b", 3);
+            test.checkEqual(document.dump(), std::string(R"({"b":3,"a":2})"), "members keep their first position");
+            test.checkEqual(document.dump(2), std::string("{\n  \"b\": 3,\n  \"a\": 2\n}"), "indented dump");
+        });
+
+        runner.run("Json/numbers", [](Test::Context& test) {
+            const auto number = [](const std::string_view text) { return Json::parse(text).value_or(Json::Value("not parsed")).asNumber(-1.0); };
+            test.checkEqual(number("0"), 0.0, "zero");
+            test.checkEqual(number("-0"), 0.0, "negative zero");
+            test.checkEqual(number("42"), 42.0, "integer");
+            test.checkEqual(number("-17.25"), -17.25, "fraction");
+            test.checkEqual(number("1E3"), 1000.0, "exponent");
+            test.checkEqual(number("2.5e-3"), 0.0025, "negative exponent");
+            test.checkEqual(number("9007199254740993"), 9007199254740992.0, "rounded to the nearest double");
+            test.checkEqual(number("1.7976931348623157e308"), 1.7976931348623157e308, "largest double");
+
+            // Shortest round trip: a dumped double parses back to the same bits
+            for (const double value : {0.1, 1.0 / 3.0, 123456.789e-12, 5e-324, 1.7976931348623157e308}) {
+                const std::string text = Json::Value(value).dump();
+                test.checkEqual(number(text), value, "number survives a round trip");
+            }
+        });
+
+        runner.run("Json/strings", [](Test::Context& test) {
+            const auto string = [](const std::string_view text) { return std::string(Json::parse(text).value_or(Json::Value(42)).asString("<not a string>")); };
+            test.checkEqual(string(R"("plain")"), std::string("plain"), "plain");
+            test.checkEqual(string(R"("\"\\\/\b\f\n\r\t")"), std::string("\"\\/\b\f\n\r\t"), "every short escape");
+            test.checkEqual(string(R"("\u0041\u00e9\u20AC")"), std::string("A\xC3\xA9\xE2\x82\xAC"), "escapes become UTF-8");
+            test.checkEqual(string(R"("\ud83d\ude00")"), std::string("\xF0\x9F\x98\x80"), "surrogate pair");
+            test.checkEqual(string("\"\xE2\x82\xAC raw\""), std::string("\xE2\x82\xAC raw"), "raw UTF-8 kept as is");
+
+            const std::string control = Json::Value(std::string("a\x01z")).dump();
+            test.checkEqual(control, std::string(R"("a\u0001z")"), "control characters are escaped");
+            test.checkEqual(string(control), std::string("a\x01z"), "and read back");
+        });
+    }
+
+    void testAccessors(Test::Runner& runner) {
+        runner.run("Json/accessor fallbacks", [](Test::Context& test) {
+            const Json::Value document = makeDocument();
+            test.check(document["absent"].isNull(), "missing key is null");
+            test.check(document["name"]["child"].isNull(), "key of a string is null");
+            test.check(document["list"][99].isNull(), "index out of range is null");
+            test.checkEqual(document["name"].asNumber(7.0), 7.0, "wrong type gives the fallback");
+            test.checkEqual(document["version"].asString("fallback"), std::string_view("fallback"), "wrong type gives the fallback");
+            test.checkEqual(document["version"].asNumber<uint32_t>(), 3u, "typed number");
+            test.checkEqual(document["list"].size(), size_t{4}, "array size");
+            test.checkEqual(document["name"].size(), size_t{0}, "scalars have no size");
+            test.checkEqual(document["nested"]["deeper"]["value"].asNumber<uint64_t>(), uint64_t{1} << 53, "nested lookup");
+            test.check(document.contains("missing") && document["missing"].isNull(), "explicit null is a member");
+        });
+
+        runner.run("Json/integer conversions", [](Test::Context& test) {
+            const auto asUint32 = [](const Json::Value& value) { return value.asNumber<uint32_t>(77u); };
+            const auto asInt8 = [](const Json::Value& value) { return value.asNumber<int8_t>(int8_t{77}); };
+            const auto asUint64 = [](const Json::Value& value) { return value.asNumber<uint64_t>(77u); };
+
+            test.checkEqual(asUint32(Json::Value(-1)), 77u, "negative into unsigned gives the fallback");
+            test.checkEqual(asUint32(Json::Value(1e300)), 77u, "1e300 gives the fallback");
+            test.checkEqual(asUint32(Json::Value(2.5)), 77u, "fractional gives the fallback");
+            test.checkEqual(asUint32(Json::Value(-0.5)), 77u, "negative fraction gives the fallback");
+            test.checkEqual(asUint32(Json::Value(std::numeric_limits<double>::quiet_NaN())), 77u, "NaN gives the fallback");
+            test.checkEqual(asUint32(Json::Value(std::numeric_limits<double>::infinity())), 77u, "infinity gives the fallback");
+            test.checkEqual(asUint32(Json::Value(4294967296.0)), 77u, "one past the maximum gives the fallback");
+            test.checkEqual(asUint32(Json::Value(4294967295.0)), UINT32_MAX, "the maximum converts");
+            test.checkEqual(asUint32(Json::Value(0.0)), 0u, "zero converts");
+            test.checkEqual(asUint32(Json::Value(-0.0)), 0u, "negative zero converts");
+            test.checkEqual(asInt8(Json::Value(-128)), int8_t{-128}, "the minimum converts");
+            test.checkEqual(asInt8(Json::Value(-129)), int8_t{77}, "below the minimum gives the fallback");
+            test.checkEqual(asInt8(Json::Value(128)), int8_t{77}, "above the maximum gives the fallback");
+            test.checkEqual(asUint64(Json::Value(18446744073709551616.0)), uint64_t{77}, "2^64 gives the fallback");
+            test.checkEqual(asUint64(Json::Value(9007199254740992.0)), uint64_t{1} << 53, "2^53 converts");
+            test.checkEqual(Json::parse("-1")->asNumber<uint32_t>(), 0u, "parsed -1 gives the default fallback");
+            test.checkEqual(Json::Value(2.5).asNumber<float>(), 2.5f, "floating point targets keep the fraction");
+        });
+    }
+
+    void testErrors(Test::Runner& runner) {
+        runner.run("Json/malformed input", [](Test::Context& test) {
+            struct Case {
+                std::string_view text;
+                std::string_view error;
+            };
+            const Case cases[] = {
+                {"", "unexpected end of input at byte 0"},
+                {"   ", "unexpected end of input"},
+                {"[1,]", "invalid value at byte 3"},
+                {"[1 2]", "expected ',' or ']'"},
+                {"{\"a\" 1}", "expected ':'"},
+                {"{\"a\": 1,}", "expected object key"},
+                {"{\"a\": 1", "unterminated object"},
+                {"[1", "unterminated array"},
+                {"tru", "invalid literal"},
+                {"nul", "invalid literal"},
+                {"NaN", "invalid value"},
+                {"-", "invalid value"},
+                {"01", "leading zero in number"},
+                {"1.", "missing digits after decimal point"},
+                {"1e+", "missing exponent digits"},
+                {"1e400", "number out of range"},
+                {"-1e400", "number out of range"},
+                {"[1e999999]", "number out of range"},
+                {"\"abc", "unterminated string"},
+                {"\"\\", "unterminated escape"},
+                {"\"\\x\"", "invalid escape"},
+                {"\"\x01\"", "control character in string"},
+                {"\"\\u12zz\"", "invalid unicode escape"},
+                {"\"\\u12", "truncated unicode escape"},
+                {"\"\\ud800\"", "unpaired surrogate"},
+                {"\"\\ud800\\u0041\"", "unpaired surrogate"},
+                {"\"\\udc00\"", "unpaired surrogate"},
+                {"\"\\ude00\\ud83d\"", "unpaired surrogate"},
+                {"1 2", "unexpected trailing characters at byte 2"},
+            };
+            for (const Case& testCase : cases) {
+                const std::string error = parseError(testCase.text);
+                test.check(error.find(testCase.error) != std::string::npos,
+                           "'" + std::string(testCase.text) + "' fails with '" + std::string(testCase.error) + "', got '" + error + "'");
+            }
+        });
+
+        runner.run("Json/nesting limit", [](Test::Context& test) {
+            const std::string shallow = std::string(512, '[') + std::string(512, ']');
+            test.checkEqual(parseError(shallow), std::string(), "512 levels parse");
+            const std::string deep = std::string(600, '[') + std::string(600, ']');
+            test.check(parseError(deep).find("nesting too deep") != std::string::npos, "600 levels are rejected, not a stack overflow");
+        });
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    std::string error;
+    const auto options = Test::parseOptions(argc, argv, &error);
+    if (!options) {
+        if (error.empty()) return 0;
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    Test::Runner runner(*options);
+    testRoundTrips(runner);
+    testAccessors(runner);
+    testErrors(runner);
+    return runner.finish();
+}
@@ -0,0 +1,169 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Test_Profiler [--filter=<text>]
+//
+// Profiler: threads that exit give their buffers back at the next frame, so spawning threads in a loop keeps the
+// registered thread count and the resident memory flat, while the zones those threads recorded still reach the
+// frame they ended in, under their names, and their dropped events stay counted.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#   include <unistd.h>
+#endif
+
+#include <VKING/Profiler.hpp>
+
+import VKING.Test.Harness;
+
+namespace {
+
+    using namespace VKING;
+
+    constexpr Profiler::ZoneInfo TEST_ZONE{"Test zone", __FILE__, __LINE__};
+
+    void recordZones(const uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            const Profiler::ScopedZone zone(&TEST_ZONE);
+        }
+    }
+
+    /// Resident set size in bytes, 0 where the platform cannot tell
+    uint64_t getResidentBytes() {
+#if defined(__linux__)
+        std::FILE* file = std::fopen("/proc/self/statm", "r");
+        if (!file) return 0;
+        unsigned long long totalPages = 0;
+        unsigned long long residentPages = 0;
+        const int read = std::fscanf(file, "%llu %llu", &totalPages, &residentPages);
+        std::fclose(file);
+        return read == 2 ? residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+        return 0;
+#endif
+    }
+
+    /// What the frame listener saw of the last frame. The listener is a plain function pointer, so it lives here
+    struct SeenFrame {
+        std::vector<uint32_t> threadIds;
+        std::vector<std::string> threadNames;
+    };
+    SeenFrame s_SeenFrame;
+
+    void onFrame(const Profiler::FrameRecord& frame) {
+        s_SeenFrame = {};
+        for (size_t i = 0; i < frame.zoneCount; i++) {
+            if (frame.zones[i].zone != &TEST_ZONE) continue;
+            s_SeenFrame.threadIds.push_back(frame.zones[i].threadId);
+            s_SeenFrame.threadNames.push_back(Profiler::getThreadName(frame.zones[i].threadId));
+        }
+    }
+
+    void testThreadLifetime(Test::Runner& runner) {
+        runner.run("Profiler/exited threads are released", [](Test::Context& test) {
+            constexpr uint32_t ROUNDS = 200;
+            constexpr uint32_t THREADS_PER_ROUND = 4;
+
+            // the main thread's own buffer is part of the baseline
+            recordZones(1);
+            Profiler::markFrame();
+            const uint32_t baselineThreads = Profiler::getStats().threadCount;
+            const uint64_t baselineBytes = getResidentBytes();
+
+            uint32_t maxThreads = 0;
+            for (uint32_t round = 0; round < ROUNDS; round++) {
+                std::vector<std::thread> threads;
+                for (uint32_t i = 0; i < THREADS_PER_ROUND; i++) threads.emplace_back([] { recordZones(100); });
+                for (std::thread& thread : threads) thread.join();
+                Profiler::markFrame();
+                maxThreads = std::max(maxThreads, Profiler::getStats().threadCount);
+            }
+
+            test.checkEqual(maxThreads, baselineThreads, "registered threads after each frame");
+            // Leaking, this loop keeps ROUNDS * THREADS_PER_ROUND buffers of THREAD_BUFFER_CAPACITY events, about 300 MiB
+            if (baselineBytes > 0) {
+                const uint64_t grownBytes = getResidentBytes() - std::min(getResidentBytes(), baselineBytes);
+                test.check(grownBytes < 32ull * 1024 * 1024, "resident memory grew by " + std::to_string(grownBytes / 1024) + " KiB");
+            }
+        });
+
+        runner.run("Profiler/zones of an exited thread reach its last frame", [](Test::Context& test) {
+            Profiler::markFrame();
+            Profiler::setFrameListener(&onFrame);
+
+            std::thread([] {
+                Profiler::setThreadName("Short lived");
+                recordZones(3);
+            }).join();
+            Profiler::markFrame();
+            const SeenFrame seen = s_SeenFrame;
+
+            test.checkEqual(seen.threadIds.size(), size_t{3}, "zones recorded before the thread exited");
+            if (!seen.threadIds.empty()) {
+                test.checkEqual(seen.threadNames.front(), std::string("Short lived"), "name while the frame is handed out");
+                test.checkEqual(Profiler::getThreadName(seen.threadIds.front()), std::string(), "name once the record is released");
+            }
+
+            std::thread(recordZones, 1).join();
+            Profiler::markFrame();
+            test.check(s_SeenFrame.threadIds.size() == 1 && !seen.threadIds.empty() && s_SeenFrame.threadIds.front() != seen.threadIds.front(),
+                       "a later thread gets a new id");
+
+            Profiler::setFrameListener(nullptr);
+        });
+
+        runner.run("Profiler/drops of exited threads stay counted", [](Test::Context& test) {
+            Profiler::markFrame();
+            const uint64_t droppedBefore = Profiler::getStats().droppedEvents;
+
+            constexpr uint32_t OVERFLOW = 10;
+            std::thread(recordZones, Profiler::THREAD_BUFFER_CAPACITY + OVERFLOW).join();
+            Profiler::markFrame();
+            Profiler::markFrame();
+            test.checkEqual(Profiler::getStats().droppedEvents - droppedBefore, uint64_t{OVERFLOW}, "events dropped by the full ring");
+        });
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    std::string error;
+    const auto options = Test::parseOptions(argc, argv, &error);
+    if (!options) {
+        if (error.empty()) return 0;
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    Profiler::setCapturing(true);
+
+    Test::Runner runner(*options);
+    testThreadLifetime(runner);
+    return runner.finish();
+}
@@ -0,0 +1,508 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Test_SceneFile [--filter=<text>]
+//
+// SceneFile: scenes loading back in place when nothing changed, columns migrating by field name or through a
+// registered migration when a schema did, unknown components being dropped, and damaged files being rejected
+// instead of handing out pointers past the mapping.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+import VKING.Log;
+import VKING.Scene.Serialization;
+import VKING.Test.Harness;
+
+namespace {
+
+    using namespace VKING;
+    using namespace VKING::Scene;
+
+    struct Transform {
+        float position[3];
+        float rotation[4];
+        float scale[3];
+    };
+
+    struct Velocity {
+        float linear[3];
+    };
+
+    /// Velocity a few releases later: doubles, and a new field that old scenes do not have
+    struct VelocityV2 {
+        double linear[3];
+        float angular[3] = {0.0f, 0.0f, 1.0f};
+    };
+
+    struct Renderable {
+        BlobRef meshName;
+        uint32_t materialIndex;
+    };
+
+    /// Small enough that a few hundred entities span several chunks
+    constexpr uint32_t TEST_CHUNK_BYTES = 4096;
+    constexpr uint32_t MOVING_ENTITIES = 300;
+    constexpr uint32_t RENDERED_ENTITIES = 200;
+
+    // Byte offsets of FileHeader fields, see SceneFile.cpp
+    constexpr uint64_t HEADER_MAGIC = 0;
+    constexpr uint64_t HEADER_VERSION = 4;
+    constexpr uint64_t HEADER_FILE_SIZE = 8;
+    constexpr uint64_t HEADER_SCHEMA_TABLE_OFFSET = 48;
+    constexpr uint64_t HEADER_ARCHETYPE_TABLE_OFFSET = 64;
+    constexpr uint64_t HEADER_ARCHETYPE_COMPONENT_TABLE_OFFSET = 72;
+
+    void registerTransform(ComponentRegistry& registry) {
+        registry.registerComponent<Transform>("Transform", {
+            {.name = "position", .type = FieldType::FLOAT32, .offset = offsetof(Transform, position), .count = 3},
+            {.name = "rotation", .type = FieldType::FLOAT32, .offset = offsetof(Transform, rotation), .count = 4},
+            {.name = "scale", .type = FieldType::FLOAT32, .offset = offsetof(Transform, scale), .count = 3},
+        });
+    }
+
+    void registerVelocity(ComponentRegistry& registry) {
+        registry.registerComponent<Velocity>("Velocity", {
+            {.name = "linear", .type = FieldType::FLOAT32, .offset = offsetof(Velocity, linear), .count = 3},
+        });
+    }
+
+    void registerVelocityV2(ComponentRegistry& registry) {
+        registry.registerComponent<VelocityV2>("Velocity", {
+            {.name = "linear", .type = FieldType::FLOAT64, .offset = offsetof(VelocityV2, linear), .count = 3},
+            {.name = "angular", .type = FieldType::FLOAT32, .offset = offsetof(VelocityV2, angular), .count = 3},
+        });
+    }
+
+    void registerRenderable(ComponentRegistry& registry) {
+        registry.registerComponent<Renderable>("Renderable", {
+            {.name = "meshName", .type = FieldType::BLOB_REF, .offset = offsetof(Renderable, meshName), .count = 1},
+            {.name = "materialIndex", .type = FieldType::UINT32, .offset = offsetof(Renderable, materialIndex), .count = 1},
+        });
+    }
+
+    void registerCurrent(ComponentRegistry& registry) {
+        registerTransform(registry);
+        registerVelocity(registry);
+        registerRenderable(registry);
+    }
+
+    std::filesystem::path getScenePath() {
+        std::error_code error;
+        return std::filesystem::temp_directory_path(error) / "VKING_Test_SceneFile.vkscene";
+    }
+
+    /**
+     * @brief Writes a Transform+Velocity archetype and a Transform+Renderable archetype with the current schemas.
+     *
+     * Entity i has position.x == i and, in the moving archetype, linear == {i, -i, 0.5}.
+     */
+    bool writeScene(const std::filesystem::path& path) {
+        ComponentRegistry registry;
+        registerCurrent(registry);
+
+        SceneWriter writer(registry, TEST_CHUNK_BYTES);
+        const std::string_view moving[] = {"Transform", "Velocity"};
+        const std::string_view rendered[] = {"Transform", "Renderable"};
+        const uint32_t movingArchetype = writer.addArchetype(moving);
+        const uint32_t renderedArchetype = writer.addArchetype(rendered);
+        const BlobRef meshNames[] = {writer.addString("Meshes/Rock.mesh"), writer.addString("Meshes/Tree.mesh")};
+
+        uint64_t nextEntity = 0;
+        writer.appendEntities(movingArchetype, MOVING_ENTITIES, [&](const ChunkView& chunk, const uint32_t begin, const uint32_t end) {
+            auto* transforms = chunk.getColumn<Transform>(0);
+            auto* velocities = chunk.getColumn<Velocity>(1);
+            for (uint32_t i = begin; i < end; i++) {
+                const auto x = static_cast<float>(nextEntity);
+                chunk.getEntities()[i] = nextEntity++;
+                transforms[i] = {{x, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}};
+                velocities[i] = {{x, -x, 0.5f}};
+            }
+        });
+        writer.appendEntities(renderedArchetype, RENDERED_ENTITIES, [&](const ChunkView& chunk, const uint32_t begin, const uint32_t end) {
+            auto* transforms = chunk.getColumn<Transform>(0);
+            auto* renderables = chunk.getColumn<Renderable>(1);
+            for (uint32_t i = begin; i < end; i++) {
+                const auto x = static_cast<float>(nextEntity);
+                chunk.getEntities()[i] = nextEntity++;
+                transforms[i] = {{x, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}};
+                renderables[i] = {meshNames[nextEntity & 1], static_cast<uint32_t>(nextEntity % 16)};
+            }
+        });
+        return writer.save(path);
+    }
+
+    std::vector<char> readFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    void writeFile(const std::filesystem::path& path, const std::vector<char>& bytes) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    template<typename T>
+    void patch(std::vector<char>& bytes, const uint64_t offset, const T value) {
+        std::memcpy(bytes.data() + offset, &value, sizeof(T));
+    }
+
+    template<typename T>
+    T peek(const std::vector<char>& bytes, const uint64_t offset) {
+        T value{};
+        std::memcpy(&value, bytes.data() + offset, sizeof(T));
+        return value;
+    }
+
+    /// Checks entity ids and positions of every chunk of an archetype, returns the number of entities seen
+    uint64_t checkTransforms(Test::Context& test, const SceneArchetype& archetype, const uint32_t transformColumn) {
+        uint64_t seen = 0;
+        bool allMatch = true;
+        for (const ChunkView& chunk : archetype.chunks) {
+            const EntityId* entities = chunk.getEntities();
+            const Transform* transforms = chunk.getColumn<Transform>(transformColumn);
+            for (uint32_t i = 0; i < chunk.entityCount; i++) {
+                allMatch &= transforms[i].position[0] == static_cast<float>(entities[i]) && transforms[i].rotation[3] == 1.0f;
+                seen++;
+            }
+        }
+        test.check(allMatch, "every Transform matches its entity id");
+        return seen;
+    }
+
+    void testZeroCopy(Test::Runner& runner) {
+        runner.run("SceneFile/unchanged schemas load in place", [](Test::Context& test) {
+            const std::filesystem::path path = getScenePath();
+            if (!test.check(writeScene(path), "scene is written")) return;
+
+            ComponentRegistry registry;
+            registerCurrent(registry);
+            const auto scene = SceneFile::load(path, registry);
+            if (!test.check(scene != nullptr, "scene loads")) return;
+
+            const SceneFile::LoadStats& stats = scene->getStats();
+            test.checkEqual(scene->getEntityCount(), uint64_t{MOVING_ENTITIES + RENDERED_ENTITIES}, "entity count");
+            test.check(stats.chunkCount > 2, "entities span several chunks");
+            test.checkEqual(stats.zeroCopyChunks, stats.chunkCount, "every chunk used in place");
+            test.checkEqual(stats.migratedChunks, 0u, "no chunk migrated");
+            test.checkEqual(stats.droppedComponents, 0u, "no component dropped");
+
+            const auto archetypes = scene->getArchetypes();
+            if (!test.checkEqual(archetypes.size(), size_t{2}, "archetype count")) return;
+
+            const uint32_t transform = registry.findComponent("Transform");
+            const uint32_t velocity = registry.findComponent("Velocity");
+            const uint32_t renderable = registry.findComponent("Renderable");
+            const SceneArchetype& moving = archetypes[0];
+            const SceneArchetype& rendered = archetypes[1];
+            test.check(!moving.migrated && !rendered.migrated, "neither archetype is marked migrated");
+            test.checkEqual(moving.findComponent(renderable), UINT32_MAX, "moving archetype lacks Renderable");
+            test.checkEqual(checkTransforms(test, moving, moving.findComponent(transform)), uint64_t{MOVING_ENTITIES}, "moving entities");
+            test.checkEqual(checkTransforms(test, rendered, rendered.findComponent(transform)), uint64_t{RENDERED_ENTITIES}, "rendered entities");
+
+            bool velocitiesMatch = true;
+            for (const ChunkView& chunk : moving.chunks) {
+                const Velocity* velocities = chunk.getColumn<Velocity>(moving.findComponent(velocity));
+                for (uint32_t i = 0; i < chunk.entityCount; i++) {
+                    const auto x = static_cast<float>(chunk.getEntities()[i]);
+                    velocitiesMatch &= velocities[i].linear[0] == x && velocities[i].linear[1] == -x && velocities[i].linear[2] == 0.5f;
+                }
+            }
+            test.check(velocitiesMatch, "every Velocity survives unchanged");
+
+            const ChunkView& chunk = rendered.chunks.front();
+            const Renderable& first = chunk.getColumn<Renderable>(rendered.findComponent(renderable))[0];
+            const std::string_view meshName = scene->resolveString(first.meshName);
+            test.check(meshName == "Meshes/Rock.mesh" || meshName == "Meshes/Tree.mesh", "blob references resolve to the written strings");
+            test.check(scene->resolveBlob({.offset = 1u << 20, .size = 1}).empty(), "a reference past the blob section resolves to nothing");
+            test.check(scene->resolveBlob({.offset = 0, .size = UINT64_MAX}).empty(), "an oversized reference resolves to nothing");
+
+            // the mapping is copy-on-write: editing a chunk must not reach the file
+            const std::vector<char> before = readFile(path);
+            moving.chunks.front().getColumn<Transform>(moving.findComponent(transform))[0].position[0] = 1234.0f;
+            test.check(readFile(path) == before, "editing a loaded chunk leaves the file unchanged");
+
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        });
+    }
+
+    void testMigration(Test::Runner& runner) {
+        runner.run("SceneFile/changed schema migrates by field name", [](Test::Context& test) {
+            const std::filesystem::path path = getScenePath();
+            if (!test.check(writeScene(path), "scene is written")) return;
+
+            ComponentRegistry registry;
+            registerTransform(registry);
+            registerVelocityV2(registry);
+            registerRenderable(registry);
+            const auto scene = SceneFile::load(path, registry);
+            if (!test.check(scene != nullptr, "scene loads")) return;
+
+            const SceneFile::LoadStats& stats = scene->getStats();
+            const auto archetypes = scene->getArchetypes();
+            if (!test.checkEqual(archetypes.size(), size_t{2}, "archetype count")) return;
+            const SceneArchetype& moving = archetypes[0];
+            const SceneArchetype& rendered = archetypes[1];
+
+            test.checkEqual(stats.migratedComponents, 1u, "only Velocity changed");
+            test.check(moving.migrated, "archetype with Velocity is migrated");
+            test.check(!rendered.migrated, "archetype without Velocity stays in place");
+            test.checkEqual(stats.migratedChunks, static_cast<uint32_t>(moving.chunks.size()), "migrated chunks");
+            test.checkEqual(stats.zeroCopyChunks, static_cast<uint32_t>(rendered.chunks.size()), "in-place chunks");
+            test.checkEqual(moving.layout.columns[moving.findComponent(registry.findComponent("Velocity"))].elementSize,
+                            static_cast<uint32_t>(sizeof(VelocityV2)), "migrated column uses the current size");
+
+            const uint32_t transform = moving.findComponent(registry.findComponent("Transform"));
+            const uint32_t velocity = moving.findComponent(registry.findComponent("Velocity"));
+            test.checkEqual(checkTransforms(test, moving, transform), uint64_t{MOVING_ENTITIES}, "unchanged columns are copied across");
+
+            bool converted = true;
+            bool defaulted = true;
+            for (const ChunkView& chunk : moving.chunks) {
+                const VelocityV2* velocities = chunk.getColumn<VelocityV2>(velocity);
+                for (uint32_t i = 0; i < chunk.entityCount; i++) {
+                    const auto x = static_cast<double>(chunk.getEntities()[i]);
+                    converted &= velocities[i].linear[0] == x && velocities[i].linear[1] == -x && velocities[i].linear[2] == 0.5;
+                    defaulted &= velocities[i].angular[0] == 0.0f && velocities[i].angular[2] == 1.0f;
+                }
+            }
+            test.check(converted, "linear converted from float to double");
+            test.check(defaulted, "new field takes its default value");
+
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        });
+
+        runner.run("SceneFile/registered migration wins", [](Test::Context& test) {
+            const std::filesystem::path path = getScenePath();
+            if (!test.check(writeScene(path), "scene is written")) return;
+
+            ComponentRegistry previous;
+            registerVelocity(previous);
+            const uint64_t previousHash = previous.getSchema(previous.findComponent("Velocity")).hash;
+
+            ComponentRegistry registry;
+            registerTransform(registry);
+            registerVelocityV2(registry);
+            registerRenderable(registry);
+            uint32_t migrated = 0;
+            registry.registerMigration("Velocity", previousHash, [&migrated](const ComponentSchema& oldSchema, const std::byte* oldData,
+                                                                             const ComponentSchema&, std::byte* newData, const uint32_t count) {
+                for (uint32_t i = 0; i < count; i++) {
+                    Velocity old{};
+                    std::memcpy(&old, oldData + static_cast<size_t>(i) * oldSchema.size, sizeof(old));
+                    const VelocityV2 converted{{old.linear[0] * 2.0, 0.0, 0.0}, {7.0f, 7.0f, 7.0f}};
+                    std::memcpy(newData + i * sizeof(VelocityV2), &converted, sizeof(converted));
+                }
+                migrated += count;
+            });
+
+            const auto scene = SceneFile::load(path, registry);
+            if (!test.check(scene != nullptr, "scene loads")) return;
+            test.checkEqual(migrated, MOVING_ENTITIES, "migration sees every entity once");
+
+            const SceneArchetype& moving = scene->getArchetypes()[0];
+            const uint32_t velocity = moving.findComponent(registry.findComponent("Velocity"));
+            bool used = true;
+            for (const ChunkView& chunk : moving.chunks) {
+                const VelocityV2* velocities = chunk.getColumn<VelocityV2>(velocity);
+                for (uint32_t i = 0; i < chunk.entityCount; i++) {
+                    used &= velocities[i].linear[0] == 2.0 * static_cast<double>(chunk.getEntities()[i]) && velocities[i].angular[1] == 7.0f;
+                }
+            }
+            test.check(used, "columns hold what the registered migration wrote");
+
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        });
+
+        runner.run("SceneFile/unknown components are dropped", [](Test::Context& test) {
+            const std::filesystem::path path = getScenePath();
+            if (!test.check(writeScene(path), "scene is written")) return;
+
+            ComponentRegistry registry;
+            registerTransform(registry);
+            registerVelocity(registry);
+            const auto scene = SceneFile::load(path, registry);
+            if (!test.check(scene != nullptr, "scene still loads")) return;
+
+            test.checkEqual(scene->getStats().droppedComponents, 1u, "Renderable dropped");
+            const SceneArchetype& rendered = scene->getArchetypes()[1];
+            test.checkEqual(rendered.components.size(), size_t{1}, "rendered archetype keeps only Transform");
+            test.checkEqual(checkTransforms(test, rendered, rendered.findComponent(registry.findComponent("Transform"))),
+                            uint64_t{RENDERED_ENTITIES}, "remaining columns still read correctly");
+
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        });
+
+        runner.run("SceneFile/narrowing conversions saturate", [](Test::Context& test) {
+            struct Wide { double small[4]; double wide[4]; double count[2]; };
+            struct Narrow { int8_t small[4]; int64_t wide[4]; uint16_t count[2]; };
+
+            ComponentSchema oldSchema;
+            oldSchema.name = "Counters";
+            oldSchema.size = sizeof(Wide);
+            oldSchema.alignment = alignof(Wide);
+            oldSchema.fields = {
+                {.name = "small", .type = FieldType::FLOAT64, .offset = offsetof(Wide, small), .count = 4},
+                {.name = "wide", .type = FieldType::FLOAT64, .offset = offsetof(Wide, wide), .count = 4},
+                {.name = "count", .type = FieldType::FLOAT64, .offset = offsetof(Wide, count), .count = 2},
+            };
+            ComponentSchema newSchema;
+            newSchema.name = "Counters";
+            newSchema.size = sizeof(Narrow);
+            newSchema.alignment = alignof(Narrow);
+            newSchema.fields = {
+                {.name = "small", .type = FieldType::INT8, .offset = offsetof(Narrow, small), .count = 4},
+                {.name = "wide", .type = FieldType::INT64, .offset = offsetof(Narrow, wide), .count = 4},
+                {.name = "count", .type = FieldType::UINT16, .offset = offsetof(Narrow, count), .count = 2},
+            };
+
+            constexpr double NOT_A_NUMBER = std::numeric_limits<double>::quiet_NaN();
+            constexpr double INFINITE = std::numeric_limits<double>::infinity();
+            const Wide wide{{300.0, -300.0, -3.7, NOT_A_NUMBER}, {1e30, -INFINITE, 9223372036854775807.0, -42.9}, {-1.0, 70000.0}};
+            Narrow narrow{};
+            ComponentRegistry::migrateByFieldName(oldSchema, reinterpret_cast<const std::byte*>(&wide),
+                                                  newSchema, reinterpret_cast<std::byte*>(&narrow), 1);
+
+            test.checkEqual(static_cast<int32_t>(narrow.small[0]), 127, "above the range clamps to the maximum");
+            test.checkEqual(static_cast<int32_t>(narrow.small[1]), -128, "below the range clamps to the minimum");
+            test.checkEqual(static_cast<int32_t>(narrow.small[2]), -3, "in range truncates toward zero");
+            test.checkEqual(static_cast<int32_t>(narrow.small[3]), 0, "NaN becomes zero");
+            test.checkEqual(narrow.wide[0], std::numeric_limits<int64_t>::max(), "64 bit maximum");
+            test.checkEqual(narrow.wide[1], std::numeric_limits<int64_t>::lowest(), "negative infinity clamps to the minimum");
+            test.checkEqual(narrow.wide[2], std::numeric_limits<int64_t>::max(), "2^63, the double nearest the maximum, clamps");
+            test.checkEqual(narrow.wide[3], int64_t{-42}, "negative in range truncates toward zero");
+            test.checkEqual(static_cast<uint32_t>(narrow.count[0]), 0u, "negative into unsigned clamps to zero");
+            test.checkEqual(static_cast<uint32_t>(narrow.count[1]), 65535u, "above the range clamps to the maximum");
+        });
+    }
+
+    void testValidation(Test::Runner& runner) {
+        runner.run("SceneFile/writer rejects bad archetypes", [](Test::Context& test) {
+            ComponentRegistry registry;
+            registerCurrent(registry);
+            SceneWriter writer(registry);
+            const std::string_view unknown[] = {"Transform", "Health"};
+            const std::string_view twice[] = {"Transform", "Velocity", "Transform"};
+            test.checkEqual(writer.addArchetype(unknown), INVALID_ARCHETYPE, "unknown component");
+            test.checkEqual(writer.addArchetype(twice), INVALID_ARCHETYPE, "component listed twice");
+            writer.appendEntities(0, 10, [&test](const ChunkView&, uint32_t, uint32_t) { test.check(false, "fill is not called for an unknown archetype"); });
+            test.checkEqual(writer.getEntityCount(), uint64_t{0}, "nothing was appended");
+        });
+
+        runner.run("SceneFile/damaged files are rejected", [](Test::Context& test) {
+            const std::filesystem::path path = getScenePath();
+            if (!test.check(writeScene(path), "scene is written")) return;
+            const std::vector<char> original = readFile(path);
+
+            ComponentRegistry registry;
+            registerCurrent(registry);
+            auto loadsAfter = [&](const std::string_view damage, auto&& modify) {
+                std::vector<char> bytes = original;
+                modify(bytes);
+                writeFile(path, bytes);
+                test.check(SceneFile::load(path, registry) == nullptr, std::string(damage) + " is rejected");
+            };
+
+            std::error_code error;
+            std::filesystem::remove(path, error);
+            test.check(SceneFile::load(path, registry) == nullptr, "missing file is rejected");
+
+            loadsAfter("an empty file", [](std::vector<char>& bytes) { bytes.clear(); });
+            loadsAfter("a file shorter than the header", [](std::vector<char>& bytes) { bytes.resize(16); });
+            loadsAfter("a wrong magic", [](std::vector<char>& bytes) { patch<uint32_t>(bytes, HEADER_MAGIC, 0x12345678); });
+            loadsAfter("a newer container version", [](std::vector<char>& bytes) { patch<uint32_t>(bytes, HEADER_VERSION, SCENE_FILE_VERSION + 1); });
+            loadsAfter("a truncated file", [](std::vector<char>& bytes) { bytes.resize(bytes.size() - 64); });
+            loadsAfter("a truncated file with a matching size field", [](std::vector<char>& bytes) {
+                bytes.resize(bytes.size() - 64);
+                patch<uint64_t>(bytes, HEADER_FILE_SIZE, bytes.size());
+            });
+            loadsAfter("a schema table outside the file", [](std::vector<char>& bytes) {
+                patch<uint64_t>(bytes, HEADER_SCHEMA_TABLE_OFFSET, bytes.size() - 8);
+            });
+            loadsAfter("a misaligned schema table", [](std::vector<char>& bytes) {
+                patch<uint64_t>(bytes, HEADER_SCHEMA_TABLE_OFFSET, peek<uint64_t>(bytes, HEADER_SCHEMA_TABLE_OFFSET) + 1);
+            });
+            // ArchetypeRecord: firstComponent, componentCount, capacity, strideBytes, firstChunk, chunkCount
+            loadsAfter("an archetype with more chunks than the file", [](std::vector<char>& bytes) {
+                patch<uint32_t>(bytes, peek<uint64_t>(bytes, HEADER_ARCHETYPE_TABLE_OFFSET) + 20, 1000);
+            });
+            loadsAfter("an archetype whose columns overflow its chunks", [](std::vector<char>& bytes) {
+                patch<uint32_t>(bytes, peek<uint64_t>(bytes, HEADER_ARCHETYPE_TABLE_OFFSET) + 8, 100000);
+            });
+            loadsAfter("an unaligned chunk stride", [](std::vector<char>& bytes) {
+                const uint64_t strideOffset = peek<uint64_t>(bytes, HEADER_ARCHETYPE_TABLE_OFFSET) + 12;
+                patch<uint32_t>(bytes, strideOffset, peek<uint32_t>(bytes, strideOffset) + 1);
+            });
+            loadsAfter("an archetype whose entity ids overflow its chunks", [](std::vector<char>& bytes) {
+                // without components only the entity column is left to check against the stride
+                const uint64_t archetypeOffset = peek<uint64_t>(bytes, HEADER_ARCHETYPE_TABLE_OFFSET);
+                patch<uint32_t>(bytes, archetypeOffset + 4, 0);
+                patch<uint32_t>(bytes, archetypeOffset + 8, peek<uint32_t>(bytes, archetypeOffset + 12) / static_cast<uint32_t>(sizeof(EntityId)) + 1);
+            });
+            // ArchetypeComponentRecord: schemaIndex, columnOffset
+            loadsAfter("an unaligned column", [](std::vector<char>& bytes) {
+                // moved back into the entity column so it still fits the stride
+                const uint64_t columnOffset = peek<uint64_t>(bytes, HEADER_ARCHETYPE_COMPONENT_TABLE_OFFSET) + 4;
+                patch<uint32_t>(bytes, columnOffset, peek<uint32_t>(bytes, columnOffset) - 8);
+            });
+
+            writeFile(path, original);
+            test.check(SceneFile::load(path, registry) != nullptr, "the undamaged file still loads");
+            std::filesystem::remove(path, error);
+        });
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    std::string error;
+    const auto options = Test::parseOptions(argc, argv, &error);
+    if (!options) {
+        if (error.empty()) return 0;
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    Log::Init("VKING_Test_SceneFile.log", Log::Level::info);
+    Log::setConsoleOutput(false);
+
+    Test::Runner runner(*options);
+    testZeroCopy(runner);
+    testMigration(runner);
+    testValidation(runner);
+    return runner.finish();
+}
@@ -0,0 +1,229 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Test_SpscQueue [--filter=<text>]
+//
+// SpscQueue: order preserved across many laps of the ring, full and empty detected at every offset, move-only
+// elements handed over intact, and a producer and consumer thread racing through a tiny ring without losing or
+// reordering anything. InputQueue: draining up to a timestamp and counting events dropped while full.
+//
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+import VKING.SpscQueue;
+import VKING.Types.Input;
+import VKING.Test.Harness;
+
+namespace {
+
+    using namespace VKING;
+
+    void testWraparound(Test::Runner& runner) {
+        runner.run("SpscQueue/order across laps", [](Test::Context& test) {
+            SpscQueue<uint32_t, 8> queue;
+            uint32_t pushed = 0;
+            uint32_t popped = 0;
+            bool inOrder = true;
+            // batch sizes that do not divide the capacity, so head and tail cross the end of the ring at every offset
+            for (uint32_t round = 0; round < 1000; round++) {
+                const uint32_t batch = 1 + round % 7;
+                for (uint32_t i = 0; i < batch; i++) {
+                    if (!queue.tryPush(pushed)) break;
+                    pushed++;
+                }
+                const uint32_t drain = 1 + (round * 3) % 5;
+                uint32_t value = 0;
+                for (uint32_t i = 0; i < drain && queue.tryPop(value); i++) inOrder &= value == popped++;
+            }
+            uint32_t value = 0;
+            while (queue.tryPop(value)) inOrder &= value == popped++;
+
+            test.check(pushed > 8 * 100, "the ring wrapped many times");
+            test.check(inOrder, "every element comes out in push order");
+            test.checkEqual(popped, pushed, "every pushed element is popped");
+            test.checkEqual(queue.sizeApprox(), size_t{0}, "empty at the end");
+        });
+
+        runner.run("SpscQueue/full and empty at every offset", [](Test::Context& test) {
+            SpscQueue<uint32_t, 4> queue;
+            for (uint32_t offset = 0; offset < 4 * 3; offset++) {
+                for (uint32_t i = 0; i < 4; i++) test.check(queue.tryPush(offset * 4 + i), "push into a queue with room");
+                test.checkEqual(queue.sizeApprox(), size_t{4}, "size when full");
+                test.check(!queue.tryPush(999), "push into a full queue fails");
+
+                for (uint32_t i = 0; i < 4; i++) {
+                    const uint32_t* front = queue.front();
+                    if (!test.check(front != nullptr, "front of a non-empty queue")) return;
+                    test.checkEqual(*front, offset * 4 + i, "front is the oldest element");
+                    queue.pop();
+                }
+                test.check(queue.front() == nullptr, "front of an empty queue is nullptr");
+                uint32_t value = 0;
+                test.check(!queue.tryPop(value), "pop from an empty queue fails");
+
+                // shift the start of the next lap by one slot
+                test.check(queue.tryPush(0), "push after draining");
+                test.check(queue.tryPop(value), "pop after draining");
+            }
+        });
+
+        runner.run("SpscQueue/move-only elements", [](Test::Context& test) {
+            SpscQueue<std::unique_ptr<std::string>, 4> queue;
+            for (uint32_t lap = 0; lap < 10; lap++) {
+                for (uint32_t i = 0; i < 3; i++) test.check(queue.tryPush(std::make_unique<std::string>(std::to_string(lap * 3 + i))), "push");
+                std::unique_ptr<std::string> value;
+                for (uint32_t i = 0; i < 3; i++) {
+                    if (!test.check(queue.tryPop(value) && value != nullptr, "pop hands over the element")) return;
+                    test.checkEqual(*value, std::to_string(lap * 3 + i), "element contents");
+                }
+            }
+        });
+    }
+
+    void testThreads(Test::Runner& runner) {
+        runner.run("SpscQueue/producer and consumer threads", [](Test::Context& test) {
+            constexpr uint64_t COUNT = 1'000'000;
+            SpscQueue<uint64_t, 16> queue;
+
+            std::thread producer([&queue] {
+                for (uint64_t value = 0; value < COUNT;) {
+                    if (queue.tryPush(value)) value++;
+                    else std::this_thread::yield();
+                }
+            });
+
+            uint64_t expected = 0;
+            uint64_t outOfOrder = 0;
+            while (expected < COUNT) {
+                const uint64_t* value = queue.front();
+                if (!value) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (*value != expected) outOfOrder++;
+                queue.pop();
+                expected++;
+            }
+            producer.join();
+
+            test.checkEqual(outOfOrder, uint64_t{0}, "elements out of order");
+            test.check(queue.front() == nullptr, "nothing left over");
+        });
+
+        runner.run("SpscQueue/size while both sides run", [](Test::Context& test) {
+            constexpr uint64_t COUNT = 1'000'000;
+            SpscQueue<uint64_t, 4> queue;
+            std::atomic<bool> done = false;
+
+            std::thread producer([&queue] {
+                for (uint64_t value = 0; value < COUNT;) {
+                    if (queue.tryPush(value)) value++;
+                    else std::this_thread::yield();
+                }
+            });
+            std::thread consumer([&queue, &done] {
+                for (uint64_t popped = 0; popped < COUNT;) {
+                    uint64_t value;
+                    if (queue.tryPop(value)) popped++;
+                    else std::this_thread::yield();
+                }
+                done.store(true, std::memory_order_release);
+            });
+
+            // any thread may ask for the size, the answer just has to be plausible
+            uint64_t samples = 0;
+            uint64_t outOfRange = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                if (queue.sizeApprox() > 4) outOfRange++;
+                samples++;
+                std::this_thread::yield();
+            }
+            producer.join();
+            consumer.join();
+
+            test.check(samples > 0, "sampled while both sides ran");
+            test.checkEqual(outOfRange, uint64_t{0}, "sizes above the capacity");
+        });
+    }
+
+    void testInputQueue(Test::Runner& runner) {
+        using Types::InputEvent;
+        using Types::InputQueue;
+
+        runner.run("InputQueue/drain up to a timestamp", [](Test::Context& test) {
+            InputQueue queue;
+            for (uint64_t i = 1; i <= 10; i++) queue.push({.code = static_cast<int32_t>(i), .timestampNanoseconds = i * 100});
+
+            std::vector<int32_t> codes;
+            const auto collect = [&codes](const InputEvent& event) { codes.push_back(event.code); };
+            test.checkEqual(queue.drain(450, collect), size_t{4}, "events up to the cutoff");
+            test.checkEqual(queue.drain(450, collect), size_t{0}, "nothing new before the cutoff");
+            test.checkEqual(queue.drain(UINT64_MAX, collect), size_t{6}, "the rest");
+            test.check(codes == std::vector<int32_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, "arrival order");
+
+            const uint64_t before = InputQueue::now();
+            queue.push({.code = 11});
+            InputEvent stamped;
+            queue.drain(UINT64_MAX, [&stamped](const InputEvent& event) { stamped = event; });
+            test.check(stamped.timestampNanoseconds >= before && stamped.timestampNanoseconds <= InputQueue::now(),
+                       "events without a timestamp are stamped on push");
+        });
+
+        runner.run("InputQueue/full queue drops and counts", [](Test::Context& test) {
+            const auto queue = std::make_unique<InputQueue>();
+            const uint64_t extra = 5;
+            for (uint64_t i = 0; i < InputQueue::CAPACITY + extra; i++) queue->push({.timestampNanoseconds = i + 1});
+            test.checkEqual(queue->getDroppedCount(), extra, "events past the capacity are counted");
+
+            uint64_t last = 0;
+            const size_t handled = queue->drain(UINT64_MAX, [&last](const InputEvent& event) { last = event.timestampNanoseconds; });
+            test.checkEqual(handled, size_t{InputQueue::CAPACITY}, "the queued events survive");
+            test.checkEqual(last, uint64_t{InputQueue::CAPACITY}, "the newest events are the ones dropped");
+
+            queue->push({.timestampNanoseconds = 1});
+            test.checkEqual(queue->drain(UINT64_MAX, [](const InputEvent&) {}), size_t{1}, "accepts events again once drained");
+        });
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    std::string error;
+    const auto options = Test::parseOptions(argc, argv, &error);
+    if (!options) {
+        if (error.empty()) return 0;
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    Test::Runner runner(*options);
+    testWraparound(runner);
+    testThreads(runner);
+    testInputQueue(runner);
+    return runner.finish();
+}
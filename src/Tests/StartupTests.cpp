@@ -0,0 +1,254 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Test_Startup [--filter=<text>]
+//
+// Startup::InitGraph: tasks starting only after their dependencies, independent tasks overlapping, main thread
+// tasks staying on the calling thread and not waiting behind worker tasks, failures skipping exactly their
+// dependents, and graphs that cannot be ordered being refused before anything runs.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+import VKING.JobSystem;
+import VKING.Log;
+import VKING.Startup;
+import VKING.Test.Harness;
+
+namespace {
+
+    using namespace VKING;
+    using Startup::InitGraph;
+
+    /// Long enough that a missing rendezvous means it will never happen, short enough to fail quickly
+    constexpr auto RENDEZVOUS_TIMEOUT = std::chrono::seconds(5);
+
+    /// Records which tasks ran, and whether each started only after its dependencies finished
+    class Recorder {
+    public:
+        InitGraph::Task task(std::string name, std::vector<std::string> dependencies, const bool succeeds = true, const bool mainThread = false) {
+            return {name, dependencies, [this, name, dependencies, succeeds] {
+                std::lock_guard lock(m_Mutex);
+                for (const std::string& dependency : dependencies) {
+                    if (std::ranges::find(m_Finished, dependency) == m_Finished.end()) m_EarlyStarts.push_back(name + " before " + dependency);
+                }
+                m_Threads[name] = std::this_thread::get_id();
+                m_Finished.push_back(name);
+                return succeeds;
+            }, mainThread};
+        }
+
+        [[nodiscard]] bool ran(const std::string& name) const { return std::ranges::find(m_Finished, name) != m_Finished.end(); }
+        [[nodiscard]] size_t getRunCount() const { return m_Finished.size(); }
+        [[nodiscard]] const std::vector<std::string>& getEarlyStarts() const { return m_EarlyStarts; }
+        [[nodiscard]] std::thread::id getThread(const std::string& name) const { return m_Threads.at(name); }
+
+    private:
+        std::mutex m_Mutex;
+        std::vector<std::string> m_Finished;
+        std::vector<std::string> m_EarlyStarts;
+        std::map<std::string, std::thread::id> m_Threads;
+    };
+
+    /// Waits until flag is set, false on timeout
+    bool waitFor(const std::atomic<bool>& flag) {
+        const auto deadline = std::chrono::steady_clock::now() + RENDEZVOUS_TIMEOUT;
+        while (!flag.load(std::memory_order_acquire)) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    void testOrdering(Test::Runner& runner) {
+        runner.run("InitGraph/dependencies finish first", [](Test::Context& test) {
+            JobSystem jobs(4);
+            for (int attempt = 0; attempt < 50; attempt++) {
+                Recorder recorder;
+                InitGraph graph;
+                // added out of order on purpose: the graph, not the insertion order, decides
+                graph.add(recorder.task("Present", {"Swapchain", "Assets"}));
+                graph.add(recorder.task("Swapchain", {"Window", "Device"}, true, true));
+                graph.add(recorder.task("Window", {"Platform"}, true, true));
+                graph.add(recorder.task("Device", {"Platform"}));
+                graph.add(recorder.task("Platform", {}));
+                graph.add(recorder.task("Assets", {}));
+                graph.add(recorder.task("Audio", {"Platform"}));
+
+                if (!test.check(graph.run(jobs), "graph succeeds")) return;
+                test.checkEqual(recorder.getRunCount(), size_t{7}, "every task ran once");
+                test.checkEqual(graph.getTimings().size(), size_t{7}, "every task was timed");
+                for (const std::string& early : recorder.getEarlyStarts()) test.check(false, "started too early: " + early);
+                if (!recorder.getEarlyStarts().empty()) return;
+            }
+        });
+
+        runner.run("InitGraph/independent tasks overlap", [](Test::Context& test) {
+            JobSystem jobs(2);
+            std::atomic<bool> firstStarted{false};
+            std::atomic<bool> secondStarted{false};
+            bool firstSawSecond = false;
+            bool secondSawFirst = false;
+
+            // each waits for the other to start, which only returns true if both run at the same time
+            InitGraph graph;
+            graph.add({"First", {}, [&] { firstStarted.store(true, std::memory_order_release); firstSawSecond = waitFor(secondStarted); return true; }});
+            graph.add({"Second", {}, [&] { secondStarted.store(true, std::memory_order_release); secondSawFirst = waitFor(firstStarted); return true; }});
+            test.check(graph.run(jobs), "graph succeeds");
+            test.check(firstSawSecond && secondSawFirst, "both tasks were running at once");
+        });
+
+        runner.run("InitGraph/main thread tasks", [](Test::Context& test) {
+            JobSystem jobs(2);
+            std::atomic<bool> mainTaskRan{false};
+            bool workerSawMainTask = false;
+            Recorder recorder;
+
+            // Blocker holds a worker until the main thread task ran: if the calling thread were busy helping with
+            // worker tasks instead of waiting for its own, this would time out
+            InitGraph graph;
+            graph.add({"Blocker", {}, [&] { workerSawMainTask = waitFor(mainTaskRan); return true; }});
+            graph.add(recorder.task("Platform", {}));
+            InitGraph::Task window = recorder.task("Window", {"Platform"}, true, true);
+            window.run = [&mainTaskRan, run = window.run] {
+                const bool succeeded = run();
+                mainTaskRan.store(true, std::memory_order_release);
+                return succeeded;
+            };
+            graph.add(std::move(window));
+
+            test.check(graph.run(jobs), "graph succeeds");
+            test.check(workerSawMainTask, "main thread task was not held up by a worker task");
+            test.check(recorder.getThread("Window") == std::this_thread::get_id(), "main thread task ran on the thread calling run()");
+
+            const auto& timings = graph.getTimings();
+            const auto windowTiming = std::ranges::find(timings, std::string("Window"), &Startup::PhaseTiming::name);
+            test.check(windowTiming != timings.end() && windowTiming->mainThread, "timing marks the main thread task");
+        });
+    }
+
+    void testFailures(Test::Runner& runner) {
+        runner.run("InitGraph/failure skips dependents only", [](Test::Context& test) {
+            JobSystem jobs(2);
+            Recorder recorder;
+            InitGraph graph;
+            graph.add(recorder.task("Platform", {}));
+            graph.add(recorder.task("Device", {"Platform"}, false));
+            graph.add(recorder.task("Swapchain", {"Device"}, true, true));
+            graph.add(recorder.task("Present", {"Swapchain", "Assets"}));
+            graph.add(recorder.task("Assets", {}));
+            graph.add(recorder.task("Audio", {"Platform"}));
+
+            test.check(!graph.run(jobs), "graph reports the failure");
+            test.check(recorder.ran("Platform") && recorder.ran("Device") && recorder.ran("Assets") && recorder.ran("Audio"),
+                       "tasks not depending on the failure still run");
+            test.check(!recorder.ran("Swapchain"), "direct dependent (main thread) is skipped");
+            test.check(!recorder.ran("Present"), "transitive dependent is skipped, even with another dependency succeeding");
+
+            const auto& timings = graph.getTimings();
+            test.checkEqual(timings.size(), size_t{4}, "only tasks that ran are timed");
+            const auto device = std::ranges::find(timings, std::string("Device"), &Startup::PhaseTiming::name);
+            test.check(device != timings.end() && !device->succeeded, "the failed task is timed as failed");
+        });
+
+        runner.run("InitGraph/failing main thread task", [](Test::Context& test) {
+            JobSystem jobs(2);
+            Recorder recorder;
+            InitGraph graph;
+            graph.add(recorder.task("Window", {}, false, true));
+            graph.add(recorder.task("Surface", {"Window"}, true, true));
+            graph.add(recorder.task("Input", {"Window"}));
+            graph.add(recorder.task("Assets", {}));
+
+            // returning at all is part of the check: skipped main thread tasks must not be waited for
+            test.check(!graph.run(jobs), "graph reports the failure");
+            test.check(!recorder.ran("Surface") && !recorder.ran("Input"), "dependents are skipped");
+            test.check(recorder.ran("Assets"), "unrelated task still runs");
+        });
+
+        runner.run("InitGraph/tasks without work succeed", [](Test::Context& test) {
+            JobSystem jobs(1);
+            InitGraph empty;
+            test.check(empty.run(jobs), "an empty graph succeeds");
+
+            Recorder recorder;
+            InitGraph graph;
+            graph.add({"Marker", {}, {}});
+            graph.add(recorder.task("After", {"Marker"}));
+            test.check(graph.run(jobs), "graph succeeds");
+            test.check(recorder.ran("After"), "a task without a function counts as succeeded");
+        });
+    }
+
+    void testInvalidGraphs(Test::Runner& runner) {
+        struct Case {
+            const char* name;
+            std::vector<std::pair<std::string, std::vector<std::string>>> tasks;
+        };
+        const std::vector<Case> cases = {
+            {"unknown dependency", {{"Platform", {}}, {"Window", {"Platfrom"}}}},
+            {"cycle", {{"Platform", {}}, {"A", {"Platform", "C"}}, {"B", {"A"}}, {"C", {"B"}}}},
+            {"self dependency", {{"Platform", {"Platform"}}}},
+            {"duplicate name", {{"Platform", {}}, {"Platform", {}}}},
+        };
+
+        for (const Case& testCase : cases) {
+            runner.run(std::string("InitGraph/refuses ") + testCase.name, [&testCase](Test::Context& test) {
+                JobSystem jobs(2);
+                Recorder recorder;
+                InitGraph graph;
+                for (const auto& [name, dependencies] : testCase.tasks) graph.add(recorder.task(name, dependencies));
+                test.check(!graph.run(jobs), "run() fails");
+                test.checkEqual(recorder.getRunCount(), size_t{0}, "nothing ran");
+                test.check(graph.getTimings().empty(), "nothing was timed");
+            });
+        }
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    std::string error;
+    const auto options = Test::parseOptions(argc, argv, &error);
+    if (!options) {
+        if (error.empty()) return 0;
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    Log::Init("VKING_Test_Startup.log", Log::Level::info);
+    Log::setConsoleOutput(false);
+
+    Test::Runner runner(*options);
+    testOrdering(runner);
+    testFailures(runner);
+    testInvalidGraphs(runner);
+    return runner.finish();
+}
@@ -0,0 +1,241 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Test_TextureStreamer [--filter=<text>]
+//
+// TextureStreamer: resident plus in-flight bytes never exceeding the memory budget (mip tails counted in full),
+// residency staying contiguous so eviction never takes a mip out from under the load that builds on it, and
+// textures that dropped out of view giving their finer mips up to the ones still on screen.
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+import VKING.Log;
+import VKING.Streaming.Textures;
+import VKING.Test.Harness;
+
+namespace {
+
+    using namespace VKING;
+    using Streaming::TextureHandle;
+    using Streaming::TextureStreamer;
+
+    /// Every test texture is 256x256 RGBA8 with a full chain, so with a 64 texel tail the tail starts at mip 2
+    constexpr uint32_t TEXTURE_DIMENSION = 256;
+    constexpr uint32_t MIP_COUNT = 9;
+    constexpr uint32_t TAIL_MIP = 2;
+    constexpr uint64_t MIP0_BYTES = 256 * 256 * 4;
+    constexpr uint64_t MIP1_BYTES = 128 * 128 * 4;
+    constexpr uint64_t TAIL_BYTES = (64 * 64 + 32 * 32 + 16 * 16 + 8 * 8 + 4 * 4 + 2 * 2 + 1) * 4;
+
+    /// Completes requests when told to, and records every request or release that would break contiguous residency
+    class TestLoader final : public Streaming::MipLoader {
+    public:
+        bool requestMip(const TextureHandle texture, const uint32_t mip, const uint64_t sizeBytes) override {
+            if (!accepting) return false;
+
+            const auto finest = m_Finest.find(texture);
+            const uint32_t expected = finest == m_Finest.end() ? TAIL_MIP : finest->second - 1;
+            if (mip != expected) {
+                violations.push_back("requested mip " + std::to_string(mip) + " of texture " + std::to_string(texture) +
+                                     ", expected mip " + std::to_string(expected));
+            }
+            if (sizeBytes != (mip == TAIL_MIP ? TAIL_BYTES : TextureStreamer::computeMipSize(createInfo(), mip))) {
+                violations.push_back("requested mip " + std::to_string(mip) + " with " + std::to_string(sizeBytes) + " bytes");
+            }
+            m_Pending.push_back({texture, mip});
+            return true;
+        }
+
+        void releaseMip(const TextureHandle texture, const uint32_t mip) override {
+            const auto finest = m_Finest.find(texture);
+            if (finest == m_Finest.end() || finest->second != mip) {
+                violations.push_back("released mip " + std::to_string(mip) + " of texture " + std::to_string(texture) +
+                                     " which is not its finest resident mip");
+                return;
+            }
+            if (mip == TAIL_MIP) m_Finest.erase(finest);
+            else finest->second = mip + 1;
+        }
+
+        /// Reports every outstanding request as loaded
+        void completeAll(TextureStreamer& streamer) {
+            for (const auto& [texture, mip] : m_Pending) {
+                m_Finest[texture] = mip;
+                streamer.notifyMipLoaded(texture, mip);
+            }
+            m_Pending.clear();
+        }
+
+        static Streaming::StreamableTextureCreateInfo createInfo() {
+            return {.name = "test", .width = TEXTURE_DIMENSION, .height = TEXTURE_DIMENSION, .mipCount = MIP_COUNT};
+        }
+
+        bool accepting = true;
+        std::vector<std::string> violations;
+
+    private:
+        struct Request {
+            TextureHandle texture;
+            uint32_t mip;
+        };
+
+        std::map<TextureHandle, uint32_t> m_Finest;
+        std::vector<Request> m_Pending;
+    };
+
+    TextureStreamer::Config testConfig(const uint64_t memoryBudgetBytes) {
+        TextureStreamer::Config config;
+        config.memoryBudgetBytes = memoryBudgetBytes;
+        config.maxBytesPerFrame = 64ull * 1024 * 1024;
+        config.maxBytesInFlight = 64ull * 1024 * 1024;
+        config.tailMaxDimension = 64;
+        config.unseenFramesBeforeDecay = 2;
+        return config;
+    }
+
+    /// Runs one frame with the given textures on screen at full size, then lets the loader finish everything
+    void runFrame(Test::Context& test, TextureStreamer& streamer, TestLoader& loader, const std::vector<TextureHandle>& visible) {
+        for (const TextureHandle texture : visible) {
+            streamer.reportScreenSize(texture, static_cast<float>(TEXTURE_DIMENSION), static_cast<float>(TEXTURE_DIMENSION));
+        }
+        streamer.update(1.0f / 60.0f);
+
+        const auto& stats = streamer.getStats();
+        test.check(stats.residentBytes + stats.inFlightBytes <= stats.memoryBudgetBytes,
+                   "frame " + std::to_string(stats.frameIndex) + " stays within the budget (" +
+                   std::to_string(stats.residentBytes + stats.inFlightBytes) + " of " + std::to_string(stats.memoryBudgetBytes) + " bytes)");
+        loader.completeAll(streamer);
+    }
+
+    void checkNoViolations(Test::Context& test, const TestLoader& loader) {
+        for (const std::string& violation : loader.violations) test.check(false, violation);
+    }
+
+    void testBudget(Test::Runner& runner) {
+        runner.run("TextureStreamer/deferred tails count in full", [](Test::Context& test) {
+            // room for one tail and most of a second. Counting only the tail's first mip would let the second through
+            TestLoader loader;
+            TextureStreamer streamer(loader, testConfig(TAIL_BYTES + MIP1_BYTES / 4 + 1024));
+
+            loader.accepting = false;
+            const TextureHandle first = streamer.registerTexture(TestLoader::createInfo());
+            const TextureHandle second = streamer.registerTexture(TestLoader::createInfo());
+            loader.accepting = true;
+
+            for (uint32_t frame = 0; frame < 4; frame++) runFrame(test, streamer, loader, {});
+
+            test.checkEqual(streamer.getResidentMip(first), TAIL_MIP, "the first tail is loaded");
+            test.checkEqual(streamer.getResidentMip(second), MIP_COUNT, "the second tail does not fit");
+            test.checkEqual(streamer.getStats().residentBytes, TAIL_BYTES, "resident bytes cover exactly one tail");
+            test.checkEqual(streamer.getStats().pendingTextures, 1u, "the second texture is still waiting");
+            checkNoViolations(test, loader);
+        });
+
+        runner.run("TextureStreamer/loads stop at the budget", [](Test::Context& test) {
+            TestLoader loader;
+            TextureStreamer streamer(loader, testConfig(3 * TAIL_BYTES + 2 * MIP1_BYTES));
+
+            std::vector<TextureHandle> textures;
+            for (uint32_t i = 0; i < 3; i++) textures.push_back(streamer.registerTexture(TestLoader::createInfo()));
+            loader.completeAll(streamer);
+
+            for (uint32_t frame = 0; frame < 8; frame++) runFrame(test, streamer, loader, textures);
+
+            uint32_t atMip1 = 0;
+            for (const TextureHandle texture : textures) {
+                test.check(streamer.getResidentMip(texture) >= 1, "no texture reaches mip 0, it never fits");
+                if (streamer.getResidentMip(texture) == 1) atMip1++;
+            }
+            test.checkEqual(atMip1, 2u, "exactly the mips that fit were loaded");
+            test.checkEqual(streamer.getStats().bytesEvictedTotal, uint64_t{0}, "textures on screen do not evict each other");
+            checkNoViolations(test, loader);
+        });
+    }
+
+    void testEviction(Test::Runner& runner) {
+        runner.run("TextureStreamer/eviction spares the texture being loaded", [](Test::Context& test) {
+            // the texture drops out of view with its finer mips still wanted. The only thing that could make room
+            // for its next mip is its own finest mip, which that next mip builds on
+            TestLoader loader;
+            TextureStreamer streamer(loader, testConfig(TAIL_BYTES + MIP1_BYTES + MIP0_BYTES - 1));
+
+            const TextureHandle texture = streamer.registerTexture(TestLoader::createInfo());
+            loader.completeAll(streamer);
+            runFrame(test, streamer, loader, {texture});
+            test.checkEqual(streamer.getResidentMip(texture), TAIL_MIP, "the tail is resident");
+            runFrame(test, streamer, loader, {texture});
+            test.checkEqual(streamer.getResidentMip(texture), 1u, "mip 1 is resident");
+
+            runFrame(test, streamer, loader, {});
+            runFrame(test, streamer, loader, {});
+
+            test.checkEqual(streamer.getResidentMip(texture), 1u, "mip 1 was not evicted to make room for mip 0");
+            test.checkEqual(streamer.getStats().bytesEvictedTotal, uint64_t{0}, "nothing was evicted");
+            test.checkEqual(streamer.getStats().residentBytes, TAIL_BYTES + MIP1_BYTES, "resident bytes match the resident mips");
+            checkNoViolations(test, loader);
+        });
+
+        runner.run("TextureStreamer/unseen textures make room", [](Test::Context& test) {
+            TestLoader loader;
+            TextureStreamer streamer(loader, testConfig(2 * TAIL_BYTES + MIP1_BYTES + MIP0_BYTES));
+
+            const TextureHandle hidden = streamer.registerTexture(TestLoader::createInfo());
+            const TextureHandle visible = streamer.registerTexture(TestLoader::createInfo());
+            loader.completeAll(streamer);
+
+            for (uint32_t frame = 0; frame < 4; frame++) runFrame(test, streamer, loader, {hidden});
+            test.checkEqual(streamer.getResidentMip(hidden), 0u, "the first texture is fully resident");
+
+            for (uint32_t frame = 0; frame < 6; frame++) runFrame(test, streamer, loader, {visible});
+
+            test.checkEqual(streamer.getResidentMip(visible), 0u, "the visible texture is fully resident");
+            test.checkEqual(streamer.getResidentMip(hidden), TAIL_MIP, "the hidden texture is back to its tail");
+            test.checkEqual(streamer.getStats().bytesEvictedTotal, MIP0_BYTES + MIP1_BYTES, "exactly the hidden finer mips were evicted");
+            test.checkEqual(streamer.getStats().residentBytes, 2 * TAIL_BYTES + MIP1_BYTES + MIP0_BYTES, "resident bytes match the resident mips");
+            checkNoViolations(test, loader);
+        });
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    std::string error;
+    const auto options = Test::parseOptions(argc, argv, &error);
+    if (!options) {
+        if (error.empty()) return 0;
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    Log::Init("VKING_Test_TextureStreamer.log", Log::Level::info);
+    Log::setConsoleOutput(false);
+
+    Test::Runner runner(*options);
+    testBudget(runner);
+    testEviction(runner);
+    return runner.finish();
+}
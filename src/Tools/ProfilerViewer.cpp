@@ -0,0 +1,527 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+//
+// Usage:
+//   VKING_ProfilerViewer [--pid=<n> | --socket=<path>] [--trigger-ms=<ms>] [--capture=<path>] [--before=<frames>]
+//                        [--after=<frames>] [--max-captures=<n>] [--quiet]
+//
+// Connects to a process started with --profiler-stream (see VKING/ProfilerStream.hpp) and prints a summary of
+// its frames once per second, plus its log messages unless --quiet. With --trigger-ms, the first frame slower
+// than that is captured: the frames around it, their zones, counters and log messages are written as a Chrome
+// trace (default VKING_Capture.json, numbered after the first). Exits after --max-captures captures (default 1,
+// 0 keeps going) or when the process goes away. Without --pid or --socket it connects to the only stream found.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <VKING/Profiler.hpp>
+#include <VKING/ProfilerStream.hpp>
+
+namespace {
+
+    using namespace VKING;
+    using Profiler::Stream::MessageType;
+
+    constexpr auto SUMMARY_INTERVAL = std::chrono::seconds(1);
+
+    struct Options {
+        int processId = 0;
+        std::string socketPath;
+        double triggerMilliseconds = 0.0;
+        std::string capturePath = "VKING_Capture.json";
+        uint32_t framesBefore = 60;
+        uint32_t framesAfter = 10;
+        uint32_t maxCaptures = 1;
+        bool quiet = false;
+    };
+
+    struct Zone {
+        uint32_t nameId;
+        uint32_t threadId;
+        int64_t beginNanoseconds;
+        uint64_t durationNanoseconds;
+        bool counted;
+        uint64_t counters[Profiler::COUNTER_COUNT];
+    };
+
+    struct Frame {
+        uint64_t index = 0;
+        uint64_t beginNanoseconds = 0;
+        uint64_t durationNanoseconds = 0;
+        std::vector<Zone> zones;
+    };
+
+    struct LogEntry {
+        uint64_t timestampNanoseconds;
+        uint8_t level;
+        uint32_t loggerId;
+        std::string message;
+    };
+
+    /// Bounds checked reader over one message payload. Reading past the end sets failed and returns zeros
+    struct Reader {
+        const char* data;
+        size_t size;
+        size_t position = 0;
+        bool failed = false;
+
+        uint8_t byte() {
+            if (position >= size) {
+                failed = true;
+                return 0;
+            }
+            return static_cast<uint8_t>(data[position++]);
+        }
+
+        uint64_t varint() {
+            uint64_t value = 0;
+            for (uint32_t shift = 0; shift < 64; shift += 7) {
+                const uint8_t next = byte();
+                value |= static_cast<uint64_t>(next & 0x7F) << shift;
+                if (!(next & 0x80)) return value;
+            }
+            failed = true;
+            return 0;
+        }
+
+        int64_t zigzag() {
+            const uint64_t value = varint();
+            return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        }
+
+        std::string_view rest() {
+            const std::string_view text(data + position, size - position);
+            position = size;
+            return text;
+        }
+    };
+
+    const char* getLevelName(const uint8_t level) {
+        constexpr const char* NAMES[] = {"trace", "debug", "info", "warning", "error", "critical", "off"};
+        return level < std::size(NAMES) ? NAMES[level] : "unknown";
+    }
+
+    void writeEscaped(std::FILE* file, const std::string_view text) {
+        for (const char c : text) {
+            if (c == '"' || c == '\\') {
+                std::fputc('\\', file);
+                std::fputc(c, file);
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                std::fprintf(file, "\\u%04x", c);
+            } else {
+                std::fputc(c, file);
+            }
+        }
+    }
+
+    class Session {
+    public:
+        explicit Session(Options options)
+            : m_Options(std::move(options)) {}
+
+        /// @return false once the session is done: a protocol error or enough captures
+        bool handleMessage(MessageType type, Reader payload);
+
+        /// Writes a capture still waiting for frames after the trigger, with whatever arrived
+        void finish();
+
+        [[nodiscard]] int getExitCode() const { return m_ProtocolError ? 1 : 0; }
+
+    private:
+        bool handleFrame(Reader& payload);
+        void handleLog(Reader& payload);
+        void printSummary(bool force);
+        bool writeCapture();
+
+        [[nodiscard]] std::string_view getString(const uint32_t id) const {
+            const auto found = m_Strings.find(id);
+            return found == m_Strings.end() ? std::string_view("?") : std::string_view(found->second);
+        }
+
+        Options m_Options;
+        std::unordered_map<uint32_t, std::string> m_Strings;
+        std::unordered_map<uint32_t, uint32_t> m_ThreadNames;
+        std::deque<Frame> m_Frames;
+        std::deque<LogEntry> m_Logs;
+        int m_ProcessId = 0;
+        bool m_ProtocolError = false;
+
+        // === Capture ===
+        bool m_CapturePending = false;
+        uint64_t m_TriggerFrame = 0;
+        uint32_t m_FramesUntilCapture = 0;
+        uint32_t m_Captures = 0;
+
+        // === Summary ===
+        std::chrono::steady_clock::time_point m_LastSummary = std::chrono::steady_clock::now();
+        uint64_t m_SummaryFrames = 0;
+        uint64_t m_SummaryNanoseconds = 0;
+        uint64_t m_DroppedMessages = 0;
+        Frame m_WorstFrame;
+    };
+
+    bool Session::handleMessage(const MessageType type, Reader payload) {
+        switch (type) {
+            case MessageType::HELLO: {
+                uint32_t magic = 0;
+                for (uint32_t i = 0; i < 4; i++) magic |= static_cast<uint32_t>(payload.byte()) << (8 * i);
+                const uint64_t version = payload.varint();
+                m_ProcessId = static_cast<int>(payload.varint());
+                if (payload.failed || magic != Profiler::Stream::PROTOCOL_MAGIC || version != Profiler::Stream::PROTOCOL_VERSION) {
+                    std::fprintf(stderr, "Not a VKING profiler stream this viewer understands (version %llu).\n",
+                                 static_cast<unsigned long long>(version));
+                    m_ProtocolError = true;
+                    return false;
+                }
+                std::printf("Connected to process %d.\n", m_ProcessId);
+                break;
+            }
+            case MessageType::STRING: {
+                const auto id = static_cast<uint32_t>(payload.varint());
+                m_Strings[id] = std::string(payload.rest());
+                break;
+            }
+            case MessageType::THREAD: {
+                const auto threadId = static_cast<uint32_t>(payload.varint());
+                m_ThreadNames[threadId] = static_cast<uint32_t>(payload.varint());
+                break;
+            }
+            case MessageType::FRAME:
+                return handleFrame(payload);
+            case MessageType::LOG:
+                handleLog(payload);
+                break;
+            case MessageType::DROPPED: {
+                const uint64_t dropped = payload.varint();
+                m_DroppedMessages += dropped;
+                if (!m_Options.quiet) std::printf("-- %llu messages dropped, the viewer fell behind\n", static_cast<unsigned long long>(dropped));
+                break;
+            }
+            default:
+                // Newer message types are skipped, the length prefix makes that safe
+                break;
+        }
+        if (payload.failed) {
+            std::fprintf(stderr, "Malformed message of type %u.\n", static_cast<uint32_t>(type));
+            m_ProtocolError = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool Session::handleFrame(Reader& payload) {
+        Frame frame;
+        frame.index = payload.varint();
+        frame.beginNanoseconds = payload.varint();
+        frame.durationNanoseconds = payload.varint();
+        const uint64_t zoneCount = payload.varint();
+        frame.zones.reserve(std::min<uint64_t>(zoneCount, payload.size));
+        for (uint64_t i = 0; i < zoneCount && !payload.failed; i++) {
+            Zone zone{};
+            zone.nameId = static_cast<uint32_t>(payload.varint());
+            zone.threadId = static_cast<uint32_t>(payload.varint());
+            zone.beginNanoseconds = payload.zigzag();
+            zone.durationNanoseconds = payload.varint();
+            zone.counted = payload.byte() != 0;
+            if (zone.counted) {
+                for (uint64_t& counter : zone.counters) counter = payload.varint();
+            }
+            frame.zones.push_back(zone);
+        }
+        if (payload.failed) {
+            std::fprintf(stderr, "Malformed frame message.\n");
+            m_ProtocolError = true;
+            return false;
+        }
+
+        m_SummaryFrames++;
+        m_SummaryNanoseconds += frame.durationNanoseconds;
+        if (frame.durationNanoseconds >= m_WorstFrame.durationNanoseconds) m_WorstFrame = frame;
+
+        const double milliseconds = static_cast<double>(frame.durationNanoseconds) / 1'000'000.0;
+        const bool triggered = m_Options.triggerMilliseconds > 0.0 && milliseconds > m_Options.triggerMilliseconds;
+        if (triggered && !m_CapturePending) {
+            std::printf("Frame %llu took %.2f ms (trigger %.2f ms), capturing.\n", static_cast<unsigned long long>(frame.index),
+                        milliseconds, m_Options.triggerMilliseconds);
+            m_CapturePending = true;
+            m_TriggerFrame = frame.index;
+            m_FramesUntilCapture = m_Options.framesAfter;
+        } else if (m_CapturePending && m_FramesUntilCapture > 0) {
+            m_FramesUntilCapture--;
+        }
+
+        m_Frames.push_back(std::move(frame));
+        while (m_Frames.size() > static_cast<size_t>(m_Options.framesBefore) + m_Options.framesAfter + 1) m_Frames.pop_front();
+        const uint64_t oldest = m_Frames.front().beginNanoseconds;
+        while (!m_Logs.empty() && m_Logs.front().timestampNanoseconds < oldest) m_Logs.pop_front();
+
+        printSummary(false);
+
+        if (m_CapturePending && m_FramesUntilCapture == 0) {
+            m_CapturePending = false;
+            writeCapture();
+            if (m_Options.maxCaptures > 0 && m_Captures >= m_Options.maxCaptures) return false;
+        }
+        return true;
+    }
+
+    void Session::handleLog(Reader& payload) {
+        LogEntry entry;
+        entry.timestampNanoseconds = payload.varint();
+        entry.level = payload.byte();
+        entry.loggerId = static_cast<uint32_t>(payload.varint());
+        entry.message = std::string(payload.rest());
+        if (payload.failed) return;
+
+        if (!m_Options.quiet) {
+            const std::string_view logger = getString(entry.loggerId);
+            std::printf("[%.*s] [%s] %s\n", static_cast<int>(logger.size()), logger.data(), getLevelName(entry.level), entry.message.c_str());
+        }
+        m_Logs.push_back(std::move(entry));
+    }
+
+    void Session::printSummary(const bool force) {
+        const auto now = std::chrono::steady_clock::now();
+        if (m_SummaryFrames == 0 || (!force && now - m_LastSummary < SUMMARY_INTERVAL)) return;
+
+        const double seconds = std::chrono::duration<double>(now - m_LastSummary).count();
+        std::printf("Frame %llu: %.1f fps, avg %.2f ms, worst %.2f ms", static_cast<unsigned long long>(m_Frames.back().index),
+                    static_cast<double>(m_SummaryFrames) / std::max(seconds, 1e-9),
+                    static_cast<double>(m_SummaryNanoseconds) / static_cast<double>(m_SummaryFrames) / 1'000'000.0,
+                    static_cast<double>(m_WorstFrame.durationNanoseconds) / 1'000'000.0);
+
+        // Where the worst frame went, by total time per zone name
+        std::unordered_map<uint32_t, uint64_t> totals;
+        for (const Zone& zone : m_WorstFrame.zones) totals[zone.nameId] += zone.durationNanoseconds;
+        std::vector<std::pair<uint32_t, uint64_t>> sorted(totals.begin(), totals.end());
+        std::ranges::sort(sorted, [](const auto& a, const auto& b) { return a.second > b.second; });
+        for (size_t i = 0; i < std::min<size_t>(sorted.size(), 3); i++) {
+            const std::string_view name = getString(sorted[i].first);
+            std::printf("%s %.*s %.2f ms", i == 0 ? " |" : ",", static_cast<int>(name.size()), name.data(),
+                        static_cast<double>(sorted[i].second) / 1'000'000.0);
+        }
+        std::printf("\n");
+        std::fflush(stdout);
+
+        m_LastSummary = now;
+        m_SummaryFrames = 0;
+        m_SummaryNanoseconds = 0;
+        m_WorstFrame = Frame();
+    }
+
+    bool Session::writeCapture() {
+        std::filesystem::path path = m_Options.capturePath;
+        if (m_Captures > 0) {
+            path.replace_filename(path.stem().string() + "_" + std::to_string(m_Captures) + path.extension().string());
+        }
+        m_Captures++;
+        if (m_Frames.empty()) return false;
+
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        if (!file) {
+            std::fprintf(stderr, "Could not write the capture to %s.\n", path.string().c_str());
+            return false;
+        }
+
+        const uint64_t origin = m_Frames.front().beginNanoseconds;
+        auto toMicroseconds = [origin](const int64_t nanoseconds) {
+            return static_cast<double>(nanoseconds - static_cast<int64_t>(origin)) / 1000.0;
+        };
+
+        std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"name\":\"Frames\"}}", m_ProcessId);
+        for (const auto& [threadId, nameId] : m_ThreadNames) {
+            std::fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"", m_ProcessId, threadId);
+            writeEscaped(file, getString(nameId));
+            std::fprintf(file, "\"}}");
+        }
+
+        for (const Frame& frame : m_Frames) {
+            std::fprintf(file, ",\n{\"name\":\"Frame %llu\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":0}",
+                         static_cast<unsigned long long>(frame.index), frame.index == m_TriggerFrame ? "trigger" : "frame",
+                         toMicroseconds(static_cast<int64_t>(frame.beginNanoseconds)), static_cast<double>(frame.durationNanoseconds) / 1000.0,
+                         m_ProcessId);
+            for (const Zone& zone : frame.zones) {
+                std::fprintf(file, ",\n{\"name\":\"");
+                writeEscaped(file, getString(zone.nameId));
+                std::fprintf(file, "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%u",
+                             toMicroseconds(static_cast<int64_t>(frame.beginNanoseconds) + zone.beginNanoseconds),
+                             static_cast<double>(zone.durationNanoseconds) / 1000.0, m_ProcessId, zone.threadId);
+                if (zone.counted) {
+                    std::fprintf(file, ",\"args\":{");
+                    for (uint32_t i = 0; i < Profiler::COUNTER_COUNT; i++) {
+                        std::fprintf(file, "%s\"%s\":%llu", i ? "," : "", Profiler::getCounterName(static_cast<Profiler::Counter>(i)),
+                                     static_cast<unsigned long long>(zone.counters[i]));
+                    }
+                    std::fprintf(file, "}");
+                }
+                std::fprintf(file, "}");
+            }
+        }
+
+        for (const LogEntry& entry : m_Logs) {
+            std::fprintf(file, ",\n{\"name\":\"");
+            writeEscaped(file, entry.message);
+            std::fprintf(file, "\",\"cat\":\"log\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":%d,\"tid\":0,\"args\":{\"logger\":\"",
+                         toMicroseconds(static_cast<int64_t>(entry.timestampNanoseconds)), m_ProcessId);
+            writeEscaped(file, getString(entry.loggerId));
+            std::fprintf(file, "\",\"level\":\"%s\"}}", getLevelName(entry.level));
+        }
+        std::fprintf(file, "\n]}\n");
+
+        const bool written = std::fclose(file) == 0;
+        if (written) {
+            std::printf("Captured %zu frames around frame %llu to %s.\n", m_Frames.size(), static_cast<unsigned long long>(m_TriggerFrame),
+                        path.string().c_str());
+        } else {
+            std::fprintf(stderr, "Could not write the capture to %s.\n", path.string().c_str());
+        }
+        return written;
+    }
+
+    void Session::finish() {
+        if (m_CapturePending) {
+            m_CapturePending = false;
+            writeCapture();
+        }
+        printSummary(true);
+        if (m_DroppedMessages > 0) std::printf("%llu messages were dropped in total.\n", static_cast<unsigned long long>(m_DroppedMessages));
+    }
+
+    /// The socket of the only process streaming, empty if there are none or several
+    std::string findSocket() {
+        const char* runtimeDirectory = std::getenv("XDG_RUNTIME_DIR");
+        const std::filesystem::path directory = runtimeDirectory && *runtimeDirectory ? runtimeDirectory : "/tmp";
+        std::string found;
+        uint32_t count = 0;
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+            const std::string name = entry.path().filename().string();
+            if (name.starts_with("VKING.") && name.ends_with(".profiler") && entry.is_socket(error)) {
+                found = entry.path().string();
+                count++;
+            }
+        }
+        if (count > 1) std::fprintf(stderr, "Several VKING processes are streaming, pick one with --pid.\n");
+        return count == 1 ? found : std::string();
+    }
+
+    int connectTo(const std::string& path) {
+        sockaddr_un address{};
+        if (path.size() >= sizeof(address.sun_path)) return -1;
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+        const int connection = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (connection < 0) return -1;
+        if (connect(connection, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            close(connection);
+            return -1;
+        }
+        return connection;
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if (argument.starts_with("--pid=")) {
+            options.processId = std::atoi(argv[i] + 6);
+        } else if (argument.starts_with("--socket=")) {
+            options.socketPath = argv[i] + 9;
+        } else if (argument.starts_with("--trigger-ms=")) {
+            options.triggerMilliseconds = std::strtod(argv[i] + 13, nullptr);
+        } else if (argument.starts_with("--capture=") && argument.size() > 10) {
+            options.capturePath = argv[i] + 10;
+        } else if (argument.starts_with("--before=")) {
+            options.framesBefore = static_cast<uint32_t>(std::max(0, std::atoi(argv[i] + 9)));
+        } else if (argument.starts_with("--after=")) {
+            options.framesAfter = static_cast<uint32_t>(std::max(0, std::atoi(argv[i] + 8)));
+        } else if (argument.starts_with("--max-captures=")) {
+            options.maxCaptures = static_cast<uint32_t>(std::max(0, std::atoi(argv[i] + 15)));
+        } else if (argument == "--quiet") {
+            options.quiet = true;
+        } else {
+            std::fprintf(stderr, "Usage: %s [--pid=<n> | --socket=<path>] [--trigger-ms=<ms>] [--capture=<path>] [--before=<frames>]\n"
+                                 "       [--after=<frames>] [--max-captures=<n>] [--quiet]\n", argv[0]);
+            return argument == "--help" || argument == "-h" ? 0 : 2;
+        }
+    }
+
+    std::string path = options.socketPath;
+    if (path.empty()) path = options.processId > 0 ? Profiler::Stream::getDefaultSocketPath(options.processId) : findSocket();
+    if (path.empty()) {
+        std::fprintf(stderr, "No VKING process is streaming. Start one with --profiler-stream.\n");
+        return 1;
+    }
+    const int connection = connectTo(path);
+    if (connection < 0) {
+        std::fprintf(stderr, "Could not connect to %s.\n", path.c_str());
+        return 1;
+    }
+
+    Session session(std::move(options));
+    std::vector<char> pending;
+    std::vector<char> chunk(64 * 1024);
+    bool running = true;
+    while (running) {
+        const ssize_t received = read(connection, chunk.data(), chunk.size());
+        if (received <= 0) {
+            std::printf("The process closed the stream.\n");
+            break;
+        }
+        pending.insert(pending.end(), chunk.data(), chunk.data() + received);
+
+        // Handle every complete message, keep a partial one for the next read
+        size_t position = 0;
+        while (running) {
+            Reader header{pending.data() + position, pending.size() - position};
+            const auto type = static_cast<MessageType>(header.byte());
+            const uint64_t length = header.varint();
+            if (header.failed || length > header.size - header.position) break;
+            running = session.handleMessage(type, Reader{pending.data() + position + header.position, static_cast<size_t>(length)});
+            position += header.position + length;
+        }
+        pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(position));
+    }
+
+    close(connection);
+    session.finish();
+    return session.getExitCode();
+}
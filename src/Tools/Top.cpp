@@ -0,0 +1,163 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+// Usage:
+//   VKING_Top [--pid=<n>] [--interval=<ms>] [--once]
+//
+// Shows the live metrics every running VKING process publishes in shared memory (see VKING/LiveMetrics.hpp):
+// frame times, frame rate, memory and queue depths. Without --pid it finds every instance under /dev/shm.
+// --once prints a single table and exits, for scripts.
+//
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <VKING/LiveMetrics.hpp>
+
+namespace {
+
+    using namespace VKING;
+
+    struct Options {
+        int processId = 0;
+        uint32_t intervalMilliseconds = 500;
+        bool once = false;
+    };
+
+    std::vector<int> findProcesses() {
+        std::vector<int> processIds;
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator("/dev/shm", error)) {
+            const std::string name = entry.path().filename().string();
+            if (!name.starts_with("VKING.")) continue;
+            char* end = nullptr;
+            const long processId = std::strtol(name.c_str() + 6, &end, 10);
+            if (end && *end == '\0' && processId > 0) processIds.push_back(static_cast<int>(processId));
+        }
+        std::ranges::sort(processIds);
+        return processIds;
+    }
+
+    /// Maps one process's block read-only, nullptr if it is missing or not a block this tool understands
+    const LiveMetrics::Block* mapBlock(const int processId) {
+        const int file = shm_open(LiveMetrics::getSharedMemoryName(processId).c_str(), O_RDONLY, 0);
+        if (file < 0) return nullptr;
+        struct stat status{};
+        if (fstat(file, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(LiveMetrics::Block)) {
+            close(file);
+            return nullptr;
+        }
+        void* memory = mmap(nullptr, sizeof(LiveMetrics::Block), PROT_READ, MAP_SHARED, file, 0);
+        close(file);
+        if (memory == MAP_FAILED) return nullptr;
+
+        const auto* block = static_cast<const LiveMetrics::Block*>(memory);
+        if (block->header.magic != LiveMetrics::MAGIC || block->header.version != LiveMetrics::LAYOUT_VERSION) {
+            munmap(memory, sizeof(LiveMetrics::Block));
+            return nullptr;
+        }
+        return block;
+    }
+
+    const char* describeState(const LiveMetrics::Snapshot& snapshot, const int processId) {
+        if (snapshot.state == LiveMetrics::State::EXITED) return "exited";
+        // A running block whose process is gone was never closed
+        if (kill(processId, 0) != 0 && errno == ESRCH) return "crashed";
+        return "running";
+    }
+
+    void printTable(const std::vector<int>& processIds) {
+        std::printf("%-8s %-20s %-8s %10s %8s %9s %9s %9s %10s %10s %9s  %s\n", "PID", "Application", "State", "Frame", "FPS",
+                    "Frame ms", "Avg ms", "Worst ms", "RSS MiB", "Peak MiB", "Uptime s", "Queues");
+        for (const int processId : processIds) {
+            const LiveMetrics::Block* block = mapBlock(processId);
+            if (!block) continue;
+
+            LiveMetrics::Snapshot snapshot{};
+            if (LiveMetrics::readSnapshot(*block, snapshot)) {
+                std::string queues;
+                for (uint32_t i = 0; i < std::min(snapshot.queueCount, LiveMetrics::MAX_QUEUES); i++) {
+                    if (!queues.empty()) queues += ' ';
+                    queues += std::string(snapshot.queues[i].name, strnlen(snapshot.queues[i].name, sizeof(snapshot.queues[i].name)));
+                    queues += '=' + std::to_string(snapshot.queues[i].depth);
+                }
+                std::printf("%-8d %-20.20s %-8s %10llu %8.1f %9.2f %9.2f %9.2f %10.1f %10.1f %9.1f  %s\n", processId,
+                            block->header.application, describeState(snapshot, processId),
+                            static_cast<unsigned long long>(snapshot.frameIndex), snapshot.framesPerSecond, snapshot.frameMilliseconds,
+                            snapshot.averageFrameMilliseconds, snapshot.worstFrameMilliseconds,
+                            static_cast<double>(snapshot.residentBytes) / (1024.0 * 1024.0),
+                            static_cast<double>(snapshot.peakResidentBytes) / (1024.0 * 1024.0),
+                            static_cast<double>(snapshot.uptimeMilliseconds) / 1000.0, queues.c_str());
+            } else {
+                std::printf("%-8d %-20.20s %-8s (no consistent snapshot, the writer is stuck mid-update)\n", processId,
+                            block->header.application, "stalled");
+            }
+            munmap(const_cast<LiveMetrics::Block*>(block), sizeof(LiveMetrics::Block));
+        }
+        std::fflush(stdout);
+    }
+
+}
+
+int main(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if (argument.starts_with("--pid=")) {
+            options.processId = std::atoi(argv[i] + 6);
+        } else if (argument.starts_with("--interval=")) {
+            options.intervalMilliseconds = std::max(50u, static_cast<uint32_t>(std::strtoul(argv[i] + 11, nullptr, 10)));
+        } else if (argument == "--once") {
+            options.once = true;
+        } else {
+            std::fprintf(stderr, "Usage: %s [--pid=<n>] [--interval=<ms>] [--once]\n", argv[0]);
+            return argument == "--help" || argument == "-h" ? 0 : 2;
+        }
+    }
+
+    while (true) {
+        const std::vector<int> processIds = options.processId > 0 ? std::vector<int>{options.processId} : findProcesses();
+        if (!options.once) std::printf("\033[H\033[2J");
+        if (processIds.empty()) {
+            std::printf("No running VKING instances.\n");
+            std::fflush(stdout);
+        } else {
+            printTable(processIds);
+        }
+        if (options.once) return processIds.empty() ? 1 : 0;
+        std::this_thread::sleep_for(std::chrono::milliseconds(options.intervalMilliseconds));
+    }
+}
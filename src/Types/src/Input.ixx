@@ -0,0 +1,124 @@
+/*
+ *         VKING: A high-performance, module-first game engine.
+ *         Copyright (C) 2026 Matthew Krueger
+ *
+ *         This program is free software: you can redistribute it and/or modify
+ *         it under the terms of the GNU General Public License as published by
+ *         the Free Software Foundation, either version 3 of the License, or
+ *         (at your option) any later version.
+ *
+ *         This program is distributed in the hope that it will be useful,
+ *         but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *         MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *         GNU General Public License for more details.
+ *
+ *         You should have received a copy of the GNU General Public License
+ *         along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//
+// Created by Matthew Krueger on 10/18/26.
+//
+module;
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+export module VKING.Types.Input;
+
+import VKING.SpscQueue;
+
+export namespace VKING::Types {
+
+    /**
+     * @brief One input event as the platform delivered it, stamped on arrival.
+     *
+     * Codes are the platform's own: GLFW key and button codes for the GLFW platform, Linux evdev codes for the
+     * native Wayland and X11 platforms.
+     */
+    struct InputEvent {
+        enum class Type : uint8_t {
+            KEY,
+            CHARACTER,
+            MOUSE_BUTTON,
+            CURSOR_POSITION,
+            SCROLL,
+            FOCUS,
+            /// Unaccelerated relative motion straight from the device, for camera and aiming controls
+            RAW_MOTION
+        };
+
+        enum class Action : uint8_t {
+            RELEASE,
+            PRESS,
+            REPEAT
+        };
+
+        Type type = Type::KEY;
+        /// KEY and MOUSE_BUTTON: pressed, released or repeated. FOCUS: PRESS when gained, RELEASE when lost
+        Action action = Action::PRESS;
+        /// Key code, mouse button or Unicode code point
+        int32_t code = 0;
+        int32_t scancode = 0;
+        int32_t modifiers = 0;
+        /// Cursor position in screen coordinates, scroll offsets, or RAW_MOTION's device units moved
+        double x = 0.0;
+        double y = 0.0;
+        /// When the event arrived, see InputQueue::now()
+        uint64_t timestampNanoseconds = 0;
+    };
+
+    /**
+     * @brief Input events in arrival order, between the thread pumping platform events and the one simulating.
+     *
+     * The pump stamps and pushes events the moment the platform hands them over; the simulation drains them once per
+     * update and can place each one within the frame by its timestamp.
+     */
+    class InputQueue {
+    public:
+        static constexpr size_t CAPACITY = 1024;
+
+        /**
+         * @return The clock event timestamps use, steady_clock in nanoseconds
+         */
+        [[nodiscard]] static uint64_t now() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        /**
+         * @brief Producer side. Stamps the event with now() unless it already has a timestamp.
+         *        When the queue is full the event is dropped and counted.
+         */
+        void push(InputEvent event) {
+            if (event.timestampNanoseconds == 0) event.timestampNanoseconds = now();
+            if (!m_Events.tryPush(event)) m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Consumer side. Calls handler for every event that arrived up to untilNanoseconds, oldest first.
+         *
+         * @return Number of events handled
+         */
+        template<typename Handler>
+        size_t drain(const uint64_t untilNanoseconds, Handler&& handler) {
+            size_t handled = 0;
+            while (const InputEvent* event = m_Events.front()) {
+                if (event->timestampNanoseconds > untilNanoseconds) break;
+                handler(*event);
+                m_Events.pop();
+                handled++;
+            }
+            return handled;
+        }
+
+        /**
+         * @return Events lost to a full queue since the window was created
+         */
+        [[nodiscard]] uint64_t getDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+    private:
+        SpscQueue<InputEvent, CAPACITY> m_Events;
+        std::atomic<uint64_t> m_Dropped{0};
+    };
+
+}
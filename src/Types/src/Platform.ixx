@@ -21,15 +21,73 @@
 //
 
 // horray for ifdef hell
+module;
+#include <span>
 
 export module VKING.Types.Platform;
 import VKING.Types.Window;
 
 export namespace VKING::Types::Platform {
 
-    class RHI;
     class PlatformManager;
 
+    /**
+     * @class Swapchain
+     * @brief The images one window presents.
+     *
+     * Created by PlatformManager::createSwapchain() on the RHI that presents it, so every window shares that RHI's
+     * device and queue.
+     */
+    class Swapchain {
+    public:
+        struct ClearColor {
+            float red = 0.0f;
+            float green = 0.0f;
+            float blue = 0.0f;
+            float alpha = 1.0f;
+        };
+
+        virtual ~Swapchain() = default;
+
+        /**
+         * @brief Colour the window is cleared to every presented frame, until a renderer draws into it
+         */
+        void setClearColor(const ClearColor& color) { m_ClearColor = color; }
+        [[nodiscard]] const ClearColor& getClearColor() const { return m_ClearColor; }
+
+    private:
+        ClearColor m_ClearColor;
+    };
+
+    /**
+     * @class RHI
+     * @brief Rendering hardware interface: the GPU objects a backend owns (instance, device, queues).
+     *
+     * Created by PlatformManager::createRHI(). Creating one needs no window, so the application creates it while
+     * the window is being created. Surfaces and swapchains, which need both, come afterwards.
+     */
+    class RHI {
+    public:
+        virtual ~RHI() = default;
+
+        /**
+         * @return Name of the device in use, for logs and reports
+         */
+        [[nodiscard]] virtual std::string getDeviceName() const = 0;
+
+        /**
+         * @brief Presents one frame to each swapchain as a single batch: one submission and one present call for all
+         *        of them, rather than a round of synchronization per window.
+         *
+         * A swapchain whose next image is not free yet (the window is minimized, or still showing earlier frames) is
+         * skipped instead of waited for, so one slow window never holds up the others.
+         *
+         * @param swapchains Swapchains created on this RHI
+         * @return How many of them presented
+         */
+        virtual uint32_t present(std::span<Swapchain* const> swapchains) = 0;
+    };
+
     /**
      * @brief Enumerates the different graphics backends supported by the platform.
      *
@@ -42,6 +100,7 @@ export namespace VKING::Types::Platform {
      * - GNM: Specifies the GNM graphics backend (specific to Sony PlayStation systems).
      * - OPENGL: Specifies the OpenGL graphics backend.
      * - DIRECTX_12: Specifies the DirectX 12 graphics backend (primarily for Windows platforms).
+     * - HEADLESS: No GPU at all. Used for servers, CI and performance harness runs.
      * - BACKEND_UNSUPPORTED: Indicates that no supported backend is available for the platform or configuration.
      * - BACKEND_NO_PREFERENCE: Used when there is no explicit preference for the graphics backend.
      */
@@ -51,6 +110,7 @@ export namespace VKING::Types::Platform {
         GNM,
         OPENGL,
         DIRECTX_12,
+        HEADLESS,
         BACKEND_UNSUPPORTED,
         BACKEND_NO_PREFERENCE
     };
@@ -69,6 +129,7 @@ export namespace VKING::Types::Platform {
      * - X11: Represents the X Window System display server.
      * - COCOA: Represents macOS's Cocoa framework.
      * - WIN32: Represents the Windows Win32 API.
+     * - HEADLESS: No windowing system. Windows exist only as objects and never receive events.
      * - PLATFORM_UNSUPPORTED: Represents an unsupported platform.
      * - PLATFORM_NO_PREFERENCE: Represents a state where no specific platform preference is indicated.
      */
@@ -78,6 +139,7 @@ export namespace VKING::Types::Platform {
         X11,
         COCOA,
         WIN32,
+        HEADLESS,
         PLATFORM_UNSUPPORTED,
         PLATFORM_NO_PREFERENCE
     };
@@ -96,6 +158,7 @@ export namespace VKING::Types::Platform {
             case BackendType::GNM: return "PlayStation";
             case BackendType::OPENGL: return "OpenGL";
             case BackendType::DIRECTX_12: return "DirectX 12";
+            case BackendType::HEADLESS: return "Headless";
             case BackendType::BACKEND_UNSUPPORTED: return "Unsupported";
             case BackendType::BACKEND_NO_PREFERENCE: return "No Preference stated";
             default: return "Unsupported";
@@ -117,6 +180,7 @@ export namespace VKING::Types::Platform {
             case PlatformType::X11: return "X11";
             case PlatformType::COCOA: return "Cocoa";
             case PlatformType::WIN32: return "Win32";
+            case PlatformType::HEADLESS: return "Headless";
             case PlatformType::PLATFORM_UNSUPPORTED: return "Unsupported";
             case PlatformType::PLATFORM_NO_PREFERENCE: return "No Preference stated";
             default: return "Unsupported";
@@ -183,6 +247,18 @@ export namespace VKING::Types::Platform {
                  */
                 void (*pfn_PlatformManagerDestroy)(PlatformManager*) = nullptr;
 
+                /**
+                 * @brief Cheap check whether this configuration can work on this machine (a display to connect to,
+                 *        a driver installed, ...), run before anything is created. nullptr means always available.
+                 *
+                 * Passing results are cached across launches by EngineConfig, keyed by the drivers and environment,
+                 * failures are probed again on every launch. A probe may take a few milliseconds but should not
+                 * create anything that outlives it.
+                 *
+                 * @param reason Receives why not, when returning false
+                 */
+                bool (*pfn_PlatformProbe)(std::string* reason) = nullptr;
+
             };
 
             /**
@@ -265,10 +341,19 @@ export namespace VKING::Types::Platform {
          * This method must be implemented by derived classes of PlatformManager
          * to provide the appropriate RHI implementation.
          *
-         * @return A unique_ptr to the newly created RHI instance.
+         * @return A unique_ptr to the newly created RHI instance, nullptr if the backend has none or it could not be created.
          */
         virtual std::unique_ptr<RHI> createRHI() = 0;
 
+        /**
+         * @brief Creates the swapchain a window presents through, on an RHI this platform manager created.
+         *
+         * Each window gets its own; they all share the RHI's device. Destroy it before the window and the RHI.
+         *
+         * @return The swapchain, or nullptr if the backend cannot present to the window (headless, no surface support)
+         */
+        virtual std::unique_ptr<Swapchain> createSwapchain([[maybe_unused]] RHI& rhi, [[maybe_unused]] Window& window) { return nullptr; }
+
         /**
          * @brief Retrieves the type of platform currently being used by the platform manager.
          *
@@ -356,4 +441,26 @@ export namespace VKING::Types::Platform {
 
     };
 
+    /// Version of PlatformPluginInfo and of the types it refers to, a plugin built against another version is not loaded
+    constexpr uint32_t PLATFORM_PLUGIN_ABI_VERSION = 2;
+
+    /// Name of the extern "C" PlatformPluginRegisterFn every platform plugin exports
+    constexpr const char* PLATFORM_PLUGIN_REGISTER_SYMBOL = "VKING_Platform_RegisterPlugin";
+
+    /**
+     * @struct PlatformPluginInfo
+     * @brief What a platform plugin (a glue library built as a shared object) offers.
+     *
+     * Each entry is scored like the built in configuration table, lower is better. The entries and the strings
+     * must stay valid for as long as the plugin is loaded, in practice they are static.
+     */
+    struct PlatformPluginInfo {
+        uint32_t abiVersion = PLATFORM_PLUGIN_ABI_VERSION;
+        const char* name = nullptr;
+        const ScoredType<PlatformManager::PlatformSpecification>* entries = nullptr;
+        uint32_t entryCount = 0;
+    };
+
+    using PlatformPluginRegisterFn = const PlatformPluginInfo* (*)();
+
 }
\ No newline at end of file
@@ -20,8 +20,13 @@
 // Created by Matthew Krueger on 1/6/26.
 //
 
+module;
+#include <optional>
+
 export module VKING.Types.Window;
 
+export import VKING.Types.Input;
+
 export namespace VKING::Types {
     class Window {
     public:
@@ -32,6 +37,29 @@ export namespace VKING::Types {
         };
 
 
+        /**
+         * @brief Size in pixels of the images the window presents
+         */
+        struct FramebufferSize {
+            uint32_t width = 0;
+            uint32_t height = 0;
+
+            bool operator==(const FramebufferSize&) const = default;
+        };
+
+        /**
+         * @brief When the window system last put one of this window's frames on screen.
+         *
+         * Timestamps are on the Types::InputQueue::now() clock.
+         */
+        struct PresentationTiming {
+            uint64_t lastPresentNanoseconds = 0;
+            /// Time between two refreshes of the output showing the window, 0 if it has no fixed rate
+            uint64_t refreshNanoseconds = 0;
+            /// Increments by one every refresh of that output, so gaps count the refreshes a frame missed
+            uint64_t refreshSequence = 0;
+        };
+
         virtual ~Window() = default;
 
         /**
@@ -48,6 +76,25 @@ export namespace VKING::Types {
          */
         virtual void pollEvents() = 0;
 
+        /**
+         * @brief Processes events as they arrive for up to timeoutSeconds, returning early once some were processed.
+         *
+         * Lets the main loop spend its idle time pumping input instead of sleeping through it.
+         */
+        virtual void waitEvents(double timeoutSeconds) = 0;
+
+        /**
+         * @brief Input events of this window, pushed by whichever thread pumps its events
+         */
+        InputQueue& getInputQueue() { return m_InputQueue; }
+
+        /**
+         * @brief Marks the window to be closed by its owner at the next opportunity, for close callbacks that cannot
+         *        close it themselves
+         */
+        void requestClose() { m_CloseRequested = true; }
+        [[nodiscard]] bool isCloseRequested() const { return m_CloseRequested; }
+
         /**
          * @brief Sets the window requests closure callback function
          *
@@ -71,12 +118,35 @@ export namespace VKING::Types {
          */
         virtual void* getNativeWindowHandle() = 0;
 
+        /**
+         * @brief Size the window's swapchain is built at. Changes with the window's size and its content scale.
+         */
+        [[nodiscard]] virtual FramebufferSize getFramebufferSize() const = 0;
+
+        /**
+         * @brief Pixels per window unit, fractional on outputs scaled by e.g. 1.25
+         */
+        [[nodiscard]] virtual double getContentScale() const { return 1.0; }
+
+        /**
+         * @return Timing of the last frame the window system reported as shown, std::nullopt if it reports none
+         */
+        [[nodiscard]] virtual std::optional<PresentationTiming> getPresentationTiming() const { return std::nullopt; }
+
+        /**
+         * @brief Called right before a frame of this window is presented, so the platform can attach per frame
+         *        requests (such as presentation feedback) to the frame being presented.
+         */
+        virtual void onBeforePresent() {}
+
     protected:
         Window() = default;
         void setProtectedWindowCloseRequestCallbackEventFN(const WindowCloseRequestCallbackEventFN callback) { m_WindowCloseRequestCallbackEventFN = callback; }
 
     private:
         WindowCloseRequestCallbackEventFN m_WindowCloseRequestCallbackEventFN = nullptr;
+        InputQueue m_InputQueue;
+        bool m_CloseRequested = false;
 
     };
 }
\ No newline at end of file